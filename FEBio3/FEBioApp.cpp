@@ -37,6 +37,8 @@ SOFTWARE.*/
 #include <FEBioLib/version.h>
 #include "febio_cb.h"
 #include "Interrupt.h"
+#include "FEBioJobServer.h"
+#include <FECore/FEMPIPartition.h>
 
 FEBioApp* FEBioApp::m_This = nullptr;
 
@@ -103,13 +105,26 @@ int FEBioApp::Run()
 	// activate interruption handler
 	Interruption I;
 
-	// run FEBio either interactively or directly
+	// run FEBio either interactively, as a job server, or directly
 	if (m_ops.binteractive)
 		return prompt();
+	else if (m_ops.szspool[0])
+		return RunServer(m_ops.szspool, m_ops.nworkers);
 	else
 		return RunModel();
 }
 
+//-----------------------------------------------------------------------------
+// Run FEBio as a job server on a spool directory
+int FEBioApp::RunServer(const char* szdir, int nworkers)
+{
+	// copy the directory, since the options are overwritten by the jobs
+	std::string dir = szdir;
+
+	FEBioJobServer server(this);
+	return server.Run(dir.c_str(), nworkers);
+}
+
 //-----------------------------------------------------------------------------
 void FEBioApp::Finish()
 {
@@ -243,6 +258,7 @@ bool FEBioApp::ParseCmdLine(int nargs, char* argv[])
 	ops.sztask[0] = 0;
 	ops.szctrl[0] = 0;
 	ops.szimp[0] = 0;
+	ops.szspool[0] = 0;
 
 	// set initial configuration file name
 	if (ops.szcnf[0] == 0)
@@ -394,6 +410,15 @@ bool FEBioApp::ParseCmdLine(int nargs, char* argv[])
 		{
 			strcpy(ops.szimp, argv[++i]);
 		}
+		else if (strcmp(sz, "-serve") == 0)
+		{
+			strcpy(ops.szspool, argv[++i]);
+			ops.binteractive = false;
+		}
+		else if (strcmp(sz, "-workers") == 0)
+		{
+			ops.nworkers = atoi(argv[++i]);
+		}
 		else if (sz[0] == '-')
 		{
 			fprintf(stderr, "FATAL ERROR: Invalid command line option.\n");
@@ -471,6 +496,28 @@ bool FEBioApp::ParseCmdLine(int nargs, char* argv[])
 		if (!bdmp) sprintf(ops.szdmp, "%s.dmp", szbase);
 	}
 
+	// In MPI runs, all ranks solve the same model. Only the first rank writes to
+	// the screen and the other ranks write their output to separate files.
+	int rank = FEMPIPartition::Rank();
+	if (rank > 0)
+	{
+		ops.bsilent = true;
+		ops.bsplash = false;
+
+		char* szfiles[] = { ops.szlog, ops.szplt, ops.szdmp };
+		for (int i = 0; i < 3; ++i)
+		{
+			char* szf = szfiles[i];
+			if (szf[0] == 0) continue;
+
+			// insert the rank before the extension
+			char szext[256] = { 0 };
+			char* ch = strrchr(szf, '.');
+			if (ch) { strcpy(szext, ch); *ch = 0; }
+			sprintf(szf + strlen(szf), "_rank%d%s", rank, szext);
+		}
+	}
+
 	return brun;
 }
 
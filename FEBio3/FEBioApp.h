@@ -54,6 +54,9 @@ public:
 	// run an febio model
 	int RunModel();
 
+	// run as a job server on a spool directory
+	int RunServer(const char* szdir, int nworkers);
+
 public:
 	// get the current model
 	FEBioModel* GetCurrentModel();
@@ -34,6 +34,7 @@ SOFTWARE.*/
 #include <FECore/FESolver.h>
 #include <FECore/CompactMatrix.h>
 #include <FECore/FEAnalysis.h>
+#include <FECore/DataRecordReader.h>
 #include "FEBioCommand.h"
 #include "console.h"
 #include "cmdoptions.h"
@@ -78,12 +79,14 @@ REGISTER_COMMAND(FEBioCmd_Print        , "print"  , "print values of variables")
 REGISTER_COMMAND(FEBioCmd_Quit         , "quit"   , "terminate the run and quit");
 REGISTER_COMMAND(FEBioCmd_Restart      , "restart", "toggle restart mode");
 REGISTER_COMMAND(FEBioCmd_Run          , "run"    , "run an FEBio input file");
+REGISTER_COMMAND(FEBioCmd_serve        , "serve"  , "run jobs from a spool directory");
 REGISTER_COMMAND(FEBioCmd_svg          , "svg"    , "write matrix sparsity pattern to svg file");
 REGISTER_COMMAND(FEBioCmd_Time         , "time"   , "print progress time statistics");
 REGISTER_COMMAND(FEBioCmd_UnLoadPlugin , "unload" , "unload a plugin");
 REGISTER_COMMAND(FEBioCmd_Version      , "version", "print version information");
 REGISTER_COMMAND(FEBioCmd_where        , "where"  , "current callback event");
 REGISTER_COMMAND(FEBioCmd_list         , "list"   , "list factory classes");
+REGISTER_COMMAND(FEBioCmd_tocsv        , "tocsv"  , "convert a binary data file to CSV");
 
 int need_active_model()
 {
@@ -765,3 +768,53 @@ int FEBioCmd_list::run(int nargs, char** argv)
 
 	return 0;
 }
+
+//-----------------------------------------------------------------------------
+// usage: serve spooldir [workers]
+int FEBioCmd_serve::run(int nargs, char** argv)
+{
+	FEBioModel* fem = GetFEM();
+	if (fem) return model_already_running();
+
+	if ((nargs < 2) || (nargs > 3)) return invalid_nr_args();
+
+	int nworkers = (nargs == 3 ? atoi(argv[2]) : 1);
+
+	FEBioApp* febio = FEBioApp::GetInstance();
+	febio->RunServer(argv[1], nworkers);
+
+	// reset the title after the server stops
+	Console* pShell = Console::GetHandle();
+	pShell->SetTitle("FEBio3");
+
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+// usage: tocsv datafile [csvfile]
+// If the CSV file name is omitted, ".csv" is appended to the data file name.
+int FEBioCmd_tocsv::run(int nargs, char** argv)
+{
+	if ((nargs < 2) || (nargs > 3)) return invalid_nr_args();
+
+	std::string csvFile;
+	if (nargs == 3) csvFile = argv[2];
+	else csvFile = std::string(argv[1]) + ".csv";
+
+	DataRecordReader reader;
+	if (reader.Open(argv[1]) == false)
+	{
+		printf("Failed to open binary data file %s\n", argv[1]);
+		return 0;
+	}
+
+	if (reader.ExportCSV(csvFile.c_str()) == false)
+	{
+		printf("Failed to write CSV file %s\n", csvFile.c_str());
+		return 0;
+	}
+
+	printf("Data written to %s\n", csvFile.c_str());
+
+	return 0;
+}
@@ -255,6 +255,22 @@ public:
 	DECLARE_COMMAND(FEBioCmd_list);
 };
 
+//-----------------------------------------------------------------------------
+class FEBioCmd_serve : public FEBioCommand
+{
+public:
+	int run(int nargs, char** argv);
+	DECLARE_COMMAND(FEBioCmd_serve);
+};
+
+//-----------------------------------------------------------------------------
+class FEBioCmd_tocsv : public FEBioCommand
+{
+public:
+	int run(int nargs, char** argv);
+	DECLARE_COMMAND(FEBioCmd_tocsv);
+};
+
 //-----------------------------------------------------------------------------
 class FEBioCmd_hist: public FEBioCommand
 {
@@ -0,0 +1,364 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#include "stdafx.h"
+#include "FEBioJobServer.h"
+#include "FEBioApp.h"
+#include "console.h"
+#include "Interrupt.h"
+#include <algorithm>
+#include <chrono>
+#include <ctype.h>
+#include <signal.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#define HAS_FORK
+#endif
+
+//-----------------------------------------------------------------------------
+// list the job files in a directory (returns the job names, without extension)
+static void list_jobs(const std::string& dir, std::vector<std::string>& jobs)
+{
+	jobs.clear();
+	const char* szext = ".job";
+	const size_t l = strlen(szext);
+#ifdef WIN32
+	std::string pattern = dir + "\\*.job";
+	WIN32_FIND_DATAA data;
+	HANDLE hFind = FindFirstFileA(pattern.c_str(), &data);
+	if (hFind == INVALID_HANDLE_VALUE) return;
+	do
+	{
+		std::string s = data.cFileName;
+		if ((s.size() > l) && (s.compare(s.size() - l, l, szext) == 0)) jobs.push_back(s.substr(0, s.size() - l));
+	}
+	while (FindNextFileA(hFind, &data));
+	FindClose(hFind);
+#else
+	DIR* pd = opendir(dir.c_str());
+	if (pd == 0) return;
+	struct dirent* pe;
+	while ((pe = readdir(pd)) != 0)
+	{
+		std::string s = pe->d_name;
+		if ((s.size() > l) && (s.compare(s.size() - l, l, szext) == 0)) jobs.push_back(s.substr(0, s.size() - l));
+	}
+	closedir(pd);
+#endif
+
+	// process the jobs in alphabetical order
+	std::sort(jobs.begin(), jobs.end());
+}
+
+//-----------------------------------------------------------------------------
+static void sleep_ms(int ms)
+{
+#ifdef WIN32
+	Sleep(ms);
+#else
+	usleep(ms * 1000);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// split a command line into arguments (arguments with spaces can be quoted)
+static int split_args(char* szcmd, char** argv, int maxargs)
+{
+	int nargs = 0;
+	char* ch = szcmd;
+	while (*ch && (nargs < maxargs))
+	{
+		while (isspace(*ch)) ch++;
+		if (*ch == 0) break;
+
+		if (*ch == '"')
+		{
+			argv[nargs++] = ++ch;
+			while (*ch && (*ch != '"')) ch++;
+		}
+		else
+		{
+			argv[nargs++] = ch;
+			while (*ch && !isspace(*ch)) ch++;
+		}
+		if (*ch) *ch++ = 0;
+	}
+	return nargs;
+}
+
+//-----------------------------------------------------------------------------
+FEBioJobServer::FEBioJobServer(FEBioApp* app) : m_app(app)
+{
+	m_jobs = 0;
+	m_failed = 0;
+	m_time = 0.0;
+}
+
+//-----------------------------------------------------------------------------
+double FEBioJobServer::wallTime()
+{
+	using namespace std::chrono;
+	return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+//-----------------------------------------------------------------------------
+std::string FEBioJobServer::filePath(const std::string& jobName, const char* szext)
+{
+#ifdef WIN32
+	return m_dir + "\\" + jobName + szext;
+#else
+	return m_dir + "/" + jobName + szext;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+bool FEBioJobServer::stopRequested()
+{
+	// a Ctrl+C also stops the server
+	if (Interruption::m_bsig)
+	{
+		Interruption::m_bsig = false;
+		return true;
+	}
+
+	std::string stopFile = filePath("stop", "");
+	FILE* fp = fopen(stopFile.c_str(), "r");
+	if (fp == 0) return false;
+	fclose(fp);
+	remove(stopFile.c_str());
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// The job is claimed by renaming the job file. Since the rename is atomic, 
+// several servers can share the same spool directory.
+bool FEBioJobServer::nextJob(std::string& jobName)
+{
+	std::vector<std::string> jobs;
+	list_jobs(m_dir, jobs);
+	for (size_t i = 0; i < jobs.size(); ++i)
+	{
+		std::string jobFile = filePath(jobs[i], ".job");
+		std::string runFile = filePath(jobs[i], ".run");
+		if (rename(jobFile.c_str(), runFile.c_str()) == 0)
+		{
+			jobName = jobs[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+int FEBioJobServer::runJob(const std::string& jobName)
+{
+	// read the command line from the job file
+	std::string runFile = filePath(jobName, ".run");
+	FILE* fp = fopen(runFile.c_str(), "rt");
+	if (fp == 0) return 1;
+
+	char szcmd[2048] = { 0 };
+	char szline[2048];
+	while (fgets(szline, sizeof(szline), fp))
+	{
+		char* ch = szline;
+		while (isspace(*ch)) ch++;
+		if ((*ch == 0) || (*ch == '#')) continue;
+		strcpy(szcmd, ch);
+		break;
+	}
+	fclose(fp);
+
+	// parse the options
+	const int MAX_ARGS = 64;
+	char* argv[MAX_ARGS];
+	char szexe[] = "febio3";
+	argv[0] = szexe;
+	int nargs = 1 + split_args(szcmd, argv + 1, MAX_ARGS - 1);
+	if (m_app->ParseCmdLine(nargs, argv) == false) return 1;
+
+	// jobs are never interactive and don't write to the console
+	CMDOPTIONS& ops = m_app->CommandOptions();
+	ops.binteractive = false;
+	ops.bsilent = true;
+	ops.szspool[0] = 0;
+	if (ops.szfile[0] == 0) return 1;
+
+	// run the model
+	int nret = 1;
+	try {
+		nret = m_app->RunModel();
+	}
+	catch (...)
+	{
+		nret = 1;
+	}
+
+	Console::GetHandle()->Activate();
+
+	return nret;
+}
+
+//-----------------------------------------------------------------------------
+void FEBioJobServer::finishJob(const JOB& job, int nret, int nsig)
+{
+	double dt = wallTime() - job.tstart;
+
+	const char* szstatus = "NORMAL TERMINATION";
+	if (nsig != 0) szstatus = "ABNORMAL TERMINATION";
+	else if (nret != 0) szstatus = "ERROR TERMINATION";
+
+	// write the status file
+	std::string statusFile = filePath(job.name, ".status");
+	FILE* fp = fopen(statusFile.c_str(), "wt");
+	if (fp)
+	{
+		fprintf(fp, "job    = %s\n", job.name.c_str());
+		fprintf(fp, "status = %s\n", szstatus);
+		fprintf(fp, "return = %d\n", nret);
+		if (nsig != 0) fprintf(fp, "signal = %d\n", nsig);
+		fprintf(fp, "time   = %.3lf\n", dt);
+		fclose(fp);
+	}
+
+	// mark the job as done
+	std::string runFile = filePath(job.name, ".run");
+	std::string doneFile = filePath(job.name, ".done");
+	remove(doneFile.c_str());
+	rename(runFile.c_str(), doneFile.c_str());
+
+	m_jobs++;
+	if ((nret != 0) || (nsig != 0)) m_failed++;
+	m_time += dt;
+
+	printf("job %s: %s (%.3lf sec)\n", job.name.c_str(), szstatus, dt);
+	fflush(stdout);
+}
+
+//-----------------------------------------------------------------------------
+int FEBioJobServer::Run(const char* szdir, int maxWorkers, int pollms)
+{
+	m_dir = szdir;
+	if (m_dir.empty()) m_dir = ".";
+	if (maxWorkers < 1) maxWorkers = 1;
+	if (pollms < 1) pollms = 1;
+	m_jobs = m_failed = 0;
+	m_time = 0.0;
+
+#ifndef HAS_FORK
+	// without worker processes, the jobs run in the server process
+	maxWorkers = 1;
+#endif
+
+	printf("FEBio job server started on spool directory %s (%d worker(s))\n", m_dir.c_str(), maxWorkers);
+	fflush(stdout);
+
+	bool bstop = false;
+	while ((bstop == false) || (m_active.empty() == false))
+	{
+		if ((bstop == false) && stopRequested()) bstop = true;
+
+#ifdef HAS_FORK
+		// reap workers that are done
+		int st = 0;
+		pid_t pid;
+		while ((m_active.empty() == false) && ((pid = waitpid(-1, &st, WNOHANG)) > 0))
+		{
+			for (size_t i = 0; i < m_active.size(); ++i)
+			{
+				if (m_active[i].pid == pid)
+				{
+					int nret = (WIFEXITED(st) ? WEXITSTATUS(st) : 1);
+					int nsig = (WIFSIGNALED(st) ? WTERMSIG(st) : 0);
+					finishJob(m_active[i], nret, nsig);
+					m_active.erase(m_active.begin() + i);
+					break;
+				}
+			}
+		}
+#endif
+
+		// start new jobs
+		bool bnew = false;
+		std::string jobName;
+		while ((bstop == false) && ((int)m_active.size() < maxWorkers) && nextJob(jobName))
+		{
+			JOB job;
+			job.name = jobName;
+			job.pid = 0;
+			job.tstart = wallTime();
+			bnew = true;
+
+#ifdef HAS_FORK
+			fflush(stdout);
+			fflush(stderr);
+			pid_t pid = fork();
+			if (pid == 0)
+			{
+				// worker process: the server handles the interruptions
+				signal(SIGINT, SIG_IGN);
+				int nret = runJob(jobName);
+				fflush(stdout);
+				_exit(nret);
+			}
+			else if (pid > 0)
+			{
+				job.pid = (int)pid;
+				m_active.push_back(job);
+			}
+			else
+			{
+				// fork failed, so run the job here
+				int nret = runJob(jobName);
+				finishJob(job, nret, 0);
+			}
+#else
+			int nret = runJob(jobName);
+			finishJob(job, nret, 0);
+#endif
+		}
+
+		// wait a little before we check again
+		if (bnew == false) sleep_ms(pollms);
+	}
+
+	printf("FEBio job server stopped.\n");
+	printf("\tjobs run     : %d\n", m_jobs);
+	printf("\tjobs failed  : %d\n", m_failed);
+	if (m_jobs > 0) printf("\taverage time : %.3lf sec\n", m_time / m_jobs);
+
+	return 0;
+}
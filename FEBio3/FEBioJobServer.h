@@ -0,0 +1,96 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#pragma once
+#include <string>
+#include <vector>
+
+class FEBioApp;
+
+//-----------------------------------------------------------------------------
+//! The job server runs FEBio models that are submitted to a spool directory.
+//! Since the kernel, the module factories, the plugins and the configuration
+//! are initialized only once, the start-up cost is paid only once for all jobs.
+//!
+//! A job is submitted by placing a file with the extension .job in the spool
+//! directory. The first line of this file (that is not empty and does not start
+//! with #) contains the command line options for the job, e.g. "-i model.feb".
+//! Relative file names are relative to the server's working directory. 
+//! When the server picks up a job, it renames the job file to .run. When the job
+//! is done, the file is renamed to .done and a .status file is written with the
+//! status and the wall time of the job.
+//! The server stops when a file named "stop" is placed in the spool directory.
+//!
+//! On systems that support it, the jobs are run in worker processes that are
+//! forked from the server, so that several jobs can run at the same time and a
+//! failing job cannot take down the server. Otherwise, the jobs are run one
+//! after the other in the server process.
+class FEBioJobServer
+{
+	struct JOB
+	{
+		std::string	name;		// job name (file name without extension)
+		int			pid;		// process ID of worker (or 0)
+		double		tstart;		// start time
+	};
+
+public:
+	FEBioJobServer(FEBioApp* app);
+
+	//! Run the server on the spool directory. 
+	int Run(const char* szdir, int maxWorkers = 1, int pollms = 500);
+
+private:
+	// find the next job and claim it
+	bool nextJob(std::string& jobName);
+
+	// run a job in this process and returns the exit code
+	int runJob(const std::string& jobName);
+
+	// called when a job has finished
+	void finishJob(const JOB& job, int nret, int nsig);
+
+	// check for the stop file
+	bool stopRequested();
+
+	std::string filePath(const std::string& jobName, const char* szext);
+
+	static double wallTime();
+
+private:
+	FEBioApp*	m_app;
+	std::string	m_dir;		// spool directory
+
+	std::vector<JOB>	m_active;	// jobs that are running
+
+	int		m_jobs;		// number of jobs that were run
+	int		m_failed;	// number of jobs that failed
+	double	m_time;		// total wall time of all jobs
+};
@@ -41,6 +41,8 @@ struct CMDOPTIONS
 
 	int		dumpLevel;		//!< requested restart level
 
+	int		nworkers;		//!< number of job server workers
+
 	char	szfile[MAXFILE];	//!< model input file name
 	char	szlog[MAXFILE];	//!< log file name
 	char	szplt[MAXFILE];	//!< plot file name
@@ -49,6 +51,7 @@ struct CMDOPTIONS
 	char	sztask[MAXFILE];	//!< task name
 	char	szctrl[MAXFILE];	//!< control file for tasks
 	char	szimp[MAXFILE];		//!< import file
+	char	szspool[MAXFILE];	//!< spool directory of job server
 
 	CMDOPTIONS()
 	{
@@ -62,6 +65,7 @@ struct CMDOPTIONS
 		bsilent = false;
 		binteractive = false;
 		dumpLevel = 0;
+		nworkers = 1;
 
 		szfile[0] = 0;
 		szlog[0] = 0;
@@ -71,5 +75,6 @@ struct CMDOPTIONS
 		sztask[0] = 0;
 		szctrl[0] = 0;
 		szimp[0] = 0;
+		szspool[0] = 0;
 	}
 };
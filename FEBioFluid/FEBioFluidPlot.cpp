@@ -55,7 +55,7 @@ bool FEPlotDisplacement::Save(FEMesh& m, FEDataStream& a)
 {
     // loop over all nodes
 	writeNodalValues<vec3d>(m, a, [](const FENode& node) {
-		return node.m_rt - node.m_r0;
+		return node.m_rt() - node.m_r0();
 	});
     return true;
 }
@@ -538,7 +538,7 @@ void FEBiphasicFSISolver::UpdateKinematics(vector<double>& ui)
     {
         FENode& node = mesh.Node(i);
         if (node.m_rid == -1)
-            node.m_rt = node.m_r0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
+            node.m_rt() = node.m_r0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
     }
     
     // update time derivatives of velocity and dilatation
@@ -557,9 +557,9 @@ void FEBiphasicFSISolver::UpdateKinematics(vector<double>& ui)
             FENode& n = mesh.Node(i);
             
             // solid acceleration
-            n.m_at = (n.m_rt - n.m_rp)*b - n.m_vp*a + n.m_ap*c;
+            n.m_at() = (n.m_rt() - n.m_rp())*b - n.m_vp()*a + n.m_ap()*c;
             // solid velocity
-            vec3d vt = n.m_vp + (n.m_ap*(1.0 - m_gamma) + n.m_at*m_gamma)*dt;
+            vec3d vt = n.m_vp() + (n.m_ap()*(1.0 - m_gamma) + n.m_at()*m_gamma)*dt;
             n.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vt);
             
             // shell kinematics
@@ -585,7 +585,7 @@ void FEBiphasicFSISolver::UpdateKinematics(vector<double>& ui)
             vec3d vft = vt + wt;
             n.set_vec3d(m_dofVF[0], m_dofVF[1], m_dofVF[2], vft);
             // material time derivative of fluid velocity (in solid frame)
-            vec3d aft = n.m_at + awt;
+            vec3d aft = n.m_at() + awt;
             n.set_vec3d(m_dofAF[0], m_dofAF[1], m_dofAF[2], aft);
             
             // dilatation time derivative
@@ -786,21 +786,21 @@ void FEBiphasicFSISolver::PrepStep()
     // store previous mesh state
     // we need them for strain and acceleration calculations
     FEMesh& mesh = fem.GetMesh();
+    mesh.UpdateNodalValues();
     for (int i=0; i<mesh.Nodes(); ++i)
     {
         FENode& ni = mesh.Node(i);
-        ni.m_rp = ni.m_rt;
-        ni.m_vp = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
-        ni.m_ap = ni.m_at;
-        ni.UpdateValues();
+        ni.m_rp() = ni.m_rt();
+        ni.m_vp() = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
+        ni.m_ap() = ni.m_at();
         
         switch (m_pred) {
             case 0:
             {
                 // initial guess at start of new time step (default)
                 // solid
-                ni.m_at = ni.m_ap*(1-0.5/m_beta) - ni.m_vp/(m_beta*dt);
-                vec3d vs = ni.m_vp + (ni.m_at*m_gamma + ni.m_ap*(1-m_gamma))*dt;
+                ni.m_at() = ni.m_ap()*(1-0.5/m_beta) - ni.m_vp()/(m_beta*dt);
+                vec3d vs = ni.m_vp() + (ni.m_at()*m_gamma + ni.m_ap()*(1-m_gamma))*dt;
                 ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vs);
                 
                 // solid shell
@@ -822,11 +822,11 @@ void FEBiphasicFSISolver::PrepStep()
             case 1:
             {
                 // initial guess at start of new time step (Zero Ydot)
-                ni.m_at = vec3d(0,0,0);
+                ni.m_at() = vec3d(0,0,0);
                 ni.set_vec3d(m_dofAW[0], m_dofAW[1], m_dofAW[2],vec3d(0,0,0));
                 ni.set(m_dofAEF, 0);
                 
-                ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], ni.m_vp + ni.m_ap*dt*(1-m_gamma)*m_alphaf);
+                ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], ni.m_vp() + ni.m_ap()*dt*(1-m_gamma)*m_alphaf);
                 vec3d wp = ni.get_vec3d_prev(m_dofW[0], m_dofW[1], m_dofW[2]);
                 vec3d awp = ni.get_vec3d_prev(m_dofAW[0], m_dofAW[1], m_dofAW[2]);
                 ni.set_vec3d(m_dofW[0], m_dofW[1], m_dofW[2], wp + awp*dt*(1-m_gamma)*m_alphaf);
@@ -841,7 +841,7 @@ void FEBiphasicFSISolver::PrepStep()
                 ni.set_vec3d(m_dofAW[0], m_dofAW[1], m_dofAW[2], awp);
                 ni.set(m_dofAEF, ni.get_prev(m_dofAEF));
                 
-                ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], ni.m_vp + ni.m_ap*dt);
+                ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], ni.m_vp() + ni.m_ap()*dt);
                 vec3d wp = ni.get_vec3d_prev(m_dofW[0], m_dofW[1], m_dofW[2]);
                 ni.set_vec3d(m_dofW[0], m_dofW[1], m_dofW[2], wp + awp*dt);
                 ni.set(m_dofEF, ni.get_prev(m_dofEF) + ni.get_prev(m_dofAEF)*dt);
@@ -964,7 +964,7 @@ bool FEBiphasicFSISolver::Quasin()
         bconv = true;
         
         // solve the equations (returns line search; solution stored in m_ui)
-        double s = QNSolve();
+        double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
         
         // extract the velocity and dilatation increments
         GetDisplacementData(m_di, m_ui);
@@ -1292,7 +1292,7 @@ bool FEBiphasicFSISolver::Residual(vector<double>& R)
     zero(m_Fr);
     
     // setup the global vector
-    FEResidualVector RHS(fem, R, m_Fr);
+    FEResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
     
     // zero rigid body reaction forces
     m_rigidSolver.Residual();
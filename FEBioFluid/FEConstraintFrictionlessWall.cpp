@@ -65,7 +65,7 @@ bool FEConstraintFrictionlessWall::Init()
         int ne = el.Nodes();
         
         // get the nodal coordinates
-        for (int j=0; j<ne; ++j) y[j] = m_surf.Node(el.m_lnode[j]).m_rt;
+        for (int j=0; j<ne; ++j) y[j] = m_surf.Node(el.m_lnode[j]).m_rt();
         
         // calculate the normals
         for (int j=0; j<ne; ++j)
@@ -87,8 +87,7 @@ bool FEConstraintFrictionlessWall::Init()
         FEAugLagLinearConstraint* pLC = new FEAugLagLinearConstraint;
         for (int j=0; j<3; ++j) {
             FEAugLagLinearConstraint::DOF dof;
-            FENode node = m_surf.Node(i);
-            dof.node = node.GetID() - 1;    // zero-based
+            dof.node = m_surf.NodeIndex(i);    // zero-based
             switch (j) {
                 case 0:
                     dof.bc = dofs.GetDOF("wx");
@@ -138,7 +138,7 @@ void FEFluidDomain2D::PreSolveUpdate(const FETimeInfo& timeInfo)
         int neln = el.Nodes();
         for (int i=0; i<neln; ++i)
         {
-            x0[i] = m.Node(el.m_node[i]).m_r0;
+            x0[i] = m.Node(el.m_node[i]).m_r0();
         }
         
         int n = el.GaussPoints();
@@ -298,7 +298,7 @@ void FEFluidDomain2D::ElementBodyForce(FEBodyForce& BF, FEElement2D& el, vector<
     // nodal coordinates
     vec3d r0[FEElement::MAX_NODES];
     for (int i=0; i<neln; ++i)
-        r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+        r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
     
     // loop over integration points
     int nint = el.GaussPoints();
@@ -36,6 +36,7 @@ SOFTWARE.*/
 #include <FECore/sys.h>
 #include "FEBioFluid.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEScratchArena.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -111,7 +112,7 @@ void FEFluidDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
         int neln = el.Nodes();
         for (int i=0; i<neln; ++i)
         {
-            x0[i] = m.Node(el.m_node[i]).m_r0;
+            x0[i] = m.Node(el.m_node[i]).m_r0();
         }
         
         int n = el.GaussPoints();
@@ -140,7 +141,7 @@ void FEFluidDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     for (int i=0; i<N; ++i)
     {
         FENode& node = m_pMesh->Node(el.m_node[i]);
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         lm[4*i  ] = id[m_dofW[0]];
         lm[4*i+1] = id[m_dofW[1]];
@@ -152,20 +153,18 @@ void FEFluidDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
 //-----------------------------------------------------------------------------
 void FEFluidDomain3D::InternalForces(FEGlobalVector& R, const FETimeInfo& tp)
 {
-    int NE = (int)m_Elem.size();
-#pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
-    {
-        // element force vector
-        vector<double> fe;
-        vector<int> lm;
+    ParallelAssemble(R, [&](int i) {
+        // use the thread's scratch arena for the element data
+        FEScratchArena& arena = FEScratchArena::ThreadArena();
+        arena.Reset();
         
         // get the element
         FESolidElement& el = m_Elem[i];
         
         // get the element force vector and initialize it to zero
         int ndof = 4*el.Nodes();
-        fe.assign(ndof, 0);
+        vector<double>& fe = arena.ElementVector(ndof);
+        vector<int>& lm = arena.LM();
         
         // calculate internal force vector
         ElementInternalForce(el, fe, tp);
@@ -175,7 +174,7 @@ void FEFluidDomain3D::InternalForces(FEGlobalVector& R, const FETimeInfo& tp)
         
         // assemble element 'fe'-vector into global R vector
         R.Assemble(el.m_node, lm, fe);
-    }
+    });
 }
 
 //-----------------------------------------------------------------------------
@@ -293,7 +292,7 @@ void FEFluidDomain3D::ElementBodyForce(FEBodyForce& BF, FESolidElement& el, vect
     // nodal coordinates
     vec3d r0[FEElement::MAX_NODES];
     for (int i=0; i<neln; ++i)
-        r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+        r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
     
     // loop over integration points
     int nint = el.GaussPoints();
@@ -380,7 +379,7 @@ void FEFluidDomain3D::ElementStiffness(FESolidElement &el, matrix &ke, const FET
     const int neln = el.Nodes();
     
     // gradient of shape functions
-    vector<vec3d> gradN(neln);
+    vec3d gradN[FEElement::MAX_NODES];
 
 	double dt = tp.timeIncrement;
     double ksi = tp.alpham/(tp.gamma*tp.alphaf)*m_btrans;
@@ -470,19 +469,20 @@ void FEFluidDomain3D::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
     {
 		FESolidElement& el = m_Elem[iel];
 
-        // element stiffness matrix
-        FEElementMatrix ke(el);
+        // use the thread's scratch arena for the element data
+        FEScratchArena& arena = FEScratchArena::ThreadArena();
+        arena.Reset();
         
         // create the element's stiffness matrix
         int ndof = 4*el.Nodes();
-        ke.resize(ndof, ndof);
+        FEElementMatrix& ke = arena.ElementMatrix(el, ndof, ndof);
         ke.zero();
         
         // calculate material stiffness
         ElementStiffness(el, ke, tp);
         
         // get the element's LM vector
-		vector<int> lm;
+		vector<int>& lm = arena.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -119,8 +119,8 @@ void FEFluidFSIDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
             int neln = el.Nodes();
             for (int i=0; i<neln; ++i)
             {
-                x0[i] = m.Node(el.m_node[i]).m_r0;
-                xt[i] = m.Node(el.m_node[i]).m_rt;
+                x0[i] = m.Node(el.m_node[i]).m_r0();
+                xt[i] = m.Node(el.m_node[i]).m_rt();
             }
             
             int n = el.GaussPoints();
@@ -155,7 +155,7 @@ void FEFluidFSIDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     for (int i=0; i<N; ++i)
     {
         FENode& node = m_pMesh->Node(el.m_node[i]);
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         // first the displacement dofs
         lm[7*i  ] = id[m_dofU[0]];
@@ -178,7 +178,7 @@ void FEFluidFSIDomain3D::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            FENodeArray<int>& id = node.m_ID;
             
             // first the displacement dofs
             lm[7*i  ] = id[m_dofSU[0]];
@@ -805,12 +805,12 @@ void FEFluidFSIDomain3D::UpdateElementStress(int iel, const FETimeInfo& tp)
     double ae[NELN];
     for (int j=0; j<neln; ++j) {
         FENode& node = m_pMesh->Node(el.m_node[j]);
-        r0[j] = node.m_r0;
-        r[j]  = node.m_rt*alphaf + node.m_rp*(1-alphaf);
-        vs[j] = node.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2])*alphaf + node.m_vp*(1-alphaf);
+        r0[j] = node.m_r0();
+        r[j]  = node.m_rt()*alphaf + node.m_rp()*(1-alphaf);
+        vs[j] = node.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2])*alphaf + node.m_vp()*(1-alphaf);
         w[j]  = node.get_vec3d(m_dofW[0], m_dofW[1], m_dofW[2])*alphaf + node.get_vec3d_prev(m_dofW[0], m_dofW[1], m_dofW[2])*(1-alphaf);
         e[j]  = node.get(m_dofEF)*alphaf + node.get_prev(m_dofEF)*(1-alphaf);
-        a[j]  = node.m_at*alpham + node.m_ap*(1-alpham);
+        a[j]  = node.m_at()*alpham + node.m_ap()*(1-alpham);
         aw[j] = node.get_vec3d(m_dofAW[0], m_dofAW[1], m_dofAW[2])*alpham + node.get_vec3d_prev(m_dofAW[0], m_dofAW[1], m_dofAW[2])*(1-alpham);
         ae[j] = node.get(m_dofAEF)*alpham + node.get_prev(m_dofAEF)*(1-alpham);
     }
@@ -529,23 +529,23 @@ void FEFluidFSISolver::UpdateKinematics(vector<double>& ui)
     m_rigidSolver.UpdateRigidBodies(m_Ui, ui);
     
     // update nodes
-    vector<double> U(m_Ut.size());
-    for (size_t i=0; i<m_Ut.size(); ++i) U[i] = ui[i] + m_Ui[i] + m_Ut[i];
-    
-    scatter(U, mesh, m_dofU[0]);
-    scatter(U, mesh, m_dofU[1]);
-    scatter(U, mesh, m_dofU[2]);
-    scatter(U, mesh, m_dofSU[0]);
-    scatter(U, mesh, m_dofSU[1]);
-    scatter(U, mesh, m_dofSU[2]);
-    scatter(U, mesh, m_dofW[0]);
-    scatter(U, mesh, m_dofW[1]);
-    scatter(U, mesh, m_dofW[2]);
-    scatter(U, mesh, m_dofEF[0]);
+    // The total values are evaluated directly from the equation numbers.
+    const int dofs[10] = { m_dofU[0], m_dofU[1], m_dofU[2], m_dofSU[0], m_dofSU[1], m_dofSU[2], m_dofW[0], m_dofW[1], m_dofW[2], m_dofEF[0] };
+    const int NN = mesh.Nodes();
+#pragma omp parallel for
+    for (int i=0; i<NN; ++i)
+    {
+        FENode& node = mesh.Node(i);
+        for (int j=0; j<10; ++j)
+        {
+            int n = node.m_ID[dofs[j]];
+            if (n >= 0) node.set(dofs[j], ui[n] + m_Ui[n] + m_Ut[n]);
+        }
+    }
     
     // force dilatations to remain greater than -1
     if (m_minJf > 0) {
-        const int NN = mesh.Nodes();
+#pragma omp parallel for
         for (int i=0; i<NN; ++i)
         {
             FENode& node = mesh.Node(i);
@@ -581,12 +581,13 @@ void FEFluidFSISolver::UpdateKinematics(vector<double>& ui)
     
     // Update the spatial nodal positions
     // Don't update rigid nodes since they are already updated
-    for (int i = 0; i<mesh.Nodes(); ++i)
+#pragma omp parallel for
+    for (int i = 0; i<NN; ++i)
     {
         FENode& node = mesh.Node(i);
         if (node.m_rid == -1) {
-            node.m_rt = node.m_r0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
-            node.m_dt = node.m_d0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2])
+            node.m_rt() = node.m_r0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
+            node.m_dt() = node.m_d0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2])
             - node.get_vec3d(m_dofSU[0], m_dofSU[1], m_dofSU[2]);
         }
     }
@@ -602,14 +603,15 @@ void FEFluidFSISolver::UpdateKinematics(vector<double>& ui)
         double b = a / dt;
         double c = 1.0 - 0.5/m_beta;
         double cgi = 1 - 1.0/m_gamma;
+#pragma omp parallel for
         for (int i=0; i<N; ++i)
         {
             FENode& n = mesh.Node(i);
             
             // solid acceleration
-            n.m_at = (n.m_rt - n.m_rp)*b - n.m_vp*a + n.m_ap*c;
+            n.m_at() = (n.m_rt() - n.m_rp())*b - n.m_vp()*a + n.m_ap()*c;
             // solid velocity
-            vec3d vt = n.m_vp + (n.m_ap*(1.0 - m_gamma) + n.m_at*m_gamma)*dt;
+            vec3d vt = n.m_vp() + (n.m_ap()*(1.0 - m_gamma) + n.m_at()*m_gamma)*dt;
             n.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vt);
             
             // shell kinematics
@@ -634,7 +636,7 @@ void FEFluidFSISolver::UpdateKinematics(vector<double>& ui)
             vec3d vft = vt + wt;
             n.set_vec3d(m_dofVF[0], m_dofVF[1], m_dofVF[2], vft);
             // material time derivative of fluid velocity (in solid frame)
-            vec3d aft = n.m_at + awt;
+            vec3d aft = n.m_at() + awt;
             n.set_vec3d(m_dofAF[0], m_dofAF[1], m_dofAF[2], aft);
             
             // dilatation time derivative
@@ -660,29 +662,19 @@ void FEFluidFSISolver::UpdateIncrements(vector<double>& Ui, vector<double>& ui,
     m_rigidSolver.UpdateIncrements(Ui, ui, emap);
     
     // update flexible nodes
-    int n;
-    for (int i=0; i<mesh.Nodes(); ++i)
+    // current position = initial + total at prev conv step + total increment so far + current increment
+    // (displacement, shell, fluid relative velocity, and fluid dilatation dofs)
+    const int dofs[10] = { m_dofU[0], m_dofU[1], m_dofU[2], m_dofSU[0], m_dofSU[1], m_dofSU[2], m_dofW[0], m_dofW[1], m_dofW[2], m_dofEF[0] };
+    const int NN = mesh.Nodes();
+#pragma omp parallel for
+    for (int i=0; i<NN; ++i)
     {
         FENode& node = mesh.Node(i);
-        
-        // displacement dofs
-        // current position = initial + total at prev conv step + total increment so far + current increment
-        if ((n = node.m_ID[m_dofU[0]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofU[1]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofU[2]]) >= 0) Ui[n] += ui[n];
-        
-        // rotational dofs
-        if ((n = node.m_ID[m_dofSU[0]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofSU[1]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofSU[2]]) >= 0) Ui[n] += ui[n];
-
-        // fluid relative velocity
-        if ((n = node.m_ID[m_dofW[0]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofW[1]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofW[2]]) >= 0) Ui[n] += ui[n];
-        
-        // fluid dilatation
-        if ((n = node.m_ID[m_dofEF[0]]) >= 0) Ui[n] += ui[n];
+        for (int j=0; j<10; ++j)
+        {
+            int n = node.m_ID[dofs[j]];
+            if (n >= 0) Ui[n] += ui[n];
+        }
     }
 }
 
@@ -834,22 +826,22 @@ void FEFluidFSISolver::PrepStep()
     // store previous mesh state
     // we need them for strain and acceleration calculations
     FEMesh& mesh = fem.GetMesh();
+    mesh.UpdateNodalValues();
     for (int i=0; i<mesh.Nodes(); ++i)
     {
         FENode& ni = mesh.Node(i);
-        ni.m_rp = ni.m_rt;
-        ni.m_vp = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
-        ni.m_ap = ni.m_at;
-        ni.m_dp = ni.m_dt = ni.m_d0;
-		ni.UpdateValues();
+        ni.m_rp() = ni.m_rt();
+        ni.m_vp() = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
+        ni.m_ap() = ni.m_at();
+        ni.m_dp() = ni.m_dt() = ni.m_d0();
         
         switch (m_pred) {
             case 0:
             {
                 // initial guess at start of new time step (default)
                 // solid
-                ni.m_at = ni.m_ap*(1-0.5/m_beta) - ni.m_vp/(m_beta*dt);
-                vec3d vs = ni.m_vp + (ni.m_at*m_gamma + ni.m_ap*(1-m_gamma))*dt;
+                ni.m_at() = ni.m_ap()*(1-0.5/m_beta) - ni.m_vp()/(m_beta*dt);
+                vec3d vs = ni.m_vp() + (ni.m_at()*m_gamma + ni.m_ap()*(1-m_gamma))*dt;
                 ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vs);
                 
                 // solid shell
@@ -871,11 +863,11 @@ void FEFluidFSISolver::PrepStep()
             case 1:
             {
                 // initial guess at start of new time step (Zero Ydot)
-                ni.m_at = vec3d(0,0,0);
+                ni.m_at() = vec3d(0,0,0);
                 ni.set_vec3d(m_dofAW[0], m_dofAW[1], m_dofAW[2],vec3d(0,0,0));
                 ni.set(m_dofAEF, 0);
 
-                ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], ni.m_vp + ni.m_ap*dt*(1-m_gamma)*m_alphaf);
+                ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], ni.m_vp() + ni.m_ap()*dt*(1-m_gamma)*m_alphaf);
                 vec3d wp = ni.get_vec3d_prev(m_dofW[0], m_dofW[1], m_dofW[2]);
                 vec3d awp = ni.get_vec3d_prev(m_dofAW[0], m_dofAW[1], m_dofAW[2]);
                 ni.set_vec3d(m_dofW[0], m_dofW[1], m_dofW[2], wp + awp*dt*(1-m_gamma)*m_alphaf);
@@ -890,7 +882,7 @@ void FEFluidFSISolver::PrepStep()
                 ni.set_vec3d(m_dofAW[0], m_dofAW[1], m_dofAW[2], awp);
                 ni.set(m_dofAEF, ni.get_prev(m_dofAEF));
                 
-                ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], ni.m_vp + ni.m_ap*dt);
+                ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], ni.m_vp() + ni.m_ap()*dt);
                 vec3d wp = ni.get_vec3d_prev(m_dofW[0], m_dofW[1], m_dofW[2]);
                 ni.set_vec3d(m_dofW[0], m_dofW[1], m_dofW[2], wp + awp*dt);
                 ni.set(m_dofEF[0], ni.get_prev(m_dofEF[0]) + ni.get_prev(m_dofAEF)*dt);
@@ -1010,7 +1002,7 @@ bool FEFluidFSISolver::Quasin()
         bconv = true;
         
 		// solve the equations (returns line search; solution stored in m_ui)
-		double s = QNSolve();
+		double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
             
         // extract the velocity and dilatation increments
         GetDisplacementData(m_di, m_ui);
@@ -1338,7 +1330,7 @@ bool FEFluidFSISolver::Residual(vector<double>& R)
     zero(m_Fr);
     
     // setup the global vector
-    FEResidualVector RHS(fem, R, m_Fr);
+    FEResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
 
     // zero rigid body reaction forces
     m_rigidSolver.Residual();
@@ -145,7 +145,7 @@ void FEFluidNormalVelocity::Activate()
 
 		// nodal coordinates
 		for (int i = 0; i<neln; ++i) {
-			r0[i] = mesh->Node(el.m_node[i]).m_r0;
+			r0[i] = mesh->Node(el.m_node[i]).m_r0();
 			m_VN[el.m_lnode[i]] += m_VC.value<double>(iel, i);
 			++nf[el.m_lnode[i]];
 		}
@@ -318,7 +318,7 @@ bool FEFluidNormalVelocity::SetParabolicVelocity()
         // nodal coordinates
         FEMesh& mesh = *ps->GetMesh();
         vec3d rt[FEElement::MAX_NODES];
-        for (int j=0; j<neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt;
+        for (int j=0; j<neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt();
         
         // repeat over integration points
         ke.zero();
@@ -389,7 +389,7 @@ bool FEFluidNormalVelocity::SetParabolicVelocity()
         // nodal coordinates
         FEMesh& mesh = *ps->GetMesh();
         vec3d rt[FEElement::MAX_NODES];
-        for (int j=0; j<neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt;
+        for (int j=0; j<neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt();
         
         // repeat over integration points
         for (int n=0; n<nint; ++n)
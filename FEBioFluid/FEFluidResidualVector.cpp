@@ -34,7 +34,7 @@ SOFTWARE.*/
 using namespace std;
 
 //-----------------------------------------------------------------------------
-FEFluidResidualVector::FEFluidResidualVector(FEModel& fem, vector<double>& R, vector<double>& Fr) : FEGlobalVector(fem, R, Fr)
+FEFluidResidualVector::FEFluidResidualVector(FEModel& fem, vector<double>& R, vector<double>& Fr, bool bcolored) : FEGlobalVector(fem, R, Fr, bcolored)
 {
 }
 
@@ -57,20 +57,33 @@ void FEFluidResidualVector::Assemble(vector<int>& en, vector<int>& elm, vector<d
     {
         // assemble the element residual into the global residual
         int ndof = (int)fe.size();
-        for (i=0; i<ndof; ++i)
+        if (m_bexclusive)
         {
+            // no other thread is assembling into these nodes (see FEMeshPartition::ElementColoring)
+            for (i=0; i<ndof; ++i)
+            {
+                I = elm[i];
+                if (I >= 0) R[I] += fe[i];
+                else if (-I-2 >= 0) m_Fr[-I-2] -= fe[i];
+            }
+        }
+        else
+        {
+            for (i=0; i<ndof; ++i)
+            {
             
-            I = elm[i];
+                I = elm[i];
             
-            if ( I >= 0){
+                if ( I >= 0){
 #pragma omp atomic
-                R[I] += fe[i];
-            }
-            // TODO: Find another way to store reaction forces
+                    R[I] += fe[i];
+                }
+                // TODO: Find another way to store reaction forces
             
-            else if (-I-2 >= 0){
+                else if (-I-2 >= 0){
 #pragma omp atomic
-                m_Fr[-I-2] -= fe[i];
+                    m_Fr[-I-2] -= fe[i];
+                }
             }
         }
         
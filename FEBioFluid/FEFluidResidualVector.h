@@ -41,7 +41,7 @@ class FEBIOFLUID_API FEFluidResidualVector : public FEGlobalVector
 {
 public:
 	//! constructor
-	FEFluidResidualVector(FEModel& fem, std::vector<double>& R, std::vector<double>& Fr);
+	FEFluidResidualVector(FEModel& fem, std::vector<double>& R, std::vector<double>& Fr, bool bcolored = false);
 
 	//! destructor
 	~FEFluidResidualVector();
@@ -91,7 +91,7 @@ bool FEFluidRotationalVelocity::Init()
     int N = nset.Size();
     m_r.resize(N,vec3d(0,0,0));
     for (int i=0; i<N; ++i) {
-        vec3d x = nset.Node(i)->m_r0 - m_p;
+        vec3d x = nset.Node(i)->m_r0() - m_p;
         m_r[i] = x - n*(x*n);
     }
 
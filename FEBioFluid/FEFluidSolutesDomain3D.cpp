@@ -232,7 +232,7 @@ void FEFluidSolutesDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
         int neln = el.Nodes();
         for (int i=0; i<neln; ++i)
         {
-            x0[i] = m.Node(el.m_node[i]).m_r0;
+            x0[i] = m.Node(el.m_node[i]).m_r0();
         }
         
         int n = el.GaussPoints();
@@ -409,7 +409,7 @@ void FEFluidSolutesDomain3D::ElementBodyForce(FEBodyForce& BF, FESolidElement& e
     // nodal coordinates
     vec3d r0[FEElement::MAX_NODES];
     for (int i=0; i<neln; ++i)
-        r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+        r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
     
     // loop over integration points
     int nint = el.GaussPoints();
@@ -584,12 +584,12 @@ void FEFluidSolutesSolver::PrepStep()
     // store previous mesh state
     // we need them for strain and acceleration calculations
     FEMesh& mesh = fem.GetMesh();
+    mesh.UpdateNodalValues();
     for (int i=0; i<mesh.Nodes(); ++i)
     {
         FENode& ni = mesh.Node(i);
-        ni.m_rp = ni.m_rt = ni.m_r0;
-        ni.m_dp = ni.m_dt = ni.m_d0;
-        ni.UpdateValues();
+        ni.m_rp() = ni.m_rt() = ni.m_r0();
+        ni.m_dp() = ni.m_dt() = ni.m_d0();
         
         switch (m_pred) {
             case 0:
@@ -758,7 +758,7 @@ bool FEFluidSolutesSolver::Quasin()
 		}
         
         // solve the equations (returns line search; solution stored in m_ui)
-        double s = QNSolve();
+        double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
 
 		// for sequential solve, we set one of the residual components to zero
 		if (m_solve_strategy == SOLVE_SEQUENTIAL)
@@ -1081,7 +1081,7 @@ bool FEFluidSolutesSolver::Residual(vector<double>& R)
     zero(m_Fr);
     
     // setup the global vector
-    FEFluidResidualVector RHS(fem, R, m_Fr);
+    FEFluidResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
     
     // get the mesh
     FEMesh& mesh = fem.GetMesh();
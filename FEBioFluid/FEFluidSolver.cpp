@@ -302,17 +302,23 @@ void FEFluidSolver::UpdateKinematics(vector<double>& ui)
     FEMesh& mesh = fem.GetMesh();
     
     // update nodes
-    vector<double> U(m_Ut.size());
-    for (size_t i=0; i<m_Ut.size(); ++i) U[i] = ui[i] + m_Ui[i] + m_Ut[i];
-    
-    scatter(U, mesh, m_dofW[0]);
-    scatter(U, mesh, m_dofW[1]);
-    scatter(U, mesh, m_dofW[2]);
-    scatter(U, mesh, m_dofEF[0]);
+    // The total values are evaluated directly from the equation numbers.
+    const int dofs[4] = { m_dofW[0], m_dofW[1], m_dofW[2], m_dofEF[0] };
+    const int NN = mesh.Nodes();
+#pragma omp parallel for
+    for (int i=0; i<NN; ++i)
+    {
+        FENode& node = mesh.Node(i);
+        for (int j=0; j<4; ++j)
+        {
+            int n = node.m_ID[dofs[j]];
+            if (n >= 0) node.set(dofs[j], ui[n] + m_Ui[n] + m_Ut[n]);
+        }
+    }
     
     // force dilatations to remain greater than -1
     if (m_minJf > 0) {
-        const int NN = mesh.Nodes();
+#pragma omp parallel for
         for (int i=0; i<NN; ++i)
         {
             FENode& node = mesh.Node(i);
@@ -354,6 +360,7 @@ void FEFluidSolver::UpdateKinematics(vector<double>& ui)
         int N = mesh.Nodes();
 		double dt = fem.GetTime().timeIncrement;
         double cgi = 1 - 1.0/m_gammaf;
+#pragma omp parallel for
         for (int i=0; i<N; ++i)
         {
             FENode& n = mesh.Node(i);
@@ -462,12 +469,12 @@ void FEFluidSolver::PrepStep()
     // store previous mesh state
     // we need them for strain and acceleration calculations
     FEMesh& mesh = fem.GetMesh();
+    mesh.UpdateNodalValues();
     for (int i=0; i<mesh.Nodes(); ++i)
     {
         FENode& ni = mesh.Node(i);
-        ni.m_rp = ni.m_rt = ni.m_r0;
-        ni.m_dp = ni.m_dt = ni.m_d0;
-		ni.UpdateValues();
+        ni.m_rp() = ni.m_rt() = ni.m_r0();
+        ni.m_dp() = ni.m_dt() = ni.m_d0();
         
         switch (m_pred) {
             case 0:
@@ -594,7 +601,7 @@ bool FEFluidSolver::Quasin()
         bconv = true;
         
 		// solve the equations (returns line search; solution stored in m_ui)
-		double s = QNSolve();
+		double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
 
         // extract the velocity and dilatation increments
         GetVelocityData(m_vi, m_ui);
@@ -853,7 +860,7 @@ bool FEFluidSolver::Residual(vector<double>& R)
     zero(m_Fr);
     
     // setup the global vector
-    FEFluidResidualVector RHS(fem, R, m_Fr);
+    FEFluidResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
     
     // get the mesh
     FEMesh& mesh = fem.GetMesh();
@@ -114,7 +114,7 @@ void FESoluteConvectiveFlow::Update()
     {
         if (!m_bexclude[i]) {
             FENode& node = mesh.Node(i);
-            vec3d x = node.m_rt;
+            vec3d x = node.m_rt();
             vec3d vt = node.get_vec3d(m_dofW[0], m_dofW[1], m_dofW[2]);
             vec3d vp = node.get_vec3d_prev(m_dofW[0], m_dofW[1], m_dofW[2]);
             
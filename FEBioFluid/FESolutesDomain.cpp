@@ -200,7 +200,7 @@ void FESolutesDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
 		int neln = el.Nodes();
 		for (int i = 0; i<neln; ++i)
 		{
-			x0[i] = m.Node(el.m_node[i]).m_r0;
+			x0[i] = m.Node(el.m_node[i]).m_r0();
 		}
 
 		int n = el.GaussPoints();
@@ -444,12 +444,12 @@ void FESolutesSolver::PrepStep()
     // store previous mesh state
     // we need them for strain and acceleration calculations
     FEMesh& mesh = fem.GetMesh();
+    mesh.UpdateNodalValues();
     for (int i=0; i<mesh.Nodes(); ++i)
     {
         FENode& ni = mesh.Node(i);
-        ni.m_rp = ni.m_rt = ni.m_r0;
-        ni.m_dp = ni.m_dt = ni.m_d0;
-        ni.UpdateValues();
+        ni.m_rp() = ni.m_rt() = ni.m_r0();
+        ni.m_dp() = ni.m_dt() = ni.m_d0();
         
         switch (m_pred) {
             case 0:
@@ -557,7 +557,7 @@ bool FESolutesSolver::Quasin()
         bconv = true;
         
         // solve the equations (returns line search; solution stored in m_ui)
-        double s = QNSolve();
+        double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
 
        
         // set initial convergence norms
@@ -749,7 +749,7 @@ bool FESolutesSolver::Residual(vector<double>& R)
     zero(m_Fr);
     
     // setup the global vector
-    FEGlobalVector RHS(fem, R, m_Fr);
+    FEGlobalVector RHS(fem, R, m_Fr, m_bcolorAssembly);
     
     // get the mesh
     FEMesh& mesh = fem.GetMesh();
@@ -123,7 +123,7 @@ void FETemperatureBackFlowStabilization::MarkBackFlow()
         // nodal coordinates
         for (int i=0; i<neln; ++i) {
             FENode& node = m_psurf->GetMesh()->Node(el.m_node[i]);
-            rt[i] = node.m_rt*m_alpha + node.m_rp*(1-m_alpha);
+            rt[i] = node.m_rt()*m_alpha + node.m_rp()*(1-m_alpha);
             vt[i] = node.get_vec3d(m_dofW[0], m_dofW[1], m_dofW[2])*m_alpha + node.get_vec3d_prev(m_dofW[0], m_dofW[1], m_dofW[2])*(1-m_alpha);
         }
         
@@ -86,13 +86,13 @@ bool FEThermoFluidPressureLoad::Init()
         tp.m_T = T;
         fp.m_Jf = J;
         double dpT = m_tfluid->Tangent_Pressure_Temperature(tp);
-        dofT.node = node->GetID() - 1;    // zero-based
+        dofT.node = m_nset[i];    // zero-based
         dofT.bc = m_dofT;
         dofT.val = dpT;
         pLC->m_dof.push_back(dofT);
         FEAugLagLinearConstraint::DOF dofJ;
         double dpJ = m_tfluid->Tangent_Pressure_Strain(tp);
-        dofJ.node = node->GetID() - 1;    // zero-based
+        dofJ.node = m_nset[i];    // zero-based
         dofJ.bc = m_dofEF;
         dofJ.val = dpJ;
         pLC->m_dof.push_back(dofJ);
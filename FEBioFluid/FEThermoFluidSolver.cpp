@@ -511,11 +511,11 @@ void FEThermoFluidSolver::PrepStep()
     // store previous mesh state
     // we need them for strain and acceleration calculations
     FEMesh& mesh = fem.GetMesh();
+    mesh.UpdateNodalValues();
     for (int i=0; i<mesh.Nodes(); ++i)
     {
         FENode& ni = mesh.Node(i);
-        ni.m_rp = ni.m_rt = ni.m_r0;
-        ni.UpdateValues();
+        ni.m_rp() = ni.m_rt() = ni.m_r0();
         
         switch (m_pred) {
             case 0:
@@ -653,7 +653,7 @@ bool FEThermoFluidSolver::Quasin()
         bconv = true;
         
         // solve the equations (returns line search; solution stored in m_ui)
-        double s = QNSolve();
+        double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
 
         // extract the velocity and dilatation increments
         GetVelocityData(m_vi, m_ui);
@@ -933,7 +933,7 @@ bool FEThermoFluidSolver::Residual(vector<double>& R)
     zero(m_Fr);
     
     // setup the global vector
-    FEFluidResidualVector RHS(fem, R, m_Fr);
+    FEFluidResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
     
     // get the mesh
     FEMesh& mesh = fem.GetMesh();
@@ -46,6 +46,7 @@ SOFTWARE.*/
 #include <FEBioMech/FERigidSpring.h>
 #include <FEBioMech/FERigidAngularDamper.h>
 #include <FEBioMech/FERigidContractileForce.h>
+#include <FEBioMech/FEContactInterface.h>
 #include "FECore/log.h"
 #include "FECore/FECoreKernel.h"
 #include "FECore/DumpFile.h"
@@ -54,6 +55,7 @@ SOFTWARE.*/
 #include <NumCore/MatrixTools.h>
 #include <FECore/LinearSolver.h>
 #include <FECore/FEDomain.h>
+#include <FECore/FEScratchArena.h>
 #include <FECore/FEMaterial.h>
 #include "febio.h"
 #include "version.h"
@@ -437,6 +439,9 @@ void FEBioModel::WriteLog(unsigned int nwhen)
 		feLog("\tTotal number of right hand evaluations ............ : %d\n\n", step->m_ntotrhs);
 		feLog("\tTotal number of stiffness reformations ............ : %d\n\n", step->m_ntotref);
 
+		FESolver* solver = step->GetFESolver();
+		if (solver) feLog("\tResidual element assembly ......................... : %s\n\n", (solver->m_bcolorAssembly ? "colored" : "atomic"));
+
 		// print linear solver stats
 		LinearSolver* ls = step->GetFESolver()->GetLinearSolver();
 		if (ls)
@@ -1591,6 +1596,7 @@ bool FEBioModel::Solve()
 		double total_rhs    = 0.0;
 		double total_update = 0.0;
 		double total_qn     = 0.0;
+		double total_ls     = 0.0;
 		int NS = Steps();
 		for (int i = 0; i<NS; ++i)
 		{
@@ -1604,6 +1610,7 @@ bool FEBioModel::Solve()
 				total_rhs    += GetTimer(TimerID::Timer_Residual )->GetTime();
 				total_update += GetTimer(TimerID::Timer_Update   )->GetTime();
 				total_qn     += GetTimer(TimerID::Timer_QNUpdate )->GetTime();
+				total_ls     += GetTimer(TimerID::Timer_LineSearch)->GetTime();
 			}
 		}
 
@@ -1617,8 +1624,23 @@ bool FEBioModel::Solve()
 		Timer::time_str(total_rhs   , sztime); feLog("\t   evaluating residual .......... : %s (%lg sec)\n\n", sztime, total_rhs   );
 		Timer::time_str(total_update, sztime); feLog("\t   model update ................. : %s (%lg sec)\n\n", sztime, total_update);
 		Timer::time_str(total_qn    , sztime); feLog("\t   QN updates ................... : %s (%lg sec)\n\n", sztime, total_qn);
+		Timer::time_str(total_ls    , sztime); feLog("\t   line search .................. : %s (%lg sec)\n", sztime, total_ls);
+		feLog("\t      (includes the residual and update evaluations of the line search,\n\t       which are also counted above)\n\n");
 		Timer::time_str(total_linsol, sztime); feLog("\t   time in linear solver ........ : %s (%lg sec)\n\n", sztime, total_linsol);
+
+		// contact interfaces that track their own evaluation times
+		for (int i = 0; i < SurfacePairConstraints(); ++i)
+		{
+			FEContactInterface* pci = dynamic_cast<FEContactInterface*>(SurfacePairConstraint(i));
+			if (pci && ((pci->ResidualTime() > 0.0) || (pci->StiffnessTime() > 0.0)))
+			{
+				feLog("\t   contact interface %d (%s)\n", i + 1, pci->GetTypeStr());
+				feLog("\t      residual .................. : %lg sec\n", pci->ResidualTime());
+				feLog("\t      stiffness ................. : %lg sec\n\n", pci->StiffnessTime());
+			}
+		}
 		Timer::time_str(total_time  , sztime); feLog("\tTotal elapsed time .............. : %s (%lg sec)\n\n", sztime, total_time  );
+		feLog("\tScratch arena allocations ....... : %d\n\n", (int)FEScratchArena::Allocations());
 
 
 		m_log.SetMode(old_mode);
@@ -78,9 +78,9 @@ void FEBoxMesh::Create(int nx, int ny, int nz, vec3d r0, vec3d r1, FE_Element_Ty
 
 				FENode& node = Node(n);
 
-				node.m_r0 = vec3d(x, y, z);
+				node.m_r0() = vec3d(x, y, z);
 
-				node.m_rt = node.m_r0;
+				node.m_rt() = node.m_r0();
 
 				// set rigid body id
 				node.m_rid = -1;
@@ -415,8 +415,8 @@ void FE3FieldElasticShellDomain::UpdateElementStress(int iel)
     vec3d r0[NME], rt[NME];
     for (int j=0; j<neln; ++j)
     {
-        r0[j] = m_pMesh->Node(el.m_node[j]).m_r0;
-        rt[j] = m_pMesh->Node(el.m_node[j]).m_rt;
+        r0[j] = m_pMesh->Node(el.m_node[j]).m_r0();
+        rt[j] = m_pMesh->Node(el.m_node[j]).m_rt();
     }
     
     // calculate the average dilatation and pressure
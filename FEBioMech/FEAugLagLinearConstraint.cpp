@@ -116,9 +116,9 @@ double FELinearConstraintSet::constraint(FEAugLagLinearConstraint& LC)
 		FENode& node = mesh.Node(it->node);
 		switch (it->bc)
 		{
-		case 0: u = node.m_rt.x - node.m_r0.x; break;
-		case 1: u = node.m_rt.y - node.m_r0.y; break;
-		case 2: u = node.m_rt.z - node.m_r0.z; break;
+		case 0: u = node.m_rt().x - node.m_r0().x; break;
+		case 1: u = node.m_rt().y - node.m_r0().y; break;
+		case 2: u = node.m_rt().z - node.m_r0().z; break;
 		default:
                 u = node.get(it->bc);
 		}
@@ -347,9 +347,9 @@ double FENodeConstraintSet::constraint(FEAugLagLinearConstraint& LC)
         FENode& node = mesh.Node(it->node);
         switch (it->bc)
         {
-        case 0: u = node.m_rt.x - node.m_r0.x; break;
-        case 1: u = node.m_rt.y - node.m_r0.y; break;
-        case 2: u = node.m_rt.z - node.m_r0.z; break;
+        case 0: u = node.m_rt().x - node.m_r0().x; break;
+        case 1: u = node.m_rt().y - node.m_r0().y; break;
+        case 2: u = node.m_rt().z - node.m_r0().z; break;
         default:
                 u = node.get(it->bc);
         }
@@ -81,7 +81,7 @@ void FEBCPrescribedDeformation::SetDeformationGradient(const mat3d& F)
 //-----------------------------------------------------------------------------
 void FEBCPrescribedDeformation::GetNodalValues(int nodelid, std::vector<double>& val)
 {
-	vec3d X = GetNodeSet()->Node(nodelid)->m_r0;
+	vec3d X = GetNodeSet()->Node(nodelid)->m_r0();
 	mat3ds XX = dyad(X);
 	vec3d x = m_F*X;
 	vec3d u = (x - X)*m_scale;
@@ -167,9 +167,9 @@ void FEBCPrescribedDeformation2O::GetNodalValues(int nodelid, std::vector<double
 {
 	FEModel& fem = *GetFEModel();
 	FEMesh& mesh = fem.GetMesh();
-	vec3d X1 = mesh.Node(m_refNode).m_r0;
+	vec3d X1 = mesh.Node(m_refNode).m_r0();
 
-	vec3d X = GetNodeSet()->Node(nodelid)->m_r0;
+	vec3d X = GetNodeSet()->Node(nodelid)->m_r0();
 
 	mat3ds XX = dyad(X);
 	mat3ds XX1 = dyad(X1);
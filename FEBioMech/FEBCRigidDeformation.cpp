@@ -56,7 +56,7 @@ void FEBCRigidDeformation::CopyFrom(FEBoundaryCondition* pbc)
 
 void FEBCRigidDeformation::GetNodalValues(int nodelid, std::vector<double>& val)
 {
-	vec3d X = GetNodeSet()->Node(nodelid)->m_r0;
+	vec3d X = GetNodeSet()->Node(nodelid)->m_r0();
 
 	quatd Q(m_qt);
 
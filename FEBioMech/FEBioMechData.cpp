@@ -47,7 +47,7 @@ double FENodeXPos::value(int nnode)
 {
 	FEMesh& mesh = GetFEModel()->GetMesh();
 	FENode& node = mesh.Node(nnode);
-	return node.m_rt.x; 
+	return node.m_rt().x; 
 }
 
 //-----------------------------------------------------------------------------
@@ -55,7 +55,7 @@ double FENodeYPos::value(int nnode)
 {
 	FEMesh& mesh = GetFEModel()->GetMesh();
 	FENode& node = mesh.Node(nnode);
-	return node.m_rt.y; 
+	return node.m_rt().y; 
 }
 
 //-----------------------------------------------------------------------------
@@ -63,7 +63,7 @@ double FENodeZPos::value(int nnode)
 {
 	FEMesh& mesh = GetFEModel()->GetMesh();
 	FENode& node = mesh.Node(nnode);
-	return node.m_rt.z; 
+	return node.m_rt().z; 
 }
 
 //-----------------------------------------------------------------------------
@@ -125,7 +125,7 @@ double FENodeXAcc::value(int nnode)
 {
 	FEMesh& mesh = GetFEModel()->GetMesh();
 	FENode& node = mesh.Node(nnode);
-	return node.m_at.x; 
+	return node.m_at().x; 
 }
 
 //-----------------------------------------------------------------------------
@@ -133,7 +133,7 @@ double FENodeYAcc::value(int nnode)
 {
 	FEMesh& mesh = GetFEModel()->GetMesh();
 	FENode& node = mesh.Node(nnode);
-	return node.m_at.y; 
+	return node.m_at().y; 
 }
 
 //-----------------------------------------------------------------------------
@@ -141,7 +141,7 @@ double FENodeZAcc::value(int nnode)
 {
 	FEMesh& mesh = GetFEModel()->GetMesh();
 	FENode& node = mesh.Node(nnode);
-	return node.m_at.z; 
+	return node.m_at().z; 
 }
 
 //-----------------------------------------------------------------------------
@@ -153,7 +153,7 @@ double FENodeForceX::value(int nnode)
 	{
 		vector<double>& Fr = psolid_solver->m_Fr;
 		vector<double>& Fn = psolid_solver->m_Fn;
-		vector<int>& id = mesh.Node(nnode).m_ID;
+		FENodeArray<int>& id = mesh.Node(nnode).m_ID;
 
 		double Fx = 0.0;
 		if (id[0] >= 0) Fx = Fn[id[0]];
@@ -171,7 +171,7 @@ double FENodeForceY::value(int nnode)
 	if (psolid_solver)
 	{
 		vector<double>& Fr = psolid_solver->m_Fr;
-		vector<int>& id = mesh.Node(nnode).m_ID;
+		FENodeArray<int>& id = mesh.Node(nnode).m_ID;
 		return (-id[1] - 2 >= 0 ? Fr[-id[1]-2] : 0);
 	}
 	return 0;
@@ -185,7 +185,7 @@ double FENodeForceZ::value(int nnode)
 	if (psolid_solver)
 	{
 		vector<double>& Fr = psolid_solver->m_Fr;
-		vector<int>& id = mesh.Node(nnode).m_ID;
+		FENodeArray<int>& id = mesh.Node(nnode).m_ID;
 		return (-id[2] - 2 >= 0 ? Fr[-id[2]-2] : 0);
 	}
 	return 0;
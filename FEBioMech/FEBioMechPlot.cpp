@@ -83,7 +83,7 @@ bool FEPlotNodeVelocity::Save(FEMesh& m, FEDataStream& a)
 bool FEPlotNodeAcceleration::Save(FEMesh& m, FEDataStream& a)
 {
 	writeNodalValues<vec3d>(m, a, [](const FENode& node) {
-		return node.m_at;
+		return node.m_at();
 	});
 	return true;
 }
@@ -1250,7 +1250,7 @@ bool FEPlotCurrentElementCenterOfMass::Save(FEDomain &dom, FEDataStream& a)
             // get nodal positions and velocities
             vec3d rt[NELN], rn[NELN];
             for (int j=0; j<el.Nodes(); ++j)
-                rt[j] = mesh.Node(el.m_node[j]).m_rt;
+                rt[j] = mesh.Node(el.m_node[j]).m_rt();
             
             // evaluate positions at integration points
             for (int j=0; j<el.GaussPoints(); ++j)
@@ -1284,7 +1284,7 @@ bool FEPlotCurrentElementCenterOfMass::Save(FEDomain &dom, FEDataStream& a)
             // get nodal velocities
             vec3d rt[NELN], st[NELN], rn[NELN];
             for (int j=0; j<el.Nodes(); ++j) {
-                rt[j] = mesh.Node(el.m_node[j]).m_rt;
+                rt[j] = mesh.Node(el.m_node[j]).m_rt();
                 st[j] = mesh.Node(el.m_node[j]).m_st();
             }
             
@@ -1425,7 +1425,7 @@ bool FEPlotCurrentElementAngularMomentum::Save(FEDomain &dom, FEDataStream& a)
             vec3d rt[NELN], rn[NELN];
             vec3d vt[NELN], vn[NELN];
             for (int j=0; j<el.Nodes(); ++j) {
-                rt[j] = mesh.Node(el.m_node[j]).m_rt;
+                rt[j] = mesh.Node(el.m_node[j]).m_rt();
                 vt[j] = mesh.Node(el.m_node[j]).get_vec3d(dof_VX, dof_VY, dof_VZ);
             }
             
@@ -1461,7 +1461,7 @@ bool FEPlotCurrentElementAngularMomentum::Save(FEDomain &dom, FEDataStream& a)
             vec3d rt[NELN], st[NELN], rn[NELN];
             vec3d vt[NELN], wt[NELN], vn[NELN];
             for (int j=0; j<el.Nodes(); ++j) {
-                rt[j] = mesh.Node(el.m_node[j]).m_rt;
+                rt[j] = mesh.Node(el.m_node[j]).m_rt();
                 st[j] = mesh.Node(el.m_node[j]).m_st();
                 vt[j] = mesh.Node(el.m_node[j]).get_vec3d(dof_VX, dof_VY, dof_VZ);
                 wt[j] = mesh.Node(el.m_node[j]).get_vec3d(dof_SVX, dof_SVY, dof_SVZ);
@@ -1744,7 +1744,7 @@ bool FEPlotShellDirector::Save(FEDomain &dom, FEDataStream &a)
                     FENode& nj = mesh.Node(e.m_node[j]);
                     vec3d D;
                     if (bd->m_bnodalnormals) {
-                        D = nj.m_d0;
+                        D = nj.m_d0();
                     }
                     else {
                         D = e.m_d0[j];
@@ -3010,10 +3010,10 @@ bool FEPlotDiscreteElementStretch::Save(FEDomain& dom, FEDataStream& a)
 	{
 		FEDiscreteElement& el = discreteDomain.Element(i);
 		
-		vec3d ra0 = mesh.Node(el.m_node[0]).m_r0;
-		vec3d ra1 = mesh.Node(el.m_node[0]).m_rt;
-		vec3d rb0 = mesh.Node(el.m_node[1]).m_r0;
-		vec3d rb1 = mesh.Node(el.m_node[1]).m_rt;
+		vec3d ra0 = mesh.Node(el.m_node[0]).m_r0();
+		vec3d ra1 = mesh.Node(el.m_node[0]).m_rt();
+		vec3d rb0 = mesh.Node(el.m_node[1]).m_r0();
+		vec3d rb1 = mesh.Node(el.m_node[1]).m_rt();
 
 		double L0 = (rb0 - ra0).norm();
 		double Lt = (rb1 - ra1).norm();
@@ -254,9 +254,9 @@ void FECGSolidSolver::PrepStep()
 	for (int i = 0; i<mesh.Nodes(); ++i)
 	{
 		FENode& ni = mesh.Node(i);
-		ni.m_rp = ni.m_rt;
-		ni.m_vp = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
-		ni.m_ap = ni.m_at;
+		ni.m_rp() = ni.m_rt();
+		ni.m_vp() = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
+		ni.m_ap() = ni.m_at();
 	}
 
 	// apply concentrated nodal forces
@@ -386,14 +386,14 @@ void FECGSolidSolver::PrepStep()
 				FERigidBody& rb = *fem.GetRigidBody(n.m_rid);
 				vec3d V = rb.m_vt;
 				vec3d W = rb.m_wt;
-				vec3d r = n.m_rt - rb.m_rt;
+				vec3d r = n.m_rt() - rb.m_rt;
 
 				vec3d v = V + (W ^ r);
-				n.m_vp = v;
+				n.m_vp() = v;
 				n.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], v);
 
 				vec3d a = (W ^ V)*2.0 + (W ^ (W ^ r));
-				n.m_ap = n.m_at = a;
+				n.m_ap() = n.m_at() = a;
 			}
 		}
 	}
@@ -729,7 +729,7 @@ void FECGSolidSolver::UpdateKinematics(vector<double>& ui)
 	{
 		FENode& node = mesh.Node(i);
 		if (node.m_rid == -1)
-			node.m_rt = node.m_r0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
+			node.m_rt() = node.m_r0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
 	}
 }
 
@@ -915,7 +915,7 @@ bool FECGSolidSolver::Residual(vector<double>& R)
 	zero(m_Fr);
 
 	// setup the global vector
-	FEResidualVector RHS(fem, R, m_Fr);
+	FEResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
 
 	// zero rigid body reaction forces
 	int NRB = fem.RigidBodies();
@@ -1053,10 +1053,10 @@ void FECGSolidSolver::InertialForces(FEGlobalVector& R)
 	for (int i = 0; i<mesh.Nodes(); ++i)
 	{
 		FENode& node = mesh.Node(i);
-		vec3d& rt = node.m_rt;
-		vec3d& rp = node.m_rp;
-		vec3d& vp = node.m_vp;
-		vec3d& ap = node.m_ap;
+		vec3d& rt = node.m_rt();
+		vec3d& rp = node.m_rp();
+		vec3d& vp = node.m_vp();
+		vec3d& ap = node.m_ap();
 
 		F[3 * i] = b*(rt.x - rp.x) - a*vp.x + c * ap.x;
 		F[3 * i + 1] = b*(rt.y - rp.y) - a*vp.y + c * ap.y;
@@ -1096,7 +1096,7 @@ void FECGSolidSolver::AssembleResidual(int node_id, int dof, double f, vector<do
 		FERigidBody& RB = *fem.GetRigidBody(node.m_rid);
 
 		// get the relative position
-		vec3d a = node.m_rt - RB.m_rt;
+		vec3d a = node.m_rt() - RB.m_rt;
 
 		int* lm = RB.m_LM;
 		if (dof == m_dofU[0])
@@ -1198,7 +1198,7 @@ void FECGSolidSolver::UpdateRigidBodies(vector<double>& ui)
 		FENode& node = mesh.Node(i);
 		if (node.m_rid >= 0)
 		{
-			vec3d ut = node.m_rt - node.m_r0;
+			vec3d ut = node.m_rt() - node.m_r0();
 			node.set_vec3d(m_dofU[0], m_dofU[1], m_dofU[2], ut);
 		}
 	}
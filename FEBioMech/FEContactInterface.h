@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #pragma once
 #include <FECore/FESurfacePairConstraint.h>
+#include <FECore/Timer.h>
 #include "febiomech_api.h"
 
 class FEModel;
@@ -63,6 +64,12 @@ public:
 	// Evaluates the contriubtion to the stiffness matrix
 	virtual void StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp) = 0;
 
+	//! time spent evaluating this interface's contribution to the residual
+	double ResidualTime() { return m_residualTimer.GetTime(); }
+
+	//! time spent evaluating this interface's contribution to the stiffness matrix
+	double StiffnessTime() { return m_stiffnessTimer.GetTime(); }
+
 protected:
 	//! don't call the default constructor
 	FEContactInterface() : FESurfacePairConstraint(0){}
@@ -81,5 +88,9 @@ public:
     double  m_psf;      //!< penalty scale factor during Lagrange augmentation
     double  m_psfmax;   //!< max allowable penalty scale factor during laugon
 
+protected:
+	Timer	m_residualTimer;	//!< tracks time spent in LoadVector (if the interface uses it)
+	Timer	m_stiffnessTimer;	//!< tracks time spent in StiffnessMatrix (if the interface uses it)
+
 	DECLARE_FECORE_CLASS();
 };
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FEContinuousFiberDistribution.h"
+#include <FECore/FEModel.h>
 
 BEGIN_FECORE_CLASS(FEContinuousFiberDistribution, FEElasticMaterial)
 
@@ -44,6 +45,10 @@ FEContinuousFiberDistribution::FEContinuousFiberDistribution(FEModel* pfem) : FE
 	m_pFmat = 0;
 	m_pFDD = 0;
 	m_pFint = 0;
+
+	m_btable = false;
+	m_bhomogeneous = false;
+	m_IFD = 1.0;
 }
 
 //-----------------------------------------------------------------------------
@@ -55,6 +60,9 @@ bool FEContinuousFiberDistribution::Init()
     // initialize base class
 	if (FEElasticMaterial::Init() == false) return false;
 
+	// tabulate the integration points
+	BuildTables();
+
 	return true;
 }
 
@@ -64,112 +72,130 @@ void FEContinuousFiberDistribution::Serialize(DumpStream& ar)
 {	
 	FEElasticMaterial::Serialize(ar);
 	if (ar.IsShallow()) return;
+
+	if (ar.IsLoading()) BuildTables();
 }
 
 //-----------------------------------------------------------------------------
-//! calculate stress at material point
-mat3ds FEContinuousFiberDistribution::Stress(FEMaterialPoint& mp)
-{ 
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+// helper function that checks whether the fiber density distribution is the same 
+// at all material points and does not change over time.
+static bool is_homogeneous(FEModel* fem, FEFiberDensityDistribution* pFDD)
+{
+	FEParameterList& pl = pFDD->GetParameterList();
+	FEParamIterator it = pl.first();
+	for (int i = 0; i < pl.Parameters(); ++i, ++it)
+	{
+		FEParam& p = *it;
+		if (fem->GetLoadController(&p)) return false;
 
-	// calculate stress
-	mat3ds s; s.zero();
+		for (int j = 0; j < p.dim(); ++j)
+		{
+			switch (p.type())
+			{
+			case FE_PARAM_DOUBLE_MAPPED: if (p.value<FEParamDouble>(j).isConst() == false) return false; break;
+			case FE_PARAM_VEC3D_MAPPED : if (p.value<FEParamVec3 >(j).isConst() == false) return false; break;
+			case FE_PARAM_MAT3D_MAPPED : if (p.value<FEParamMat3d>(j).isConst() == false) return false; break;
+			case FE_PARAM_MAT3DS_MAPPED: if (p.value<FEParamMat3ds>(j).isConst() == false) return false; break;
+			case FE_PARAM_MATERIALPOINT: return false;
+			default:
+				break;
+			}
+		}
+	}
+	return true;
+}
 
-	// get the local coordinate systems
-	mat3d Qt = GetLocalCS(mp).transpose();
-    
-    double IFD = IntegratedFiberDensity(mp);
+//-----------------------------------------------------------------------------
+void FEContinuousFiberDistribution::BuildTables()
+{
+	m_fiber.clear();
+	m_weight.clear();
+	m_btable = m_bhomogeneous = false;
+	m_IFD = 1.0;
 
-	// obtain an integration point iterator
-	FEFiberIntegrationSchemeIterator* it = m_pFint->GetIterator(&pt);
+	// see if the fiber density is the same everywhere
+	m_bhomogeneous = IsLocalCSConstant() && is_homogeneous(GetFEModel(), m_pFDD);
+
+	// in that case, we only need to evaluate the integrated fiber density once
+	FEElasticMaterialPoint ep;
+	if (m_bhomogeneous) m_IFD = IntegratedFiberDensity(ep);
+
+	// tabulate the integration points
+	if (m_pFint->IsDeformationIndependent() == false) return;
+
+	FEFiberIntegrationSchemeIterator* it = m_pFint->GetIterator(nullptr);
 	if (it->IsValid())
 	{
 		do
 		{
-			// get the global fiber direction
-			vec3d& N = it->m_fiber;
-
-			// convert to local coordinates
-			vec3d n0 = Qt*N;
-
-			// rotate to local configuration to evaluate ellipsoidally distributed material coefficients
-			double R = m_pFDD->FiberDensity(mp, n0);
-            
-			// calculate the stress
-			double wn = it->m_weight;
-			s += m_pFmat->FiberStress(pt, N)*(R*wn);
+			m_fiber.push_back(it->m_fiber);
+			m_weight.push_back(it->m_weight);
 		}
 		while (it->Next());
 	}
-
-	// don't forget to delete the iterator
 	delete it;
+	m_btable = true;
 
-	// divide by IFD
-	return s / IFD;
+	// premultiply the weights with the normalized fiber density
+	if (m_bhomogeneous)
+	{
+		mat3d Qt = GetLocalCS(ep).transpose();
+		for (size_t i = 0; i < m_fiber.size(); ++i)
+		{
+			vec3d n0 = Qt*m_fiber[i];
+			m_weight[i] *= m_pFDD->FiberDensity(ep, n0) / m_IFD;
+		}
+	}
 }
 
 //-----------------------------------------------------------------------------
-//! calculate tangent stiffness at material point
-tens4ds FEContinuousFiberDistribution::Tangent(FEMaterialPoint& mp)
+// Integrates the fiber quantity f over all fiber directions, weighted by the 
+// normalized fiber density.
+template <class T> T FEContinuousFiberDistribution::IntegrateFibers(FEMaterialPoint& mp, T sum, const std::function<T(const vec3d& N)>& f)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	// tabulated and homogeneous: weights already include the fiber density
+	if (m_btable && m_bhomogeneous)
+	{
+		const int n = (int)m_fiber.size();
+		for (int i = 0; i < n; ++i) sum += f(m_fiber[i])*m_weight[i];
+		return sum;
+	}
 
 	// get the local coordinate systems
 	mat3d Qt = GetLocalCS(mp).transpose();
-    
-    double IFD = IntegratedFiberDensity(mp);
-
-	// initialize stress tensor
-	tens4ds c;
-	c.zero();
 
-	FEFiberIntegrationSchemeIterator* it = m_pFint->GetIterator(&pt);
-	if (it->IsValid())
+	// tabulated: the integrated fiber density can be evaluated in the same pass
+	if (m_btable)
 	{
-		do
+		double IFD = 0.0;
+		const int n = (int)m_fiber.size();
+		for (int i = 0; i < n; ++i)
 		{
-			// get the global fiber direction
-			vec3d& N = it->m_fiber;
-
-			// convert to local
-			vec3d n0 = Qt*N;
+			const vec3d& N = m_fiber[i];
 
 			// rotate to local configuration to evaluate ellipsoidally distributed material coefficients
-			double R = m_pFDD->FiberDensity(mp, n0);
-            
-			// calculate the tangent
-			c += m_pFmat->FiberTangent(mp, N)*(R*it->m_weight);
+			double Rw = m_pFDD->FiberDensity(mp, Qt*N)*m_weight[i];
+			IFD += Rw;
+
+			sum += f(N)*Rw;
 		}
-		while (it->Next());
-	}
 
-	// don't forget to delete the iterator
-	delete it;
-    
-	// divide by IFD
-	return c / IFD;
-}
+		// just in case
+		if (IFD == 0.0) IFD = 1.0;
 
-//-----------------------------------------------------------------------------
-//! calculate strain energy density at material point
-//double FEContinuousFiberDistribution::StrainEnergyDensity(FEMaterialPoint& pt) { return m_pFint->StrainEnergyDensity(pt); }
-double FEContinuousFiberDistribution::StrainEnergyDensity(FEMaterialPoint& mp)
-{ 
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+		return sum / IFD;
+	}
 
-	// get the local coordinate systems
-	mat3d Qt = GetLocalCS(mp).transpose();
-    
-    double IFD = IntegratedFiberDensity(mp);
+	// the integration points depend on the deformation, so we need an iterator
+	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+	double IFD = (m_bhomogeneous ? m_IFD : IntegratedFiberDensity(mp));
 
-	double sed = 0.0;
 	FEFiberIntegrationSchemeIterator* it = m_pFint->GetIterator(&pt);
 	if (it->IsValid())
 	{
 		do
 		{
-			// get fiber direction in global coordinate system
+			// get the global fiber direction
 			vec3d& N = it->m_fiber;
 
 			// convert to local coordinates
@@ -177,9 +203,8 @@ double FEContinuousFiberDistribution::StrainEnergyDensity(FEMaterialPoint& mp)
 
 			// rotate to local configuration to evaluate ellipsoidally distributed material coefficients
 			double R = m_pFDD->FiberDensity(mp, n0);
-            
-			// calculate the stress
-			sed += m_pFmat->FiberStrainEnergyDensity(mp, N)*(R*it->m_weight);
+
+			sum += f(N)*(R*it->m_weight);
 		}
 		while (it->Next());
 	}
@@ -188,9 +213,41 @@ double FEContinuousFiberDistribution::StrainEnergyDensity(FEMaterialPoint& mp)
 	delete it;
 
 	// divide by IFD
-	return sed / IFD;
+	return sum / IFD;
+}
+
+//-----------------------------------------------------------------------------
+//! calculate stress at material point
+mat3ds FEContinuousFiberDistribution::Stress(FEMaterialPoint& mp)
+{ 
+	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+
+	mat3ds s; s.zero();
+	return IntegrateFibers<mat3ds>(mp, s, [&](const vec3d& N) {
+		return m_pFmat->FiberStress(pt, N);
+	});
 }
 
+//-----------------------------------------------------------------------------
+//! calculate tangent stiffness at material point
+tens4ds FEContinuousFiberDistribution::Tangent(FEMaterialPoint& mp)
+{
+	tens4ds c; c.zero();
+	return IntegrateFibers<tens4ds>(mp, c, [&](const vec3d& N) {
+		return m_pFmat->FiberTangent(mp, N);
+	});
+}
+
+//-----------------------------------------------------------------------------
+//! calculate strain energy density at material point
+double FEContinuousFiberDistribution::StrainEnergyDensity(FEMaterialPoint& mp)
+{ 
+	return IntegrateFibers<double>(mp, 0.0, [&](const vec3d& N) {
+		return m_pFmat->FiberStrainEnergyDensity(mp, N);
+	});
+}
+
+//-----------------------------------------------------------------------------
 double FEContinuousFiberDistribution::IntegratedFiberDensity(FEMaterialPoint& mp)
 {
 	// get the local coordinate systems
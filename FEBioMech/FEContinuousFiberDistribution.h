@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include "FEFiberDensityDistribution.h"
 #include "FEFiberIntegrationScheme.h"
 #include "FEFiberMaterialPoint.h"
+#include <functional>
 
 //  This material is a container for a fiber material, a fiber density
 //  distribution, and an integration scheme.
@@ -61,10 +62,27 @@ public:
 private:
 	double IntegratedFiberDensity(FEMaterialPoint& pt);
 
+	// build the tables of fiber directions and weights
+	void BuildTables();
+
+	// integrate a fiber quantity over all fiber directions
+	template <class T> T IntegrateFibers(FEMaterialPoint& mp, T zero, const std::function<T(const vec3d& N)>& f);
+
 protected:
     FEElasticFiberMaterial*     m_pFmat;    // pointer to fiber material
 	FEFiberDensityDistribution* m_pFDD;     // pointer to fiber density distribution
 	FEFiberIntegrationScheme*   m_pFint;    // pointer to fiber integration scheme
 
+private:
+	// The fiber directions and weights are tabulated when the integration scheme does not
+	// depend on the deformation. When, in addition, the local coordinate system and the fiber 
+	// density are the same at all material points, the weights are premultiplied with the 
+	// (normalized) fiber density.
+	bool				m_btable;		//!< integration points are tabulated
+	bool				m_bhomogeneous;	//!< fiber density is the same at all material points
+	double				m_IFD;			//!< integrated fiber density (homogeneous case only)
+	std::vector<vec3d>	m_fiber;		//!< fiber directions (global coordinates)
+	std::vector<double>	m_weight;		//!< integration weights (normalized by IFD in homogeneous case)
+
 	DECLARE_FECORE_CLASS();
 };
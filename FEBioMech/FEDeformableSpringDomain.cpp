@@ -75,7 +75,7 @@ void FEDeformableSpringDomain::BuildMatrixProfile(FEGlobalMatrix& K)
 		for (int j=0; j<3; ++j)
 		{
 			int n = i-1+j;
-			vector<int>& id = Node(n).m_ID;
+			FENodeArray<int>& id = Node(n).m_ID;
 
 			// first the displacement dofs
 			lm[6 * j    ] = id[m_dofU[0]];
@@ -100,7 +100,7 @@ void FEDeformableSpringDomain::UnpackLM(FEElement &el, vector<int>& lm)
 	for (int i = 0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3 * i    ] = id[m_dofU[0]];
@@ -151,8 +151,8 @@ double FEDeformableSpringDomain::InitialLength()
 		FENode& n2 = mesh.Node(el.m_node[1]);
 
 		// get the nodal positions
-		vec3d& r1 = n1.m_r0;
-		vec3d& r2 = n2.m_r0;
+		vec3d& r1 = n1.m_r0();
+		vec3d& r2 = n2.m_r0();
 
 		L += (r2 - r1).norm();
 	}
@@ -175,8 +175,8 @@ double FEDeformableSpringDomain::CurrentLength()
 		FENode& n2 = mesh.Node(el.m_node[1]);
 
 		// get the nodal positions
-		vec3d& r1 = n1.m_rt;
-		vec3d& r2 = n2.m_rt;
+		vec3d& r1 = n1.m_rt();
+		vec3d& r2 = n2.m_rt();
 
 		L += (r2 - r1).norm();
 	}
@@ -212,10 +212,10 @@ void FEDeformableSpringDomain::InternalForces(FEGlobalVector& R)
 		FENode& n2 = mesh.Node(el.m_node[1]);
 
 		// get the nodal positions
-		vec3d& r01 = n1.m_r0;
-		vec3d& r02 = n2.m_r0;
-		vec3d& rt1 = n1.m_rt;
-		vec3d& rt2 = n2.m_rt;
+		vec3d& r01 = n1.m_r0();
+		vec3d& r02 = n2.m_r0();
+		vec3d& rt1 = n1.m_rt();
+		vec3d& rt2 = n2.m_rt();
 
 		vec3d e = rt2 - rt1; e.unit();
 
@@ -255,9 +255,9 @@ void FEDeformableSpringDomain::InternalForces(FEGlobalVector& R)
 			int i0 = i - 1;
 			int i1 = i + 1;
 
-			vec3d xi = Node(i).m_rt;
-			vec3d x0 = Node(i0).m_rt;
-			vec3d x1 = Node(i1).m_rt;
+			vec3d xi = Node(i).m_rt();
+			vec3d x0 = Node(i0).m_rt();
+			vec3d x1 = Node(i1).m_rt();
 
 			vec3d r = xi - x0;
 			vec3d s = x1 - x0; s.unit();
@@ -284,9 +284,9 @@ void FEDeformableSpringDomain::InternalForces(FEGlobalVector& R)
 			int i0 = i - 1;
 			int i1 = i + 1;
 
-			vec3d xi = Node(i).m_rt;
-			vec3d x0 = Node(i0).m_rt;
-			vec3d x1 = Node(i1).m_rt;
+			vec3d xi = Node(i).m_rt();
+			vec3d x0 = Node(i0).m_rt();
+			vec3d x1 = Node(i1).m_rt();
 
 			vec3d d = xi - (x0 + x1)*0.5;
 
@@ -328,7 +328,7 @@ void FEDeformableSpringDomain::InternalForces(FEGlobalVector& R)
 			lm[4] = n1.m_ID[m_dofU[1]];
 			lm[5] = n1.m_ID[m_dofU[2]];
 
-			vec3d ei = n1.m_rt - n0.m_rt;
+			vec3d ei = n1.m_rt() - n0.m_rt();
 
 			fe[0] =  eps*ei.x;
 			fe[1] =  eps*ei.y;
@@ -373,10 +373,10 @@ void FEDeformableSpringDomain::StiffnessMatrix(FELinearSystem& LS)
 		FENode& n2 = mesh.Node(el.m_node[1]);
 
 		// get the nodal positions
-		vec3d& r01 = n1.m_r0;
-		vec3d& r02 = n2.m_r0;
-		vec3d& rt1 = n1.m_rt;
-		vec3d& rt2 = n2.m_rt;
+		vec3d& r01 = n1.m_r0();
+		vec3d& r02 = n2.m_r0();
+		vec3d& rt1 = n1.m_rt();
+		vec3d& rt2 = n2.m_rt();
 
 		vec3d e = rt2 - rt1; e.unit();
 
@@ -449,9 +449,9 @@ void FEDeformableSpringDomain::StiffnessMatrix(FELinearSystem& LS)
 			ke[1][1] = -eps; ke[1][4] = 0.5*eps; ke[1][7] = 0.5*eps;
 			ke[2][2] = -eps; ke[2][5] = 0.5*eps; ke[2][8] = 0.5*eps;
 
-			vector<int>& IDi = Node(i).m_ID;
-			vector<int>& ID0 = Node(i0).m_ID;
-			vector<int>& ID1 = Node(i1).m_ID;
+			FENodeArray<int>& IDi = Node(i).m_ID;
+			FENodeArray<int>& ID0 = Node(i0).m_ID;
+			FENodeArray<int>& ID1 = Node(i1).m_ID;
 
 			lmi[0] = IDi[m_dofU[0]];
 			lmi[1] = IDi[m_dofU[1]];
@@ -546,7 +546,7 @@ void FEDeformableSpringDomain2::UnpackLM(FEElement &el, vector<int>& lm)
 	{
 		int n = (i==0? 0 : N-1);
 		FENode& node = Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3 * i    ] = id[m_dofU[0]];
@@ -620,8 +620,8 @@ double FEDeformableSpringDomain2::InitialLength()
 		FENode& n2 = mesh.Node(el.m_node[1]);
 
 		// get the nodal positions
-		vec3d& r1 = n1.m_r0;
-		vec3d& r2 = n2.m_r0;
+		vec3d& r1 = n1.m_r0();
+		vec3d& r2 = n2.m_r0();
 
 		double DL = (r2 - r1).norm();
 		L += DL;
@@ -645,8 +645,8 @@ double FEDeformableSpringDomain2::CurrentLength()
 		FENode& n2 = mesh.Node(el.m_node[1]);
 
 		// get the nodal positions
-		vec3d& r1 = n1.m_rt;
-		vec3d& r2 = n2.m_rt;
+		vec3d& r1 = n1.m_rt();
+		vec3d& r2 = n2.m_rt();
 
 		double DL = (r2 - r1).norm();
 		L += DL;
@@ -686,10 +686,10 @@ void FEDeformableSpringDomain2::InternalForces(FEGlobalVector& R)
 		FENode& n2 = mesh.Node(el.m_node[1]);
 
 		// get the nodal positions
-		vec3d& r01 = n1.m_r0;
-		vec3d& r02 = n2.m_r0;
-		vec3d& rt1 = n1.m_rt;
-		vec3d& rt2 = n2.m_rt;
+		vec3d& r01 = n1.m_r0();
+		vec3d& r02 = n2.m_r0();
+		vec3d& rt1 = n1.m_rt();
+		vec3d& rt2 = n2.m_rt();
 
 		vec3d e = rt2 - rt1; e.unit();
 
@@ -728,10 +728,10 @@ void FEDeformableSpringDomain2::StiffnessMatrix(FELinearSystem& LS)
 	FENode& n2 = Node(NN-1);
 
 	// get the nodal positions
-	vec3d& r01 = n1.m_r0;
-	vec3d& r02 = n2.m_r0;
-	vec3d& rt1 = n1.m_rt;
-	vec3d& rt2 = n2.m_rt;
+	vec3d& r01 = n1.m_r0();
+	vec3d& r02 = n2.m_r0();
+	vec3d& rt1 = n1.m_rt();
+	vec3d& rt2 = n2.m_rt();
 
 	vec3d e = rt2 - rt1; e.unit();
 
@@ -795,8 +795,8 @@ void FEDeformableSpringDomain2::Update(const FETimeInfo& tp)
 void FEDeformableSpringDomain2::SetNodePosition(int node, const vec3d& r)
 {
 	FENode& nd = Node(node);
-	nd.m_rt = r;
-	vec3d u = nd.m_rt - nd.m_r0;
+	nd.m_rt() = r;
+	vec3d u = nd.m_rt() - nd.m_r0();
 	nd.set_vec3d(m_dofU[0], m_dofU[1], m_dofU[2], u);
 }
 
@@ -816,8 +816,8 @@ void FEDeformableSpringDomain2::UpdateNodes()
 	{
 		if (m_nodeData[n1].banchor)
 		{
-			vec3d r0 = Node(n0).m_rt;
-			vec3d r1 = Node(n1).m_rt;
+			vec3d r0 = Node(n0).m_rt();
+			vec3d r1 = Node(n1).m_rt();
 
 			for (int n = n0+1; n<=n1-1; ++n)
 			{
@@ -826,8 +826,8 @@ void FEDeformableSpringDomain2::UpdateNodes()
 				double w = (double) (n - n0) / (double)(n1 - n0);
 
 				FENode& nd = Node(n);
-				nd.m_rt = r0 + (r1 - r0)*w;
-				vec3d u = nd.m_rt - nd.m_r0;
+				nd.m_rt() = r0 + (r1 - r0)*w;
+				vec3d u = nd.m_rt() - nd.m_r0();
 				nd.set_vec3d(m_dofU[0], m_dofU[1], m_dofU[2], u);
 			}
 
@@ -853,9 +853,9 @@ vec3d FEDeformableSpringDomain2::NodalForce(int node)
 	int NN = Nodes();
 	if ((node <= 0) || (node >= NN -1)) return vec3d(0,0,0);
 
-	vec3d r = Node(node).m_rt;
-	vec3d rm = Node(node-1).m_rt;
-	vec3d rp = Node(node+1).m_rt;
+	vec3d r = Node(node).m_rt();
+	vec3d rm = Node(node-1).m_rt();
+	vec3d rp = Node(node+1).m_rt();
 
 	double F = SpringForce();
 
@@ -882,19 +882,19 @@ vec3d FEDeformableSpringDomain2::Tangent(int node)
 	if (NN < 2) return vec3d(0,0,0);
 	if (node == 0)
 	{
-		vec3d t = Node(node+1).m_rt - Node(node).m_rt;
+		vec3d t = Node(node+1).m_rt() - Node(node).m_rt();
 		t.unit();
 		return t;
 	}
 	else if (node == NN-1)
 	{
-		vec3d t = Node(node).m_rt - Node(node - 1).m_rt;
+		vec3d t = Node(node).m_rt() - Node(node - 1).m_rt();
 		t.unit();
 		return t;
 	}
 	else
 	{
-		vec3d t = Node(node + 1).m_rt - Node(node - 1).m_rt;
+		vec3d t = Node(node + 1).m_rt() - Node(node - 1).m_rt();
 		t.unit();
 		return t;
 	}
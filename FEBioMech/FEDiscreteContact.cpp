@@ -55,7 +55,7 @@ BEGIN_FECORE_CLASS(FEDiscreteContact, FESurfaceConstraint)
 	ADD_PARAMETER(m_nsegup , "segup");
 END_FECORE_CLASS();
 
-FEDiscreteContact::FEDiscreteContact(FEModel* pfem) : FESurfaceConstraint(pfem), m_surf(pfem)
+FEDiscreteContact::FEDiscreteContact(FEModel* pfem) : FESurfaceConstraint(pfem), m_surf(pfem), m_cpp(m_surf)
 {
 	m_blaugon = false;
 	m_altol = 0.01;
@@ -117,11 +117,11 @@ void FEDiscreteContact::SetDiscreteSet(FEDiscreteSet* pset)
 
 void FEDiscreteContact::ProjectSurface(bool bsegup)
 {
-	FEClosestPointProjection cpp(m_surf);
+	FEClosestPointProjection& cpp = m_cpp;
 	cpp.SetTolerance(0.01);
 	cpp.SetSearchRadius(0.0);
 	cpp.HandleSpecialCases(true);
-	cpp.Init();
+	cpp.Update();
 
 	// loop over all primary nodes
 	FEMesh& mesh = *m_surf.GetMesh();
@@ -133,7 +133,7 @@ void FEDiscreteContact::ProjectSurface(bool bsegup)
 		FENode& node = mesh.Node(nodeData.nid);
 
 		// get the nodal position
-		vec3d x = node.m_rt;
+		vec3d x = node.m_rt();
 
 		// If the node is in contact, let's see if the node still is 
 		// on the same secondary element
@@ -216,7 +216,7 @@ void FEDiscreteContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 		NODE& nodeData = m_Node[i];
 
 		FENode& node = mesh.Node(nodeData.nid);
-		vector<int>& sLM = node.m_ID;
+		FENodeArray<int>& sLM = node.m_ID;
 
 		FESurfaceElement* pe = nodeData.pe;
 
@@ -299,7 +299,7 @@ void FEDiscreteContact::ContactNodalForce(FEDiscreteContact::NODE& nodeData, FES
 	int ndof = 3*(1 + nmeln);
 
 	// get the secondary element node positions
-	for (int k=0; k<nmeln; ++k) rtm[k] = mesh.Node(mel.m_node[k]).m_rt;
+	for (int k=0; k<nmeln; ++k) rtm[k] = mesh.Node(mel.m_node[k]).m_rt();
 
 	// isoparametric coordinates of the projected primary node
 	// onto the secondary element
@@ -342,7 +342,7 @@ void FEDiscreteContact::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp
 	{
 		NODE& nodeData = m_Node[i];
 
-		vector<int>& sLM = mesh.Node(nodeData.nid).m_ID;
+		FENodeArray<int>& sLM = mesh.Node(nodeData.nid).m_ID;
 
 		// see if this node's constraint is active
 		// that is, if it has a secondary element associated with it
@@ -409,7 +409,7 @@ void FEDiscreteContact::ContactNodalStiffness(FEDiscreteContact::NODE& nodeData,
 
 	// nodal coordinates
 	vec3d rt[MAXMN];
-	for (int j=0; j<nmeln; ++j) rt[j] = mesh.Node(mel.m_node[j]).m_rt;
+	for (int j=0; j<nmeln; ++j) rt[j] = mesh.Node(mel.m_node[j]).m_rt();
 
 	// primary node natural coordinates in secondary element
 	double r = nodeData.proj[0];
@@ -687,7 +687,7 @@ void FEDiscreteContact::BuildMatrixProfile(FEGlobalMatrix& K)
 
 			for (int k=0; k<n; ++k)
 			{
-				vector<int>& id = mesh.Node(en[k]).m_ID;
+				FENodeArray<int>& id = mesh.Node(en[k]).m_ID;
 				lm[6*(k+1)  ] = id[dof_X];
 				lm[6*(k+1)+1] = id[dof_Y];
 				lm[6*(k+1)+2] = id[dof_Z];
@@ -702,7 +702,7 @@ void FEDiscreteContact::BuildMatrixProfile(FEGlobalMatrix& K)
 }
 
 //=============================================================================
-FEDiscreteContact2::FEDiscreteContact2(FEModel* fem) : FESurfaceConstraint(fem), m_surf(fem)
+FEDiscreteContact2::FEDiscreteContact2(FEModel* fem) : FESurfaceConstraint(fem), m_surf(fem), m_cpp(m_surf)
 {
 	m_dom = 0;	
 }
@@ -801,11 +801,11 @@ void FEDiscreteContact2::Update(const FETimeInfo& tp)
 void FEDiscreteContact2::ProjectNodes()
 {
 	// setup closest point projection
-	FEClosestPointProjection cpp(m_surf);
+	FEClosestPointProjection& cpp = m_cpp;
 	cpp.SetTolerance(0.01);
 	cpp.SetSearchRadius(0.0);
 	cpp.HandleSpecialCases(true);
-	cpp.Init();
+	cpp.Update();
 
 	// number of nodes
 	int NN = m_dom->Nodes();
@@ -831,7 +831,7 @@ void FEDiscreteContact2::ProjectNodes()
 			NODE& nodeData = m_nodeData[i];
 				
 			// get nodal position
-			vec3d x = nd.m_rt;
+			vec3d x = nd.m_rt();
 
 			// If the node is in contact, let's see if it remains in contact
 			if (nodeData.pe != 0)
@@ -842,8 +842,8 @@ void FEDiscreteContact2::ProjectNodes()
 				double s = nodeData.proj[1];
 
 				// find the position of neighbors
-				vec3d ra = m_dom->Node(i - 1).m_rt;
-				vec3d rb = m_dom->Node(i + 1).m_rt;
+				vec3d ra = m_dom->Node(i - 1).m_rt();
+				vec3d rb = m_dom->Node(i + 1).m_rt();
 
 				// evaluate center
 				vec3d c = (ra + rb)*0.5;
@@ -29,6 +29,7 @@ SOFTWARE.*/
 #pragma once
 #include <FECore/FESurfaceConstraint.h>
 #include "FEContactSurface.h"
+#include <FECore/FEClosestPointProjection.h>
 #include "FEDeformableSpringDomain.h"
 
 //-----------------------------------------------------------------------------
@@ -83,6 +84,7 @@ protected:
 
 protected:
 	FEDiscreteContactSurface	m_surf;
+	FEClosestPointProjection	m_cpp;
 	vector<NODE>	m_Node;
 	double	m_normg0;
 	bool	m_bfirst;
@@ -131,6 +133,7 @@ protected:
 
 protected:
 	FEDiscreteContactSurface	m_surf;
+	FEClosestPointProjection	m_cpp;
 	FEDeformableSpringDomain2*	m_dom;
 	vector<NODE>	m_nodeData;
 };
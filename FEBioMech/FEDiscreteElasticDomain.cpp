@@ -67,7 +67,7 @@ void FEDiscreteElasticDomain::UnpackLM(FEElement &el, vector<int>& lm)
 	for (int i = 0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3 * i] = id[m_dofU[0]];
@@ -215,16 +215,16 @@ void FEDiscreteElasticDomain::Update(const FETimeInfo& tp)
 		FENode& n2 = mesh.Node(el.m_node[1]);
 
 		// get the nodal positions
-		vec3d& rt1 = n1.m_rt;
-		vec3d& rt2 = n2.m_rt;
+		vec3d& rt1 = n1.m_rt();
+		vec3d& rt2 = n2.m_rt();
 
 		// get the previous nodal positions
-		vec3d rp1 = n1.m_rp;
-		vec3d rp2 = n2.m_rp;
+		vec3d rp1 = n1.m_rp();
+		vec3d rp2 = n2.m_rp();
 
 		// get the initial nodal positions
-		vec3d ri1 = n1.m_r0;
-		vec3d ri2 = n2.m_r0;
+		vec3d ri1 = n1.m_r0();
+		vec3d ri2 = n2.m_r0();
 
 		mp.m_drt = rt2 - rt1;
 		mp.m_drp = rp2 - rp1;
@@ -51,6 +51,8 @@ FEDistanceConstraint::FEDistanceConstraint(FEModel* pfem) : FENLConstraint(pfem)
 	m_blaugon = false;
 	m_node[0] = -1;
 	m_node[1] = -1;
+	m_index[0] = -1;
+	m_index[1] = -1;
 	m_l0 = 0.0;
 	m_Lm = 0.0;
 	m_nminaug = 0;
@@ -67,10 +69,19 @@ bool FEDistanceConstraint::Init()
 	FEMesh& mesh = GetFEModel()->GetMesh();
 	int NN = mesh.Nodes();
 
+	// find the indices of the nodes
+	// (remember, the nodes are defined in the input file by their IDs, which
+	// can differ from the node indices, e.g. when the mesh was reordered)
+	m_index[0] = m_index[1] = -1;
+	for (int i=0; i<NN; ++i)
+	{
+		int nid = mesh.Node(i).GetID();
+		if (nid == m_node[0]) m_index[0] = i;
+		if (nid == m_node[1]) m_index[1] = i;
+	}
+
 	// make sure the nodes are valid
-	// (remember, they are one-based since they are defined in the input file)
-	if ((m_node[0] <= 0)||(m_node[0] > NN)) return false;
-	if ((m_node[1] <= 0)||(m_node[1] > NN)) return false;
+	if ((m_index[0] < 0) || (m_index[1] < 0)) return false;
 
 	return true;
 }
@@ -86,8 +97,8 @@ void FEDistanceConstraint::Activate()
 	int NN = mesh.Nodes();
 
 	// get the initial position of the two nodes
-	vec3d ra = mesh.Node(m_node[0] - 1).m_rt;
-	vec3d rb = mesh.Node(m_node[1] - 1).m_rt;
+	vec3d ra = mesh.Node(m_index[0]).m_rt();
+	vec3d rb = mesh.Node(m_index[1]).m_rt();
 
 	// set the initial length
 	m_l0 = (ra - rb).norm();
@@ -100,12 +111,12 @@ void FEDistanceConstraint::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 	FEMesh& mesh = GetFEModel()->GetMesh();
 
 	// get the two nodes
-	FENode& nodea = mesh.Node(m_node[0] - 1);
-	FENode& nodeb = mesh.Node(m_node[1] - 1);
+	FENode& nodea = mesh.Node(m_index[0]);
+	FENode& nodeb = mesh.Node(m_index[1]);
 
 	// get the current position of the two nodes
-	vec3d ra = nodea.m_rt;
-	vec3d rb = nodeb.m_rt;
+	vec3d ra = nodea.m_rt();
+	vec3d rb = nodeb.m_rt();
 
 	// calculate the force
 	double lt = (ra - rb).norm();
@@ -132,8 +143,8 @@ void FEDistanceConstraint::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 
 	// setup element vector
 	vector<int> en(2);
-	en[0] = m_node[0] - 1;
-	en[1] = m_node[1] - 1;
+	en[0] = m_index[0];
+	en[1] = m_index[1];
 
 	// add element force vector to global force vector
 	R.Assemble(en, lm, fe);
@@ -146,12 +157,12 @@ void FEDistanceConstraint::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 	FEMesh& mesh = GetFEModel()->GetMesh();
 
 	// get the two nodes
-	FENode& nodea = mesh.Node(m_node[0] - 1);
-	FENode& nodeb = mesh.Node(m_node[1] - 1);
+	FENode& nodea = mesh.Node(m_index[0]);
+	FENode& nodeb = mesh.Node(m_index[1]);
 
 	// get the current position of the two nodes
-	vec3d ra = nodea.m_rt;
-	vec3d rb = nodeb.m_rt;
+	vec3d ra = nodea.m_rt();
+	vec3d rb = nodeb.m_rt();
 	vec3d rab = ra - rb;
 
 	// calculate the Lagrange mulitplier
@@ -192,8 +203,8 @@ void FEDistanceConstraint::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 
 	// setup element vector
 	vector<int> en(2);
-	en[0] = m_node[0] - 1;
-	en[1] = m_node[1] - 1;
+	en[0] = m_index[0];
+	en[1] = m_index[1];
 
 	// assemble element matrix in global stiffness matrix
 	ke.SetNodes(en);
@@ -211,12 +222,12 @@ bool FEDistanceConstraint::Augment(int naug, const FETimeInfo& tp)
 	FEMesh& mesh = GetFEModel()->GetMesh();
 
 	// get the two nodes
-	FENode& nodea = mesh.Node(m_node[0] - 1);
-	FENode& nodeb = mesh.Node(m_node[1] - 1);
+	FENode& nodea = mesh.Node(m_index[0]);
+	FENode& nodeb = mesh.Node(m_index[1]);
 
 	// get the current position of the two nodes
-	vec3d ra = nodea.m_rt;
-	vec3d rb = nodeb.m_rt;
+	vec3d ra = nodea.m_rt();
+	vec3d rb = nodeb.m_rt();
 
 	// calculate the Lagrange multipler
 	double l = (ra - rb).norm();
@@ -251,11 +262,11 @@ void FEDistanceConstraint::BuildMatrixProfile(FEGlobalMatrix& M)
 {
 	FEMesh& mesh = GetFEModel()->GetMesh();
 	vector<int> lm(6);
-	FENode& n0 = mesh.Node(m_node[0] - 1);
+	FENode& n0 = mesh.Node(m_index[0]);
 	lm[0] = n0.m_ID[m_dofU[0]];
 	lm[1] = n0.m_ID[m_dofU[1]];
 	lm[2] = n0.m_ID[m_dofU[2]];
-	FENode& n1 = mesh.Node(m_node[1] - 1);
+	FENode& n1 = mesh.Node(m_index[1]);
 	lm[3] = n1.m_ID[m_dofU[0]];
 	lm[4] = n1.m_ID[m_dofU[1]];
 	lm[5] = n1.m_ID[m_dofU[2]];
@@ -266,7 +277,8 @@ void FEDistanceConstraint::BuildMatrixProfile(FEGlobalMatrix& M)
 void FEDistanceConstraint::Serialize(DumpStream& ar)
 {
 	FENLConstraint::Serialize(ar);
-	ar & m_Lm; 
+	ar & m_Lm;
+	ar & m_index[0] & m_index[1];
 }
 
 //-----------------------------------------------------------------------------
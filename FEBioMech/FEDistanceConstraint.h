@@ -56,6 +56,7 @@ public:
 	double	m_atol;		//!< augmented Lagrangian tolerance
 	bool	m_blaugon;	//!< augmentation flag
 	int		m_node[2];	//!< the two nodes that are connected
+	int		m_index[2];	//!< zero-based indices of the two nodes
 	int		m_nminaug;	//!< min number of augmentations
 	int		m_nmaxaug;	//!< max number of augmentations
 
@@ -322,7 +322,7 @@ void FEElasticANSShellDomain::InertialForces(FEGlobalVector& R, vector<double>&
         // get the nodal accelerations
         for (int i=0; i<neln; ++i)
         {
-            at[i] = m_pMesh->Node(el.m_node[i]).m_at;
+            at[i] = m_pMesh->Node(el.m_node[i]).m_at();
             aqt[i] = m_pMesh->Node(el.m_node[i]).get_vec3d(m_dofSA[0], m_dofSA[1], m_dofSA[2]);
         }
         
@@ -867,8 +867,8 @@ void FEElasticANSShellDomain::Update(const FETimeInfo& tp)
         for (int j=0; j<neln; ++j)
         {
             FENode& nj = mesh.Node(el.m_node[j]);
-            r0[j] = nj.m_r0;
-            rt[j] = nj.m_rt;
+            r0[j] = nj.m_r0();
+            rt[j] = nj.m_rt();
         }
         
         // loop over the integration points and calculate
@@ -910,7 +910,7 @@ void FEElasticANSShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
     for (int i=0; i<N; ++i)
     {
         FENode& node = m_pMesh->Node(el.m_node[i]);
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         // first the displacement dofs
         lm[6*i  ] = id[m_dofU[0]];
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FEElasticMaterial.h"
+#include "FEElasticMaterialBatch.h"
 #include "FECore/FEModel.h"
 
 BEGIN_FECORE_CLASS(FEElasticMaterial, FESolidMaterial)
@@ -49,6 +50,18 @@ FEElasticMaterial::~FEElasticMaterial()
 //! return the strain energy density
 double FEElasticMaterial::StrainEnergyDensity(FEMaterialPoint& pt) { return 0; }
 
+//-----------------------------------------------------------------------------
+void FEElasticMaterial::StressBatch(FEElasticMaterialBatch& batch)
+{
+	for (int i = 0; i < batch.Points(); ++i) batch.SetStress(i, Stress(batch.MaterialPoint(i)));
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterial::TangentBatch(FEElasticMaterialBatch& batch)
+{
+	for (int i = 0; i < batch.Points(); ++i) batch.SetTangent(i, Tangent(batch.MaterialPoint(i)));
+}
+
 //-----------------------------------------------------------------------------
 FEElasticStress::FEElasticStress() : FEDomainParameter("stress")
 {
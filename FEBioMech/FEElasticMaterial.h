@@ -30,6 +30,8 @@ SOFTWARE.*/
 #include "FESolidMaterial.h"
 #include "FEElasticMaterialPoint.h"
 
+class FEElasticMaterialBatch;
+
 //-----------------------------------------------------------------------------
 //! Base class for (hyper-)elastic materials
 
@@ -51,6 +53,19 @@ public:
     // get the elastic material
     virtual FEElasticMaterial* GetElasticMaterial() { return this; }
 
+public:
+	//! Returns true if the material implements a dedicated batch evaluation.
+	//! (Domains only use the batch functions if this returns true.)
+	virtual bool HasBatchEvaluation() const { return false; }
+
+	//! Calculate the Cauchy stress at all points of the batch. The default
+	//! implementation calls Stress for each point.
+	virtual void StressBatch(FEElasticMaterialBatch& batch);
+
+	//! Calculate the spatial tangent at all points of the batch. The default
+	//! implementation calls Tangent for each point.
+	virtual void TangentBatch(FEElasticMaterialBatch& batch);
+
 protected:
 	DECLARE_FECORE_CLASS();
 };
@@ -0,0 +1,232 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#include "stdafx.h"
+#include "FEElasticMaterialBatch.h"
+#include "FEElasticMaterialPoint.h"
+
+//-----------------------------------------------------------------------------
+// Voigt index pairs and the inverse map
+static const int VI[6] = { 0, 1, 2, 0, 1, 0 };
+static const int VJ[6] = { 0, 1, 2, 1, 2, 2 };
+static const int VM[3][3] = { { 0, 3, 5 },{ 3, 1, 4 },{ 5, 4, 2 } };
+
+// index into the tens4ds storage for Voigt components I <= J
+inline int tens4ds_index(int I, int J) { return J*(J + 1) / 2 + I; }
+
+//-----------------------------------------------------------------------------
+FEElasticMaterialBatch::FEElasticMaterialBatch()
+{
+	m_npts = 0;
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::Gather(FEElement& el)
+{
+	FEMaterialPoint* mp[MAX_POINTS];
+	int nint = el.GaussPoints();
+	assert(nint <= MAX_POINTS);
+	for (int i = 0; i < nint; ++i) mp[i] = el.GetMaterialPoint(i);
+	Gather(mp, nint);
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::Gather(FEMaterialPoint** mp, int npts)
+{
+	assert(npts <= MAX_POINTS);
+	m_npts = npts;
+	for (int i = 0; i < npts; ++i)
+	{
+		m_mp[i] = mp[i];
+		FEElasticMaterialPoint& pt = *mp[i]->ExtractData<FEElasticMaterialPoint>();
+
+		const mat3d& Fi = pt.m_F;
+		F[0][i] = Fi(0, 0); F[1][i] = Fi(0, 1); F[2][i] = Fi(0, 2);
+		F[3][i] = Fi(1, 0); F[4][i] = Fi(1, 1); F[5][i] = Fi(1, 2);
+		F[6][i] = Fi(2, 0); F[7][i] = Fi(2, 1); F[8][i] = Fi(2, 2);
+		J[i] = pt.m_J;
+
+		SetStress(i, pt.m_s);
+	}
+
+	// left Cauchy-Green tensor b = F*Ft
+	for (int i = 0; i < npts; ++i)
+	{
+		b[0][i] = F[0][i]*F[0][i] + F[1][i]*F[1][i] + F[2][i]*F[2][i];
+		b[1][i] = F[3][i]*F[3][i] + F[4][i]*F[4][i] + F[5][i]*F[5][i];
+		b[2][i] = F[6][i]*F[6][i] + F[7][i]*F[7][i] + F[8][i]*F[8][i];
+		b[3][i] = F[0][i]*F[3][i] + F[1][i]*F[4][i] + F[2][i]*F[5][i];
+		b[4][i] = F[3][i]*F[6][i] + F[4][i]*F[7][i] + F[5][i]*F[8][i];
+		b[5][i] = F[0][i]*F[6][i] + F[1][i]*F[7][i] + F[2][i]*F[8][i];
+	}
+}
+
+//-----------------------------------------------------------------------------
+mat3ds FEElasticMaterialBatch::Stress(int i) const
+{
+	return mat3ds(s[0][i], s[1][i], s[2][i], s[3][i], s[4][i], s[5][i]);
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::SetStress(int i, const mat3ds& si)
+{
+	s[0][i] = si.xx(); s[1][i] = si.yy(); s[2][i] = si.zz();
+	s[3][i] = si.xy(); s[4][i] = si.yz(); s[5][i] = si.xz();
+}
+
+//-----------------------------------------------------------------------------
+tens4ds FEElasticMaterialBatch::Tangent(int i) const
+{
+	tens4ds t;
+	for (int k = 0; k < tens4ds::NNZ; ++k) t.d[k] = c[k][i];
+	return t;
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::SetTangent(int i, const tens4ds& t)
+{
+	for (int k = 0; k < tens4ds::NNZ; ++k) c[k][i] = t.d[k];
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::Square(int n, const double a[][MAX_POINTS], double a2[][MAX_POINTS])
+{
+	for (int I = 0; I < 6; ++I)
+	{
+		const int i = VI[I], j = VJ[I];
+		const double* a0 = a[VM[i][0]]; const double* b0 = a[VM[0][j]];
+		const double* a1 = a[VM[i][1]]; const double* b1 = a[VM[1][j]];
+		const double* a2i = a[VM[i][2]]; const double* b2 = a[VM[2][j]];
+		double* r = a2[I];
+		for (int k = 0; k < n; ++k) r[k] = a0[k]*b0[k] + a1[k]*b1[k] + a2i[k]*b2[k];
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::Trace(int n, const double a[][MAX_POINTS], double* tr)
+{
+	for (int k = 0; k < n; ++k) tr[k] = a[0][k] + a[1][k] + a[2][k];
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::Det(int n, const double a[][MAX_POINTS], double* d)
+{
+	const double* xx = a[0]; const double* yy = a[1]; const double* zz = a[2];
+	const double* xy = a[3]; const double* yz = a[4]; const double* xz = a[5];
+	for (int k = 0; k < n; ++k)
+	{
+		d[k] = xx[k]*(yy[k]*zz[k] - yz[k]*yz[k])
+			 - xy[k]*(xy[k]*zz[k] - yz[k]*xz[k])
+			 + xz[k]*(xy[k]*yz[k] - yy[k]*xz[k]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::ZeroTangent()
+{
+	for (int l = 0; l < tens4ds::NNZ; ++l)
+	{
+		double* cl = c[l];
+		for (int k = 0; k < m_npts; ++k) cl[k] = 0.0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// (a dyad1s a)_ijkl = a_ij a_kl
+void FEElasticMaterialBatch::AddDyad1s(const double* alpha, const double a[][MAX_POINTS])
+{
+	const int n = m_npts;
+	for (int J = 0; J < 6; ++J)
+		for (int I = 0; I <= J; ++I)
+		{
+			double* cl = c[tens4ds_index(I, J)];
+			const double* aI = a[I];
+			const double* aJ = a[J];
+			for (int k = 0; k < n; ++k) cl[k] += alpha[k]*aI[k]*aJ[k];
+		}
+}
+
+//-----------------------------------------------------------------------------
+// (a dyad1s I)_ijkl = a_ij d_kl + d_ij a_kl
+void FEElasticMaterialBatch::AddDyad1sI(const double* alpha, const double a[][MAX_POINTS])
+{
+	const int n = m_npts;
+	for (int J = 0; J < 6; ++J)
+		for (int I = 0; I <= J; ++I)
+		{
+			double* cl = c[tens4ds_index(I, J)];
+			const double* aI = a[I];
+			const double* aJ = a[J];
+			// note that I <= J
+			if (J < 3) for (int k = 0; k < n; ++k) cl[k] += alpha[k]*(aI[k] + aJ[k]);
+			else if (I < 3) for (int k = 0; k < n; ++k) cl[k] += alpha[k]*aJ[k];
+		}
+}
+
+//-----------------------------------------------------------------------------
+// (a dyad4s a)_ijkl = (a_ik a_jl + a_il a_jk)/2
+void FEElasticMaterialBatch::AddDyad4s(const double* alpha, const double a[][MAX_POINTS])
+{
+	const int n = m_npts;
+	for (int J = 0; J < 6; ++J)
+		for (int I = 0; I <= J; ++I)
+		{
+			const int i = VI[I], j = VJ[I];
+			const int k = VI[J], l = VJ[J];
+			double* cl = c[tens4ds_index(I, J)];
+			const double* aik = a[VM[i][k]]; const double* ajl = a[VM[j][l]];
+			const double* ail = a[VM[i][l]]; const double* ajk = a[VM[j][k]];
+			for (int m = 0; m < n; ++m) cl[m] += 0.5*alpha[m]*(aik[m]*ajl[m] + ail[m]*ajk[m]);
+		}
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::AddIxI(const double* alpha)
+{
+	const int n = m_npts;
+	for (int J = 0; J < 3; ++J)
+		for (int I = 0; I <= J; ++I)
+		{
+			double* cl = c[tens4ds_index(I, J)];
+			for (int k = 0; k < n; ++k) cl[k] += alpha[k];
+		}
+}
+
+//-----------------------------------------------------------------------------
+void FEElasticMaterialBatch::AddI4(const double* alpha)
+{
+	const int n = m_npts;
+	for (int I = 0; I < 6; ++I)
+	{
+		double* cl = c[tens4ds_index(I, I)];
+		double f = (I < 3 ? 1.0 : 0.5);
+		for (int k = 0; k < n; ++k) cl[k] += f*alpha[k];
+	}
+}
@@ -0,0 +1,115 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#pragma once
+#include <FECore/FEElement.h>
+#include <FECore/tens4d.h>
+#include "febiomech_api.h"
+
+//-----------------------------------------------------------------------------
+//! Structure-of-arrays storage for evaluating an elastic material at a batch of
+//! material points (usually the integration points of an element) in one call.
+//! Each tensor component is stored in its own contiguous array, so that the 
+//! material can evaluate all points with simple loops that the compiler vectorizes.
+//!
+//! Symmetric 2nd-order tensors are stored in Voigt order (xx, yy, zz, xy, yz, xz).
+//! The 4th-order tangent uses the component layout of tens4ds.
+class FEBIOMECH_API FEElasticMaterialBatch
+{
+public:
+	enum { MAX_POINTS = FEElement::MAX_INTPOINTS };
+
+public:
+	FEElasticMaterialBatch();
+
+	//! load the kinematics (and current stress) of the element's integration points
+	void Gather(FEElement& el);
+
+	//! load the kinematics (and current stress) of a list of material points
+	void Gather(FEMaterialPoint** mp, int npts);
+
+	//! nr of points in the batch
+	int Points() const { return m_npts; }
+
+	//! get the material point of a batch entry
+	FEMaterialPoint& MaterialPoint(int i) { return *m_mp[i]; }
+
+	//! return the stress of point i
+	mat3ds Stress(int i) const;
+
+	//! set the stress of point i
+	void SetStress(int i, const mat3ds& s);
+
+	//! return the tangent of point i
+	tens4ds Tangent(int i) const;
+
+	//! set the tangent of point i
+	void SetTangent(int i, const tens4ds& c);
+
+public: // helper functions for SoA tensor algebra (n is the nr of points)
+
+	//! a2 = a*a
+	static void Square(int n, const double a[][MAX_POINTS], double a2[][MAX_POINTS]);
+
+	//! tr = trace(a)
+	static void Trace(int n, const double a[][MAX_POINTS], double* tr);
+
+	//! d = det(a)
+	static void Det(int n, const double a[][MAX_POINTS], double* d);
+
+	//! set the tangent to zero
+	void ZeroTangent();
+
+	//! c += alpha*(a dyad1s a)
+	void AddDyad1s(const double* alpha, const double a[][MAX_POINTS]);
+
+	//! c += alpha*(a dyad1s I)
+	void AddDyad1sI(const double* alpha, const double a[][MAX_POINTS]);
+
+	//! c += alpha*(a dyad4s a)
+	void AddDyad4s(const double* alpha, const double a[][MAX_POINTS]);
+
+	//! c += alpha*(I dyad1s I)
+	void AddIxI(const double* alpha);
+
+	//! c += alpha*(I dyad4s I)
+	void AddI4(const double* alpha);
+
+public:
+	double	F[9][MAX_POINTS];	//!< deformation gradient (row major)
+	double	J[MAX_POINTS];		//!< determinant of deformation gradient
+	double	b[6][MAX_POINTS];	//!< left Cauchy-Green tensor
+	double	s[6][MAX_POINTS];	//!< Cauchy stress
+	double	c[21][MAX_POINTS];	//!< spatial elasticity tensor
+
+private:
+	int					m_npts;
+	FEMaterialPoint*	m_mp[MAX_POINTS];
+};
@@ -63,8 +63,8 @@ bool FEElasticMultiscaleDomain2O::Init()
 		int neln = el.Nodes();
 		for (int j=0; j<neln; ++j)
 		{
-			x0[j] = m.Node(el.m_node[j]).m_r0;
-			xt[j] = m.Node(el.m_node[j]).m_rt;
+			x0[j] = m.Node(el.m_node[j]).m_r0();
+			xt[j] = m.Node(el.m_node[j]).m_rt();
 		}
 
 		int n = el.GaussPoints();
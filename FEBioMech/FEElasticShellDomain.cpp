@@ -149,10 +149,7 @@ void FEElasticShellDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
 // Calculates the forces due to the stress
 void FEElasticShellDomain::InternalForces(FEGlobalVector& R)
 {
-    int NS = (int)m_Elem.size();
-#pragma omp parallel for shared (NS)
-    for (int i=0; i<NS; ++i)
-    {
+    ParallelAssemble(R, [&](int i) {
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -172,7 +169,7 @@ void FEElasticShellDomain::InternalForces(FEGlobalVector& R)
         
         // assemble the residual
         R.Assemble(el.m_node, lm, fe, true);
-    }
+    });
 }
 
 //-----------------------------------------------------------------------------
@@ -446,6 +443,9 @@ void FEElasticShellDomain::StiffnessMatrix(FELinearSystem& LS)
 #pragma omp parallel for shared (NS)
     for (int iel=0; iel<NS; ++iel)
     {
+		// skip elements that are excluded from the assembly
+		if (AssembleElement(iel) == false) continue;
+
 		FEShellElement& el = m_Elem[iel];
         
         // create the element's stiffness matrix
@@ -823,9 +823,9 @@ void FEElasticShellDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
         for (int j=0; j<neln; ++j)
         {
             FENode& node = m_pMesh->Node(el.m_node[j]);
-            v[j] = node.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2])*m_alphaf + node.m_vp*(1-m_alphaf);
+            v[j] = node.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2])*m_alphaf + node.m_vp()*(1-m_alphaf);
             w[j] = node.get_vec3d(m_dofSV[0], m_dofSV[1], m_dofSV[2])*m_alphaf + node.get_vec3d_prev(m_dofSV[0], m_dofSV[1], m_dofSV[2])*(1-m_alphaf);
-            a[j] = node.m_at*m_alpham + node.m_ap*(1-m_alpham);
+            a[j] = node.m_at()*m_alpham + node.m_ap()*(1-m_alpham);
             b[j] = node.get_vec3d(m_dofSA[0], m_dofSA[1], m_dofSA[2])*m_alpham + node.get_vec3d_prev(m_dofSA[0], m_dofSA[1], m_dofSA[2])*(1-m_alpham);
         }
     }
@@ -896,7 +896,7 @@ void FEElasticShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
 	for (int i=0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[6*i  ] = id[m_dofU[0]];
@@ -145,7 +145,7 @@ void FEElasticShellDomainOld::CoBaseVectors0(FEShellElementOld& el, int n, vec3d
 	for (i = 0; i<neln; ++i)
 	{
 		FENode& ni = m_pMesh->Node(el.m_node[i]);
-		r[i] = ni.m_r0;
+		r[i] = ni.m_r0();
 		D[i] = el.m_D0[i];
 	}
 
@@ -243,7 +243,7 @@ void FEElasticShellDomainOld::CoBaseVectors(FEShellElementOld& el, int n, vec3d
     for (i=0; i<neln; ++i)
     {
         FENode& ni = m_pMesh->Node(el.m_node[i]);
-        r[i] = ni.m_rt;
+        r[i] = ni.m_rt();
         D[i] = el.m_D0[i] + ni.get_vec3d(m_dofSR[0], m_dofSR[1], m_dofSR[2]);
     }
     
@@ -743,8 +743,8 @@ void FEElasticShellDomainOld::Update(const FETimeInfo& tp)
 		// nodal coordinates
 		for (int j=0; j<neln; ++j)
 		{
-			r0[j] = mesh.Node(el.m_node[j]).m_r0;
-			rt[j] = mesh.Node(el.m_node[j]).m_rt;
+			r0[j] = mesh.Node(el.m_node[j]).m_r0();
+			rt[j] = mesh.Node(el.m_node[j]).m_rt();
 		}
 
 		// update shell thickness
@@ -793,7 +793,7 @@ void FEElasticShellDomainOld::UnpackLM(FEElement& el, vector<int>& lm)
 	for (int i=0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[6*i  ] = id[m_dofSU[0]];
@@ -29,6 +29,7 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "FEElasticSolidDomain.h"
 #include "FEElasticMaterial.h"
+#include "FEElasticMaterialBatch.h"
 #include "FEBodyForce.h"
 #include "FECore/log.h"
 #include <FECore/FEModel.h>
@@ -36,6 +37,7 @@ SOFTWARE.*/
 #include <FECore/sys.h>
 #include "FEBioMech.h"
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEScratchArena.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -44,6 +46,7 @@ SOFTWARE.*/
 FEElasticSolidDomain::FEElasticSolidDomain(FEModel* pfem) : FESolidDomain(pfem), FEElasticDomain(pfem), m_dofU(pfem), m_dofR(pfem), m_dofSU(pfem), m_dofV(pfem), m_dofSV(pfem), m_dofSA(pfem), m_dof(pfem)
 {
 	m_pMat = 0;
+	m_pBatchMat = 0;
     m_alphaf = m_beta = 1;
     m_alpham = 2;
 	m_update_dynamic = true; // default for backward compatibility
@@ -89,8 +92,12 @@ void FEElasticSolidDomain::SetMaterial(FEMaterial* pmat)
 	{
 		m_pMat = dynamic_cast<FESolidMaterial*>(pmat);
 		assert(m_pMat);
+
+		// see if we can evaluate all integration points of an element at once
+		FEElasticMaterial* pme = dynamic_cast<FEElasticMaterial*>(pmat);
+		m_pBatchMat = (pme && pme->HasBatchEvaluation() ? pme : 0);
 	}
-	else m_pMat = 0;
+	else m_pMat = m_pBatchMat = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -156,21 +163,19 @@ void FEElasticSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
 //-----------------------------------------------------------------------------
 void FEElasticSolidDomain::InternalForces(FEGlobalVector& R)
 {
-	int NE = Elements();
-	#pragma omp parallel for shared (NE)
-	for (int i=0; i<NE; ++i)
-	{
+	ParallelAssemble(R, [&](int i) {
 		// get the element
 		FESolidElement& el = m_Elem[i];
 
 		if (el.isActive()) {
-			// element force vector
-			vector<double> fe;
-			vector<int> lm;
+			// use the thread's scratch arena for the element data
+			FEScratchArena& arena = FEScratchArena::ThreadArena();
+			arena.Reset();
 
 			// get the element force vector and initialize it to zero
 			int ndof = 3 * el.Nodes();
-			fe.assign(ndof, 0);
+			vector<double>& fe = arena.ElementVector(ndof);
+			vector<int>& lm = arena.LM();
 
 			// calculate internal force vector
 			ElementInternalForce(el, fe);
@@ -181,7 +186,7 @@ void FEElasticSolidDomain::InternalForces(FEGlobalVector& R)
 			// assemble element 'fe'-vector into global R vector
 			R.Assemble(el.m_node, lm, fe);
 		}
-	}
+	});
 }
 
 //-----------------------------------------------------------------------------
@@ -336,6 +341,15 @@ void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &
 	// weights at gauss points
 	const double *gw = el.GaussWeights();
 
+	// evaluate the tangents of all integration points at once
+	bool batchTangent = (m_pBatchMat && !m_pMat->m_secant);
+	FEElasticMaterialBatch batch;
+	if (batchTangent)
+	{
+		batch.Gather(el);
+		m_pBatchMat->TangentBatch(batch);
+	}
+
 	// calculate element stiffness matrix
 	for (int n=0; n<nint; ++n)
 	{
@@ -347,9 +361,17 @@ void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
 
 		// get the 'D' matrix
-//		tens4ds C = m_pMat->Tangent(mp);
-        tens4dmm C = m_pMat->m_secant ? m_pMat->SecantTangent(mp) : m_pMat->Tangent(mp);
-		C.extract(D);
+		if (batchTangent)
+		{
+			tens4ds C = batch.Tangent(n);
+			C.extract(D);
+		}
+		else
+		{
+//			tens4ds C = m_pMat->Tangent(mp);
+			tens4dmm C = m_pMat->m_secant ? m_pMat->SecantTangent(mp) : m_pMat->Tangent(mp);
+			C.extract(D);
+		}
 
 		// we only calculate the upper triangular part
 		// since ke is symmetric. The other part is
@@ -418,20 +440,22 @@ void FEElasticSolidDomain::StiffnessMatrix(FELinearSystem& LS)
 	{
 		FESolidElement& el = m_Elem[iel];
 
-		if (el.isActive()) {
-
-			// get the element's LM vector
-			vector<int> lm;
-			UnpackLM(el, lm);
+		if (el.isActive() && AssembleElement(iel)) {
 
-			// element stiffness matrix
-			FEElementMatrix ke(el, lm);
+			// use the thread's scratch arena for the element data
+			FEScratchArena& arena = FEScratchArena::ThreadArena();
+			arena.Reset();
 
 			// create the element's stiffness matrix
 			int ndof = 3 * el.Nodes();
-			ke.resize(ndof, ndof);
+			FEElementMatrix& ke = arena.ElementMatrix(el, ndof, ndof);
 			ke.zero();
 
+			// get the element's LM vector
+			vector<int>& lm = arena.LM();
+			UnpackLM(el, lm);
+			ke.SetIndices(lm);
+
 			// calculate geometrical stiffness
 			ElementGeometricalStiffness(el, ke);
 
@@ -597,11 +621,15 @@ void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
 		for (int j = 0; j<neln; ++j)
 		{
 			FENode& node = m_pMesh->Node(el.m_node[j]);
-			v[j] = node.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2])*m_alphaf + node.m_vp*(1 - m_alphaf);
-			a[j] = node.m_at*m_alpham + node.m_ap*(1 - m_alpham);
+			v[j] = node.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2])*m_alphaf + node.m_vp()*(1 - m_alphaf);
+			a[j] = node.m_at()*m_alpham + node.m_ap()*(1 - m_alpham);
 		}
 	}
 
+	// the stresses of all integration points can be evaluated at once after
+	// the kinematics are updated, unless the energy-conserving adjustment needs them
+	bool batchStress = (m_pBatchMat && (m_alphaf != 0.5));
+
 	// loop over the integration points and calculate
 	// the stress at the integration point
 	for (int n=0; n<nint; ++n)
@@ -639,6 +667,8 @@ void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
 
         // update specialized material points
         m_pMat->UpdateSpecializedMaterialPoints(mp, tp);
+
+		if (batchStress) continue;
         
 		// calculate the stress at this material point
         pt.m_s = m_pMat->Stress(mp);
@@ -661,6 +691,19 @@ void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
                 pt.m_s += D*(((pt.m_Wt-pt.m_Wp)/(dt*pt.m_J) - pt.m_s.dotdot(D))/D2);
         }
     }
+
+	// calculate the stresses at all material points
+	if (batchStress)
+	{
+		FEElasticMaterialBatch batch;
+		batch.Gather(el);
+		m_pBatchMat->StressBatch(batch);
+		for (int n = 0; n < nint; ++n)
+		{
+			FEElasticMaterialPoint& pt = *(el.GetMaterialPoint(n)->ExtractData<FEElasticMaterialPoint>());
+			pt.m_s = batch.Stress(n);
+		}
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -672,7 +715,7 @@ void FEElasticSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
 	for (int i=0; i<N; ++i)
 	{
 		FENode& node = m_pMesh->Node(el.m_node[i]);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3*i  ] = id[m_dofU[0]];
@@ -691,7 +734,7 @@ void FEElasticSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            FENodeArray<int>& id = node.m_ID;
             
             // first the displacement dofs
             lm[3*i  ] = id[m_dofSU[0]];
@@ -712,13 +755,14 @@ void FEElasticSolidDomain::InertialForces(FEGlobalVector& R, vector<double>& F)
 		FESolidElement& el = m_Elem[i];
 
 		if (el.isActive()) {
-			// element force vector
-			vector<double> fe;
-			vector<int> lm;
+			// use the thread's scratch arena for the element data
+			FEScratchArena& arena = FEScratchArena::ThreadArena();
+			arena.Reset();
 
 			// get the element force vector and initialize it to zero
 			int ndof = 3 * el.Nodes();
-			fe.assign(ndof, 0);
+			vector<double>& fe = arena.ElementVector(ndof);
+			vector<int>& lm = arena.LM();
 
 			// calculate internal force vector
 			ElementInertialForce(el, fe);
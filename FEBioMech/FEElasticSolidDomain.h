@@ -32,6 +32,8 @@ SOFTWARE.*/
 #include "FESolidMaterial.h"
 #include <FECore/FEDofList.h>
 
+class FEElasticMaterial;
+
 //-----------------------------------------------------------------------------
 //! domain described by Lagrange-type 3D volumetric elements
 //!
@@ -132,4 +134,5 @@ protected:
 	FEDofList	m_dof;		// total dof list
 
 	FESolidMaterial*	m_pMat;
+	FEElasticMaterial*	m_pBatchMat;	//!< set when the material supports batch evaluation
 };
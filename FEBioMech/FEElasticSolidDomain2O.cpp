@@ -247,8 +247,8 @@ bool FEElasticSolidDomain2O::FEInternalSurface2O::Initialize(FEElasticSolidDomai
 			FESolidElement& eb = static_cast<FESolidElement&>(*face.m_elem[1]);
 			vec3d xa[FEElement::MAX_NODES];
 			vec3d xb[FEElement::MAX_NODES];
-			for (int a=0; a<ea.Nodes(); a++) xa[a] = mesh.Node(ea.m_node[a]).m_r0;
-			for (int b=0; b<eb.Nodes(); b++) xb[b] = mesh.Node(eb.m_node[b]).m_r0;
+			for (int a=0; a<ea.Nodes(); a++) xa[a] = mesh.Node(ea.m_node[a]).m_r0();
+			for (int b=0; b<eb.Nodes(); b++) xb[b] = mesh.Node(eb.m_node[b]).m_r0();
 			vec3d ksia = m_data[nnf].ksi[0];
 			vec3d ksib = m_data[nnf].ksi[1];
 
@@ -267,8 +267,8 @@ bool FEElasticSolidDomain2O::FEInternalSurface2O::Initialize(FEElasticSolidDomai
 	{
 		FESurfaceElement& el = m_ps->Element(i);
 		int neln = el.Nodes();
-		FEBoundingBox box(mesh.Node(el.m_node[0]).m_r0);
-		for (int j=1; j<neln; ++j) box.add(mesh.Node(el.m_node[j]).m_r0);
+		FEBoundingBox box(mesh.Node(el.m_node[0]).m_r0());
+		for (int j=1; j<neln; ++j) box.add(mesh.Node(el.m_node[j]).m_r0());
 
 		double R = 0.5*box.radius();
 		if (R > m_h) m_h = R;
@@ -325,14 +325,14 @@ void FEElasticSolidDomain2O::BuildMatrixProfile(FEGlobalMatrix& M)
 		lm.resize(ndof);
 		for (int i=0; i<nelna; ++i)
 		{
-			vector<int>& id = mesh.Node(ela.m_node[i]).m_ID;
+			FENodeArray<int>& id = mesh.Node(ela.m_node[i]).m_ID;
 			lm[3*i  ] = id[0];
 			lm[3*i+1] = id[1];
 			lm[3*i+2] = id[2];
 		}
 		for (int i=0; i<nelnb; ++i)
 		{
-			vector<int>& id = mesh.Node(elb.m_node[i]).m_ID;
+			FENodeArray<int>& id = mesh.Node(elb.m_node[i]).m_ID;
 			lm[3*(nelna+i)  ] = id[0];
 			lm[3*(nelna+i)+1] = id[1];
 			lm[3*(nelna+i)+2] = id[2];
@@ -409,7 +409,7 @@ void FEElasticSolidDomain2O::UpdateKinematics()
 			for (int j=0; j<neln; ++j)
 			{
 				FENode& node = mesh.Node(el.m_node[j]);
-				ut[j] = node.m_rt - node.m_r0;
+				ut[j] = node.m_rt() - node.m_r0();
 			}
 
 			// loop over all integration points
@@ -522,8 +522,8 @@ void FEElasticSolidDomain2O::UpdateElementStress(int iel, const FETimeInfo& tp)
 	vec3d rt[FEElement::MAX_NODES];
 	for (int j=0; j<neln; ++j)
 	{
-		r0[j] = m_pMesh->Node(el.m_node[j]).m_r0;
-		rt[j] = m_pMesh->Node(el.m_node[j]).m_rt;
+		r0[j] = m_pMesh->Node(el.m_node[j]).m_r0();
+		rt[j] = m_pMesh->Node(el.m_node[j]).m_rt();
 	}
 
 	// get the integration weights
@@ -701,7 +701,7 @@ void FEElasticSolidDomain2O::InternalForcesDG2(FEGlobalVector& R)
 			int neln = el.Nodes();
 
 			// get the initial nodal positions
-			for (int j=0; j<neln; ++j) X[j] = mesh.Node(el.m_node[j]).m_r0;
+			for (int j=0; j<neln; ++j) X[j] = mesh.Node(el.m_node[j]).m_r0();
 
 			// allocate force vector
 			int ndof = neln*3;
@@ -968,7 +968,7 @@ void FEElasticSolidDomain2O::ElementInternalForce_QG(FESolidElement& el, vector<
 	vec3d X[FEElement::MAX_NODES];
 	FEMesh& mesh = *GetMesh();
 	int neln = el.Nodes();
-	for (int i=0; i<neln; ++i) X[i] = mesh.Node(el.m_node[i]).m_r0;
+	for (int i=0; i<neln; ++i) X[i] = mesh.Node(el.m_node[i]).m_r0();
 
 	mat3d H[FEElement::MAX_NODES];
 
@@ -1092,14 +1092,14 @@ void FEElasticSolidDomain2O::StiffnessMatrixDG(FELinearSystem& LS)
 		lm.resize(ndof);
 		for (int i=0; i<nelna; ++i)
 		{
-			vector<int>& id = mesh.Node(ela.m_node[i]).m_ID;
+			FENodeArray<int>& id = mesh.Node(ela.m_node[i]).m_ID;
 			lm[3*i  ] = id[0];
 			lm[3*i+1] = id[1];
 			lm[3*i+2] = id[2];
 		}
 		for (int i=0; i<nelnb; ++i)
 		{
-			vector<int>& id = mesh.Node(elb.m_node[i]).m_ID;
+			FENodeArray<int>& id = mesh.Node(elb.m_node[i]).m_ID;
 			lm[3*(nelna+i)  ] = id[0];
 			lm[3*(nelna+i)+1] = id[1];
 			lm[3*(nelna+i)+2] = id[2];
@@ -1140,8 +1140,8 @@ void FEElasticSolidDomain2O::ElementStiffnessMatrixDG1(FESurfaceElement& face, F
 	// nodal coordinates
 	vec3d Xa[FEElement::MAX_NODES];
 	vec3d Xb[FEElement::MAX_NODES];
-	for (int i=0; i<nelna; ++i) Xa[i] = mesh.Node(ela.m_node[i]).m_r0;
-	for (int i=0; i<nelnb; ++i) Xb[i] = mesh.Node(elb.m_node[i]).m_r0;
+	for (int i=0; i<nelna; ++i) Xa[i] = mesh.Node(ela.m_node[i]).m_r0();
+	for (int i=0; i<nelnb; ++i) Xb[i] = mesh.Node(elb.m_node[i]).m_r0();
 
 	// shape function derivatives
 	vec3d Ga[FEElement::MAX_NODES];
@@ -1366,8 +1366,8 @@ void FEElasticSolidDomain2O::ElementStiffnessMatrixDG2(FESurfaceElement& face, F
 	// nodal coordinates
 	vec3d Xa[FEElement::MAX_NODES];
 	vec3d Xb[FEElement::MAX_NODES];
-	for (int i=0; i<nelna; ++i) Xa[i] = mesh.Node(ela.m_node[i]).m_r0;
-	for (int i=0; i<nelnb; ++i) Xb[i] = mesh.Node(elb.m_node[i]).m_r0;
+	for (int i=0; i<nelna; ++i) Xa[i] = mesh.Node(ela.m_node[i]).m_r0();
+	for (int i=0; i<nelnb; ++i) Xb[i] = mesh.Node(elb.m_node[i]).m_r0();
 
 	// loop over all integration points
 	int nint = face.GaussPoints();
@@ -1878,8 +1878,8 @@ void FEElasticSolidDomain2O::defhess(FESolidElement &el, int n, tens3drs &G)
 	FEMesh& mesh = *GetMesh();
 	for (int i=0; i<neln; ++i)
 	{
-		X[i] = mesh.Node(el.m_node[i]).m_r0;
-		x[i] = mesh.Node(el.m_node[i]).m_rt;
+		X[i] = mesh.Node(el.m_node[i]).m_r0();
+		x[i] = mesh.Node(el.m_node[i]).m_rt();
 	}
 
 	mat3d H[FEElement::MAX_NODES];
@@ -1917,8 +1917,8 @@ void FEElasticSolidDomain2O::defhess(FESolidElement &el, double r, double s, dou
 	FEMesh& mesh = *GetMesh();
 	for (int i=0; i<neln; ++i)
 	{
-		X[i] = mesh.Node(el.m_node[i]).m_r0;
-		x[i] = mesh.Node(el.m_node[i]).m_rt;
+		X[i] = mesh.Node(el.m_node[i]).m_r0();
+		x[i] = mesh.Node(el.m_node[i]).m_rt();
 	}
 
 	mat3d H[FEElement::MAX_NODES];
@@ -138,8 +138,8 @@ void FEElasticTrussDomain::ElementStiffness(int iel, matrix& ke)
 	vec3d r0[2], rt[2];
 	for (int i=0; i<2; ++i)
 	{
-		r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
-		rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+		r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
+		rt[i] = m_pMesh->Node(el.m_node[i]).m_rt();
 	}
 
 	// intial length
@@ -216,8 +216,8 @@ void FEElasticTrussDomain::ElementInternalForces(FETrussElement& el, vector<doub
 	vec3d r0[2], rt[2];
 	for (int i=0; i<2; ++i)
 	{
-		r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
-		rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+		r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
+		rt[i] = m_pMesh->Node(el.m_node[i]).m_rt();
 	}
 
 	// initial length
@@ -257,8 +257,8 @@ void FEElasticTrussDomain::Update(const FETimeInfo& tp)
 		// nodal coordinates
 		for (int j=0; j<2; ++j)
 		{
-			r0[j] = m_pMesh->Node(el.m_node[j]).m_r0;
-			rt[j] = m_pMesh->Node(el.m_node[j]).m_rt;
+			r0[j] = m_pMesh->Node(el.m_node[j]).m_r0();
+			rt[j] = m_pMesh->Node(el.m_node[j]).m_rt();
 		}
 
 		double l = (rt[1] - rt[0]).norm();
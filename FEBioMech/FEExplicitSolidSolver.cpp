@@ -277,7 +277,7 @@ void FEExplicitSolidSolver::UpdateKinematics(vector<double>& ui)
 	{
 		FENode& node = mesh.Node(i);
 		if (node.m_rid == -1)
-			node.m_rt = node.m_r0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
+			node.m_rt() = node.m_r0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
 	}
 }
 
@@ -361,7 +361,7 @@ void FEExplicitSolidSolver::UpdateRigidBodies(vector<double>& ui)
 		FENode& node = mesh.Node(i);
 		if (node.m_rid >= 0)
 		{
-			vec3d ut = node.m_rt - node.m_r0;
+			vec3d ut = node.m_rt() - node.m_r0();
 			node.set_vec3d(m_dofU[0], m_dofU[1], m_dofU[2], ut);
 		}
 	}
@@ -459,9 +459,9 @@ void FEExplicitSolidSolver::PrepStep()
 	for (i=0; i<mesh.Nodes(); ++i)
 	{
 		FENode& ni = mesh.Node(i);
-		ni.m_rp = ni.m_rt;
-		ni.m_vp = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
-		ni.m_ap = ni.m_at;
+		ni.m_rp() = ni.m_rt();
+		ni.m_vp() = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
+		ni.m_ap() = ni.m_at();
 	}
 
 	const FETimeInfo& tp = fem.GetTime();
@@ -620,9 +620,9 @@ bool FEExplicitSolidSolver::DoSolve()
 	for (i=0; i<N; ++i) // zero the new acceleration vector ready to add in the damping components
 	{
 		FENode& node = mesh.Node(i);
-		node.m_at.x = 0.0;
-		node.m_at.y = 0.0;
-		node.m_at.z = 0.0;
+		node.m_at().x = 0.0;
+		node.m_at().y = 0.0;
+		node.m_at().z = 0.0;
 	}
 
 	for (int nd = 0; nd < mesh.Domains(); ++nd)
@@ -649,9 +649,9 @@ bool FEExplicitSolidSolver::DoSolve()
 				for (j=0; j<el.Nodes(); j++) // loop over each node in the element
 				{
 					FENode& node = mesh.Node(el.m_node[j]);  // get the node 
-					avx += node.m_vp.x*this_element[j+1];  // add each of the three components to the averages
-					avy += node.m_vp.y*this_element[j+1];  // weighted by the fractional mass of the node
-					avz += node.m_vp.z*this_element[j+1];  // remembering that this_element[0] is the total mass
+					avx += node.m_vp().x*this_element[j+1];  // add each of the three components to the averages
+					avy += node.m_vp().y*this_element[j+1];  // weighted by the fractional mass of the node
+					avz += node.m_vp().z*this_element[j+1];  // remembering that this_element[0] is the total mass
 				}
 				for (j=0; j<el.Nodes(); j++) // loop over each node in the element again
 				// and calculate and add in the velocity change contribution to each dof
@@ -662,9 +662,9 @@ bool FEExplicitSolidSolver::DoSolve()
 					// put this into the accelerations as (avx-node.m_vp.x)*m_dyn_damping*element_mass_at_node
 					// then it will be multiplied by dt and divided by m_inv_mass later 
 					mass_at_node = this_element[j+1]*this_element[0];
-					node.m_at.x += (avx-node.m_vp.x)*mass_at_node*m_dyn_damping;
-					node.m_at.y += (avy-node.m_vp.y)*mass_at_node*m_dyn_damping;
-					node.m_at.z += (avz-node.m_vp.z)*mass_at_node*m_dyn_damping;
+					node.m_at().x += (avx-node.m_vp().x)*mass_at_node*m_dyn_damping;
+					node.m_at().y += (avy-node.m_vp().y)*mass_at_node*m_dyn_damping;
+					node.m_at().z += (avz-node.m_vp().z)*mass_at_node*m_dyn_damping;
 				}
 			}  // loop over elements
 		}  // if (pbd)
@@ -675,12 +675,12 @@ bool FEExplicitSolidSolver::DoSolve()
 		FENode& node = mesh.Node(i);
 		//  calculate acceleration using F=ma and update - note m_inv_mass is 1/m so multiply not divide
 		n=(int)m_R1[0];
-		if ((n = node.m_ID[m_dofU[0]]) >= 0) node.m_at.x = (node.m_at.x+m_R1[n])*m_inv_mass[n];
-		if ((n = node.m_ID[m_dofU[1]]) >= 0) node.m_at.y = (node.m_at.y+m_R1[n])*m_inv_mass[n];
-		if ((n = node.m_ID[m_dofU[2]]) >= 0) node.m_at.z = (node.m_at.z+m_R1[n])*m_inv_mass[n];
+		if ((n = node.m_ID[m_dofU[0]]) >= 0) node.m_at().x = (node.m_at().x+m_R1[n])*m_inv_mass[n];
+		if ((n = node.m_ID[m_dofU[1]]) >= 0) node.m_at().y = (node.m_at().y+m_R1[n])*m_inv_mass[n];
+		if ((n = node.m_ID[m_dofU[2]]) >= 0) node.m_at().z = (node.m_at().z+m_R1[n])*m_inv_mass[n];
 		// and update the velocities using the accelerations
 		// which are added to the previously calculated velocity changes from damping
-		vec3d vt = node.m_vp + node.m_at*dt;
+		vec3d vt = node.m_vp() + node.m_at()*dt;
 		node.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vt);	//  update velocity using acceleration m_at
 		//	calculate incremental displacement using the velocity
 		if ((n = node.m_ID[m_dofU[0]]) >= 0) m_ui[n] = vt.x*dt;
@@ -732,7 +732,7 @@ bool FEExplicitSolidSolver::Residual(vector<double>& R)
 	zero(m_Fr);
 
 	// setup the global vector
-	FEGlobalVector RHS(fem, R, m_Fr);
+	FEGlobalVector RHS(fem, R, m_Fr, m_bcolorAssembly);
 
 	// zero rigid body reaction forces
 	int NRB = fem.RigidBodies();
@@ -859,10 +859,10 @@ void FEExplicitSolidSolver::InertialForces(FEGlobalVector& R)
 	for (int i=0; i<mesh.Nodes(); ++i)
 	{
 		FENode& node = mesh.Node(i);
-		vec3d& rt = node.m_rt;
-		vec3d& rp = node.m_rp;
-		vec3d& vp = node.m_vp;
-		vec3d& ap = node.m_ap;
+		vec3d& rt = node.m_rt();
+		vec3d& rp = node.m_rp();
+		vec3d& vp = node.m_vp();
+		vec3d& ap = node.m_ap();
 
 		F[3*i  ] = b*(rt.x - rp.x) - a*vp.x - ap.x;
 		F[3*i+1] = b*(rt.y - rp.y) - a*vp.y - ap.y;
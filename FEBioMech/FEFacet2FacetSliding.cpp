@@ -238,7 +238,7 @@ void FEFacetSlidingSurface::GetNodalContactTraction(int nface, vec3d* tn)
 // FEFacet2FacetSliding
 //-----------------------------------------------------------------------------
 
-FEFacet2FacetSliding::FEFacet2FacetSliding(FEModel* pfem) : FEContactInterface(pfem), m_ss(pfem), m_ms(pfem)
+FEFacet2FacetSliding::FEFacet2FacetSliding(FEModel* pfem) : FEContactInterface(pfem), m_ss(pfem), m_ms(pfem), m_cppm(m_ms), m_cpps(m_ss)
 {
 	static int ncount = 1;
 	SetID(ncount++);
@@ -314,7 +314,7 @@ void FEFacet2FacetSliding::BuildMatrixProfile(FEGlobalMatrix& K)
 
 					for (int l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
 						lm[6*l  ] = id[dof_X];
 						lm[6*l+1] = id[dof_Y];
 						lm[6*l+2] = id[dof_Z];
@@ -325,7 +325,7 @@ void FEFacet2FacetSliding::BuildMatrixProfile(FEGlobalMatrix& K)
 
 					for (int l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
 						lm[6*(l+nseln)  ] = id[dof_X];
 						lm[6*(l+nseln)+1] = id[dof_Y];
 						lm[6*(l+nseln)+2] = id[dof_Z];
@@ -420,10 +420,11 @@ void FEFacet2FacetSliding::CalcAutoPenalty(FEFacetSlidingSurface& s)
 //
 void FEFacet2FacetSliding::ProjectSurface(FEFacetSlidingSurface &ss, FEFacetSlidingSurface &ms, bool bsegup, bool bmove)
 {
-	FEClosestPointProjection cpp(ms);
+	// the search structures are built once and refit when the surface moves
+	FEClosestPointProjection& cpp = (&ms == &m_ms ? m_cppm : m_cpps);
 	cpp.HandleSpecialCases(true);
 	cpp.SetTolerance(m_stol);
-	cpp.Init();
+	cpp.Update();
 
 	// if we need to project the nodes onto the secondary surface,
 	// let's do this first
@@ -439,9 +440,9 @@ void FEFacet2FacetSliding::ProjectSurface(FEFacetSlidingSurface &ss, FEFacetSlid
 			int ne = el.Nodes();
 			for (int j=0; j<ne; ++j)
 			{
-				vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt;
-				vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt;
-				vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt;
+				vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt();
+				vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt();
+				vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt();
 				vec3d n = (rp - r0)^(rm - r0);
 				normal[el.m_lnode[j]] += n;
 			}
@@ -454,7 +455,7 @@ void FEFacet2FacetSliding::ProjectSurface(FEFacetSlidingSurface &ss, FEFacetSlid
 			FENode& node = ss.Node(i);
 
 			// get the spatial nodal coordinates
-			vec3d rt = node.m_rt;
+			vec3d rt = node.m_rt();
 			vec3d nu = normal[i];
 
 			// project onto the secondary surface
@@ -464,7 +465,7 @@ void FEFacet2FacetSliding::ProjectSurface(FEFacetSlidingSurface &ss, FEFacetSlid
 			if (pme) 
 			{
 				double gap = (nu*(rt - q));
-				if (gap>0) node.m_r0 = node.m_rt = q;
+				if (gap>0) node.m_r0() = node.m_rt() = q;
 			}
 		}
 	}
@@ -481,7 +482,7 @@ void FEFacet2FacetSliding::ProjectSurface(FEFacetSlidingSurface &ss, FEFacetSlid
 
 		// get nodal coordinates
 		vec3d re[FEElement::MAX_NODES];
-		for (int l=0; l<nn; ++l) re[l] = ss.GetMesh()->Node(se.m_node[l]).m_rt;
+		for (int l=0; l<nn; ++l) re[l] = ss.GetMesh()->Node(se.m_node[l]).m_rt();
 
 		// loop over all its integration points
 		int nint = se.GaussPoints();
@@ -571,12 +572,7 @@ void FEFacet2FacetSliding::Update()
 //-----------------------------------------------------------------------------
 void FEFacet2FacetSliding::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 {
-	vector<int> sLM, mLM, LM, en;
-	vector<double> fe;
-
-	const int MELN = FEElement::MAX_NODES;
-	double detJ[MELN], w[MELN], *Hs, Hm[MELN];
-	vec3d r0[MELN];
+	TimerTracker t(&m_residualTimer);
 
 	m_ss.m_Fn.assign(m_ss.Nodes(), vec3d(0,0,0));
 	m_ms.m_Fn.assign(m_ms.Nodes(), vec3d(0,0,0));
@@ -588,132 +584,164 @@ void FEFacet2FacetSliding::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 		FEFacetSlidingSurface& ms = (np == 0? m_ms : m_ss);
 
 		// loop over all primary surface elements
-		for (int i=0; i<ss.Elements(); ++i)
+		int ne = ss.Elements();
+		#pragma omp parallel shared(ne)
 		{
-			FESurfaceElement& se = ss.Element(i);
-			int nseln = se.Nodes();
-			int nint = se.GaussPoints();
+			// per-thread buffers
+			vector<int> sLM, mLM, LM, en;
+			vector<double> fe;
 
-			// get the element's LM vector
-			ss.UnpackLM(se, sLM);
+			const int MELN = FEElement::MAX_NODES;
+			double detJ[MELN], w[MELN], *Hs, Hm[MELN];
+			vec3d r0[MELN];
 
-			// nodal coordinates
-			for (int j=0; j<nseln; ++j) r0[j] = ss.GetMesh()->Node(se.m_node[j]).m_r0;
-
-			// we calculate all the metrics we need before we
-			// calculate the nodal forces
-			for (int j=0; j<nint; ++j)
+			#pragma omp for
+			for (int i=0; i<ne; ++i)
 			{
-				double* Gr = se.Gr(j);
-				double* Gs = se.Gs(j);
+				FESurfaceElement& se = ss.Element(i);
+				int nseln = se.Nodes();
+				int nint = se.GaussPoints();
+
+				// get the element's LM vector
+				ss.UnpackLM(se, sLM);
 
-				// calculate jacobian
-				// note that we are integrating over the reference surface
-				vec3d dxr, dxs;
-				for (int k=0; k<nseln; ++k)
+				// nodal coordinates
+				for (int j=0; j<nseln; ++j) r0[j] = ss.GetMesh()->Node(se.m_node[j]).m_r0();
+
+				// we calculate all the metrics we need before we
+				// calculate the nodal forces
+				for (int j=0; j<nint; ++j)
 				{
-					dxr.x += Gr[k]*r0[k].x;
-					dxr.y += Gr[k]*r0[k].y;
-					dxr.z += Gr[k]*r0[k].z;
+					double* Gr = se.Gr(j);
+					double* Gs = se.Gs(j);
 
-					dxs.x += Gs[k]*r0[k].x;
-					dxs.y += Gs[k]*r0[k].y;
-					dxs.z += Gs[k]*r0[k].z;
-				}
+					// calculate jacobian
+					// note that we are integrating over the reference surface
+					vec3d dxr, dxs;
+					for (int k=0; k<nseln; ++k)
+					{
+						dxr.x += Gr[k]*r0[k].x;
+						dxr.y += Gr[k]*r0[k].y;
+						dxr.z += Gr[k]*r0[k].z;
 
-				// jacobians
-				detJ[j] = (dxr ^ dxs).norm();
+						dxs.x += Gs[k]*r0[k].x;
+						dxs.y += Gs[k]*r0[k].y;
+						dxs.z += Gs[k]*r0[k].z;
+					}
 
-				// integration weights
-				w[j] = se.GaussWeights()[j];
-			}
+					// jacobians
+					detJ[j] = (dxr ^ dxs).norm();
 
-			// loop over all integration points
-			for (int j=0; j<nint; ++j)
-			{
-				// get integration point data
-				FEFacetSlidingSurface::Data& pt = static_cast<FEFacetSlidingSurface::Data&>(*se.GetMaterialPoint(j));
+					// integration weights
+					w[j] = se.GaussWeights()[j];
+				}
 
-				// get the secondary surface element
-				FESurfaceElement* pme = pt.m_pme;
-				if (pme)
+				// loop over all integration points
+				for (int j=0; j<nint; ++j)
 				{
-					FESurfaceElement& me = *pme;
+					// get integration point data
+					FEFacetSlidingSurface::Data& pt = static_cast<FEFacetSlidingSurface::Data&>(*se.GetMaterialPoint(j));
 
-					int nmeln = me.Nodes();
-					ms.UnpackLM(me, mLM);
+					// get the secondary surface element
+					FESurfaceElement* pme = pt.m_pme;
+					if (pme)
+					{
+						FESurfaceElement& me = *pme;
 
-					// calculate degrees of freedom
-					int ndof = 3*(nseln + nmeln);
+						int nmeln = me.Nodes();
+						ms.UnpackLM(me, mLM);
 
-					// build the LM vector
-					LM.resize(ndof);
-					for (int k=0; k<nseln; ++k)
-					{
-						LM[3*k  ] = sLM[3*k  ];
-						LM[3*k+1] = sLM[3*k+1];
-						LM[3*k+2] = sLM[3*k+2];
-					}
+						// calculate degrees of freedom
+						int ndof = 3*(nseln + nmeln);
 
-					for (int k=0; k<nmeln; ++k)
-					{
-						LM[3*(k+nseln)  ] = mLM[3*k  ];
-						LM[3*(k+nseln)+1] = mLM[3*k+1];
-						LM[3*(k+nseln)+2] = mLM[3*k+2];
-					}
+						// build the LM vector
+						LM.resize(ndof);
+						for (int k=0; k<nseln; ++k)
+						{
+							LM[3*k  ] = sLM[3*k  ];
+							LM[3*k+1] = sLM[3*k+1];
+							LM[3*k+2] = sLM[3*k+2];
+						}
 
-					// build the en vector
-					en.resize(nseln+nmeln);
-					for (int k=0; k<nseln; ++k) en[k] = se.m_node[k];
-					for (int k=0; k<nmeln; ++k) en[k+nseln] = me.m_node[k];
+						for (int k=0; k<nmeln; ++k)
+						{
+							LM[3*(k+nseln)  ] = mLM[3*k  ];
+							LM[3*(k+nseln)+1] = mLM[3*k+1];
+							LM[3*(k+nseln)+2] = mLM[3*k+2];
+						}
+
+						// build the en vector
+						en.resize(nseln+nmeln);
+						for (int k=0; k<nseln; ++k) en[k] = se.m_node[k];
+						for (int k=0; k<nmeln; ++k) en[k+nseln] = me.m_node[k];
 
-					// calculate shape functions
-					Hs = se.H(j);
+						// calculate shape functions
+						Hs = se.H(j);
 
-					double r = pt.m_rs[0];
-					double s = pt.m_rs[1];
-					me.shape_fnc(Hm, r, s);
+						double r = pt.m_rs[0];
+						double s = pt.m_rs[1];
+						me.shape_fnc(Hm, r, s);
 
-					// get normal vector
-					vec3d nu = pt.m_nu;
+						// get normal vector
+						vec3d nu = pt.m_nu;
 
-					// gap function
-					double g = pt.m_gap;
+						// gap function
+						double g = pt.m_gap;
 					
-					// lagrange multiplier
-					double Lm = pt.m_Lm;
+						// lagrange multiplier
+						double Lm = pt.m_Lm;
 
-					// penalty value
-					double eps = m_epsn*pt.m_eps;
+						// penalty value
+						double eps = m_epsn*pt.m_eps;
 
-					// contact traction
-					double tn = Lm + eps*g;
-					tn = MBRACKET(tn);
+						// contact traction
+						double tn = Lm + eps*g;
+						tn = MBRACKET(tn);
 
-					// calculate the force vector
-					fe.resize(ndof);
+						// calculate the force vector
+						fe.resize(ndof);
 
-					for (int k=0; k<nseln; ++k)
-					{
-						fe[3*k  ] = Hs[k]*nu.x;
-						fe[3*k+1] = Hs[k]*nu.y;
-						fe[3*k+2] = Hs[k]*nu.z;
-					}
+						for (int k=0; k<nseln; ++k)
+						{
+							fe[3*k  ] = Hs[k]*nu.x;
+							fe[3*k+1] = Hs[k]*nu.y;
+							fe[3*k+2] = Hs[k]*nu.z;
+						}
 
-					for (int k=0; k<nmeln; ++k)
-					{
-						fe[3*(k+nseln)  ] = -Hm[k]*nu.x;
-						fe[3*(k+nseln)+1] = -Hm[k]*nu.y;
-						fe[3*(k+nseln)+2] = -Hm[k]*nu.z;
-					}
+						for (int k=0; k<nmeln; ++k)
+						{
+							fe[3*(k+nseln)  ] = -Hm[k]*nu.x;
+							fe[3*(k+nseln)+1] = -Hm[k]*nu.y;
+							fe[3*(k+nseln)+2] = -Hm[k]*nu.z;
+						}
 
-					for (int k=0; k<ndof; ++k) fe[k] *= tn*detJ[j]*w[j];
+						for (int k=0; k<ndof; ++k) fe[k] *= tn*detJ[j]*w[j];
 
-					for (int k=0; k<nseln; ++k) ss.m_Fn[se.m_lnode[k]] += vec3d(fe[3*k], fe[3*k+1], fe[3*k+2]);
-					for (int k=0; k<nmeln; ++k) ms.m_Fn[me.m_lnode[k]] += vec3d(fe[3*nseln+3*k], fe[3*nseln+3*k+1], fe[3*nseln+3*k+2]);
+						// accumulate the nodal contact forces (nodes are shared between threads)
+						for (int k=0; k<nseln; ++k)
+						{
+							vec3d& Fn = ss.m_Fn[se.m_lnode[k]];
+							#pragma omp atomic
+							Fn.x += fe[3*k  ];
+							#pragma omp atomic
+							Fn.y += fe[3*k+1];
+							#pragma omp atomic
+							Fn.z += fe[3*k+2];
+						}
+						for (int k=0; k<nmeln; ++k)
+						{
+							vec3d& Fn = ms.m_Fn[me.m_lnode[k]];
+							#pragma omp atomic
+							Fn.x += fe[3*(k+nseln)  ];
+							#pragma omp atomic
+							Fn.y += fe[3*(k+nseln)+1];
+							#pragma omp atomic
+							Fn.z += fe[3*(k+nseln)+2];
+						}
 
-					// assemble the global residual
-					R.Assemble(en, LM, fe);
+						// assemble the global residual
+						R.Assemble(en, LM, fe);
+					}
 				}
 			}
 		}
@@ -724,11 +752,10 @@ void FEFacet2FacetSliding::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 
 void FEFacet2FacetSliding::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 {
-	vector<int> sLM, mLM, LM, en;
+	TimerTracker t(&m_stiffnessTimer);
+
 	const int MN = FEElement::MAX_NODES;
 	const int ME = 3*MN*2;
-	double N[ME], T1[ME], T2[ME], N1[ME] = {0}, N2[ME] = {0}, D1[ME], D2[ME], Nb1[ME], Nb2[ME];
-	FEElementMatrix ke;
 
 	// get the mesh
 	FEMesh* pm = m_ss.GetMesh();
@@ -754,9 +781,6 @@ void FEFacet2FacetSliding::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 		else knmult = 0;
 	}
 
-	double detJ[MN], w[MN], *Hs, Hm[MN], Hmr[MN], Hms[MN];
-	vec3d r0[MN];
-
 	int npass = (m_btwo_pass?2:1);
 	for (int np=0; np < npass; ++np)
 	{
@@ -764,264 +788,277 @@ void FEFacet2FacetSliding::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 		FEFacetSlidingSurface& ms = (np == 0? m_ms : m_ss);
 
 		// loop over all primary surface elements
-		for (int i=0; i<ss.Elements(); ++i)
+		int ne = ss.Elements();
+		#pragma omp parallel shared(ne)
 		{
-			FESurfaceElement& se = ss.Element(i);
-			int nseln = se.Nodes();
-			int nint = se.GaussPoints();
-
-			// get the element's LM vector
-			ss.UnpackLM(se, sLM);
+			// per-thread buffers
+			vector<int> sLM, mLM, LM, en;
+			double N[ME], T1[ME], T2[ME], N1[ME] = {0}, N2[ME] = {0}, D1[ME], D2[ME], Nb1[ME], Nb2[ME];
+			FEElementMatrix ke;
 
-			// nodal coordinates
-			for (int j=0; j<nseln; ++j) r0[j] = ss.GetMesh()->Node(se.m_node[j]).m_r0;
+			double detJ[MN], w[MN], *Hs, Hm[MN], Hmr[MN], Hms[MN];
+			vec3d r0[MN];
 
-			// we calculate all the metrics we need before we
-			// calculate the nodal forces
-			for (int j=0; j<nint; ++j)
+			#pragma omp for
+			for (int i=0; i<ne; ++i)
 			{
-				double* Gr = se.Gr(j);
-				double* Gs = se.Gs(j);
+				FESurfaceElement& se = ss.Element(i);
+				int nseln = se.Nodes();
+				int nint = se.GaussPoints();
 
-				// calculate jacobian
-				// note that we are integrating over the reference surface
-				vec3d dxr, dxs;
-				for (int k=0; k<nseln; ++k)
-				{
-					dxr.x += Gr[k]*r0[k].x;
-					dxr.y += Gr[k]*r0[k].y;
-					dxr.z += Gr[k]*r0[k].z;
-
-					dxs.x += Gs[k]*r0[k].x;
-					dxs.y += Gs[k]*r0[k].y;
-					dxs.z += Gs[k]*r0[k].z;
-				}
+				// get the element's LM vector
+				ss.UnpackLM(se, sLM);
 
-				// jacobians
-				detJ[j] = (dxr ^ dxs).norm();
+				// nodal coordinates
+				for (int j=0; j<nseln; ++j) r0[j] = ss.GetMesh()->Node(se.m_node[j]).m_r0();
 
-				// integration weights
-				w[j] = se.GaussWeights()[j];
-			}
-
-			// loop over all integration points
-			for (int j=0; j<nint; ++j)
-			{
-				// get integration point data
-				FEFacetSlidingSurface::Data& pt = static_cast<FEFacetSlidingSurface::Data&>(*se.GetMaterialPoint(j));
-
-				// get the secondary surface element
-				FESurfaceElement* pme = pt.m_pme;
-				if (pme)
+				// we calculate all the metrics we need before we
+				// calculate the nodal forces
+				for (int j=0; j<nint; ++j)
 				{
-					FESurfaceElement& me = *pme;
-
-					int nmeln = me.Nodes();
-					ms.UnpackLM(me, mLM);
-
-					// calculate degrees of freedom
-					int ndof = 3*(nseln + nmeln);
+					double* Gr = se.Gr(j);
+					double* Gs = se.Gs(j);
 
-					// build the LM vector
-					LM.resize(ndof);
+					// calculate jacobian
+					// note that we are integrating over the reference surface
+					vec3d dxr, dxs;
 					for (int k=0; k<nseln; ++k)
 					{
-						LM[3*k  ] = sLM[3*k  ];
-						LM[3*k+1] = sLM[3*k+1];
-						LM[3*k+2] = sLM[3*k+2];
-					}
+						dxr.x += Gr[k]*r0[k].x;
+						dxr.y += Gr[k]*r0[k].y;
+						dxr.z += Gr[k]*r0[k].z;
 
-					for (int k=0; k<nmeln; ++k)
-					{
-						LM[3*(k+nseln)  ] = mLM[3*k  ];
-						LM[3*(k+nseln)+1] = mLM[3*k+1];
-						LM[3*(k+nseln)+2] = mLM[3*k+2];
+						dxs.x += Gs[k]*r0[k].x;
+						dxs.y += Gs[k]*r0[k].y;
+						dxs.z += Gs[k]*r0[k].z;
 					}
 
-					// build the en vector
-					en.resize(nseln+nmeln);
-					for (int k=0; k<nseln; ++k) en[k] = se.m_node[k];
-					for (int k=0; k<nmeln; ++k) en[k+nseln] = me.m_node[k];
+					// jacobians
+					detJ[j] = (dxr ^ dxs).norm();
 
-					// calculate shape functions
-					Hs = se.H(j);
-					double r = pt.m_rs[0];
-					double s = pt.m_rs[1];
-					me.shape_fnc(Hm, r, s);
+					// integration weights
+					w[j] = se.GaussWeights()[j];
+				}
 
-					// get normal vector
-					vec3d nu = pt.m_nu;
+				// loop over all integration points
+				for (int j=0; j<nint; ++j)
+				{
+					// get integration point data
+					FEFacetSlidingSurface::Data& pt = static_cast<FEFacetSlidingSurface::Data&>(*se.GetMaterialPoint(j));
 
-					// gap function
-					double g = pt.m_gap;
+					// get the secondary surface element
+					FESurfaceElement* pme = pt.m_pme;
+					if (pme)
+					{
+						FESurfaceElement& me = *pme;
 
-					// when the node is on the surface, the gap value
-					// can flip-flop between positive and negative.
-					if (fabs(g)<1e-20) g = 0;
-					
-					// lagrange multiplier
-					double Lm = pt.m_Lm;
+						int nmeln = me.Nodes();
+						ms.UnpackLM(me, mLM);
 
-					// penalty value
-					double eps = m_epsn*pt.m_eps;
+						// calculate degrees of freedom
+						int ndof = 3*(nseln + nmeln);
 
-					// contact traction
-					double tn = Lm + eps*g;
-					tn = MBRACKET(tn);
+						// build the LM vector
+						LM.resize(ndof);
+						for (int k=0; k<nseln; ++k)
+						{
+							LM[3*k  ] = sLM[3*k  ];
+							LM[3*k+1] = sLM[3*k+1];
+							LM[3*k+2] = sLM[3*k+2];
+						}
 
-					double dtn = eps*HEAVYSIDE(Lm + eps*g);
+						for (int k=0; k<nmeln; ++k)
+						{
+							LM[3*(k+nseln)  ] = mLM[3*k  ];
+							LM[3*(k+nseln)+1] = mLM[3*k+1];
+							LM[3*(k+nseln)+2] = mLM[3*k+2];
+						}
 
-					// define buffer layer for penalty insertion
-					// TODO: I don't think this does anything since dtn cannot < 0
-					if ((dtn < 1e-7) && (g < 0) && (dxtol != 0))
-					{
-						if (dxtol < 0) dtn = eps*exp(-g/dxtol);
-						else if (-g<=dxtol) dtn = eps*(1 + g/dxtol);
-					}
+						// build the en vector
+						en.resize(nseln+nmeln);
+						for (int k=0; k<nseln; ++k) en[k] = se.m_node[k];
+						for (int k=0; k<nmeln; ++k) en[k+nseln] = me.m_node[k];
 
-					// calculate the N-vector
-					for (int k=0; k<nseln; ++k)
-					{
-						N[3*k  ] = Hs[k]*nu.x;
-						N[3*k+1] = Hs[k]*nu.y;
-						N[3*k+2] = Hs[k]*nu.z;
-					}
+						// calculate shape functions
+						Hs = se.H(j);
+						double r = pt.m_rs[0];
+						double s = pt.m_rs[1];
+						me.shape_fnc(Hm, r, s);
 
-					for (int k=0; k<nmeln; ++k)
-					{
-						N[3*(k+nseln)  ] = -Hm[k]*nu.x;
-						N[3*(k+nseln)+1] = -Hm[k]*nu.y;
-						N[3*(k+nseln)+2] = -Hm[k]*nu.z;
-					}
+						// get normal vector
+						vec3d nu = pt.m_nu;
 
-					// --- N O R M A L   S T I F F N E S S ---
+						// gap function
+						double g = pt.m_gap;
 
-					// create the stiffness matrix
-					ke.resize(ndof, ndof);
+						// when the node is on the surface, the gap value
+						// can flip-flop between positive and negative.
+						if (fabs(g)<1e-20) g = 0;
+					
+						// lagrange multiplier
+						double Lm = pt.m_Lm;
 
-					// add the first order term (= D(tn)*dg )
-					for (int k=0; k<ndof; ++k)
-						for (int l=0; l<ndof; ++l) ke[k][l] = dtn*N[k]*N[l]*detJ[j]*w[j];
+						// penalty value
+						double eps = m_epsn*pt.m_eps;
 
-					// add the higher order terms (= tn*D(dg) )
-					if (knmult > 0)
-					{
-						// calculate the secondary surface shape fncs derivatives
-						me.shape_deriv(Hmr, Hms, r, s);
+						// contact traction
+						double tn = Lm + eps*g;
+						tn = MBRACKET(tn);
 
-						// get the secondary surface nodes
-						vec3d rt[MN];
-						for (int k=0; k<nmeln; ++k) rt[k] = ms.GetMesh()->Node(me.m_node[k]).m_rt;
+						double dtn = eps*HEAVYSIDE(Lm + eps*g);
 
-						// get the tangent vectors
-						vec3d tau1(0,0,0), tau2(0,0,0);
-						for (int k=0; k<nmeln; ++k)
+						// define buffer layer for penalty insertion
+						// TODO: I don't think this does anything since dtn cannot < 0
+						if ((dtn < 1e-7) && (g < 0) && (dxtol != 0))
 						{
-							tau1.x += Hmr[k]*rt[k].x;
-							tau1.y += Hmr[k]*rt[k].y;
-							tau1.z += Hmr[k]*rt[k].z;
-		
-							tau2.x += Hms[k]*rt[k].x;
-							tau2.y += Hms[k]*rt[k].y;
-							tau2.z += Hms[k]*rt[k].z;
+							if (dxtol < 0) dtn = eps*exp(-g/dxtol);
+							else if (-g<=dxtol) dtn = eps*(1 + g/dxtol);
 						}
 
-						// set up the Ti vectors
+						// calculate the N-vector
 						for (int k=0; k<nseln; ++k)
 						{
-							T1[k*3  ] = Hs[k]*tau1.x; T2[k*3  ] = Hs[k]*tau2.x;
-							T1[k*3+1] = Hs[k]*tau1.y; T2[k*3+1] = Hs[k]*tau2.y;
-							T1[k*3+2] = Hs[k]*tau1.z; T2[k*3+2] = Hs[k]*tau2.z;
+							N[3*k  ] = Hs[k]*nu.x;
+							N[3*k+1] = Hs[k]*nu.y;
+							N[3*k+2] = Hs[k]*nu.z;
 						}
 
-						for (int k=0; k<nmeln; ++k) 
+						for (int k=0; k<nmeln; ++k)
 						{
-							T1[(k+nseln)*3  ] = -Hm[k]*tau1.x;
-							T1[(k+nseln)*3+1] = -Hm[k]*tau1.y;
-							T1[(k+nseln)*3+2] = -Hm[k]*tau1.z;
-
-							T2[(k+nseln)*3  ] = -Hm[k]*tau2.x;
-							T2[(k+nseln)*3+1] = -Hm[k]*tau2.y;
-							T2[(k+nseln)*3+2] = -Hm[k]*tau2.z;
+							N[3*(k+nseln)  ] = -Hm[k]*nu.x;
+							N[3*(k+nseln)+1] = -Hm[k]*nu.y;
+							N[3*(k+nseln)+2] = -Hm[k]*nu.z;
 						}
 
-						// set up the Ni vectors
-						for (int k=0; k<nmeln; ++k) 
+						// --- N O R M A L   S T I F F N E S S ---
+
+						// create the stiffness matrix
+						ke.resize(ndof, ndof);
+
+						// add the first order term (= D(tn)*dg )
+						for (int k=0; k<ndof; ++k)
+							for (int l=0; l<ndof; ++l) ke[k][l] = dtn*N[k]*N[l]*detJ[j]*w[j];
+
+						// add the higher order terms (= tn*D(dg) )
+						if (knmult > 0)
 						{
-							N1[(k+nseln)*3  ] = -Hmr[k]*nu.x;
-							N1[(k+nseln)*3+1] = -Hmr[k]*nu.y;
-							N1[(k+nseln)*3+2] = -Hmr[k]*nu.z;
+							// calculate the secondary surface shape fncs derivatives
+							me.shape_deriv(Hmr, Hms, r, s);
 
-							N2[(k+nseln)*3  ] = -Hms[k]*nu.x;
-							N2[(k+nseln)*3+1] = -Hms[k]*nu.y;
-							N2[(k+nseln)*3+2] = -Hms[k]*nu.z;
-						}
+							// get the secondary surface nodes
+							vec3d rt[MN];
+							for (int k=0; k<nmeln; ++k) rt[k] = ms.GetMesh()->Node(me.m_node[k]).m_rt();
 
-						// calculate metric tensor
-						mat2d M;
-						M[0][0] = tau1*tau1; M[0][1] = tau1*tau2; 
-						M[1][0] = tau2*tau1; M[1][1] = tau2*tau2; 
+							// get the tangent vectors
+							vec3d tau1(0,0,0), tau2(0,0,0);
+							for (int k=0; k<nmeln; ++k)
+							{
+								tau1.x += Hmr[k]*rt[k].x;
+								tau1.y += Hmr[k]*rt[k].y;
+								tau1.z += Hmr[k]*rt[k].z;
+		
+								tau2.x += Hms[k]*rt[k].x;
+								tau2.y += Hms[k]*rt[k].y;
+								tau2.z += Hms[k]*rt[k].z;
+							}
 
-						// calculate reciprocal metric tensor
-						mat2d Mi = M.inverse();
+							// set up the Ti vectors
+							for (int k=0; k<nseln; ++k)
+							{
+								T1[k*3  ] = Hs[k]*tau1.x; T2[k*3  ] = Hs[k]*tau2.x;
+								T1[k*3+1] = Hs[k]*tau1.y; T2[k*3+1] = Hs[k]*tau2.y;
+								T1[k*3+2] = Hs[k]*tau1.z; T2[k*3+2] = Hs[k]*tau2.z;
+							}
 
-						// calculate curvature tensor
-						double K[2][2] = {0};
-						double Grr[MN];
-						double Gss[MN];
-						double Grs[MN];
-						me.shape_deriv2(Grr, Grs, Gss, r, s);
-						for (int k=0; k<nmeln; ++k)
-						{
-							K[0][0] += (nu*rt[k])*Grr[k];
-							K[0][1] += (nu*rt[k])*Grs[k];
-							K[1][0] += (nu*rt[k])*Grs[k];
-							K[1][1] += (nu*rt[k])*Gss[k];
-						}
+							for (int k=0; k<nmeln; ++k) 
+							{
+								T1[(k+nseln)*3  ] = -Hm[k]*tau1.x;
+								T1[(k+nseln)*3+1] = -Hm[k]*tau1.y;
+								T1[(k+nseln)*3+2] = -Hm[k]*tau1.z;
 
-						// setup A matrix A = M + gK
-						double A[2][2];
-						A[0][0] = M[0][0] + g*K[0][0];
-						A[0][1] = M[0][1] + g*K[0][1];
-						A[1][0] = M[1][0] + g*K[1][0];
-						A[1][1] = M[1][1] + g*K[1][1];
+								T2[(k+nseln)*3  ] = -Hm[k]*tau2.x;
+								T2[(k+nseln)*3+1] = -Hm[k]*tau2.y;
+								T2[(k+nseln)*3+2] = -Hm[k]*tau2.z;
+							}
 
-						// calculate determinant of A
-						double detA = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+							// set up the Ni vectors
+							for (int k=0; k<nmeln; ++k) 
+							{
+								N1[(k+nseln)*3  ] = -Hmr[k]*nu.x;
+								N1[(k+nseln)*3+1] = -Hmr[k]*nu.y;
+								N1[(k+nseln)*3+2] = -Hmr[k]*nu.z;
 
-						// setup Di vectors
-						for (int k=0; k<ndof; ++k)
-						{
-							D1[k] = (1/detA)*(A[1][1]*(T1[k]+g*N1[k]) - A[0][1]*(T2[k] + g*N2[k]));
-							D2[k] = (1/detA)*(A[0][0]*(T2[k]+g*N2[k]) - A[0][1]*(T1[k] + g*N1[k]));
-						}
+								N2[(k+nseln)*3  ] = -Hms[k]*nu.x;
+								N2[(k+nseln)*3+1] = -Hms[k]*nu.y;
+								N2[(k+nseln)*3+2] = -Hms[k]*nu.z;
+							}
 
-						// setup Nbi vectors
-						for (int k=0; k<ndof; ++k)
-						{
-							Nb1[k] = N1[k] - K[0][1]*D2[k];
-							Nb2[k] = N2[k] - K[0][1]*D1[k];
-						}
+							// calculate metric tensor
+							mat2d M;
+							M[0][0] = tau1*tau1; M[0][1] = tau1*tau2; 
+							M[1][0] = tau2*tau1; M[1][1] = tau2*tau2; 
+
+							// calculate reciprocal metric tensor
+							mat2d Mi = M.inverse();
+
+							// calculate curvature tensor
+							double K[2][2] = {0};
+							double Grr[MN];
+							double Gss[MN];
+							double Grs[MN];
+							me.shape_deriv2(Grr, Grs, Gss, r, s);
+							for (int k=0; k<nmeln; ++k)
+							{
+								K[0][0] += (nu*rt[k])*Grr[k];
+								K[0][1] += (nu*rt[k])*Grs[k];
+								K[1][0] += (nu*rt[k])*Grs[k];
+								K[1][1] += (nu*rt[k])*Gss[k];
+							}
 
-						// add it to the stiffness
-						double sum;
-						for (int k=0; k<ndof; ++k)
-							for (int l=0; l<ndof; ++l)
+							// setup A matrix A = M + gK
+							double A[2][2];
+							A[0][0] = M[0][0] + g*K[0][0];
+							A[0][1] = M[0][1] + g*K[0][1];
+							A[1][0] = M[1][0] + g*K[1][0];
+							A[1][1] = M[1][1] + g*K[1][1];
+
+							// calculate determinant of A
+							double detA = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+
+							// setup Di vectors
+							for (int k=0; k<ndof; ++k)
 							{
-								sum = Mi[0][0]*Nb1[k]*Nb1[l]+Mi[0][1]*(Nb1[k]*Nb2[l]+Nb2[k]*Nb1[l])+Mi[1][1]*Nb2[k]*Nb2[l];
-								sum *= g;
-								sum -= D1[k]*N1[l]+D2[k]*N2[l]+N1[k]*D1[l]+N2[k]*D2[l];
-								sum += K[0][1]*(D1[k]*D2[l]+D2[k]*D1[l]);
-								sum *= tn*knmult;
+								D1[k] = (1/detA)*(A[1][1]*(T1[k]+g*N1[k]) - A[0][1]*(T2[k] + g*N2[k]));
+								D2[k] = (1/detA)*(A[0][0]*(T2[k]+g*N2[k]) - A[0][1]*(T1[k] + g*N1[k]));
+							}
 
-								ke[k][l] += sum*detJ[j]*w[j];
+							// setup Nbi vectors
+							for (int k=0; k<ndof; ++k)
+							{
+								Nb1[k] = N1[k] - K[0][1]*D2[k];
+								Nb2[k] = N2[k] - K[0][1]*D1[k];
 							}
-					}
 
-					// assemble the global residual
-					ke.SetNodes(en);
-					ke.SetIndices(LM);
-					LS.Assemble(ke);
+							// add it to the stiffness
+							double sum;
+							for (int k=0; k<ndof; ++k)
+								for (int l=0; l<ndof; ++l)
+								{
+									sum = Mi[0][0]*Nb1[k]*Nb1[l]+Mi[0][1]*(Nb1[k]*Nb2[l]+Nb2[k]*Nb1[l])+Mi[1][1]*Nb2[k]*Nb2[l];
+									sum *= g;
+									sum -= D1[k]*N1[l]+D2[k]*N2[l]+N1[k]*D1[l]+N2[k]*D2[l];
+									sum += K[0][1]*(D1[k]*D2[l]+D2[k]*D1[l]);
+									sum *= tn*knmult;
+
+									ke[k][l] += sum*detJ[j]*w[j];
+								}
+						}
+
+						// assemble the global residual
+						ke.SetNodes(en);
+						ke.SetIndices(LM);
+						LS.Assemble(ke);
+					}
 				}
 			}
 		}
@@ -30,6 +30,7 @@ SOFTWARE.*/
 
 #include "FEContactInterface.h"
 #include "FEContactSurface.h"
+#include <FECore/FEClosestPointProjection.h>
 
 //-----------------------------------------------------------------------------
 //! Contact surface for facet-to-facet sliding interfaces
@@ -165,6 +166,9 @@ private:
 	bool	m_bfirst;
 	double	m_normg0;
 
+	FEClosestPointProjection	m_cppm;	//!< projection onto secondary surface
+	FEClosestPointProjection	m_cpps;	//!< projection onto primary surface (two-pass)
+
 public:
 	DECLARE_FECORE_CLASS();
 };
@@ -207,7 +207,7 @@ void FEFacet2FacetTied::BuildMatrixProfile(FEGlobalMatrix& K)
 
 				for (int l=0; l<nseln; ++l)
 				{
-					vector<int>& id = mesh.Node(sn[l]).m_ID;
+					FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
 					lm[6*l  ] = id[dof_X];
 					lm[6*l+1] = id[dof_Y];
 					lm[6*l+2] = id[dof_Z];
@@ -218,7 +218,7 @@ void FEFacet2FacetTied::BuildMatrixProfile(FEGlobalMatrix& K)
 
 				for (int l=0; l<nmeln; ++l)
 				{
-					vector<int>& id = mesh.Node(mn[l]).m_ID;
+					FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
 					lm[6*(l+nseln)  ] = id[dof_X];
 					lm[6*(l+nseln)+1] = id[dof_Y];
 					lm[6*(l+nseln)+2] = id[dof_Z];
@@ -276,7 +276,7 @@ void FEFacet2FacetTied::ProjectSurface(FEFacetTiedSurface& ss, FEFacetTiedSurfac
 		// get nodal coordinates
 		int nn = se.Nodes();
 		vec3d re[FEElement::MAX_NODES];
-		for (int j=0; j<nn; ++j) re[j] = mesh.Node(se.m_node[j]).m_rt;
+		for (int j=0; j<nn; ++j) re[j] = mesh.Node(se.m_node[j]).m_rt();
 
 		// loop over all its integration points
 		int nint = se.GaussPoints();
@@ -325,7 +325,7 @@ void FEFacet2FacetTied::Update()
 
 		// get the nodal coordinates
 		vec3d rs[FEElement::MAX_NODES];
-		for (int j=0; j<nseln; ++j) rs[j] = mesh.Node(se.m_node[j]).m_rt;
+		for (int j=0; j<nseln; ++j) rs[j] = mesh.Node(se.m_node[j]).m_rt();
 
 		// loop over all integration points
 		const int nint = se.GaussPoints();
@@ -349,7 +349,7 @@ void FEFacet2FacetTied::Update()
 				// get the secondary nodal coordinates
 				int nmeln = me.Nodes();
 				vec3d y[FEElement::MAX_NODES];
-				for (int l=0; l<nmeln; ++l) y[l] = mesh.Node( me.m_node[l] ).m_rt;
+				for (int l=0; l<nmeln; ++l) y[l] = mesh.Node( me.m_node[l] ).m_rt();
 
 				// calculate the primary node projection
 				vec3d q = me.eval(y, r, s);
@@ -50,6 +50,9 @@ public:
 	// get iterator
 	FEFiberIntegrationSchemeIterator* GetIterator(FEMaterialPoint* mp) override;
 
+	// the integration points are the same for all material points
+	bool IsDeformationIndependent() const override { return true; }
+
 protected:
 	void InitIntegrationRule();  
 
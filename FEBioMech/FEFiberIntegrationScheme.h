@@ -69,4 +69,8 @@ public:
 	// In general, the integration scheme may depend on the material point.
 	// The passed material point pointer will be zero when evaluating the integrated fiber density
 	virtual FEFiberIntegrationSchemeIterator* GetIterator(FEMaterialPoint* mp = 0) = 0;
+
+	// Returns true if the integration points and weights do not depend on the material point.
+	// In that case, the integration points can be tabulated.
+	virtual bool IsDeformationIndependent() const { return false; }
 };
@@ -42,6 +42,9 @@ public:
 
 	// get iterator	
 	FEFiberIntegrationSchemeIterator* GetIterator(FEMaterialPoint* mp) override;
+
+	// the integration points are the same for all material points
+	bool IsDeformationIndependent() const override { return true; }
     
 private:
     int             m_nth;  // number of trapezoidal integration points along theta
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FEHolmesMow.h"
+#include "FEElasticMaterialBatch.h"
 
 //-----------------------------------------------------------------------------
 // define the material parameters
@@ -130,3 +131,71 @@ double FEHolmesMow::StrainEnergyDensity(FEMaterialPoint& mp)
 	
 	return sed;
 }
+
+//-----------------------------------------------------------------------------
+// helper function that calculates the stress (in batch.s) and the exponential term
+// at all points of the batch
+static void holmes_mow_stress(FEHolmesMow& mat, FEElasticMaterialBatch& batch, double* eQ)
+{
+	const int N = FEElasticMaterialBatch::MAX_POINTS;
+	const int n = batch.Points();
+	const double lam = mat.lam, mu = mat.mu, Ha = mat.Ha, beta = mat.m_b;
+
+	// invariants of b
+	double b2[6][N], I1[N], trb2[N], I3[N];
+	FEElasticMaterialBatch::Square(n, batch.b, b2);
+	FEElasticMaterialBatch::Trace(n, batch.b, I1);
+	FEElasticMaterialBatch::Trace(n, b2, trb2);
+	FEElasticMaterialBatch::Det(n, batch.b, I3);
+
+	for (int i = 0; i < n; ++i)
+	{
+		double I2 = (I1[i]*I1[i] - trb2[i])/2.;
+		eQ[i] = exp(beta*((2*mu-lam)*(I1[i]-3) + lam*(I2-3))/Ha)/pow(I3[i], beta);
+
+		// s = 0.5*eQ/J*((2*mu+lam*(I1-1))*b - lam*b2 - Ha*I)
+		double a = 0.5*eQ[i]/batch.J[i];
+		double g = 2*mu + lam*(I1[i] - 1);
+		batch.s[0][i] = a*(g*batch.b[0][i] - lam*b2[0][i] - Ha);
+		batch.s[1][i] = a*(g*batch.b[1][i] - lam*b2[1][i] - Ha);
+		batch.s[2][i] = a*(g*batch.b[2][i] - lam*b2[2][i] - Ha);
+		batch.s[3][i] = a*(g*batch.b[3][i] - lam*b2[3][i]);
+		batch.s[4][i] = a*(g*batch.b[4][i] - lam*b2[4][i]);
+		batch.s[5][i] = a*(g*batch.b[5][i] - lam*b2[5][i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FEHolmesMow::StressBatch(FEElasticMaterialBatch& batch)
+{
+	double eQ[FEElasticMaterialBatch::MAX_POINTS];
+	holmes_mow_stress(*this, batch, eQ);
+}
+
+//-----------------------------------------------------------------------------
+void FEHolmesMow::TangentBatch(FEElasticMaterialBatch& batch)
+{
+	const int N = FEElasticMaterialBatch::MAX_POINTS;
+	const int n = batch.Points();
+
+	// this also recalculates the stress
+	double eQ[N];
+	holmes_mow_stress(*this, batch, eQ);
+
+	// c = 4*beta/Ha*J/eQ*(s dyad1s s) + eQ/J*(lam*(b dyad1s b - b dyad4s b) + Ha*I4)
+	double a[N], l[N], ml[N], h[N];
+	for (int i = 0; i < n; ++i)
+	{
+		double J = batch.J[i];
+		a [i] = 4.*m_b/Ha*J/eQ[i];
+		l [i] = eQ[i]/J*lam;
+		ml[i] = -l[i];
+		h [i] = eQ[i]/J*Ha;
+	}
+
+	batch.ZeroTangent();
+	batch.AddDyad1s(a, batch.s);
+	batch.AddDyad1s(l, batch.b);
+	batch.AddDyad4s(ml, batch.b);
+	batch.AddI4(h);
+}
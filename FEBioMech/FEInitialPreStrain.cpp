@@ -25,7 +25,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.*/
 #include "stdafx.h"
 #include "FEInitialPreStrain.h"
-#include <FECore/FEDomain.h>
+#include <FECore/FESolidDomain.h>
 #include <FECore/FEModel.h>
 #include "FEConstPrestrain.h"
 
@@ -105,10 +105,17 @@ void FEInitialPreStrain::Activate()
 		for (int i=0; i<NN; ++i)
 		{
 			FENode& node = mesh.Node(i);
-			node.m_r0 = node.m_rt;
+			node.m_r0() = node.m_rt();
 			node.set(dofX, 0.0);
 			node.set(dofY, 0.0);
 			node.set(dofZ, 0.0);
 		}
+
+		// the reference configuration changed, so update cached reference gradients
+		for (int i = 0; i < mesh.Domains(); ++i)
+		{
+			FESolidDomain* dom = dynamic_cast<FESolidDomain*>(&mesh.Domain(i));
+			if (dom && dom->ReferenceGradientCache()) dom->UpdateReferenceGradientCache();
+		}
 	}
 }
@@ -64,7 +64,7 @@ void FEInitialVelocity::GetNodalValues(int inode, std::vector<double>& values)
 	const FENode& node = *nset.Node(inode);
 
 	FEMaterialPoint mp;
-	mp.m_r0 = node.m_r0;
+	mp.m_r0 = node.m_r0();
 	mp.m_index = inode;
 
 	vec3d v0 = m_v0(mp);
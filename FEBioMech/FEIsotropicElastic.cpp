@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FEIsotropicElastic.h"
+#include "FEElasticMaterialBatch.h"
 
 //-----------------------------------------------------------------------------
 // define the material parameters
@@ -146,3 +147,58 @@ tens4ds FEIsotropicElastic::MaterialTangent(FEMaterialPoint& pt, const mat3ds E)
     
     return c;
 }
+
+//-----------------------------------------------------------------------------
+// helper function for evaluating the (scaled) lame parameters at all points of the batch
+static void isotropic_elastic_lame(FEIsotropicElastic& mat, FEElasticMaterialBatch& batch, double* lam, double* mu)
+{
+	for (int i = 0; i < batch.Points(); ++i)
+	{
+		FEMaterialPoint& mp = batch.MaterialPoint(i);
+		double E = mat.m_E(mp);
+		double v = mat.m_v(mp);
+		double Ji = 1.0 / batch.J[i];
+		lam[i] = Ji*(v*E/((1+v)*(1-2*v)));
+		mu [i] = Ji*(0.5*E/(1+v));
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FEIsotropicElastic::StressBatch(FEElasticMaterialBatch& batch)
+{
+	const int N = FEElasticMaterialBatch::MAX_POINTS;
+	const int n = batch.Points();
+
+	double lam[N], mu[N];
+	isotropic_elastic_lame(*this, batch, lam, mu);
+
+	// square of b-matrix
+	double b2[6][N];
+	FEElasticMaterialBatch::Square(n, batch.b, b2);
+
+	// s = b*(lam*trE - mu) + b2*mu
+	for (int i = 0; i < n; ++i)
+	{
+		double trE = 0.5*(batch.b[0][i] + batch.b[1][i] + batch.b[2][i] - 3);
+		double a = lam[i]*trE - mu[i];
+		for (int k = 0; k < 6; ++k) batch.s[k][i] = batch.b[k][i]*a + b2[k][i]*mu[i];
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FEIsotropicElastic::TangentBatch(FEElasticMaterialBatch& batch)
+{
+	const int N = FEElasticMaterialBatch::MAX_POINTS;
+	const int n = batch.Points();
+
+	double lam[N], mu[N];
+	isotropic_elastic_lame(*this, batch, lam, mu);
+
+	// c = lam*(b dyad1s b) + 2*mu*(b dyad4s b)
+	double mu2[N];
+	for (int i = 0; i < n; ++i) mu2[i] = 2.0*mu[i];
+
+	batch.ZeroTangent();
+	batch.AddDyad1s(lam, batch.b);
+	batch.AddDyad4s(mu2, batch.b);
+}
@@ -61,14 +61,14 @@ bool FEMergedConstraint::Merge(FEFacetSet* surf1, FEFacetSet* surf2, const vecto
 	for (int i=0; i<N1; ++i)
 	{
 		// get the node position
-		vec3d ri = set1.Node(i)->m_rt;
+		vec3d ri = set1.Node(i)->m_rt();
 
 		// find the closest node
 		int n = 0;
-		double Dmin = (set2.Node(0)->m_rt - ri).norm2();
+		double Dmin = (set2.Node(0)->m_rt() - ri).norm2();
 		for (int j=1; j<N2; ++j)
 		{
-			vec3d rj = set2.Node(j)->m_rt;
+			vec3d rj = set2.Node(j)->m_rt();
 			double D2 = (ri - rj).norm2();
 			if (D2 < Dmin)
 			{
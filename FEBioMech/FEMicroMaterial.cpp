@@ -333,7 +333,7 @@ mat3d FEMicroMaterial::AveragedStressPK1(FEModel& rve, FEMaterialPoint &mp)
 				// We multiply by two since the reaction forces are only stored at the primary surface 
 				// and we also need to sum over the secondary nodes (NOTE: should I figure out a way to 
 				// store the reaction forces on the secondary nodes as well?)
-				PK1 += (f & node.m_r0)*2.0;
+				PK1 += (f & node.m_r0())*2.0;
 			}
 		}
 	}
@@ -359,7 +359,7 @@ mat3d FEMicroMaterial::AveragedStressPK1(FEModel& rve, FEMaterialPoint &mp)
 		f.x = R[-n.m_ID[dof_X]-2];
 		f.y = R[-n.m_ID[dof_Y]-2];
 		f.z = R[-n.m_ID[dof_Z]-2];
-		PK1 += f & n.m_r0;
+		PK1 += f & n.m_r0();
 	}
 
 	double V0 = m_mrve.InitialVolume();
@@ -399,7 +399,7 @@ mat3ds FEMicroMaterial::AveragedStressPK2(FEModel& rve, FEMaterialPoint &mp)
 				// We multiply by two since the reaction forces are only stored at the primary surface 
 				// and we also need to sum over the secondary nodes (NOTE: should I figure out a way to 
 				// store the reaction forces on the secondary nodes as well?)
-				S += (f0 & node.m_r0)*2.0;
+				S += (f0 & node.m_r0())*2.0;
 			}
 		}
 	}
@@ -425,7 +425,7 @@ mat3ds FEMicroMaterial::AveragedStressPK2(FEModel& rve, FEMaterialPoint &mp)
 		f.y = R[-n.m_ID[dof_Y]-2];
 		f.z = R[-n.m_ID[dof_Z]-2];
 		vec3d f0 = Finv*f;
-		S += f0 & n.m_r0;
+		S += f0 & n.m_r0();
 	}
 
 	double V0 = m_mrve.InitialVolume();
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FEMooneyRivlin.h"
+#include "FEElasticMaterialBatch.h"
 
 //-----------------------------------------------------------------------------
 // define the material parameters
@@ -165,3 +166,112 @@ double FEMooneyRivlin::DevStrainEnergyDensity(FEMaterialPoint& mp)
     
     return sed;
 }
+
+//-----------------------------------------------------------------------------
+// helper function that evaluates the material parameters, the deviatoric left
+// Cauchy-Green tensor, its square and the invariants at all points of the batch
+static void mooney_rivlin_batch(FEMooneyRivlin& mat, FEElasticMaterialBatch& batch,
+	double* W1, double* W2, double B[][FEElasticMaterialBatch::MAX_POINTS], double B2[][FEElasticMaterialBatch::MAX_POINTS], double* I1, double* I2)
+{
+	const int n = batch.Points();
+	for (int i = 0; i < n; ++i)
+	{
+		FEMaterialPoint& mp = batch.MaterialPoint(i);
+		W1[i] = mat.m_c1(mp);
+		W2[i] = mat.m_c2(mp);
+	}
+
+	for (int i = 0; i < n; ++i)
+	{
+		double Jm23 = pow(batch.J[i], -2.0/3.0);
+		for (int k = 0; k < 6; ++k) B[k][i] = batch.b[k][i]*Jm23;
+	}
+
+	double trB2[FEElasticMaterialBatch::MAX_POINTS];
+	FEElasticMaterialBatch::Square(n, B, B2);
+	FEElasticMaterialBatch::Trace(n, B, I1);
+	FEElasticMaterialBatch::Trace(n, B2, trB2);
+	for (int i = 0; i < n; ++i) I2[i] = 0.5*(I1[i]*I1[i] - trB2[i]);
+}
+
+//-----------------------------------------------------------------------------
+//! Calculates the total stress (i.e. deviatoric stress plus pressure) for all points
+void FEMooneyRivlin::StressBatch(FEElasticMaterialBatch& batch)
+{
+	const int N = FEElasticMaterialBatch::MAX_POINTS;
+	const int n = batch.Points();
+
+	double W1[N], W2[N], B[6][N], B2[6][N], I1[N], I2[N];
+	mooney_rivlin_batch(*this, batch, W1, W2, B, B2, I1, I2);
+
+	double p[N];
+	for (int i = 0; i < n; ++i) p[i] = UJ(batch.J[i]);
+
+	for (int i = 0; i < n; ++i)
+	{
+		// T = B*(W1 + W2*I1) - B2*W2
+		double a = W1[i] + W2[i]*I1[i];
+		double T[6];
+		for (int k = 0; k < 6; ++k) T[k] = B[k][i]*a - B2[k][i]*W2[i];
+
+		// s = dev(T)*2/J + p*I
+		double trT = (T[0] + T[1] + T[2])/3.0;
+		double f = 2.0/batch.J[i];
+		batch.s[0][i] = (T[0] - trT)*f + p[i];
+		batch.s[1][i] = (T[1] - trT)*f + p[i];
+		batch.s[2][i] = (T[2] - trT)*f + p[i];
+		batch.s[3][i] = T[3]*f;
+		batch.s[4][i] = T[4]*f;
+		batch.s[5][i] = T[5]*f;
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! Calculates the total tangent (i.e. deviatoric plus dilatational) for all points.
+//! As in DevTangent, this uses the current stress of the material points.
+void FEMooneyRivlin::TangentBatch(FEElasticMaterialBatch& batch)
+{
+	const int N = FEElasticMaterialBatch::MAX_POINTS;
+	const int n = batch.Points();
+
+	double W1[N], W2[N], B[6][N], B2[6][N], I1[N], I2[N];
+	mooney_rivlin_batch(*this, batch, W1, W2, B, B2, I1, I2);
+
+	// deviatoric cauchy-stress and d2W/dCdC:C
+	double devs[6][N], WCCxC[6][N];
+	for (int i = 0; i < n; ++i)
+	{
+		double trs = (batch.s[0][i] + batch.s[1][i] + batch.s[2][i])/3.0;
+		for (int k = 0; k < 6; ++k) devs[k][i] = batch.s[k][i] - (k < 3 ? trs : 0.0);
+		for (int k = 0; k < 6; ++k) WCCxC[k][i] = B[k][i]*(W2[i]*I1[i]) - B2[k][i]*W2[i];
+	}
+
+	// coefficients of the tangent terms
+	double aBB[N], mBB[N], aWC[N], aDs[N], aIxI[N], aI4[N];
+	for (int i = 0; i < n; ++i)
+	{
+		double J = batch.J[i];
+		double Ji = 1.0/J;
+		double WC = W1[i]*I1[i] + 2*W2[i]*I2[i];
+		double CWWC = 2*I2[i]*W2[i];
+		double p = UJ(J);
+
+		aBB [i] = W2[i]*4.0*Ji;
+		mBB [i] = -aBB[i];
+		aWC [i] = -4.0/3.0*Ji;
+		aDs [i] = -2.0/3.0;
+		aIxI[i] = 4.0/9.0*Ji*CWWC - 4.0/9.0*Ji*WC + p + UJJ(J)*J;
+		aI4 [i] = 4.0/3.0*Ji*WC - 2.0*p;
+	}
+
+	// c = (BxB - B4)*(4*W2/J) - (WCCxC dyad1s I)*(4/3/J) + IxI*(4/9/J*CWWC)
+	//   + (devs dyad1s I)*(-2/3) + (I4 - IxI/3)*(4/3/J*WC)
+	//   + (IxI - 2*I4)*p + IxI*(UJJ*J)
+	batch.ZeroTangent();
+	batch.AddDyad1s(aBB, B);
+	batch.AddDyad4s(mBB, B);
+	batch.AddDyad1sI(aWC, WCCxC);
+	batch.AddDyad1sI(aDs, devs);
+	batch.AddIxI(aIxI);
+	batch.AddI4(aI4);
+}
@@ -49,6 +49,11 @@ public:
 	//! calculate deviatoric tangent stiffness at material point
 	tens4ds DevTangent(FEMaterialPoint& pt) override;
 
+	//! batch evaluation of stress and tangent (see FEElasticMaterialBatch)
+	bool HasBatchEvaluation() const override { return true; }
+	void StressBatch(FEElasticMaterialBatch& batch) override;
+	void TangentBatch(FEElasticMaterialBatch& batch) override;
+
 	//! calculate deviatoric strain energy density
 	double DevStrainEnergyDensity(FEMaterialPoint& mp) override;
     
@@ -31,26 +31,63 @@ SOFTWARE.*/
 #include "FECore/mortar.h"
 #include "FECore/log.h"
 #include <FECore/FEMesh.h>
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 FEMortarInterface::FEMortarInterface(FEModel* pfem) : FEContactInterface(pfem)
 {
 	// set the integration rule
 	m_pT = dynamic_cast<FESurfaceElementTraits*>(FEElementLibrary::GetElementTraits(FE_TRI3G7));
+
+	m_srad = 0.1;
+}
+
+//-----------------------------------------------------------------------------
+// helper structure for collecting the contributions to the mortar weights
+struct MORTAR_WEIGHT
+{
+	int		row, col;
+	double	val;
+};
+
+//-----------------------------------------------------------------------------
+// Build a sparse matrix from a list of contributions. Contributions to the same 
+// entry are added in the order in which they appear in the list.
+static void BuildWeightMatrix(int nr, int nc, vector<MORTAR_WEIGHT>& w, CSRMatrix& M)
+{
+	std::stable_sort(w.begin(), w.end(), [](const MORTAR_WEIGHT& a, const MORTAR_WEIGHT& b) {
+		return (a.row < b.row) || ((a.row == b.row) && (a.col < b.col));
+	});
+
+	M.create(nr, nc);
+	vector<int>& rowIndex = M.pointers();
+	vector<int>& columns = M.indices();
+	vector<double>& values = M.values();
+	rowIndex.assign(nr + 1, 0);
+	columns.reserve(w.size());
+	values.reserve(w.size());
+
+	int lastRow = -1;
+	for (size_t i = 0; i < w.size(); ++i)
+	{
+		MORTAR_WEIGHT& wi = w[i];
+		if ((wi.row == lastRow) && (columns.back() == wi.col)) values.back() += wi.val;
+		else
+		{
+			columns.push_back(wi.col);
+			values.push_back(wi.val);
+			rowIndex[wi.row + 1]++;
+			lastRow = wi.row;
+		}
+	}
+	for (int i = 0; i < nr; ++i) rowIndex[i + 1] += rowIndex[i];
 }
 
 //-----------------------------------------------------------------------------
-void FEMortarInterface::UpdateMortarWeights(FESurface& ss, FESurface& ms)
+void FEMortarInterface::UpdateMortarWeights(FEMortarContactSurface& ss, FEMortarContactSurface& ms)
 {
-	// allocate sturcture for the integration weights
 	int NS = ss.Nodes();
 	int NM = ms.Nodes();
-	m_n1.resize(NS,NS);
-	m_n2.resize(NS,NM);
-
-	// clear weights
-	m_n1.zero();
-	m_n2.zero();
 
 	// number of integration points
 	const int MAX_INT = 11;
@@ -59,18 +96,43 @@ void FEMortarInterface::UpdateMortarWeights(FESurface& ss, FESurface& ms)
 	vector<double>& gr = m_pT->gr;
 	vector<double>& gs = m_pT->gs;
 
+	// The search radius determines which facets are intersected. It is at least
+	// the largest nodal gap of the last update, so that facets that were already
+	// coupled across a gap are found again.
+	double R = m_srad*GetFEModel()->GetMesh().GetBoundingBox().radius();
+	for (int i = 0; i < (int)ss.m_gap.size(); ++i)
+	{
+		double g = ss.m_gap[i].norm();
+		if (g > R) R = g;
+	}
+
 	// calculate the mortar surface
 	MortarSurface mortar;
-	CalculateMortarSurface(ss, ms, mortar);
+	CalculateMortarSurface(ss, ms, mortar, R);
 
-	// These arrays will store the shape function values of the projection points 
-	// on the primary and secondary side when evaluating the integral over a pallet
-	double Ns[MAX_INT][4], Nm[MAX_INT][4];
+	// Each patch contributes ns*ns weights to n1 and ns*nm weights to n2.
+	// We figure out where each patch stores its contributions so that the 
+	// patches can be processed in parallel.
+	int NP = mortar.Patches();
+	vector<int> off1(NP + 1, 0), off2(NP + 1, 0);
+	for (int i=0; i<NP; ++i)
+	{
+		Patch& pi = mortar.GetPatch(i);
+		int ns = ss.Element(pi.GetPrimaryFacetID()).Nodes();
+		int nm = ms.Element(pi.GetSecondaryFacetID()).Nodes();
+		off1[i + 1] = off1[i] + ns*ns;
+		off2[i + 1] = off2[i] + ns*nm;
+	}
+	vector<MORTAR_WEIGHT> w1(off1[NP]), w2(off2[NP]);
 
 	// loop over the mortar patches
-	int NP = mortar.Patches();
+#pragma omp parallel for schedule(dynamic, 16)
 	for (int i=0; i<NP; ++i)
 	{
+		// These arrays will store the shape function values of the projection points 
+		// on the primary and secondary side when evaluating the integral over a pallet
+		double Ns[MAX_INT][4], Nm[MAX_INT][4];
+
 		// get the next patch
 		Patch& pi = mortar.GetPatch(i);
 
@@ -83,6 +145,16 @@ void FEMortarInterface::UpdateMortarWeights(FESurface& ss, FESurface& ms)
 		// get the mortar surface element
 		FESurfaceElement& me = ms.Element(l);
 
+		int ns = se.Nodes();
+		int nm = me.Nodes();
+		MORTAR_WEIGHT* pw1 = (off1[i] < off1[i + 1] ? &w1[off1[i]] : 0);
+		MORTAR_WEIGHT* pw2 = (off2[i] < off2[i + 1] ? &w2[off2[i]] : 0);
+		for (int A=0; A<ns; ++A)
+		{
+			for (int B=0; B<ns; ++B) { MORTAR_WEIGHT& w = pw1[A*ns + B]; w.row = se.m_lnode[A]; w.col = se.m_lnode[B]; w.val = 0.0; }
+			for (int C=0; C<nm; ++C) { MORTAR_WEIGHT& w = pw2[A*nm + C]; w.row = se.m_lnode[A]; w.col = me.m_lnode[C]; w.val = 0.0; }
+		}
+
 		// loop over all patch triangles
 		int np = pi.Size();
 		for (int j=0; j<np; ++j)
@@ -117,12 +189,8 @@ void FEMortarInterface::UpdateMortarWeights(FESurface& ss, FESurface& ms)
 				}
 
 				// Evaluate the contributions to the integrals
-				int ns = se.Nodes();
-				int nm = me.Nodes();
 				for (int A=0; A<ns; ++A)
 				{
-					int a = se.m_lnode[A];
-
 					// loop over all the nodes on the primary facet
 					for (int B=0; B<ns; ++B)
 					{
@@ -133,8 +201,7 @@ void FEMortarInterface::UpdateMortarWeights(FESurface& ss, FESurface& ms)
 						}
 						n1 *= Area;
 
-						int b = se.m_lnode[B];
-						m_n1[a][b] += n1;
+						pw1[A*ns + B].val += n1;
 					}
 
 					// loop over all the nodes on the secondary facet
@@ -147,24 +214,25 @@ void FEMortarInterface::UpdateMortarWeights(FESurface& ss, FESurface& ms)
 						}
 						n2 *= Area;
 
-						int c = me.m_lnode[C];
-						m_n2[a][c] += n2;
+						pw2[A*nm + C].val += n2;
 					}
 				}
 			}		
 		}
 	}
 
+	// store the weights in sparse format
+	BuildWeightMatrix(NS, NS, w1, m_n1);
+	BuildWeightMatrix(NS, NM, w2, m_n2);
+
 #ifdef _DEBUG
 	// Sanity check: sum should add up to contact area
 	// This is for a hardcoded problem. Remove or generalize this!
 	double sum1 = 0.0;
-	for (int A=0; A<NS; ++A)
-		for (int B=0; B<NS; ++B) sum1 += m_n1[A][B];
+	for (int i=0; i<m_n1.nonzeroes(); ++i) sum1 += m_n1.values()[i];
 
 	double sum2 = 0.0;
-	for (int A=0; A<NS; ++A)
-		for (int C=0; C<NM; ++C) sum2 += m_n2[A][C];
+	for (int i=0; i<m_n2.nonzeroes(); ++i) sum2 += m_n2.values()[i];
 
 	if (fabs(sum1 - 1.0) > 1e-5) feLog("WARNING: Mortar weights are not correct (%lg).\n", sum1);
 	if (fabs(sum2 - 1.0) > 1e-5) feLog("WARNING: Mortar weights are not correct (%lg).\n", sum2);
@@ -180,26 +248,30 @@ void FEMortarInterface::UpdateNodalGaps(FEMortarContactSurface& ss, FEMortarCont
 	zero(ss.m_gap);
 
 	int NS = ss.Nodes();
-	int NM = ms.Nodes();
+
+	// sparse mortar weights
+	const vector<int>& P1 = m_n1.pointers(); const vector<int>& I1 = m_n1.indices(); const vector<double>& N1 = m_n1.values();
+	const vector<int>& P2 = m_n2.pointers(); const vector<int>& I2 = m_n2.indices(); const vector<double>& N2 = m_n2.values();
 
 	// loop over all primary nodes
+#pragma omp parallel for
 	for (int A=0; A<NS; ++A)
 	{
 		// loop over all primary nodes
-		for (int B=0; B<NS; ++B)
+		for (int b=P1[A]; b<P1[A+1]; ++b)
 		{
-			FENode& nodeB = ss.Node(B);
-			vec3d& xB = nodeB.m_rt;
-			double nAB = m_n1[A][B];
+			FENode& nodeB = ss.Node(I1[b]);
+			vec3d& xB = nodeB.m_rt();
+			double nAB = N1[b];
 			gap[A] += xB*nAB;
 		}
 
 		// loop over secondary side
-		for (int C=0; C<NM; ++C)
+		for (int c=P2[A]; c<P2[A+1]; ++c)
 		{
-			FENode& nodeC = ms.Node(C);
-			vec3d& xC = nodeC.m_rt;
-			double nAC = m_n2[A][C];
+			FENode& nodeC = ms.Node(I2[c]);
+			vec3d& xC = nodeC.m_rt();
+			double nAC = N2[c];
 			gap[A] -= xC*nAC;
 		}
 	}
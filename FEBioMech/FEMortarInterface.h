@@ -29,6 +29,7 @@ SOFTWARE.*/
 #pragma once
 #include "FEContactInterface.h"
 #include "FEMortarContactSurface.h"
+#include <FECore/CSRMatrix.h>
 
 //-----------------------------------------------------------------------------
 // Base class for mortar-type contact formulations
@@ -39,14 +40,18 @@ public:
 	FEMortarInterface(FEModel* pfem);
 
 	//! update the mortar weights
-	void UpdateMortarWeights(FESurface& ss, FESurface& ms);
+	void UpdateMortarWeights(FEMortarContactSurface& ss, FEMortarContactSurface& ms);
 
 	//! update the nodal gaps
 	void UpdateNodalGaps(FEMortarContactSurface& ss, FEMortarContactSurface& ms);
 
 protected:
-	matrix	m_n1;	//!< integration weights n1_AB
-	matrix	m_n2;	//!< integration weights n2_AB
+	// The integration weights are stored in sparse (row-compressed) format, since
+	// each primary node only couples to the nodes of the facets it overlaps.
+	CSRMatrix	m_n1;	//!< integration weights n1_AB
+	CSRMatrix	m_n2;	//!< integration weights n2_AB
+
+	double	m_srad;	//!< search radius (relative to the mesh size) for finding facets across a gap
 
 private:
 	// integration rule
@@ -81,9 +81,9 @@ void FEMortarSlidingSurface::UpdateNormals(bool binit)
 		int neln = el.Nodes();
 		for (int j=0; j<neln; ++j)
 		{
-			vec3d r0 = Node(el.m_lnode[j]).m_rt;
-			vec3d r1 = Node(el.m_lnode[(j+1)%neln]).m_rt;
-			vec3d r2 = Node(el.m_lnode[(j+neln-1)%neln]).m_rt;
+			vec3d r0 = Node(el.m_lnode[j]).m_rt();
+			vec3d r1 = Node(el.m_lnode[(j+1)%neln]).m_rt();
+			vec3d r2 = Node(el.m_lnode[(j+neln-1)%neln]).m_rt();
 
 			vec3d n = (r1 - r0)^(r2 - r0);
 			m_nu[el.m_lnode[j]] += n;
@@ -116,6 +116,7 @@ BEGIN_FECORE_CLASS(FEMortarSlidingContact, FEMortarInterface)
 	ADD_PARAMETER(m_eps    , "penalty"      );
 	ADD_PARAMETER(m_naugmin, "minaug"       );
 	ADD_PARAMETER(m_naugmax, "maxaug"       );
+	ADD_PARAMETER(m_srad   , "search_radius");
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
@@ -192,7 +193,10 @@ void FEMortarSlidingContact::BuildMatrixProfile(FEGlobalMatrix& K)
 void FEMortarSlidingContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 {
 	int NS = m_ss.Nodes();
-	int NM = m_ms.Nodes();
+
+	// sparse mortar weights
+	const vector<int>& P1 = m_n1.pointers(); const vector<int>& I1 = m_n1.indices(); const vector<double>& N1 = m_n1.values();
+	const vector<int>& P2 = m_n2.pointers(); const vector<int>& I2 = m_n2.indices(); const vector<double>& N2 = m_n2.values();
 
 	// loop over all primary nodes
 	for (int A=0; A<NS; ++A)
@@ -210,15 +214,16 @@ void FEMortarSlidingContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 		vector<int> en(1);
 		vector<int> lm(3);
 		vector<double> fe(3);
-		for (int B=0; B<NS; ++B)
+		for (int b=P1[A]; b<P1[A+1]; ++b)
 		{
+			int B = I1[b];
 			FENode& nodeB = m_ss.Node(B);
 			en[0] = m_ss.NodeIndex(B);
 			lm[0] = nodeB.m_ID[m_dofX];
 			lm[1] = nodeB.m_ID[m_dofY];
 			lm[2] = nodeB.m_ID[m_dofZ];
 
-			double nAB = -m_n1[A][B];
+			double nAB = -N1[b];
 			if (nAB != 0.0)
 			{
 				fe[0] = tA.x*nAB;
@@ -230,15 +235,16 @@ void FEMortarSlidingContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 		}
 
 		// loop over secondary side
-		for (int C=0; C<NM; ++C)
+		for (int c=P2[A]; c<P2[A+1]; ++c)
 		{
+			int C = I2[c];
 			FENode& nodeC = m_ms.Node(C);
 			en[0] = m_ms.NodeIndex(C);
 			lm[0] = nodeC.m_ID[m_dofX];
 			lm[1] = nodeC.m_ID[m_dofY];
 			lm[2] = nodeC.m_ID[m_dofZ];
 
-			double nAC = m_n2[A][C];
+			double nAC = N2[c];
 			if (nAC != 0.0)
 			{
 				fe[0] = tA.x*nAC;
@@ -264,7 +270,10 @@ void FEMortarSlidingContact::StiffnessMatrix(FELinearSystem& LS, const FETimeInf
 void FEMortarSlidingContact::ContactGapStiffness(FELinearSystem& LS)
 {
 	int NS = m_ss.Nodes();
-	int NM = m_ms.Nodes();
+
+	// sparse mortar weights
+	const vector<int>& P1 = m_n1.pointers(); const vector<int>& I1 = m_n1.indices(); const vector<double>& N1 = m_n1.values();
+	const vector<int>& P2 = m_n2.pointers(); const vector<int>& I2 = m_n2.indices(); const vector<double>& N2 = m_n2.values();
 
 	// A. Linearization of the gap function
 	vector<int> lmi(3), lmj(3);
@@ -277,14 +286,15 @@ void FEMortarSlidingContact::ContactGapStiffness(FELinearSystem& LS)
 		double eps = m_eps*m_ss.m_A[A];
 
 		// loop over all primary nodes
-		for (int B=0; B<NS; ++B)
+		for (int b=P1[A]; b<P1[A+1]; ++b)
 		{
+			int B = I1[b];
 			FENode& nodeB = m_ss.Node(B);
 			lmi[0] = nodeB.m_ID[0];
 			lmi[1] = nodeB.m_ID[1];
 			lmi[2] = nodeB.m_ID[2];
 
-			double nAB = m_n1[A][B];
+			double nAB = N1[b];
 			if (nAB != 0.0)
 			{
 				kA[0][0] = eps*nAB*(nuA.x*nuA.x); kA[0][1] = eps*nAB*(nuA.x*nuA.y); kA[0][2] = eps*nAB*(nuA.x*nuA.z);
@@ -292,14 +302,15 @@ void FEMortarSlidingContact::ContactGapStiffness(FELinearSystem& LS)
 				kA[2][0] = eps*nAB*(nuA.z*nuA.x); kA[2][1] = eps*nAB*(nuA.z*nuA.y); kA[2][2] = eps*nAB*(nuA.z*nuA.z);
 
 				// loop over primary nodes
-				for (int C=0; C<NS; ++C)
+				for (int c=P1[A]; c<P1[A+1]; ++c)
 				{
+					int C = I1[c];
 					FENode& nodeC = m_ss.Node(C);
 					lmj[0] = nodeC.m_ID[0];
 					lmj[1] = nodeC.m_ID[1];
 					lmj[2] = nodeC.m_ID[2];
 
-					double nAC = m_n1[A][C];
+					double nAC = N1[c];
 					if (nAC != 0.0)
 					{
 						kG[0][0] = nAC; kG[0][1] = 0.0; kG[0][2] = 0.0;
@@ -314,14 +325,15 @@ void FEMortarSlidingContact::ContactGapStiffness(FELinearSystem& LS)
 				}
 
 				// loop over secondary nodes
-				for (int C=0; C<NM; ++C)
+				for (int c=P2[A]; c<P2[A+1]; ++c)
 				{
+					int C = I2[c];
 					FENode& nodeC = m_ms.Node(C);
 					lmj[0] = nodeC.m_ID[0];
 					lmj[1] = nodeC.m_ID[1];
 					lmj[2] = nodeC.m_ID[2];
 
-					double nAC = -m_n2[A][C];
+					double nAC = -N2[c];
 					if (nAC != 0.0)
 					{
 						kG[0][0] = nAC; kG[0][1] = 0.0; kG[0][2] = 0.0;
@@ -338,14 +350,15 @@ void FEMortarSlidingContact::ContactGapStiffness(FELinearSystem& LS)
 		}
 
 		// loop over all secondary nodes
-		for (int B=0; B<NM; ++B)
+		for (int b=P2[A]; b<P2[A+1]; ++b)
 		{
+			int B = I2[b];
 			FENode& nodeB = m_ms.Node(B);
 			lmi[0] = nodeB.m_ID[0];
 			lmi[1] = nodeB.m_ID[1];
 			lmi[2] = nodeB.m_ID[2];
 
-			double nAB = -m_n2[A][B];
+			double nAB = -N2[b];
 			if (nAB != 0.0)
 			{
 				kA[0][0] = eps*nAB*(nuA.x*nuA.x); kA[0][1] = eps*nAB*(nuA.x*nuA.y); kA[0][2] = eps*nAB*(nuA.x*nuA.z);
@@ -353,14 +366,15 @@ void FEMortarSlidingContact::ContactGapStiffness(FELinearSystem& LS)
 				kA[2][0] = eps*nAB*(nuA.z*nuA.x); kA[2][1] = eps*nAB*(nuA.z*nuA.y); kA[2][2] = eps*nAB*(nuA.z*nuA.z);
 
 				// loop over primary nodes
-				for (int C=0; C<NS; ++C)
+				for (int c=P1[A]; c<P1[A+1]; ++c)
 				{
+					int C = I1[c];
 					FENode& nodeC = m_ss.Node(C);
 					lmj[0] = nodeC.m_ID[0];
 					lmj[1] = nodeC.m_ID[1];
 					lmj[2] = nodeC.m_ID[2];
 
-					double nAC = m_n1[A][C];
+					double nAC = N1[c];
 					if (nAC != 0.0)
 					{
 						kG[0][0] = nAC; kG[0][1] = 0.0; kG[0][2] = 0.0;
@@ -375,14 +389,15 @@ void FEMortarSlidingContact::ContactGapStiffness(FELinearSystem& LS)
 				}
 
 				// loop over secondary nodes
-				for (int C=0; C<NM; ++C)
+				for (int c=P2[A]; c<P2[A+1]; ++c)
 				{
+					int C = I2[c];
 					FENode& nodeC = m_ms.Node(C);
 					lmj[0] = nodeC.m_ID[0];
 					lmj[1] = nodeC.m_ID[1];
 					lmj[2] = nodeC.m_ID[2];
 
-					double nAC = -m_n2[A][C];
+					double nAC = -N2[c];
 					if (nAC != 0.0)
 					{
 						kG[0][0] = nAC; kG[0][1] = 0.0; kG[0][2] = 0.0;
@@ -404,8 +419,9 @@ void FEMortarSlidingContact::ContactGapStiffness(FELinearSystem& LS)
 //! calculate contact stiffness
 void FEMortarSlidingContact::ContactNormalStiffness(FELinearSystem& LS)
 {
-	int NS = m_ss.Nodes();
-	int NM = m_ms.Nodes();
+	// sparse mortar weights
+	const vector<int>& P1 = m_n1.pointers(); const vector<int>& I1 = m_n1.indices(); const vector<double>& N1 = m_n1.values();
+	const vector<int>& P2 = m_n2.pointers(); const vector<int>& I2 = m_n2.indices(); const vector<double>& N2 = m_n2.values();
 
 	vector<int> lm1(3);
 	vector<int> lm2(3);
@@ -431,25 +447,26 @@ void FEMortarSlidingContact::ContactNormalStiffness(FELinearSystem& LS)
 			mat3d kA = ((vA&gA)*eps + mat3dd(pA));
 
 			FENode& nodej1 = m_ss.Node(f.m_lnode[jp1]);
-			vec3d& x1 = nodej1.m_rt;
+			vec3d& x1 = nodej1.m_rt();
 			mat3da k1(x1);
 			lm1[0] = nodej1.m_ID[0];
 			lm1[1] = nodej1.m_ID[1];
 			lm1[2] = nodej1.m_ID[2];
 
 			FENode& nodej2 = m_ss.Node(f.m_lnode[jm1]);
-			vec3d& x2 = nodej2.m_rt;
+			vec3d& x2 = nodej2.m_rt();
 			mat3da k2(x2);
 			lm2[0] = nodej2.m_ID[0];
 			lm2[1] = nodej2.m_ID[1];
 			lm2[2] = nodej2.m_ID[2];
 
 			// loop over primary nodes
-			for (int B=0; B<NS; ++B)
+			for (int b=P1[A]; b<P1[A+1]; ++b)
 			{
+				int B = I1[b];
 				FENode& nodeB = m_ss.Node(B);
 				
-				double nAB = m_n1[A][B];
+				double nAB = N1[b];
 				if (nAB != 0.0)
 				{
 					vector<int> lmi(3);
@@ -476,11 +493,12 @@ void FEMortarSlidingContact::ContactNormalStiffness(FELinearSystem& LS)
 			}
 
 			// loop over secondary nodes
-			for (int B=0; B<NM; ++B)
+			for (int b=P2[A]; b<P2[A+1]; ++b)
 			{
+				int B = I2[b];
 				FENode& nodeB = m_ms.Node(B);
 				
-				double nAB = m_n2[A][B];
+				double nAB = N2[b];
 				if (nAB != 0.0)
 				{
 					vector<int> lmi(3);
@@ -67,6 +67,7 @@ BEGIN_FECORE_CLASS(FEMortarTiedContact, FEMortarInterface)
 	ADD_PARAMETER(m_eps    , "penalty"      );
 	ADD_PARAMETER(m_naugmin, "minaug"       );
 	ADD_PARAMETER(m_naugmax, "maxaug"       );
+	ADD_PARAMETER(m_srad   , "search_radius");
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
@@ -135,7 +136,10 @@ void FEMortarTiedContact::BuildMatrixProfile(FEGlobalMatrix& K)
 void FEMortarTiedContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 {
 	int NS = m_ss.Nodes();
-	int NM = m_ms.Nodes();
+
+	// sparse mortar weights
+	const vector<int>& P1 = m_n1.pointers(); const vector<int>& I1 = m_n1.indices(); const vector<double>& N1 = m_n1.values();
+	const vector<int>& P2 = m_n2.pointers(); const vector<int>& I2 = m_n2.indices(); const vector<double>& N2 = m_n2.values();
 
 	// loop over all primary nodes
 	for (int A=0; A<NS; ++A)
@@ -148,15 +152,16 @@ void FEMortarTiedContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 		vector<int> en(1);
 		vector<int> lm(3);
 		vector<double> fe(3);
-		for (int B=0; B<NS; ++B)
+		for (int b=P1[A]; b<P1[A+1]; ++b)
 		{
+			int B = I1[b];
 			FENode& nodeB = m_ss.Node(B);
 			en[0] = m_ss.NodeIndex(B);
 			lm[0] = nodeB.m_ID[m_dofX];
 			lm[1] = nodeB.m_ID[m_dofY];
 			lm[2] = nodeB.m_ID[m_dofZ];
 
-			double nAB = -m_n1[A][B];
+			double nAB = -N1[b];
 			if (nAB != 0.0)
 			{
 				fe[0] = tA.x*nAB;
@@ -168,15 +173,16 @@ void FEMortarTiedContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 		}
 
 		// loop over secondary side
-		for (int C=0; C<NM; ++C)
+		for (int c=P2[A]; c<P2[A+1]; ++c)
 		{
+			int C = I2[c];
 			FENode& nodeC = m_ms.Node(C);
 			en[0] = m_ms.NodeIndex(C);
 			lm[0] = nodeC.m_ID[m_dofX];
 			lm[1] = nodeC.m_ID[m_dofY];
 			lm[2] = nodeC.m_ID[m_dofZ];
 
-			double nAC = m_n2[A][C];
+			double nAC = N2[c];
 			if (nAC != 0.0)
 			{
 				fe[0] = tA.x*nAC;
@@ -194,7 +200,10 @@ void FEMortarTiedContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 void FEMortarTiedContact::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 {
 	int NS = m_ss.Nodes();
-	int NM = m_ms.Nodes();
+
+	// sparse mortar weights
+	const vector<int>& P1 = m_n1.pointers(); const vector<int>& I1 = m_n1.indices(); const vector<double>& N1 = m_n1.values();
+	const vector<int>& P2 = m_n2.pointers(); const vector<int>& I2 = m_n2.indices(); const vector<double>& N2 = m_n2.values();
 
 	// A. Linearization of the gap function
 	vector<int> lmi(3), lmj(3);
@@ -205,25 +214,27 @@ void FEMortarTiedContact::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 		double eps = m_eps*m_ss.m_A[A];
 
 		// loop over all primary nodes
-		for (int B=0; B<NS; ++B)
+		for (int b=P1[A]; b<P1[A+1]; ++b)
 		{
+			int B = I1[b];
 			FENode& nodeB = m_ss.Node(B);
 			lmi[0] = nodeB.m_ID[0];
 			lmi[1] = nodeB.m_ID[1];
 			lmi[2] = nodeB.m_ID[2];
 
-			double nAB = m_n1[A][B]*eps;
+			double nAB = N1[b]*eps;
 			if (nAB != 0.0)
 			{
 				// loop over primary nodes
-				for (int C=0; C<NS; ++C)
+				for (int c=P1[A]; c<P1[A+1]; ++c)
 				{
+					int C = I1[c];
 					FENode& nodeC = m_ss.Node(C);
 					lmj[0] = nodeC.m_ID[0];
 					lmj[1] = nodeC.m_ID[1];
 					lmj[2] = nodeC.m_ID[2];
 
-					double nAC = m_n1[A][C]*nAB;
+					double nAC = N1[c]*nAB;
 					if (nAC != 0.0)
 					{
 						ke[0][0] = nAC; ke[0][1] = 0.0; ke[0][2] = 0.0;
@@ -236,14 +247,15 @@ void FEMortarTiedContact::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 				}
 
 				// loop over secondary nodes
-				for (int C=0; C<NM; ++C)
+				for (int c=P2[A]; c<P2[A+1]; ++c)
 				{
+					int C = I2[c];
 					FENode& nodeC = m_ms.Node(C);
 					lmj[0] = nodeC.m_ID[0];
 					lmj[1] = nodeC.m_ID[1];
 					lmj[2] = nodeC.m_ID[2];
 
-					double nAC = -m_n2[A][C]*nAB;
+					double nAC = -N2[c]*nAB;
 					if (nAC != 0.0)
 					{
 						ke[0][0] = nAC; ke[0][1] = 0.0; ke[0][2] = 0.0;
@@ -258,25 +270,27 @@ void FEMortarTiedContact::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 		}
 
 		// loop over all secondary nodes
-		for (int B=0; B<NM; ++B)
+		for (int b=P2[A]; b<P2[A+1]; ++b)
 		{
+			int B = I2[b];
 			FENode& nodeB = m_ms.Node(B);
 			lmi[0] = nodeB.m_ID[0];
 			lmi[1] = nodeB.m_ID[1];
 			lmi[2] = nodeB.m_ID[2];
 
-			double nAB = -m_n2[A][B]*eps;
+			double nAB = -N2[b]*eps;
 			if (nAB != 0.0)
 			{
 				// loop over primary nodes
-				for (int C=0; C<NS; ++C)
+				for (int c=P1[A]; c<P1[A+1]; ++c)
 				{
+					int C = I1[c];
 					FENode& nodeC = m_ss.Node(C);
 					lmj[0] = nodeC.m_ID[0];
 					lmj[1] = nodeC.m_ID[1];
 					lmj[2] = nodeC.m_ID[2];
 
-					double nAC = m_n1[A][C]*nAB;
+					double nAC = N1[c]*nAB;
 					if (nAC != 0.0)
 					{
 						ke[0][0] = nAC; ke[0][1] = 0.0; ke[0][2] = 0.0;
@@ -289,14 +303,15 @@ void FEMortarTiedContact::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 				}
 
 				// loop over secondary nodes
-				for (int C=0; C<NM; ++C)
+				for (int c=P2[A]; c<P2[A+1]; ++c)
 				{
+					int C = I2[c];
 					FENode& nodeC = m_ms.Node(C);
 					lmj[0] = nodeC.m_ID[0];
 					lmj[1] = nodeC.m_ID[1];
 					lmj[2] = nodeC.m_ID[2];
 
-					double nAC = -m_n2[A][C]*nAB;
+					double nAC = -N2[c]*nAB;
 					if (nAC != 0.0)
 					{
 						ke[0][0] = nAC; ke[0][1] = 0.0; ke[0][2] = 0.0;
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FENeoHookean.h"
+#include "FEElasticMaterialBatch.h"
 
 //-----------------------------------------------------------------------------
 // define the material parameters
@@ -167,3 +168,64 @@ tens4ds FENeoHookean::MaterialTangent(FEMaterialPoint& pt, const mat3ds ES)
     
     return c;
 }
+
+//-----------------------------------------------------------------------------
+// helper function for evaluating the lame parameters at all points of the batch
+static void neo_hookean_lame(FENeoHookean& mat, FEElasticMaterialBatch& batch, double* lam, double* mu)
+{
+	for (int i = 0; i < batch.Points(); ++i)
+	{
+		FEMaterialPoint& mp = batch.MaterialPoint(i);
+		double E = mat.m_E(mp);
+		double v = mat.m_v(mp);
+		lam[i] = v*E/((1+v)*(1-2*v));
+		mu [i] = 0.5*E/(1+v);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FENeoHookean::StressBatch(FEElasticMaterialBatch& batch)
+{
+	const int N = FEElasticMaterialBatch::MAX_POINTS;
+	const int n = batch.Points();
+
+	double lam[N], mu[N];
+	neo_hookean_lame(*this, batch, lam, mu);
+
+	// s = (b - I)*(mu/J) + I*(lam*lnJ/J)
+	for (int i = 0; i < n; ++i)
+	{
+		double detFi = 1.0/batch.J[i];
+		double a = mu[i]*detFi;
+		double p = lam[i]*log(batch.J[i])*detFi;
+		batch.s[0][i] = (batch.b[0][i] - 1.0)*a + p;
+		batch.s[1][i] = (batch.b[1][i] - 1.0)*a + p;
+		batch.s[2][i] = (batch.b[2][i] - 1.0)*a + p;
+		batch.s[3][i] = batch.b[3][i]*a;
+		batch.s[4][i] = batch.b[4][i]*a;
+		batch.s[5][i] = batch.b[5][i]*a;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FENeoHookean::TangentBatch(FEElasticMaterialBatch& batch)
+{
+	const int N = FEElasticMaterialBatch::MAX_POINTS;
+	const int n = batch.Points();
+
+	double lam[N], mu[N];
+	neo_hookean_lame(*this, batch, lam, mu);
+
+	// c = lam1*IxI + 2*mu1*I4
+	double lam1[N], mu2[N];
+	for (int i = 0; i < n; ++i)
+	{
+		double detFi = 1.0/batch.J[i];
+		lam1[i] = lam[i]*detFi;
+		mu2 [i] = 2.0*(mu[i] - lam[i]*log(batch.J[i]))*detFi;
+	}
+
+	batch.ZeroTangent();
+	batch.AddIxI(lam1);
+	batch.AddI4(mu2);
+}
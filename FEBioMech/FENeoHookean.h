@@ -50,6 +50,11 @@ public:
 	//! calculate tangent stiffness at material point
 	virtual tens4ds Tangent(FEMaterialPoint& pt) override;
 
+	//! batch evaluation of stress and tangent (see FEElasticMaterialBatch)
+	bool HasBatchEvaluation() const override { return true; }
+	void StressBatch(FEElasticMaterialBatch& batch) override;
+	void TangentBatch(FEElasticMaterialBatch& batch) override;
+
 	//! calculate strain energy density at material point
 	virtual double StrainEnergyDensity(FEMaterialPoint& pt) override;
     
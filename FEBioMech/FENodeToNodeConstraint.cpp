@@ -28,6 +28,7 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include <FECore/FELinearSystem.h>
 #include <FECore/FEGlobalMatrix.h>
+#include <FECore/DumpStream.h>
 
 BEGIN_FECORE_CLASS(FENodeToNodeConstraint, FENLConstraint)
 	ADD_PARAMETER(m_a, FE_RANGE_GREATER(0), "a");
@@ -37,9 +38,34 @@ END_FECORE_CLASS();
 FENodeToNodeConstraint::FENodeToNodeConstraint(FEModel* fem) : FENLConstraint(fem)
 {
 	m_a = m_b = -1;
+	m_na = m_nb = -1;
 	m_Lm = vec3d(0, 0, 0);
 }
 
+// find the indices of the two nodes
+bool FENodeToNodeConstraint::Init()
+{
+	// The nodes are defined by their IDs, which can differ from
+	// the node indices (e.g. when the mesh was reordered)
+	FEMesh& mesh = GetFEModel()->GetMesh();
+	m_na = m_nb = -1;
+	for (int i = 0; i < mesh.Nodes(); ++i)
+	{
+		int nid = mesh.Node(i).GetID();
+		if (nid == m_a) m_na = i;
+		if (nid == m_b) m_nb = i;
+	}
+	if ((m_na < 0) || (m_nb < 0)) return false;
+
+	return FENLConstraint::Init();
+}
+
+void FENodeToNodeConstraint::Serialize(DumpStream& ar)
+{
+	FENLConstraint::Serialize(ar);
+	ar & m_na & m_nb;
+}
+
 // allocate equations
 int FENodeToNodeConstraint::InitEquations(int neq)
 {
@@ -64,13 +90,13 @@ void FENodeToNodeConstraint::UnpackLM(vector<int>& lm)
 	FEMesh& mesh = fem.GetMesh();
 
 	// add the dofs of node A
-	FENode& node_a = mesh.Node(m_a - 1);
+	FENode& node_a = mesh.Node(m_na);
 	lm.push_back(node_a.m_ID[dofX]);
 	lm.push_back(node_a.m_ID[dofY]);
 	lm.push_back(node_a.m_ID[dofZ]);
 
 	// add the dofs of node B
-	FENode& node_b = mesh.Node(m_b - 1);
+	FENode& node_b = mesh.Node(m_nb);
 	lm.push_back(node_b.m_ID[dofX]);
 	lm.push_back(node_b.m_ID[dofY]);
 	lm.push_back(node_b.m_ID[dofZ]);
@@ -93,8 +119,8 @@ void FENodeToNodeConstraint::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 {
 	FEModel& fem = *GetFEModel();
 	FEMesh& mesh = fem.GetMesh();
-	vec3d ra = mesh.Node(m_a - 1).m_rt;
-	vec3d rb = mesh.Node(m_b - 1).m_rt;
+	vec3d ra = mesh.Node(m_na).m_rt();
+	vec3d rb = mesh.Node(m_nb).m_rt();
 	vec3d c = ra - rb;
 
 	vector<double> fe(9, 0.0);
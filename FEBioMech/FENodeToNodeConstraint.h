@@ -31,6 +31,12 @@ class FENodeToNodeConstraint : public FENLConstraint
 public:
 	FENodeToNodeConstraint(FEModel* fem);
 
+	// find the nodes
+	bool Init() override;
+
+	// serialize data
+	void Serialize(DumpStream& ar) override;
+
 	// allocate equations
 	int InitEquations(int neq) override;
 
@@ -49,7 +55,8 @@ protected:
 	void Update(const std::vector<double>& ui) override;
 
 private:
-	int		m_a, m_b;
+	int		m_a, m_b;	// node IDs
+	int		m_na, m_nb;	// node indices
 	vec3d	m_Lm;
 
 	vector<int> m_LM;
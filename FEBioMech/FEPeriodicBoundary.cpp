@@ -97,7 +97,7 @@ vec3d FEPeriodicSurface::CenterOfMass()
 {
 	vec3d c(0,0,0);
 	int N = Nodes();
-	for (int i=0; i<N; ++i) c += Node(i).m_r0;
+	for (int i=0; i<N; ++i) c += Node(i).m_r0();
 	if (N != 0) c /= (double) N;
 	return c;
 }
@@ -241,7 +241,7 @@ void FEPeriodicBoundary::BuildMatrixProfile(FEGlobalMatrix& K)
 
 		for (int k=0; k<n; ++k)
 		{
-			vector<int>& id = mesh.Node(en[k]).m_ID;
+			FENodeArray<int>& id = mesh.Node(en[k]).m_ID;
 			lm[6*(k+1)  ] = id[dof_X];
 			lm[6*(k+1)+1] = id[dof_Y];
 			lm[6*(k+1)+2] = id[dof_Z];
@@ -286,7 +286,7 @@ void FEPeriodicBoundary::ProjectSurface(FEPeriodicSurface& ss, FEPeriodicSurface
 		FENode& node = ss.Node(i);
 
 		// get the nodal position
-		vec3d r0 = node.m_r0;
+		vec3d r0 = node.m_r0();
 
 		// find the intersection with the secondary surface
 		ss.m_data[i].m_pme = np.Project3(r0, cn, rs);
@@ -324,7 +324,7 @@ void FEPeriodicBoundary::Update()
 		{
 			// calculate the primary displacement
 			FENode& node = ss.Node(i);
-			us = node.m_rt - node.m_r0;
+			us = node.m_rt() - node.m_r0();
 
 			// get the secondary element
 			pme = ss.m_data[i].m_pme;
@@ -334,7 +334,7 @@ void FEPeriodicBoundary::Update()
 			for (j=0; j<ne; ++j)
 			{
 				FENode& node = ms.Node(pme->m_lnode[j]);
-				umi[j] = node.m_rt - node.m_r0;
+				umi[j] = node.m_rt() - node.m_r0();
 			}
 			um = pme->eval(umi, ss.m_data[i].m_rs[0], ss.m_data[i].m_rs[1]);
 
@@ -404,8 +404,8 @@ void FEPeriodicBoundary::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 
 			for (int i=0; i<nseln; ++i)
 			{
-				r0[i] = ss.GetMesh()->Node(sel.m_node[i]).m_r0;
-				rt[i] = ss.GetMesh()->Node(sel.m_node[i]).m_rt;
+				r0[i] = ss.GetMesh()->Node(sel.m_node[i]).m_r0();
+				rt[i] = ss.GetMesh()->Node(sel.m_node[i]).m_rt();
 			}
 			w = sel.GaussWeights();
 
@@ -561,8 +561,8 @@ void FEPeriodicBoundary::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& t
 
 			for (int i=0; i<nseln; ++i)
 			{
-				r0[i] = ss.GetMesh()->Node(se.m_node[i]).m_r0;
-				rt[i] = ss.GetMesh()->Node(se.m_node[i]).m_rt;
+				r0[i] = ss.GetMesh()->Node(se.m_node[i]).m_r0();
+				rt[i] = ss.GetMesh()->Node(se.m_node[i]).m_rt();
 			}
 
 			w = se.GaussWeights();
@@ -597,7 +597,7 @@ void FEPeriodicBoundary::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& t
 				nmeln = me.Nodes();
 
 				// get the secondary element node positions
-				for (k=0; k<nmeln; ++k) rtm[k] = ms.GetMesh()->Node(me.m_node[k]).m_rt;
+				for (k=0; k<nmeln; ++k) rtm[k] = ms.GetMesh()->Node(me.m_node[k]).m_rt();
 
 				// primary node natural coordinates in secondary element
 				r = ss.m_data[m].m_rs[0];
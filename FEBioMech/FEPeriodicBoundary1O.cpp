@@ -145,7 +145,7 @@ void FEPeriodicBoundary1O::BuildMatrixProfile(FEGlobalMatrix& K)
 
 		for (int k=0; k<n; ++k)
 		{
-			vector<int>& id = mesh.Node(en[k]).m_ID;
+			FENodeArray<int>& id = mesh.Node(en[k]).m_ID;
 			lm[6*(k+1)  ] = id[dof_X];
 			lm[6*(k+1)+1] = id[dof_Y];
 			lm[6*(k+1)+2] = id[dof_Z];
@@ -190,7 +190,7 @@ void FEPeriodicBoundary1O::ProjectSurface(FEPeriodicSurface& ss, FEPeriodicSurfa
 		FENode& node = ss.Node(i);
 
 		// get the nodal position
-		vec3d r0 = node.m_r0;
+		vec3d r0 = node.m_r0();
 
 		// find the intersection with the secondary surface
 		ss.m_data[i].m_pme = np.Project3(r0, cn, rs);
@@ -230,7 +230,7 @@ void FEPeriodicBoundary1O::Update()
 		{
 			// calculate the primary displacement
 			FENode& node = ss.Node(i);
-			ws = node.m_rt - m_Fmacro*node.m_r0;
+			ws = node.m_rt() - m_Fmacro*node.m_r0();
 
 			// get the secondary element
 			pme = ss.m_data[i].m_pme;
@@ -240,7 +240,7 @@ void FEPeriodicBoundary1O::Update()
 			for (j=0; j<ne; ++j)
 			{
 				FENode& node = ms.Node(pme->m_lnode[j]);
-				wmi[j] = node.m_rt - m_Fmacro*node.m_r0;
+				wmi[j] = node.m_rt() - m_Fmacro*node.m_r0();
 			}
 			
 			wm = pme->eval(wmi, ss.m_data[i].m_rs[0], ss.m_data[i].m_rs[1]);
@@ -310,8 +310,8 @@ void FEPeriodicBoundary1O::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 
 			for (int i=0; i<nseln; ++i)
 			{
-				r0[i] = ss.GetMesh()->Node(sel.m_node[i]).m_r0;
-				rt[i] = ss.GetMesh()->Node(sel.m_node[i]).m_rt;
+				r0[i] = ss.GetMesh()->Node(sel.m_node[i]).m_r0();
+				rt[i] = ss.GetMesh()->Node(sel.m_node[i]).m_rt();
 			}
 			w = sel.GaussWeights();
 
@@ -467,8 +467,8 @@ void FEPeriodicBoundary1O::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 
 			for (int i=0; i<nseln; ++i)
 			{
-				r0[i] = ss.GetMesh()->Node(se.m_node[i]).m_r0;
-				rt[i] = ss.GetMesh()->Node(se.m_node[i]).m_rt;
+				r0[i] = ss.GetMesh()->Node(se.m_node[i]).m_r0();
+				rt[i] = ss.GetMesh()->Node(se.m_node[i]).m_rt();
 			}
 
 			w = se.GaussWeights();
@@ -503,7 +503,7 @@ void FEPeriodicBoundary1O::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 				nmeln = me.Nodes();
 
 				// get the secondary element node positions
-				for (k=0; k<nmeln; ++k) rtm[k] = ms.GetMesh()->Node(me.m_node[k]).m_rt;
+				for (k=0; k<nmeln; ++k) rtm[k] = ms.GetMesh()->Node(me.m_node[k]).m_rt();
 
 				// primary node natural coordinates in secondary element
 				r = ss.m_data[m].m_rs[0];
@@ -110,7 +110,7 @@ bool FEPeriodicLinearConstraint::GenerateConstraints(FEModel* fem)
 	if (refNode == -1) return false;
 
 	// get the position of the reference node
-	vec3d rm = mesh.Node(refNode).m_r0;
+	vec3d rm = mesh.Node(refNode).m_r0();
 
 	// create the linear constraints for the surface nodes that don't belong to an edge (i.e. tag = 1)
 	for (size_t n = 0; n<m_set.size(); ++n)
@@ -131,7 +131,7 @@ bool FEPeriodicLinearConstraint::GenerateConstraints(FEModel* fem)
 			if (tag[ss[i]] == -1)
 			{
 				// get the primary node position
-				vec3d& rs = ss.Node(i)->m_r0;
+				vec3d& rs = ss.Node(i)->m_r0();
 
 				// find the closest secondary node
 				int m = closestNode(mesh, ms, rs);
@@ -202,7 +202,7 @@ bool FEPeriodicLinearConstraint::GenerateConstraints(FEModel* fem)
 		FENodeList& edge = secondaryEdges[i];
 
 		// get the edge vector
-		Em[i] = edge.Node(0)->m_r0 - edge.Node(1)->m_r0; assert(edge[0] != edge[1]); 
+		Em[i] = edge.Node(0)->m_r0() - edge.Node(1)->m_r0(); assert(edge[0] != edge[1]); 
 		Em[i].unit();
 	}
 
@@ -212,7 +212,7 @@ bool FEPeriodicLinearConstraint::GenerateConstraints(FEModel* fem)
 		FENodeList& edge = primaryEdges[n];
 
 		// get the edge vector
-		vec3d E = edge.Node(0)->m_r0 - edge.Node(1)->m_r0; assert(edge[0] != edge[1]); E.unit();
+		vec3d E = edge.Node(0)->m_r0() - edge.Node(1)->m_r0(); assert(edge[0] != edge[1]); E.unit();
 
 		// find the corresponding secondary edge
 		bool bfound = true;
@@ -229,7 +229,7 @@ bool FEPeriodicLinearConstraint::GenerateConstraints(FEModel* fem)
 					assert(tag[edge[i]] < 0);
 					if (tag[edge[i]] == -2)
 					{
-						vec3d ri = edge.Node(i)->m_r0;
+						vec3d ri = edge.Node(i)->m_r0();
 						int k = closestNode(mesh, medge, ri);
 
 						addLinearConstraint(*fem, edge[i], medge[k], edge[mref], refNode);
@@ -252,7 +252,7 @@ int closestNode(FEMesh& mesh, const FENodeList& set, const vec3d& r)
 	double Dmin = 0.0;
 	for (int i = 0; i<(int)set.Size(); ++i)
 	{
-		vec3d& ri = mesh.Node(set[i]).m_r0;
+		vec3d& ri = mesh.Node(set[i]).m_r0();
 		double D = (r - ri)*(r - ri);
 		if ((D < Dmin) || (nmin == -1))
 		{
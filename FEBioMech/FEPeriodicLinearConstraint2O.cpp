@@ -73,7 +73,7 @@ int FEPeriodicLinearConstraint2O::closestNode(FEMesh& mesh, const FENodeList& se
 	double Dmin = 0.0;
 	for (int i = 0; i<(int)set.Size(); ++i)
 	{
-		vec3d& ri = mesh.Node(set[i]).m_r0;
+		vec3d& ri = mesh.Node(set[i]).m_r0();
 		double D = (r - ri)*(r - ri);
 		if ((D < Dmin) || (nmin == -1))
 		{
@@ -210,7 +210,7 @@ bool FEPeriodicLinearConstraint2O::GenerateConstraints(FEModel* fem)
 		FENodeList& edge = secondaryEdges[i];
 
 		// get the edge vector
-		Em[i] = edge.Node(0)->m_r0 - edge.Node(1)->m_r0; assert(edge[0] != edge[1]);
+		Em[i] = edge.Node(0)->m_r0() - edge.Node(1)->m_r0(); assert(edge[0] != edge[1]);
 		Em[i].unit();
 	}
 
@@ -227,7 +227,7 @@ bool FEPeriodicLinearConstraint2O::GenerateConstraints(FEModel* fem)
 			if (tag[ss[i]] == -1)
 			{
 				// get the nodal position
-				vec3d rs = ss.Node(i)->m_r0;
+				vec3d rs = ss.Node(i)->m_r0();
 
 				// find the corresponding node on the secondary side
 				int m = closestNode(mesh, ms, rs);
@@ -245,7 +245,7 @@ bool FEPeriodicLinearConstraint2O::GenerateConstraints(FEModel* fem)
 		FENodeList& edge = primaryEdges[n];
 
 		// get the edge vector
-		vec3d E = edge.Node(0)->m_r0 - edge.Node(1)->m_r0; assert(edge[0] != edge[1]); E.unit();
+		vec3d E = edge.Node(0)->m_r0() - edge.Node(1)->m_r0(); assert(edge[0] != edge[1]); E.unit();
 
 		// find the corresponding secondary edge
 		bool bfound = true;
@@ -260,7 +260,7 @@ bool FEPeriodicLinearConstraint2O::GenerateConstraints(FEModel* fem)
 					assert(tag[edge[i]] < 0);
 					if (tag[edge[i]] == -2)
 					{
-						vec3d ri = edge.Node(i)->m_r0;
+						vec3d ri = edge.Node(i)->m_r0();
 						int k = closestNode(mesh, medge, ri);
 
 						addLinearConstraint(*fem, edge[i], medge[k]);
@@ -77,7 +77,7 @@ vec3d FEPeriodicSurfaceConstraintSurface::CenterOfMass()
 {
 	vec3d c(0, 0, 0);
 	int N = Nodes();
-	for (int i = 0; i<N; ++i) c += Node(i).m_r0;
+	for (int i = 0; i<N; ++i) c += Node(i).m_r0();
 	if (N != 0) c /= (double)N;
 	return c;
 }
@@ -182,7 +182,7 @@ void FEPeriodicSurfaceConstraint::BuildMatrixProfile(FEGlobalMatrix& K)
 
 	for (int k = 0; k<n0; ++k)
 	{
-		vector<int>& id = mesh.Node(nr0[k]).m_ID;
+		FENodeArray<int>& id = mesh.Node(nr0[k]).m_ID;
 		lm[6 * (k + 1)] = id[dof_X];
 		lm[6 * (k + 1) + 1] = id[dof_Y];
 		lm[6 * (k + 1) + 2] = id[dof_Z];
@@ -209,7 +209,7 @@ void FEPeriodicSurfaceConstraint::BuildMatrixProfile(FEGlobalMatrix& K)
 
 		for (int k = 0; k<n; ++k)
 		{
-			vector<int>& id = mesh.Node(en[k]).m_ID;
+			FENodeArray<int>& id = mesh.Node(en[k]).m_ID;
 			lm[6 * (k + 1)] = id[dof_X];
 			lm[6 * (k + 1) + 1] = id[dof_Y];
 			lm[6 * (k + 1) + 2] = id[dof_Z];
@@ -269,7 +269,7 @@ void FEPeriodicSurfaceConstraint::ProjectSurface(FEPeriodicSurfaceConstraintSurf
 		FENode& node = ss.Node(i);
 
 		// get the nodal position
-		vec3d r0 = node.m_r0;
+		vec3d r0 = node.m_r0();
 
 		// find the intersection with the secondary surface
 		ss.m_pme[i] = np.Project(r0, cn, rs);
@@ -283,11 +283,11 @@ void FEPeriodicSurfaceConstraint::ProjectSurface(FEPeriodicSurfaceConstraintSurf
 	if (ss.m_nref < 0)
 	{
 		// we pick the node that is closest to the center of mass
-		double dmin = (ss.Node(0).m_rt - cs).norm(), d;
+		double dmin = (ss.Node(0).m_rt() - cs).norm(), d;
 		int nref = 0;
 		for (i = 1; i<ss.Nodes(); ++i)
 		{
-			d = (ss.Node(i).m_rt - cs).norm();
+			d = (ss.Node(i).m_rt() - cs).norm();
 			if (d < dmin)
 			{
 				dmin = d;
@@ -321,7 +321,7 @@ void FEPeriodicSurfaceConstraint::Update()
 		// calculate the reference node displacement
 		n0 = ss.m_nref;
 		FENode& node = ss.Node(n0);
-		us = node.m_rt - node.m_r0;
+		us = node.m_rt() - node.m_r0();
 
 		// get the secondary element
 		pme = ss.m_pme[n0];
@@ -331,7 +331,7 @@ void FEPeriodicSurfaceConstraint::Update()
 		for (j = 0; j<ne; ++j)
 		{
 			FENode& node = ms.Node(pme->m_lnode[j]);
-			umi[j] = node.m_rt - node.m_r0;
+			umi[j] = node.m_rt() - node.m_r0();
 		}
 		um = pme->eval(umi, ss.m_rs[n0][0], ss.m_rs[n0][1]);
 
@@ -342,7 +342,7 @@ void FEPeriodicSurfaceConstraint::Update()
 		{
 			// calculate the primary displacement
 			FENode& node = ss.Node(i);
-			us = node.m_rt - node.m_r0;
+			us = node.m_rt() - node.m_r0();
 
 			// get the secondary element
 			pme = ss.m_pme[i];
@@ -352,7 +352,7 @@ void FEPeriodicSurfaceConstraint::Update()
 			for (j = 0; j<ne; ++j)
 			{
 				FENode& node = ms.Node(pme->m_lnode[j]);
-				umi[j] = node.m_rt - node.m_r0;
+				umi[j] = node.m_rt() - node.m_r0();
 			}
 			um = pme->eval(umi, ss.m_rs[i][0], ss.m_rs[i][1]);
 
@@ -424,8 +424,8 @@ void FEPeriodicSurfaceConstraint::LoadVector(FEGlobalVector& R, const FETimeInfo
 
 			for (int i = 0; i<nseln; ++i)
 			{
-				r0[i] = ss.GetMesh()->Node(sel.m_node[i]).m_r0;
-				rt[i] = ss.GetMesh()->Node(sel.m_node[i]).m_rt;
+				r0[i] = ss.GetMesh()->Node(sel.m_node[i]).m_r0();
+				rt[i] = ss.GetMesh()->Node(sel.m_node[i]).m_rt();
 			}
 
 			w = sel.GaussWeights();
@@ -622,8 +622,8 @@ void FEPeriodicSurfaceConstraint::StiffnessMatrix(FELinearSystem& LS, const FETi
 
 			for (int i = 0; i<nseln; ++i)
 			{
-				r0[i] = ss.GetMesh()->Node(se.m_node[i]).m_r0;
-				rt[i] = ss.GetMesh()->Node(se.m_node[i]).m_rt;
+				r0[i] = ss.GetMesh()->Node(se.m_node[i]).m_r0();
+				rt[i] = ss.GetMesh()->Node(se.m_node[i]).m_rt();
 			}
 
 			w = se.GaussWeights();
@@ -658,7 +658,7 @@ void FEPeriodicSurfaceConstraint::StiffnessMatrix(FELinearSystem& LS, const FETi
 				nmeln = me.Nodes();
 
 				// get the secondary element node positions
-				for (k = 0; k<nmeln; ++k) rtm[k] = ms.GetMesh()->Node(me.m_node[k]).m_rt;
+				for (k = 0; k<nmeln; ++k) rtm[k] = ms.GetMesh()->Node(me.m_node[k]).m_rt();
 
 				// primary node natural coordinates in secondary element
 				r = ss.m_rs[m][0];
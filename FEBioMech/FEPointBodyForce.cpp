@@ -111,7 +111,7 @@ bool FEPointBodyForce::Init()
 	else 
 	{
 		FEMesh& m = GetFEModel()->GetMesh();
-		m_rc = m.Node(m_inode).m_r0;
+		m_rc = m.Node(m_inode).m_r0();
 	}
 
 	return true;
@@ -127,7 +127,7 @@ void FEPointBodyForce::Update()
 		{
 			FEMesh& m = GetFEModel()->GetMesh();
 			vec3d x[FEElement::MAX_NODES];
-			for (int i=0; i<8; ++i) x[i] = m.Node(m_pel->m_node[i]).m_rt;
+			for (int i=0; i<8; ++i) x[i] = m.Node(m_pel->m_node[i]).m_rt();
 
 			double* r = m_rs;
 			double H[FEElement::MAX_NODES];
@@ -147,6 +147,6 @@ void FEPointBodyForce::Update()
 	else
 	{
 		FEMesh& m = GetFEModel()->GetMesh();
-		m_rc = m.Node(m_inode).m_rt;
+		m_rc = m.Node(m_inode).m_rt();
 	}
 }
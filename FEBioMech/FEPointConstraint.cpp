@@ -60,7 +60,7 @@ bool FEPointConstraint::Init()
 
 	// get the nodal position in the reference state
 	m_node = m_node_id - 1;
-	vec3d r = m.Node(m_node).m_r0;
+	vec3d r = m.Node(m_node).m_r0();
 
 	// find the element in which this node lies
 	m_pel = m.FindSolidElement(r, m_rs);
@@ -115,8 +115,8 @@ void FEPointConstraint::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 
 	// get the nodal position
 	vec3d x[9];
-	x[0] = m.Node(m_node).m_rt;
-	for (i=0; i<8; ++i) x[i+1] = m.Node(m_pel->m_node[i]).m_rt;
+	x[0] = m.Node(m_node).m_rt();
+	for (i=0; i<8; ++i) x[i+1] = m.Node(m_pel->m_node[i]).m_rt();
 
 	// calculate the constraint
 	vec3d c(0,0,0);
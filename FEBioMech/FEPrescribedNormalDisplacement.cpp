@@ -71,9 +71,9 @@ void FEPrescribedNormalDisplacement::Activate()
 					int ip = el.m_lnode[(n+1)%nn];
 					int im = el.m_lnode[(n + nn - 1)%nn];
 
-					vec3d r0 = surf.Node(i0).m_r0;
-					vec3d rp = surf.Node(ip).m_r0;
-					vec3d rm = surf.Node(im).m_r0;
+					vec3d r0 = surf.Node(i0).m_r0();
+					vec3d rp = surf.Node(ip).m_r0();
+					vec3d rm = surf.Node(im).m_r0();
 
 					vec3d nu = (rp - r0) ^ (rm - r0);
 
@@ -91,9 +91,9 @@ void FEPrescribedNormalDisplacement::Activate()
 					int ip = el.m_lnode[(n + 1) % 3];
 					int im = el.m_lnode[(n + 2) % 3];
 
-					vec3d r0 = surf.Node(i0).m_r0;
-					vec3d rp = surf.Node(ip).m_r0;
-					vec3d rm = surf.Node(im).m_r0;
+					vec3d r0 = surf.Node(i0).m_r0();
+					vec3d rp = surf.Node(ip).m_r0();
+					vec3d rm = surf.Node(im).m_r0();
 
 					vec3d nu = (rp - r0) ^ (rm - r0);
 
@@ -124,7 +124,7 @@ void FEPrescribedNormalDisplacement::Activate()
 		int NN = surf.Nodes();
 		for (int i=0; i<NN; ++i)
 		{
-			vec3d ri = -surf.Node(i).m_r0;
+			vec3d ri = -surf.Node(i).m_r0();
 			ri.unit();
 			m_node[i].normal = ri;
 		}
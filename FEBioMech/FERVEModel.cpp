@@ -210,12 +210,12 @@ void FERVEModel::CenterRVE()
 	FENode& node = mesh.Node(0);
 
 	// setup bounding box
-	FEBoundingBox box(node.m_r0, node.m_r0);
+	FEBoundingBox box(node.m_r0(), node.m_r0());
 	const int NN = mesh.Nodes();
 	for (int i=1; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
-		box.add(node.m_r0);
+		box.add(node.m_r0());
 	}
 
 	// get the center
@@ -225,8 +225,8 @@ void FERVEModel::CenterRVE()
 	for (int n = 0; n < NN; ++n)
 	{
 		FENode& node = mesh.Node(n);
-		node.m_r0 -= c;
-		node.m_rt = node.m_r0;
+		node.m_r0() -= c;
+		node.m_rt() = node.m_r0();
 	}
 
 	// adjust bounding box
@@ -269,9 +269,9 @@ void FERVEModel::FindBoundaryNodes(vector<int>& BN)
 					{
 						FENode& node = m.Node(fn[k]);
 						
-						if (fabs(node.m_r0.x) >= 0.999*wx) BN[fn[k]] = 1;
-						if (fabs(node.m_r0.y) >= 0.999*wy) BN[fn[k]] = 1;
-						if (fabs(node.m_r0.z) >= 0.999*wz) BN[fn[k]] = 1;
+						if (fabs(node.m_r0().x) >= 0.999*wx) BN[fn[k]] = 1;
+						if (fabs(node.m_r0().y) >= 0.999*wy) BN[fn[k]] = 1;
+						if (fabs(node.m_r0().z) >= 0.999*wz) BN[fn[k]] = 1;
 					}
 				}
 			}
@@ -383,7 +383,7 @@ void FERVEModel::ScaleGeometry(double scale)
 	vec3d rc(0,0,0);
 	for (int i = 0; i<mesh.Nodes(); ++i)
 	{
-		rc += mesh.Node(i).m_r0;
+		rc += mesh.Node(i).m_r0();
 	}
 	rc /= (double) mesh.Nodes();
 
@@ -391,11 +391,11 @@ void FERVEModel::ScaleGeometry(double scale)
 	for (int i = 0; i<mesh.Nodes(); ++i)
 	{
 		FENode& node = mesh.Node(i);
-		vec3d r0 = node.m_r0;
-		node.m_r0 = rc + (r0 - rc)*scale;
+		vec3d r0 = node.m_r0();
+		node.m_r0() = rc + (r0 - rc)*scale;
 
-		vec3d rt = node.m_rt;
-		node.m_rt = rc + (rt - rc)*scale;
+		vec3d rt = node.m_rt();
+		node.m_rt() = rc + (rt - rc)*scale;
 	}
 }
 
@@ -510,7 +510,7 @@ mat3ds FERVEModel::StressAverage(FEMaterialPoint& mp)
 				// We multiply by two since the reaction forces are only stored at the primary surface 
 				// and we also need to sum over the secondary nodes (NOTE: should I figure out a way to 
 				// store the reaction forces on the secondary nodes as well?)
-				T += (f & node.m_rt)*2.0;
+				T += (f & node.m_rt())*2.0;
 			}
 		}
 	}
@@ -540,7 +540,7 @@ mat3ds FERVEModel::StressAverage(FEMaterialPoint& mp)
 				f.x = R[-n.m_ID[dof_X] - 2];
 				f.y = R[-n.m_ID[dof_Y] - 2];
 				f.z = R[-n.m_ID[dof_Z] - 2];
-				T += f & n.m_rt;
+				T += f & n.m_rt();
 			}
 		}
 	}
@@ -553,7 +553,7 @@ mat3ds FERVEModel::StressAverage(FEMaterialPoint& mp)
 			f.x = R[-n.m_ID[dof_X] - 2];
 			f.y = R[-n.m_ID[dof_Y] - 2];
 			f.z = R[-n.m_ID[dof_Z] - 2];
-			T += f & n.m_rt;
+			T += f & n.m_rt();
 		}
 	}
 
@@ -580,7 +580,7 @@ tens4ds FERVEModel::StiffnessAverage(FEMaterialPoint &mp)
 
 	// calculate the center point
 	vec3d rc(0, 0, 0);
-	for (int k = 0; k<m.Nodes(); ++k) rc += m.Node(k).m_rt;
+	for (int k = 0; k<m.Nodes(); ++k) rc += m.Node(k).m_rt();
 	rc /= (double)m.Nodes();
 
 	// elasticity tensor
@@ -625,8 +625,8 @@ tens4ds FERVEModel::StiffnessAverage(FEMaterialPoint &mp)
 						ke.get(3 * i, 3 * j, K);
 
 						// get the nodal positions
-						vec3d ri = ni.m_rt - rc;
-						vec3d rj = nj.m_rt - rc;
+						vec3d ri = ni.m_rt() - rc;
+						vec3d rj = nj.m_rt() - rc;
 
 						// create the elasticity tensor
 						c += dyad4s(ri, K, rj);
@@ -64,7 +64,7 @@ void FERVEModel2O::ScaleGeometry(double scale)
 	vec3d rc(0, 0, 0);
 	for (int i = 0; i<mesh.Nodes(); ++i)
 	{
-		rc += mesh.Node(i).m_r0;
+		rc += mesh.Node(i).m_r0();
 	}
 	rc /= (double)mesh.Nodes();
 
@@ -72,11 +72,11 @@ void FERVEModel2O::ScaleGeometry(double scale)
 	for (int i = 0; i<mesh.Nodes(); ++i)
 	{
 		FENode& node = mesh.Node(i);
-		vec3d r0 = node.m_r0;
-		node.m_r0 = rc + (r0 - rc)*scale;
+		vec3d r0 = node.m_r0();
+		node.m_r0() = rc + (r0 - rc)*scale;
 
-		vec3d rt = node.m_rt;
-		node.m_rt = rc + (rt - rc)*scale;
+		vec3d rt = node.m_rt();
+		node.m_rt() = rc + (rt - rc)*scale;
 	}
 }
 
@@ -172,12 +172,12 @@ void FERVEModel2O::CenterRVE()
 	FENode& node = mesh.Node(0);
 
 	// setup bounding box
-	FEBoundingBox box(node.m_r0);
+	FEBoundingBox box(node.m_r0());
 	const int NN = mesh.Nodes();
 	for (int i=1; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
-		box.add(node.m_r0);
+		box.add(node.m_r0());
 	}
 
 	// get the center
@@ -187,8 +187,8 @@ void FERVEModel2O::CenterRVE()
 	for (int n=0; n<NN; ++n)
 	{
 		FENode& node = mesh.Node(n);
-		node.m_r0 -= c;
-		node.m_rt = node.m_r0;
+		node.m_r0() -= c;
+		node.m_rt() = node.m_r0();
 	}
 
 	// adjust bounding box
@@ -231,9 +231,9 @@ void FERVEModel2O::FindBoundaryNodes(vector<int>& BN)
 					{
 						FENode& node = m.Node(fn[k]);
 						
-						if (fabs(node.m_r0.x) >= 0.999*wx) BN[fn[k]] = 1;
-						if (fabs(node.m_r0.y) >= 0.999*wy) BN[fn[k]] = 1;
-						if (fabs(node.m_r0.z) >= 0.999*wz) BN[fn[k]] = 1;
+						if (fabs(node.m_r0().x) >= 0.999*wx) BN[fn[k]] = 1;
+						if (fabs(node.m_r0().y) >= 0.999*wy) BN[fn[k]] = 1;
+						if (fabs(node.m_r0().z) >= 0.999*wz) BN[fn[k]] = 1;
 					}
 				}
 			}
@@ -468,8 +468,8 @@ void FEMicroModel2O::UpdateBC(const mat3d& F, const tens3drs& G)
 			FENode& parentNode = m.Node(lc.m_parentDof.node);
 			FENode& childNode = m.Node(lc.m_childDof[0].node);
 
-			vec3d Xp = parentNode.m_r0;
-			vec3d Xm = childNode.m_r0;
+			vec3d Xp = parentNode.m_r0();
+			vec3d Xm = childNode.m_r0();
 
 			mat3ds XXp = dyad(Xp);
 			mat3ds XXm = dyad(Xm);
@@ -517,7 +517,7 @@ mat3d FEMicroModel2O::AveragedStressPK1(FEMaterialPoint &mp)
 				// We multiply by two since the reaction forces are only stored at the primary surface 
 				// and we also need to sum over the secondary nodes (NOTE: should I figure out a way to 
 				// store the reaction forces on the secondary nodes as well?)
-				PK1 += (f & node.m_r0)*2.0;
+				PK1 += (f & node.m_r0())*2.0;
 			}
 		}
 	}
@@ -543,7 +543,7 @@ mat3d FEMicroModel2O::AveragedStressPK1(FEMaterialPoint &mp)
 		f.x = R[-n.m_ID[dof_X]-2];
 		f.y = R[-n.m_ID[dof_Y]-2];
 		f.z = R[-n.m_ID[dof_Z]-2];
-		PK1 += f & n.m_r0;
+		PK1 += f & n.m_r0();
 	}
 
 	return PK1 / m_V0;
@@ -629,7 +629,7 @@ void FEMicroModel2O::AveragedStress2O(mat3d& Pa, tens3drs& Qa)
 			{
 				FENode& node = ss.Node(i);
 				vec3d f = ss.m_Fr[i];
-				const vec3d& X = node.m_r0;
+				const vec3d& X = node.m_r0();
 				
 				// We multiply by two since the reaction forces are only stored at the primary surface 
 				// and we also need to sum over the secondary nodes (NOTE: should I figure out a way to 
@@ -663,7 +663,7 @@ void FEMicroModel2O::AveragedStress2O(mat3d& Pa, tens3drs& Qa)
 		f.y = R[-n.m_ID[dof_Y]-2];
 		f.z = R[-n.m_ID[dof_Z]-2];
 
-		const vec3d& X = n.m_r0;
+		const vec3d& X = n.m_r0();
 
 		Pa += (f & X);
 
@@ -709,9 +709,9 @@ void FEMicroModel2O::AveragedStress2OPK1(FEMaterialPoint &mp, mat3d &PK1a, tens3
 				// We multiply by two since the reaction forces are only stored at the primary surface 
 				// and we also need to sum over the secondary nodes (NOTE: should I figure out a way to 
 				// store the reaction forces on the secondary nodes as well?)
-				PK1 += (f & node.m_r0)*2.0;
+				PK1 += (f & node.m_r0())*2.0;
 
-				vec3d X = node.m_r0;
+				vec3d X = node.m_r0();
 		
 				QK1 += dyad3rs(f, X)*2.0;
 			}
@@ -741,8 +741,8 @@ void FEMicroModel2O::AveragedStress2OPK1(FEMaterialPoint &mp, mat3d &PK1a, tens3
 		f.y = R[-n.m_ID[dof_Y]-2];
 		f.z = R[-n.m_ID[dof_Z]-2];
 		
-		PK1 += f & n.m_r0;
-		vec3d X; X = n.m_r0;
+		PK1 += f & n.m_r0();
+		vec3d X; X = n.m_r0();
 		
 		QK1 += dyad3rs(f, X);
 	}
@@ -785,9 +785,9 @@ void FEMicroModel2O::AveragedStress2OPK2(FEMaterialPoint &mp, mat3ds &Sa, tens3d
 				// We multiply by two since the reaction forces are only stored at the primary surface 
 				// and we also need to sum over the secondary nodes (NOTE: should I figure out a way to 
 				// store the reaction forces on the secondary nodes as well?)
-				S += (f0 & node.m_r0)*2.0;
+				S += (f0 & node.m_r0())*2.0;
 
-				vec3d X = node.m_r0;
+				vec3d X = node.m_r0();
 		
 				T += dyad3s(X, f0, X)*2.0;
 			}
@@ -820,9 +820,9 @@ void FEMicroModel2O::AveragedStress2OPK2(FEMaterialPoint &mp, mat3ds &Sa, tens3d
 		f.z = R[-n.m_ID[dof_Z]-2];
 		vec3d f0 = Finv*f;
 		
-		S += f0 & n.m_r0;
+		S += f0 & n.m_r0();
 
-		vec3d X = n.m_r0;
+		vec3d X = n.m_r0();
 		
 		T += dyad3s(X, f0, X);
 	}
@@ -853,7 +853,7 @@ void FEMicroModel2O::AveragedStiffness(FEMaterialPoint &mp, tens4d& C, tens5d& L
 
 	// calculate the center point
 	vec3d rc(0,0,0);
-	for (int k=0; k<m.Nodes(); ++k) rc += m.Node(k).m_r0;
+	for (int k=0; k<m.Nodes(); ++k) rc += m.Node(k).m_r0();
 	rc /= (double) m.Nodes();
 
 	// zero the stiffness components
@@ -901,8 +901,8 @@ void FEMicroModel2O::AveragedStiffness(FEMaterialPoint &mp, tens4d& C, tens5d& L
 						ke.get(3*a, 3*b, K);
 
 						// get the nodal positions relative to the center
-						vec3d ra = na.m_r0 - rc;
-						vec3d rb = nb.m_r0 - rc;
+						vec3d ra = na.m_r0() - rc;
+						vec3d rb = nb.m_r0() - rc;
 						
 						double Ra[3] = { ra.x, ra.y, ra.z };
 						double Rb[3] = { rb.x, rb.y, rb.z };
@@ -30,6 +30,61 @@ SOFTWARE.*/
 #include "FEReactiveVEMaterialPoint.h"
 #include "FEElasticMaterial.h"
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// FEBondGenerationBuffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+void FEBondGenerationBuffer::reserve(int n)
+{
+    int cap = (int)m_buf.size();
+    if (n <= cap) return;
+
+    // grow to the next power of two and unroll the buffer
+    int newCap = (cap == 0 ? 4 : cap);
+    while (newCap < n) newCap *= 2;
+
+    std::vector<FEBondGeneration> buf(newCap);
+    for (int i=0; i<m_size; ++i) buf[i] = (*this)[i];
+    m_buf.swap(buf);
+    m_head = 0;
+}
+
+//-----------------------------------------------------------------------------
+void FEBondGenerationBuffer::push_back(const FEBondGeneration& g)
+{
+    reserve(m_size + 1);
+    m_size++;
+    back() = g;
+}
+
+//-----------------------------------------------------------------------------
+void FEBondGenerationBuffer::pop_front()
+{
+    assert(m_size > 0);
+    m_head = (m_head + 1) & ((int)m_buf.size() - 1);
+    m_size--;
+    if (m_size == 0) m_head = 0;
+}
+
+//-----------------------------------------------------------------------------
+void FEBondGenerationBuffer::erase(int i)
+{
+    assert((i >= 0) && (i < m_size));
+    if (i == 0) { pop_front(); return; }
+    for (int j=i; j<m_size-1; ++j) (*this)[j] = (*this)[j+1];
+    m_size--;
+}
+
+//-----------------------------------------------------------------------------
+void FEBondGenerationBuffer::resize(int n)
+{
+    reserve(n);
+    m_size = n;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // FEReactiveVEMaterialPoint
@@ -50,10 +105,7 @@ FEMaterialPoint* FEReactiveVEMaterialPoint::Copy()
 void FEReactiveVEMaterialPoint::Init()
 {
 	// initialize data to zero
-	m_Fi.clear();
-	m_Ji.clear();
-	m_v.clear();
-	m_w.clear();
+	m_gen.clear();
     
     // don't forget to initialize the base class
     FEMaterialPoint::Init();
@@ -67,23 +119,16 @@ void FEReactiveVEMaterialPoint::Update(const FETimeInfo& timeInfo)
 
 	// check if the current deformation gradient is different from that of
 	// the last generation, in which case store the current state
-	if (m_pRve) {
-	    if (m_pRve->NewGeneration(*this)) {
-		    m_Fi.push_back(pt.m_F.inverse());
-	        m_Ji.push_back(1./pt.m_J);
-			m_v.push_back(timeInfo.currentTime);
-			double w = m_pRve->ReformingBondMassFraction(*this);
-			m_w.push_back(w);
-		}
-	}
-	else {
-		if (m_pRuc->NewGeneration(*this)) {
-			m_Fi.push_back(pt.m_F.inverse());
-			m_Ji.push_back(1./pt.m_J);
-			m_v.push_back(timeInfo.currentTime);
-			double w = m_pRuc->ReformingBondMassFraction(*this);
-			m_w.push_back(w);
-		}
+	bool newGen = (m_pRve ? m_pRve->NewGeneration(*this) : m_pRuc->NewGeneration(*this));
+	if (newGen) {
+		FEBondGeneration g;
+		g.Fi = pt.m_F.inverse();
+		g.Ji = 1./pt.m_J;
+		g.v = timeInfo.currentTime;
+		g.w = (m_pRve ? m_pRve->ReformingBondMassFraction(*this) : m_pRuc->ReformingBondMassFraction(*this));
+		g.e = 0;
+		if (!m_gen.empty()) m_gen.back().e = GenerationStrain(m_gen.back(), g);
+		m_gen.push_back(g);
 	}
     
     // don't forget to initialize the base class
@@ -98,18 +143,60 @@ void FEReactiveVEMaterialPoint::Serialize(DumpStream& ar)
     
     if (ar.IsSaving())
     {
-        int n = (int)m_Fi.size();
+        int n = m_gen.size();
         ar << n;
-        for (int i=0; i<n; ++i) ar << m_Fi[i] << m_Ji[i] << m_v[i] << m_w[i];
+        for (int i=0; i<n; ++i) ar << m_gen[i].Fi << m_gen[i].Ji << m_gen[i].v << m_gen[i].w;
     }
     else
     {
         int n;
         ar >> n;
-		m_Fi.resize(n);
-		m_Ji.resize(n);
-		m_v.resize(n);
-		m_w.resize(n);
-        for (int i=0; i<n; ++i) ar >> m_Fi[i] >> m_Ji[i] >> m_v[i] >> m_w[i];
+		m_gen.clear();
+		m_gen.resize(n);
+        for (int i=0; i<n; ++i) ar >> m_gen[i].Fi >> m_gen[i].Ji >> m_gen[i].v >> m_gen[i].w;
+
+		// the merge strains are not stored
+		for (int i=0; i<n; ++i) m_gen[i].e = (i < n-1 ? GenerationStrain(m_gen[i], m_gen[i+1]) : 0.0);
     }
 }
+
+//-----------------------------------------------------------------------------
+//! Evaluates the Lagrangian strain of the reference configuration of generation ga
+//! relative to that of generation gb.
+double FEReactiveVEMaterialPoint::GenerationStrain(const FEBondGeneration& ga, const FEBondGeneration& gb)
+{
+    mat3d G = gb.Fi.inverse()*ga.Fi;
+    mat3ds E = ((G.transpose()*G).sym() - mat3dd(1))/2;
+    return E.norm();
+}
+
+//-----------------------------------------------------------------------------
+int FEReactiveVEMaterialPoint::MergeCandidate(double tol, int nmax) const
+{
+    // The newest generation is never merged since new generations are
+    // detected relative to it.
+    int ng = m_gen.size();
+    if (ng < 3) return -1;
+
+    int imin = 0;
+    double emin = m_gen[0].e;
+    for (int i=1; i<ng-2; ++i)
+    {
+        if (m_gen[i].e < emin) { emin = m_gen[i].e; imin = i; }
+    }
+
+    if ((emin < tol) || ((nmax > 0) && (ng > nmax))) return imin;
+
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+void FEReactiveVEMaterialPoint::MergeGenerations(int ig, double w)
+{
+    // generation ig+1 absorbs the bonds of generation ig
+    m_gen[ig + 1].w = w;
+    m_gen.erase(ig);
+
+    // update the strain of the generation preceding the merged one
+    if (ig > 0) m_gen[ig - 1].e = GenerationStrain(m_gen[ig - 1], m_gen[ig]);
+}
@@ -30,11 +30,64 @@ SOFTWARE.*/
 #include "FECore/FEMaterialPoint.h"
 #include "FEReactiveViscoelastic.h"
 #include "FEUncoupledReactiveViscoelastic.h"
-#include <deque>
+#include <vector>
 
 class FEReactiveViscoelasticMaterial;
 class FEUncoupledReactiveViscoelasticMaterial;
 
+//-----------------------------------------------------------------------------
+//! Data of a single generation of reactive bonds
+struct FEBondGeneration
+{
+    mat3d   Fi;     //!< inverse of relative deformation gradient
+    double  Ji;     //!< determinant of Fi (store for efficiency)
+    double  v;      //!< time when generation starts breaking
+    double  w;      //!< mass fraction when generation starts breaking
+    double  e;      //!< strain between this generation and the next one
+};
+
+//-----------------------------------------------------------------------------
+//! Ring buffer that stores the bond generations of a material point contiguously.
+//! Generations are indexed from oldest (0) to newest (size()-1).
+class FEBondGenerationBuffer
+{
+public:
+    FEBondGenerationBuffer() : m_head(0), m_size(0) {}
+
+    int size() const { return m_size; }
+    bool empty() const { return (m_size == 0); }
+
+    FEBondGeneration& operator [] (int i) { return m_buf[(m_head + i) & (m_buf.size() - 1)]; }
+    const FEBondGeneration& operator [] (int i) const { return m_buf[(m_head + i) & (m_buf.size() - 1)]; }
+
+    FEBondGeneration& front() { return (*this)[0]; }
+    FEBondGeneration& back() { return (*this)[m_size - 1]; }
+
+    //! add a generation after the newest one
+    void push_back(const FEBondGeneration& g);
+
+    //! remove the oldest generation
+    void pop_front();
+
+    //! remove generation i, preserving the order of the others
+    void erase(int i);
+
+    //! remove all generations (keeps the allocated storage)
+    void clear() { m_head = 0; m_size = 0; }
+
+    //! set the number of generations
+    void resize(int n);
+
+private:
+    //! make sure the buffer can store at least n generations
+    void reserve(int n);
+
+private:
+    std::vector<FEBondGeneration>   m_buf;  //!< storage (size is a power of two)
+    int     m_head;     //!< index of oldest generation in m_buf
+    int     m_size;     //!< number of stored generations
+};
+
 //-----------------------------------------------------------------------------
 //! Material point data for reactive viscoelastic materials
 class FEReactiveVEMaterialPoint : public FEMaterialPoint
@@ -55,13 +108,21 @@ public:
     
     //! Serialize data to archive
     void Serialize(DumpStream& ar);
+
+    //! Find the pair of generations (ig, ig+1) that should be merged, or -1 if none.
+    //! A pair is merged when the strain between them is below tol, or when
+    //! there are more than nmax generations (nmax = 0 means no bound).
+    int MergeCandidate(double tol, int nmax) const;
+
+    //! Merge generation ig into generation ig+1, which gets the mass fraction w
+    void MergeGenerations(int ig, double w);
+
+    //! strain measure between two generations
+    static double GenerationStrain(const FEBondGeneration& ga, const FEBondGeneration& gb);
     
 public:
     // multigenerational material data
-    deque <mat3d>  m_Fi;	//!< inverse of relative deformation gradient
-    deque <double> m_Ji;	//!< determinant of Fi (store for efficiency)
-    deque <double> m_v;     //!< time when generation starts breaking
-    deque <double> m_w;     //!< mass fraction when generation starts breaking
+    FEBondGenerationBuffer  m_gen;  //!< bond generations (oldest first)
     FEReactiveViscoelasticMaterial*  m_pRve; //!< pointer to parent material
     FEUncoupledReactiveViscoelasticMaterial*  m_pRuc; //!< pointer to parent material
 };
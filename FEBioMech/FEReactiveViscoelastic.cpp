@@ -44,6 +44,8 @@ BEGIN_FECORE_CLASS(FEReactiveViscoelasticMaterial, FEElasticMaterial)
     ADD_PARAMETER(m_wmin , FE_RANGE_CLOSED(0.0, 1.0), "wmin");
     ADD_PARAMETER(m_btype, FE_RANGE_CLOSED(1,2), "kinetics");
     ADD_PARAMETER(m_ttype, FE_RANGE_CLOSED(0,2), "trigger");
+    ADD_PARAMETER(m_gmax , FE_RANGE_GREATER_OR_EQUAL(0), "max_gen");
+    ADD_PARAMETER(m_gtol , FE_RANGE_GREATER_OR_EQUAL(0.0), "merge_tol");
 
 	// set material properties
 	ADD_PROPERTY(m_pBase, "elastic");
@@ -59,6 +61,8 @@ FEReactiveViscoelasticMaterial::FEReactiveViscoelasticMaterial(FEModel* pfem) :
     m_wmin = 0;
     m_btype = 0;
     m_ttype = 0;
+    m_gmax = 0;
+    m_gtol = 0;
 
 	m_pBase = 0;
 	m_pBond = 0;
@@ -81,6 +85,12 @@ bool FEReactiveViscoelasticMaterial::Init()
 		return false;
 	}
     
+    // the newest two generations are never merged, so a smaller limit cannot be enforced
+    if ((m_gmax == 1) || (m_gmax == 2)) {
+        feLogError("max_gen must be 0 (no limit) or at least 3");
+        return false;
+    }
+    
     return FEElasticMaterial::Init();
 }
 
@@ -108,8 +118,8 @@ bool FEReactiveViscoelasticMaterial::NewGeneration(FEMaterialPoint& mp)
     // the last generation, in which case store the current state
     // evaluate the relative deformation gradient
     mat3d F = pe.m_F;
-    int lg = (int)pt.m_Fi.size() - 1;
-    mat3d Fi = (lg > -1) ? pt.m_Fi[lg] : mat3d(mat3dd(1));
+    int lg = pt.m_gen.size() - 1;
+    mat3d Fi = (lg > -1) ? pt.m_gen[lg].Fi : mat3d(mat3dd(1));
     mat3d Fu = F*Fi;
 
     switch (m_ttype) {
@@ -170,23 +180,23 @@ double FEReactiveViscoelasticMaterial::BreakingBondMassFraction(FEMaterialPoint&
         case 1:
         {
             // time when this generation started breaking
-            double v = pt.m_v[ig];
+            double v = pt.m_gen[ig].v;
             
             if (time >= v)
-                w = pt.m_w[ig]*m_pRelx->Relaxation(mp, time - v, D);
+                w = pt.m_gen[ig].w*m_pRelx->Relaxation(mp, time - v, D);
         }
             break;
         case 2:
         {
             double tu, tv;
             if (ig == 0) {
-                tv = time - pt.m_v[ig];
+                tv = time - pt.m_gen[ig].v;
                 w = m_pRelx->Relaxation(mp, tv, D);
             }
             else
             {
-                tu = time - pt.m_v[ig-1];
-                tv = time - pt.m_v[ig];
+                tu = time - pt.m_gen[ig-1].v;
+                tv = time - pt.m_gen[ig].v;
                 w = m_pRelx->Relaxation(mp, tv, D) - m_pRelx->Relaxation(mp, tu, D);
             }
         }
@@ -218,15 +228,15 @@ double FEReactiveViscoelasticMaterial::ReformingBondMassFraction(FEMaterialPoint
     double J = ep.m_J;
     
     // get current number of generations
-    int ng = (int)pt.m_Fi.size();
+    int ng = pt.m_gen.size();
     
     double w = 1;
     
     for (int ig=0; ig<ng-1; ++ig)
     {
         // evaluate relative deformation gradient for this generation Fu(v)
-        ep.m_F = pt.m_Fi[ig+1].inverse()*pt.m_Fi[ig];
-        ep.m_J = pt.m_Ji[ig]/pt.m_Ji[ig+1];
+        ep.m_F = pt.m_gen[ig+1].Fi.inverse()*pt.m_gen[ig].Fi;
+        ep.m_J = pt.m_gen[ig].Ji/pt.m_gen[ig+1].Ji;
         // evaluate the breaking bond mass fraction for this generation
         w -= BreakingBondMassFraction(mp, ig, D);
     }
@@ -260,7 +270,7 @@ mat3ds FEReactiveViscoelasticMaterial::Stress(FEMaterialPoint& mp)
 	mat3ds s = m_pBase->Stress(mp);
     
     // current number of breaking generations
-    int ng = (int)pt.m_Fi.size();
+    int ng = pt.m_gen.size();
     
     // no bonds have broken
     if (ng == 0) {
@@ -278,14 +288,14 @@ mat3ds FEReactiveViscoelasticMaterial::Stress(FEMaterialPoint& mp)
         // calculate the bond stresses for breaking generations
         for (int ig=0; ig<ng; ++ig) {
             // evaluate relative deformation gradient for this generation
-            ep.m_F = F*pt.m_Fi[ig];
-            ep.m_J = J*pt.m_Ji[ig];
+            ep.m_F = F*pt.m_gen[ig].Fi;
+            ep.m_J = J*pt.m_gen[ig].Ji;
             // evaluate bond mass fraction for this generation
             w = BreakingBondMassFraction(mp, ig, D);
             // evaluate bond stress
             sb = m_pBond->Stress(mp);
             // add bond stress to total stress
-            s += sb*(w*pt.m_Ji[ig]);
+            s += sb*(w*pt.m_gen[ig].Ji);
         }
         
         // restore safe copy of deformation gradient
@@ -315,7 +325,7 @@ tens4ds FEReactiveViscoelasticMaterial::Tangent(FEMaterialPoint& mp)
 	tens4ds c = m_pBase->Tangent(mp);
     
     // current number of breaking generations
-    int ng = (int)pt.m_Fi.size();
+    int ng = pt.m_gen.size();
     
     // no bonds have broken
     if (ng == 0) {
@@ -333,14 +343,14 @@ tens4ds FEReactiveViscoelasticMaterial::Tangent(FEMaterialPoint& mp)
         // calculate the bond tangents for breaking generations
         for (int ig=0; ig<ng; ++ig) {
             // evaluate relative deformation gradient for this generation
-            ep.m_F = F*pt.m_Fi[ig];
-            ep.m_J = J*pt.m_Ji[ig];
+            ep.m_F = F*pt.m_gen[ig].Fi;
+            ep.m_J = J*pt.m_gen[ig].Ji;
             // evaluate bond mass fraction for this generation
             w = BreakingBondMassFraction(mp, ig, D);
             // evaluate bond tangent
             cb = m_pBond->Tangent(mp);
             // add bond tangent to total tangent
-            c += cb*(w*pt.m_Ji[ig]);
+            c += cb*(w*pt.m_gen[ig].Ji);
         }
         
         // restore safe copy of deformation gradient
@@ -372,7 +382,7 @@ double FEReactiveViscoelasticMaterial::StrainEnergyDensity(FEMaterialPoint& mp)
     double sed = m_pBase->StrainEnergyDensity(mp);
     
     // current number of breaking generations
-    int ng = (int)pt.m_Fi.size();
+    int ng = pt.m_gen.size();
     
     // no bonds have broken
     if (ng == 0) {
@@ -390,8 +400,8 @@ double FEReactiveViscoelasticMaterial::StrainEnergyDensity(FEMaterialPoint& mp)
         // calculate the strain energy density for breaking generations
         for (int ig=0; ig<ng; ++ig) {
             // evaluate relative deformation gradient for this generation
-            ep.m_F = F*pt.m_Fi[ig];
-            ep.m_J = J*pt.m_Ji[ig];
+            ep.m_F = F*pt.m_gen[ig].Fi;
+            ep.m_J = J*pt.m_gen[ig].Ji;
             // evaluate bond mass fraction for this generation
             w = BreakingBondMassFraction(mp, ig, D);
             // evaluate bond stress
@@ -421,7 +431,7 @@ void FEReactiveViscoelasticMaterial::CullGenerations(FEMaterialPoint& mp)
     
     mat3ds D = ep.RateOfDeformation();
     
-    if (pt.m_Fi.empty()) return;
+    if (pt.m_gen.empty()) return;
 
     // culling termination flag
     bool done = false;
@@ -429,14 +439,30 @@ void FEReactiveViscoelasticMaterial::CullGenerations(FEMaterialPoint& mp)
     // always check oldest generation
     while (!done) {
         double w = BreakingBondMassFraction(mp, 0, D);
-        if ((w > m_wmin) || (pt.m_Fi.size() == 1))
+        if ((w > m_wmin) || (pt.m_gen.size() == 1))
             done = true;
         else {
-            pt.m_Fi.pop_front();
-            pt.m_Ji.pop_front();
-            pt.m_v.pop_front();
-            pt.m_w.pop_front();
+            pt.m_gen.pop_front();
+        }
+    }
+
+    // merge generations whose reference configurations are (nearly) the same
+    // and enforce the maximum number of generations
+    int ig;
+    while ((ig = pt.MergeCandidate(m_gtol, m_gmax)) >= 0)
+    {
+        double w = pt.m_gen[ig+1].w;
+        if (m_btype == 1)
+        {
+            // preserve the current mass fraction of the merged bonds
+            double wa = BreakingBondMassFraction(mp, ig, D);
+            double wb = BreakingBondMassFraction(mp, ig+1, D);
+            if (wb > 0) w *= (wa + wb)/wb;
+            if (w > 1) w = 1;
         }
+        // for kinetics type 2 the mass fraction of generation ig+1 follows
+        // from its predecessor, so merging does not change it
+        pt.MergeGenerations(ig, w);
     }
     
     return;
@@ -89,6 +89,8 @@ public:
     double	m_wmin;		//!< minimum value of relaxation
     int     m_btype;    //!< bond kinetics type
     int     m_ttype;    //!< bond breaking trigger type
+    int     m_gmax;     //!< max number of generations (0 = no limit)
+    double  m_gtol;     //!< strain tolerance for merging generations
     
     DECLARE_FECORE_CLASS();
 };
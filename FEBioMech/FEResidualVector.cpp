@@ -34,7 +34,7 @@ SOFTWARE.*/
 using namespace std;
 
 //-----------------------------------------------------------------------------
-FEResidualVector::FEResidualVector(FEModel& fem, vector<double>& R, vector<double>& Fr) : FEGlobalVector(fem, R, Fr)
+FEResidualVector::FEResidualVector(FEModel& fem, vector<double>& R, vector<double>& Fr, bool bcolored) : FEGlobalVector(fem, R, Fr, bcolored)
 {
 }
 
@@ -56,20 +56,33 @@ void FEResidualVector::Assemble(vector<int>& en, vector<int>& elm, vector<double
     {
         // assemble the element residual into the global residual
         int ndof = (int)fe.size();
-        for (i=0; i<ndof; ++i)
+        if (m_bexclusive)
         {
+            // no other thread is assembling into these nodes (see FEMeshPartition::ElementColoring)
+            for (i=0; i<ndof; ++i)
+            {
+                I = elm[i];
+                if (I >= 0) R[I] += fe[i];
+                else if (-I-2 >= 0) m_Fr[-I-2] -= fe[i];
+            }
+        }
+        else
+        {
+            for (i=0; i<ndof; ++i)
+            {
             
-            I = elm[i];
+                I = elm[i];
             
-            if ( I >= 0){
+                if ( I >= 0){
 #pragma omp atomic
-                R[I] += fe[i];
-            }
-            // TODO: Find another way to store reaction forces
+                    R[I] += fe[i];
+                }
+                // TODO: Find another way to store reaction forces
             
-            else if (-I-2 >= 0){
+                else if (-I-2 >= 0){
 #pragma omp atomic
-                m_Fr[-I-2] -= fe[i];
+                    m_Fr[-I-2] -= fe[i];
+                }
             }
         }
         
@@ -105,7 +118,7 @@ void FEResidualVector::Assemble(vector<int>& en, vector<int>& elm, vector<double
                         lm = RB.m_LM;
                         
                         // add to total torque of this body
-                        a = node.m_rt - RB.m_rt;
+                        a = node.m_rt() - RB.m_rt;
                         vec3d m = a ^ F;
                         vec3d f = F;
                         
@@ -114,7 +127,7 @@ void FEResidualVector::Assemble(vector<int>& en, vector<int>& elm, vector<double
 						if (bdom)
 						{
 							if (node.HasFlags(FENode::SHELL) && node.HasFlags(FENode::RIGID_CLAMP)) {
-								vec3d d = node.m_dt;
+								vec3d d = node.m_dt();
 								vec3d b = a - d;
 								vec3d Fd(fe[i+3], fe[i+4], fe[i+5]);
 								f += Fd;
@@ -41,7 +41,7 @@ class FEBIOMECH_API FEResidualVector : public FEGlobalVector
 {
 public:
 	//! constructor
-	FEResidualVector(FEModel& fem, std::vector<double>& R, std::vector<double>& Fr);
+	FEResidualVector(FEModel& fem, std::vector<double>& R, std::vector<double>& Fr, bool bcolored = false);
 
 	//! destructor
 	~FEResidualVector();
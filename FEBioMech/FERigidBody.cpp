@@ -256,7 +256,7 @@ void FERigidBody::UpdateCOM()
 					int neln = el.Nodes();
 
 					// initial coordinates
-					for (int i=0; i<neln; ++i) r0[i] = pbd->GetMesh()->Node(el.m_node[i]).m_r0;
+					for (int i=0; i<neln; ++i) r0[i] = pbd->GetMesh()->Node(el.m_node[i]).m_r0();
 
 					// integration weights
 					double* gw = el.GaussWeights();
@@ -324,7 +324,7 @@ void FERigidBody::UpdateMOI()
 
 					// initial coordinates
 					int neln = el.Nodes();
-					for (int i = 0; i<neln; ++i) r0[i] = pbd->GetMesh()->Node(el.m_node[i]).m_r0;
+					for (int i = 0; i<neln; ++i) r0[i] = pbd->GetMesh()->Node(el.m_node[i]).m_r0();
 
 					// loop over integration points
 					double* gw = el.GaussWeights();
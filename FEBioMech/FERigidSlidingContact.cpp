@@ -135,7 +135,7 @@ void FERigidSlidingSurface::UnpackLM(FEElement& el, vector<int>& lm)
 	{
 		int n = el.m_lnode[i];
 		FENode& node = Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		lm[3*i  ] = id[m_dofX];
 		lm[3*i+1] = id[m_dofY];
@@ -283,7 +283,7 @@ void FERigidSlidingContact::ProjectSurface(FERigidSlidingSurface& ss)
 		int nint = el.GaussPoints();
 
 		// get the nodal coordinates
-		for (int j=0; j<neln; ++j) rt[j] = m_ss.Node(el.m_lnode[j]).m_rt;
+		for (int j=0; j<neln; ++j) rt[j] = m_ss.Node(el.m_lnode[j]).m_rt();
 
 		// loop over all integration points
 		for (int j=0; j<nint; ++j)
@@ -344,7 +344,7 @@ void FERigidSlidingContact::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 		m_ss.UnpackLM(se, lm);
 
 		// nodal coordinates
-		for (int j = 0; j<neln; ++j) r0[j] = m_ss.Node(se.m_lnode[j]).m_r0;
+		for (int j = 0; j<neln; ++j) r0[j] = m_ss.Node(se.m_lnode[j]).m_r0();
 
 		// we calculate all the metrics we need before we
 		// calculate the nodal forces
@@ -448,7 +448,7 @@ void FERigidSlidingContact::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo
 		m_ss.UnpackLM(se, lm);
 
 		// nodal coordinates
-		for (int j = 0; j<neln; ++j) r0[j] = m_ss.Node(se.m_lnode[j]).m_r0;
+		for (int j = 0; j<neln; ++j) r0[j] = m_ss.Node(se.m_lnode[j]).m_r0();
 
 		// we calculate all the metrics we need before we
 		// calculate the nodal forces
@@ -283,14 +283,14 @@ void FERigidSolver::PrepStep(const FETimeInfo& timeInfo, vector<double>& ui)
 				FERigidBody& rb = *fem.GetRigidBody(n.m_rid);
 				vec3d V = rb.m_vt;
 				vec3d W = rb.m_wt;
-				vec3d r = n.m_rt - rb.m_rt;
+				vec3d r = n.m_rt() - rb.m_rt;
 
 				vec3d v = V + (W ^ r);
-				n.m_vp = v;
+				n.m_vp() = v;
 				n.set_vec3d(m_dofVX, m_dofVY, m_dofVZ, v);
 
 				vec3d a = (W ^ V)*2.0 + (W ^ (W ^ r));
-				n.m_ap = n.m_at = a;
+				n.m_ap() = n.m_at() = a;
 			}
 		}
 	}
@@ -304,9 +304,40 @@ void FERigidSolver::PrepStep(const FETimeInfo& timeInfo, vector<double>& ui)
 	}
 }
 
+//-----------------------------------------------------------------------------
+void FERigidStiffnessBuffer::Flush(SparseMatrix& K, vector<double>& F)
+{
+	for (size_t n = 0; n < m_K.size(); ++n) K.add(m_K[n].i, m_K[n].j, m_K[n].v);
+	for (size_t n = 0; n < m_F.size(); ++n) F[m_F[n].i] += m_F[n].v;
+	m_K.clear();
+	m_F.clear();
+}
+
+//-----------------------------------------------------------------------------
+bool FERigidSolver::HasRigidNodes(const vector<int>& en)
+{
+	if ((m_fem == nullptr) || (m_fem->RigidBodies() == 0)) return false;
+
+	FEMesh& mesh = m_fem->GetMesh();
+	for (size_t j = 0; j < en.size(); ++j)
+	{
+		if ((en[j] >= 0) && (mesh.Node(en[j]).m_rid >= 0)) return true;
+	}
+	return false;
+}
+
 //-----------------------------------------------------------------------------
 //! This function calculates the rigid stiffness matrices
 void FERigidSolver::RigidStiffness(SparseMatrix& K, vector<double>& ui, vector<double>& F, const FEElementMatrix& ke, double alpha)
+{
+	FERigidStiffnessBuffer B(ui);
+	RigidStiffness(B, ke, alpha);
+	B.Flush(K, F);
+}
+
+//-----------------------------------------------------------------------------
+//! This function calculates the rigid stiffness matrices
+void FERigidSolver::RigidStiffness(FERigidStiffnessBuffer& B, const FEElementMatrix& ke, double alpha)
 {
 	if (m_fem == nullptr) return;
 
@@ -326,16 +357,16 @@ void FERigidSolver::RigidStiffness(SparseMatrix& K, vector<double>& ui, vector<d
 		}
     }
     if (bclamped_shell)
-        RigidStiffnessShell(K, ui, F, en, ke.RowIndices(), ke.ColumnsIndices(), ke, alpha);
+        RigidStiffnessShell(B, en, ke.RowIndices(), ke.ColumnsIndices(), ke, alpha);
     else
-        RigidStiffnessSolid(K, ui, F, en, ke.RowIndices(), ke.ColumnsIndices(), ke, alpha);
+        RigidStiffnessSolid(B, en, ke.RowIndices(), ke.ColumnsIndices(), ke, alpha);
     return;
 }
 
 //-----------------------------------------------------------------------------
 //! This function calculates the rigid stiffness matrices
 //! correct stiffness matrix for rigid-solid interfaces
-void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vector<double>& F, const vector<int>& en, const vector<int>& elmi, const std::vector<int>& elmj, const matrix& ke, double alpha)
+void FERigidSolver::RigidStiffnessSolid(FERigidStiffnessBuffer& B, const vector<int>& en, const vector<int>& elmi, const std::vector<int>& elmj, const matrix& ke, double alpha)
 {
 	if (m_fem == nullptr) return;
 	FEMechModel& fem = *m_fem;
@@ -379,7 +410,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
             lmj = RBj.m_LM;
             
             // get the relative distance to the center of mass
-            zj = nodej.m_rt - RBj.m_rt;
+            zj = nodej.m_rt() - RBj.m_rt;
             Zj.skew(zj);
             
             // loop over rows
@@ -405,7 +436,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
                     lmi = RBi.m_LM;
                     
                     // get the relative distance (use alpha rule)
-                    zi = (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha);
+                    zi = (nodei.m_rt() - RBi.m_rt)*alpha + (nodei.m_rp() - RBi.m_rp)*(1 - alpha);
                     Zi.skew(zi);
                     
                     mat3d M;
@@ -447,8 +478,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
                             if (I >= 0)
                             {
                                 // multiply KR by alpha for alpha rule
-                                if (J < -1) F[I] -= KR[l][k]*ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KR[l][k]);
+                                B.add(I, J, KR[l][k]);
                             }
                         }
                     
@@ -471,8 +501,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
                             if (I >= 0)
                             {
                                 // multiply KF by alpha for alpha rule
-                                if (J < -1) F[I] -= KF[l][k] * ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KF[l][k]);
+                                B.add(I, J, KF[l][k]);
                             }
                         }
                     
@@ -492,8 +521,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
                             
                             if (I >= 0)
                             {
-                                if (J < -1) F[I] -= KF[l][k] * ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KF[l][k]);
+                                B.add(I, J, KF[l][k]);
                             }
                         }
                     
@@ -521,8 +549,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
                             if (I >= 0)
                             {
                                 // multiply KF by alpha for alpha rule
-                                if (J < -1) F[I] -= KF[l][k] * ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KF[l][k]);
+                                B.add(I, J, KF[l][k]);
                             }
                         }
                 }
@@ -544,7 +571,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
                     lmi = RBi.m_LM;
                     
                     // get the relative distance (use alpha rule)
-                    zi = (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha);
+                    zi = (nodei.m_rt() - RBi.m_rt)*alpha + (nodei.m_rp() - RBi.m_rp)*(1 - alpha);
                     Zi.skew(zi);
                     
                     // get the element sub-matrix
@@ -570,8 +597,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
                             
                             if (I >= 0)
                             {
-                                if (J < -1) F[I] -= KF[l][k] * ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KF[l][k]);
+                                B.add(I, J, KF[l][k]);
                             }
                         }
                 }
@@ -583,7 +609,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
 //-----------------------------------------------------------------------------
 //! This function calculates the rigid stiffness matrices
 //! correct stiffness matrix for rigid bodies accounting for rigid-body-deformable-shell interfaces
-void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vector<double>& F, const vector<int>& en, const vector<int>& elmi, const vector<int>& elmj, const matrix& ke, double alpha)
+void FERigidSolver::RigidStiffnessShell(FERigidStiffnessBuffer& B, const vector<int>& en, const vector<int>& elmi, const vector<int>& elmj, const matrix& ke, double alpha)
 {
 	if (m_fem == nullptr) return;
 	FEMechModel& fem = *m_fem;
@@ -625,11 +651,11 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
             lmj = RBj.m_LM;
             
             // get the relative distance to the center of mass
-            aj = nodej.m_rt - RBj.m_rt;
+            aj = nodej.m_rt() - RBj.m_rt;
             Aj.skew(aj);
             
             // get the shell director
-            bj = aj - nodej.m_dt;
+            bj = aj - nodej.m_dt();
             Bj.skew(bj);
             
             // loop over rows
@@ -667,11 +693,11 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                     lmi = RBi.m_LM;
                     
                     // get the relative distance (use alpha rule)
-                    ai = (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha);
+                    ai = (nodei.m_rt() - RBi.m_rt)*alpha + (nodei.m_rp() - RBi.m_rp)*(1 - alpha);
                     Ai.skew(ai);
                     
                     // get the shell director
-                    bi = ai - nodei.m_dt;
+                    bi = ai - nodei.m_dt();
                     Bi.skew(bi);
                     
                     mat3d M;
@@ -713,8 +739,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                             if (I >= 0)
                             {
                                 // multiply KR by alpha for alpha rule
-                                if (J < -1) F[I] -= KR[l][k]*ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KR[l][k]);
+                                B.add(I, J, KR[l][k]);
                             }
                         }
                     
@@ -738,8 +763,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                             if (I >= 0)
                             {
                                 // multiply KF by alpha for alpha rule
-                                if (J < -1) F[I] -= KF[l][k] * ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KF[l][k]);
+                                B.add(I, J, KF[l][k]);
                             }
                         }
                     
@@ -761,8 +785,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                             
                             if (I >= 0)
                             {
-                                if (J < -1) F[I] -= KF[l][k] * ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KF[l][k]);
+                                B.add(I, J, KF[l][k]);
                             }
                         }
                     
@@ -791,8 +814,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                             if (I >= 0)
                             {
                                 // multiply KF by alpha for alpha rule
-                                if (J < -1) F[I] -= KF[l][k] * ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KF[l][k]);
+                                B.add(I, J, KF[l][k]);
                             }
                         }
                 }
@@ -814,11 +836,11 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                     lmi = RBi.m_LM;
                     
                     // get the relative distance (use alpha rule)
-                    ai = (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha);
+                    ai = (nodei.m_rt() - RBi.m_rt)*alpha + (nodei.m_rp() - RBi.m_rp)*(1 - alpha);
                     Ai.skew(ai);
                     
                     // get the shell director
-                    bi = ai - nodei.m_dt;
+                    bi = ai - nodei.m_dt();
                     Bi.skew(bi);
                     
                     // get the element sub-matrix
@@ -846,8 +868,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                             
                             if (I >= 0)
                             {
-                                if (J < -1) F[I] -= KF[l][k] * ui[-J - 2];
-                                else if (J >= 0) K.add(I, J, KF[l][k]);
+                                B.add(I, J, KF[l][k]);
                             }
                         }
                 }
@@ -876,7 +897,7 @@ void FERigidSolver::AssembleResidual(int node_id, int dof, double f, vector<doub
         FERigidBody& RB = *fem.GetRigidBody(node.m_rid);
         
         // get the relative position
-        vec3d a = node.m_rt - RB.m_rt;
+        vec3d a = node.m_rt() - RB.m_rt;
         
         int* lm = RB.m_LM;
         if (dof == m_dofX)
@@ -899,7 +920,7 @@ void FERigidSolver::AssembleResidual(int node_id, int dof, double f, vector<doub
         }
 		if (node.HasFlags(FENode::SHELL) && node.HasFlags(FENode::RIGID_CLAMP)) {
             // get the shell director
-            vec3d d = node.m_dt;
+            vec3d d = node.m_dt();
             vec3d b = a - d;
             if (dof == m_dofSX)
             {
@@ -1067,7 +1088,7 @@ void FERigidSolverOld::UpdateRigidKinematics()
 					int NN = dom.Nodes();
 					for (int i = 0; i<NN; ++i, ncnt++)
 					{
-						vec3d ri = dom.Node(i).m_rt - rb.m_rt;
+						vec3d ri = dom.Node(i).m_rt() - rb.m_rt;
 						vec3d vi = dom.Node(i).get_vec3d(m_dofVX, m_dofVY, m_dofVZ);
 
 						vec3d wi = ri ^ vi;
@@ -1217,7 +1238,7 @@ void FERigidSolverOld::UpdateRigidBodies(vector<double>& Ui, vector<double>& ui,
 		FENode& node = mesh.Node(i);
 		if (node.m_rid >= 0)
 		{
-			vec3d ut = node.m_rt - node.m_r0;
+			vec3d ut = node.m_rt() - node.m_r0();
 			node.set_vec3d(m_dofX, m_dofY, m_dofZ, ut);
 		}
 	}
@@ -1379,14 +1400,14 @@ void FERigidSolverNew::UpdateRigidBodies(vector<double>& Ui, vector<double>& ui)
 		FENode& node = mesh.Node(i);
 		if (node.m_rid >= 0)
 		{
-			vec3d ut = node.m_rt - node.m_r0;
+			vec3d ut = node.m_rt() - node.m_r0();
 			node.set_vec3d(m_dofX, m_dofY, m_dofZ, ut);
             
 			if (node.HasFlags(FENode::SHELL) && node.HasFlags(FENode::RIGID_CLAMP)) {
                 // get the rigid body
                 FERigidBody& RB = *fem.GetRigidBody(node.m_rid);
                 // evaluate the director in the current configuration
-				vec3d d = RB.GetRotation()*node.m_d0 - node.m_d0;
+				vec3d d = RB.GetRotation()*node.m_d0() - node.m_d0();
                 // evaluate the back face displacement increments
                 node.set_vec3d(m_dofSX, m_dofSY, m_dofSZ, ut - d);
             }
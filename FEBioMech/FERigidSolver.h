@@ -43,6 +43,38 @@ class DumpStream;
 class FEElementMatrix;
 class FEMechModel;
 
+//-----------------------------------------------------------------------------
+//! Collects the stiffness contributions of rigid-deformable interfaces. This allows
+//! element matrices to be processed concurrently (each thread using its own buffer),
+//! while the contributions are added to the global system afterwards (see Flush).
+class FEBIOMECH_API FERigidStiffnessBuffer
+{
+	struct Entry
+	{
+		int		i, j;
+		double	v;
+	};
+
+public:
+	FERigidStiffnessBuffer(const std::vector<double>& ui) : m_ui(&ui) {}
+
+	//! add the coupling v between equation I and dof J. If J is a prescribed
+	//! dof (J < -1), the contribution is moved to the right-hand side.
+	void add(int I, int J, double v)
+	{
+		if (J < -1) { Entry e = { I, -1, -v*(*m_ui)[-J - 2] }; m_F.push_back(e); }
+		else if (J >= 0) { Entry e = { I, J, v }; m_K.push_back(e); }
+	}
+
+	//! add the collected contributions to the stiffness matrix and right-hand side and clear the buffer.
+	void Flush(SparseMatrix& K, std::vector<double>& F);
+
+private:
+	const std::vector<double>*	m_ui;	//!< prescribed displacement values
+	std::vector<Entry>	m_K;	//!< stiffness contributions
+	std::vector<Entry>	m_F;	//!< right-hand side contributions
+};
+
 //-----------------------------------------------------------------------------
 //! This is a helper class that helps the solid deformables solvers update the 
 //! state of the rigid system.
@@ -62,14 +94,21 @@ public:
 	// This is called at the start of each time step
 	void PrepStep(const FETimeInfo& timeInfo, vector<double>& ui);
 
+	// returns true if any of the nodes is attached to a rigid body (i.e. the element matrix
+	// of these nodes needs to be corrected by RigidStiffness)
+	bool HasRigidNodes(const std::vector<int>& en);
+
 	// correct stiffness matrix for rigid bodies
 	void RigidStiffness(SparseMatrix& K, std::vector<double>& ui, std::vector<double>& F, const FEElementMatrix& ke, double alpha);
 
+	// collect the rigid body corrections of an element matrix in the buffer
+	void RigidStiffness(FERigidStiffnessBuffer& B, const FEElementMatrix& ke, double alpha);
+
     // correct stiffness matrix for rigid bodies accounting for rigid-body-deformable-shell interfaces
-    void RigidStiffnessSolid(SparseMatrix& K, std::vector<double>& ui, std::vector<double>& F, const std::vector<int>& en, const std::vector<int>& lmi, const std::vector<int>& lmj, const matrix& ke, double alpha);
+    void RigidStiffnessSolid(FERigidStiffnessBuffer& B, const std::vector<int>& en, const std::vector<int>& lmi, const std::vector<int>& lmj, const matrix& ke, double alpha);
     
     // correct stiffness matrix for rigid bodies accounting for rigid-body-deformable-shell interfaces
-    void RigidStiffnessShell(SparseMatrix& K, std::vector<double>& ui, std::vector<double>& F, const std::vector<int>& en, const std::vector<int>& lmi, const std::vector<int>& lmj, const matrix& ke, double alpha);
+    void RigidStiffnessShell(FERigidStiffnessBuffer& B, const std::vector<int>& en, const std::vector<int>& lmi, const std::vector<int>& lmj, const matrix& ke, double alpha);
     
 	// adjust residual for rigid-deformable interface nodes
 	void AssembleResidual(int node_id, int dof, double f, std::vector<double>& R);
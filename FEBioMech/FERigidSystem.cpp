@@ -467,9 +467,9 @@ void FERigidSystem::UpdateMesh()
 			FENode& node = mesh.Node(i);
 			if (node.m_rid == RB.m_nID)
 			{
-				vec3d a0 = node.m_r0 - RB.m_r0;
+				vec3d a0 = node.m_r0() - RB.m_r0;
 				vec3d at = RB.GetRotation()*a0;
-				node.m_rt = RB.m_rt + at;
+				node.m_rt() = RB.m_rt + at;
 			}
 		}
 	}
@@ -151,7 +151,7 @@ void FERigidWallSurface::UpdateNormals()
 	{
 		FESurfaceElement& el = Element(i);
 		int ne = el.Nodes();
-		for (j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt;
+		for (j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt();
 
 		for (j=0; j<ne; ++j)
 		{
@@ -192,7 +192,7 @@ void FERigidWallSurface::UnpackLM(FEElement& el, vector<int>& lm)
 	{
 		int n = el.m_node[i];
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		lm[3*i  ] = id[m_dofX];
 		lm[3*i+1] = id[m_dofY];
@@ -280,7 +280,7 @@ void FERigidWallInterface::ProjectSurface(FERigidWallSurface& ss)
 	for (int i=0; i<m_ss.Nodes(); ++i)
 	{
 		// get the nodal position
-		vec3d r = m_ss.Node(i).m_rt;
+		vec3d r = m_ss.Node(i).m_rt();
 
 		// project this node onto the plane
 		vec3d q = m_plane.Project(r);
@@ -357,8 +357,8 @@ void FERigidWallInterface::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 
 		for (int i=0; i<nseln; ++i)
 		{
-			r0[i] = m_ss.GetMesh()->Node(sel.m_node[i]).m_r0;
-			rt[i] = m_ss.GetMesh()->Node(sel.m_node[i]).m_rt;
+			r0[i] = m_ss.GetMesh()->Node(sel.m_node[i]).m_r0();
+			rt[i] = m_ss.GetMesh()->Node(sel.m_node[i]).m_rt();
 		}
 		w = sel.GaussWeights();
 
@@ -460,8 +460,8 @@ void FERigidWallInterface::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo&
 
 		for (int i=0; i<nseln; ++i)
 		{
-			r0[i] = m_ss.GetMesh()->Node(se.m_node[i]).m_r0;
-			rt[i] = m_ss.GetMesh()->Node(se.m_node[i]).m_rt;
+			r0[i] = m_ss.GetMesh()->Node(se.m_node[i]).m_r0();
+			rt[i] = m_ss.GetMesh()->Node(se.m_node[i]).m_rt();
 		}
 
 		w = se.GaussWeights();
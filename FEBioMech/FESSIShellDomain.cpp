@@ -99,8 +99,8 @@ void FESSIShellDomain::InitShells()
             el.shape_deriv(Mr, Ms, 0, 0);
             for (int j = 0; j<ne; ++j)
             {
-                gr += mesh.Node(el.m_node[j]).m_r0*Mr[j];
-                gs += mesh.Node(el.m_node[j]).m_r0*Ms[j];
+                gr += mesh.Node(el.m_node[j]).m_r0()*Mr[j];
+                gs += mesh.Node(el.m_node[j]).m_r0()*Ms[j];
             }
             vec3d d0 = gr ^ gs;
             d0.unit();
@@ -205,7 +205,7 @@ void FESSIShellDomain::FindSSI()
 					{
 						// check interface side
 						// get outward normal to solid element face
-						vec3d n0 = mesh.Node(nf[0]).m_r0, n1 = mesh.Node(nf[1]).m_r0, n2 = mesh.Node(nf[2]).m_r0;
+						vec3d n0 = mesh.Node(nf[0]).m_r0(), n1 = mesh.Node(nf[1]).m_r0(), n2 = mesh.Node(nf[2]).m_r0();
 						vec3d nsld = (n1 - n0) ^ (n2 - n1);
 						// get outward normal to shell face
 						CoBaseVectors0(sel, 0, g);
@@ -262,8 +262,7 @@ void FESSIShellDomain::FindSSI()
             if (sldmn) {
                 // for each node in this shell domain, check the solid elements it belongs to
                 for (int j=0; j<psdom->Nodes(); ++j) {
-                    FENode& node = psdom->Node(j);
-                    int nid = node.GetID() - 1;
+                    int nid = psdom->NodeIndex(j);
                     int nval = NEL.Valence(nid);
                     FEElement** pe = NEL.ElementList(nid);
                     for (int k=0; k<nval; ++k)
@@ -345,7 +344,7 @@ void FESSIShellDomain::FindSSI()
 					if (found) {
 						// check interface side
 						// get outward normal to solid element face
-						vec3d n0 = mesh.Node(nf[0]).m_r0, n1 = mesh.Node(nf[1]).m_r0, n2 = mesh.Node(nf[2]).m_r0;
+						vec3d n0 = mesh.Node(nf[0]).m_r0(), n1 = mesh.Node(nf[1]).m_r0(), n2 = mesh.Node(nf[2]).m_r0();
 						vec3d nsld = (n1 - n0) ^ (n2 - n1);
 						// get outward normal to shell face
 						CoBaseVectors0(el, 0, g);
@@ -398,7 +397,7 @@ void FESSIShellDomain::FindSSI()
                 // for each node in this shell domain, check the solid elements it belongs to
                 for (int j=0; j<psdom->Nodes(); ++j) {
                     FENode& node = psdom->Node(j);
-                    int nid = node.GetID() - 1;
+                    int nid = psdom->NodeIndex(j);
                     int nval = NEL.Valence(nid);
                     FEElement** pe = NEL.ElementList(nid);
                     for (int k=0; k<nval; ++k)
@@ -433,8 +432,8 @@ void FESSIShellDomain::CoBaseVectors0(FEShellElement& el, int n, vec3d g[3])
 	for (i = 0; i<neln; ++i)
 	{
 		FENode& ni = m_pMesh->Node(el.m_node[i]);
-		r[i] = ni.m_r0;
-        D[i] = m_bnodalnormals ? ni.m_d0 : el.m_d0[i];
+		r[i] = ni.m_r0();
+        D[i] = m_bnodalnormals ? ni.m_d0() : el.m_d0[i];
 	}
 
 	double eta = el.gt(n);
@@ -467,8 +466,8 @@ void FESSIShellDomain::CoBaseVectors0(FEShellElement& el, double r, double s, do
     for (i = 0; i<neln; ++i)
     {
         FENode& ni = m_pMesh->Node(el.m_node[i]);
-        r0[i] = ni.m_r0;
-        D[i] = m_bnodalnormals ? ni.m_d0 : el.m_d0[i];
+        r0[i] = ni.m_r0();
+        D[i] = m_bnodalnormals ? ni.m_d0() : el.m_d0[i];
     }
     
     double eta = t;
@@ -631,8 +630,8 @@ void FESSIShellDomain::CoBaseVectors(FEShellElement& el, int n, vec3d g[3])
     for (i=0; i<neln; ++i)
     {
         FENode& ni = m_pMesh->Node(el.m_node[i]);
-        r[i] = ni.m_rt;
-        D[i] = m_bnodalnormals ? ni.m_d0 : el.m_d0[i];
+        r[i] = ni.m_rt();
+        D[i] = m_bnodalnormals ? ni.m_d0() : el.m_d0[i];
         D[i] +=  ni.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]) - ni.get_vec3d(m_dofSU[0], m_dofSU[1], m_dofSU[2]);
     }
     
@@ -666,9 +665,9 @@ void FESSIShellDomain::CoBaseVectorsP(FEShellElement& el, int n, vec3d g[3])
     for (i=0; i<neln; ++i)
     {
         FENode& ni = m_pMesh->Node(el.m_node[i]);
-        r[i] = ni.m_rp;
-        D[i] = m_bnodalnormals ? ni.m_d0 : el.m_d0[i];
-        D[i] += ni.m_rp - ni.m_r0 - ni.get_vec3d_prev(m_dofSU[0], m_dofSU[1], m_dofSU[2]);
+        r[i] = ni.m_rp();
+        D[i] = m_bnodalnormals ? ni.m_d0() : el.m_d0[i];
+        D[i] += ni.m_rp() - ni.m_r0() - ni.get_vec3d_prev(m_dofSU[0], m_dofSU[1], m_dofSU[2]);
     }
     
     double eta = el.gt(n);
@@ -712,8 +711,8 @@ void FESSIShellDomain::CoBaseVectors(FEShellElement& el, double r, double s, dou
     for (i=0; i<neln; ++i)
     {
         FENode& ni = m_pMesh->Node(el.m_node[i]);
-        rt[i] = ni.m_rt;
-        D[i] = m_bnodalnormals ? ni.m_d0 : el.m_d0[i];
+        rt[i] = ni.m_rt();
+        D[i] = m_bnodalnormals ? ni.m_d0() : el.m_d0[i];
         D[i] += ni.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]) - ni.get_vec3d(m_dofSU[0], m_dofSU[1], m_dofSU[2]);
     }
     
@@ -1066,7 +1065,7 @@ void FESSIShellDomain::Update(const FETimeInfo& tp)
 		for (int j = 0; j<n; ++j)
 		{
 			FENode& nj = mesh.Node(e.m_node[j]);
-			vec3d D = nj.m_dt;
+			vec3d D = nj.m_dt();
 			double h = D.norm();
 
 			e.m_ht[j] = h;
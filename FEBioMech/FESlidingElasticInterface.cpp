@@ -409,7 +409,7 @@ void FESlidingElasticInterface::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nseln; ++l)
                     {
-                        vector<int>& id = mesh.Node(sn[l]).m_ID;
+                        FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
                         lm[6*l  ] = id[dof_X];
                         lm[6*l+1] = id[dof_Y];
                         lm[6*l+2] = id[dof_Z];
@@ -420,7 +420,7 @@ void FESlidingElasticInterface::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nmeln; ++l)
                     {
-                        vector<int>& id = mesh.Node(mn[l]).m_ID;
+                        FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
                         lm[6*(l+nseln)  ] = id[dof_X];
                         lm[6*(l+nseln)+1] = id[dof_Y];
                         lm[6*(l+nseln)+2] = id[dof_Z];
@@ -491,9 +491,9 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
             {
                 vec3d r0, rp, rm;
                 if (!ss.IsShellBottom()) {
-                    r0 = ss.Node(el.m_lnode[ j         ]).m_rt;
-                    rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt;
-                    rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt;
+                    r0 = ss.Node(el.m_lnode[ j         ]).m_rt();
+                    rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt();
+                    rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt();
                 }
                 else {
                     r0 = ss.Node(el.m_lnode[ j         ]).m_st();
@@ -513,7 +513,7 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
             FENode& node = ss.Node(i);
             
             // get the spatial nodal coordinates
-            vec3d rt = ss.IsShellBottom() ? node.m_st() : node.m_rt;
+            vec3d rt = ss.IsShellBottom() ? node.m_st() : node.m_rt();
             vec3d nu = normal[i];
             
             // project onto the secondary surface
@@ -533,10 +533,10 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
                 
                 if (gap>0) {
                     if (!ss.IsShellBottom()) {
-                        node.m_r0 = node.m_rt = q;
+                        node.m_r0() = node.m_rt() = q;
                     }
                     else {
-                        node.m_r0 = node.m_rt = q + node.m_d0;
+                        node.m_r0() = node.m_rt() = q + node.m_d0();
                     }
                 }
                 
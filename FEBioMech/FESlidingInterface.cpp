@@ -146,7 +146,7 @@ void FESlidingInterface::BuildMatrixProfile(FEGlobalMatrix& K)
 
 				for (int k=0; k<n; ++k)
 				{
-					vector<int>& id = mesh.Node(en[k]).m_ID;
+					FENodeArray<int>& id = mesh.Node(en[k]).m_ID;
 					lm[6*(k+1)  ] = id[dof_X];
 					lm[6*(k+1)+1] = id[dof_Y];
 					lm[6*(k+1)+2] = id[dof_Z];
@@ -381,7 +381,7 @@ void FESlidingSurface::GetNodalContactTraction(int nface, vec3d* tn)
 
 //-----------------------------------------------------------------------------
 //! constructor
-FESlidingInterface::FESlidingInterface(FEModel* pfem) : FEContactInterface(pfem), m_ss(pfem), m_ms(pfem)
+FESlidingInterface::FESlidingInterface(FEModel* pfem) : FEContactInterface(pfem), m_ss(pfem), m_ms(pfem), m_cppm(m_ms), m_cpps(m_ss)
 {
 	static int count = 1;
 	SetID(count++);
@@ -503,11 +503,12 @@ void FESlidingInterface::ProjectSurface(FESlidingSurface& ss, FESlidingSurface&
 	double r, s;
 	vec3d q;
 
-	FEClosestPointProjection cpp(ms);
+	// the search structures are built once and refit when the surface moves
+	FEClosestPointProjection& cpp = (&ms == &m_ms ? m_cppm : m_cpps);
 	cpp.SetTolerance(m_stol);
 	cpp.SetSearchRadius(m_sradius);
 	cpp.HandleSpecialCases(true);
-	cpp.Init();
+	cpp.Update();
 
 	// loop over all primary surface nodes
 	for (int i=0; i<ss.Nodes(); ++i)
@@ -516,7 +517,7 @@ void FESlidingInterface::ProjectSurface(FESlidingSurface& ss, FESlidingSurface&
 		FENode& node = ss.Node(i);
 
 		// get the nodal position
-		vec3d x = node.m_rt;
+		vec3d x = node.m_rt();
 
 		// get the global node number
 		int m = ss.NodeIndex(i);
@@ -608,7 +609,7 @@ void FESlidingInterface::ProjectSurface(FESlidingSurface& ss, FESlidingSurface&
 			ss.m_data[i].m_gap = -(ss.m_data[i].m_nu*(x - q)) + ss.m_data[i].m_off;
 			if (bmove && (ss.m_data[i].m_gap>0))
 			{
-				node.m_r0 = node.m_rt = q + ss.m_data[i].m_nu*ss.m_data[i].m_off;
+				node.m_r0() = node.m_rt() = q + ss.m_data[i].m_nu*ss.m_data[i].m_off;
 				ss.m_data[i].m_gap = 0;
 			}
 
@@ -665,25 +666,7 @@ void FESlidingInterface::Update()
 
 void FESlidingInterface::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 {
-	// element contact force vector
-	vector<double> fe;
-
-	// the lm array for this force vector
-	vector<int> lm;
-
-	// the en array
-	vector<int> en;
-
-	// the elements LM vectors
-	vector<int> sLM;
-	vector<int> mLM;
-
-	const int MN = FEElement::MAX_NODES;
-	vec3d r0[MN];
-	double w[MN];
-	double* Gr, *Gs;
-	double detJ[MN];
-	vec3d dxr, dxs;
+	TimerTracker t(&m_residualTimer);
 
 	// do two-pass
 	int npass = (m_btwo_pass?2:1);
@@ -695,97 +678,117 @@ void FESlidingInterface::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 		FESlidingSurface& ms = (np==0? m_ms : m_ss);
 
 		// loop over all primary surface facets
+		// The secondary elements change with each projection, so the element vectors
+		// are assembled with the residual's atomic assembly.
 		int ne = ss.Elements();
-		for (int j=0; j<ne; ++j)
+		#pragma omp parallel shared(ne)
 		{
-			// get the next element
-			FESurfaceElement& sel = ss.Element(j);
-			int nseln = sel.Nodes();
-
-			// get the element's LM array
-			ss.UnpackLM(sel, sLM);
+			// per-thread buffers
+			vector<double> fe;
+			vector<int> lm;
+			vector<int> en;
+			vector<int> sLM;
+			vector<int> mLM;
+
+			const int MN = FEElement::MAX_NODES;
+			vec3d r0[MN];
+			double w[MN];
+			double* Gr, *Gs;
+			double detJ[MN];
+			vec3d dxr, dxs;
+
+			#pragma omp for
+			for (int j=0; j<ne; ++j)
+			{
+				// get the next element
+				FESurfaceElement& sel = ss.Element(j);
+				int nseln = sel.Nodes();
 
-			// nodal coordinates
-			for (int i=0; i<nseln; ++i) r0[i] = ss.GetMesh()->Node(sel.m_node[i]).m_r0;
+				// get the element's LM array
+				ss.UnpackLM(sel, sLM);
 
-			// we calculate all the metrics we need before we
-			// calculate the nodal forces
-			for (int n=0; n<nseln; ++n)
-			{
-				Gr = sel.Gr(n);
-				Gs = sel.Gs(n);
+				// nodal coordinates
+				for (int i=0; i<nseln; ++i) r0[i] = ss.GetMesh()->Node(sel.m_node[i]).m_r0();
 
-				// calculate jacobian
-				// note that we are integrating over the reference surface
-				dxr = dxs = vec3d(0,0,0);
-				for (int k=0; k<nseln; ++k)
+				// we calculate all the metrics we need before we
+				// calculate the nodal forces
+				for (int n=0; n<nseln; ++n)
 				{
-					dxr.x += Gr[k]*r0[k].x;
-					dxr.y += Gr[k]*r0[k].y;
-					dxr.z += Gr[k]*r0[k].z;
+					Gr = sel.Gr(n);
+					Gs = sel.Gs(n);
 
-					dxs.x += Gs[k]*r0[k].x;
-					dxs.y += Gs[k]*r0[k].y;
-					dxs.z += Gs[k]*r0[k].z;
-				}
+					// calculate jacobian
+					// note that we are integrating over the reference surface
+					dxr = dxs = vec3d(0,0,0);
+					for (int k=0; k<nseln; ++k)
+					{
+						dxr.x += Gr[k]*r0[k].x;
+						dxr.y += Gr[k]*r0[k].y;
+						dxr.z += Gr[k]*r0[k].z;
 
-				// jacobians
-				detJ[n] = (dxr ^ dxs).norm();
+						dxs.x += Gs[k]*r0[k].x;
+						dxs.y += Gs[k]*r0[k].y;
+						dxs.z += Gs[k]*r0[k].z;
+					}
 
-				// integration weights
-				w[n] = sel.GaussWeights()[n];
-			}
+					// jacobians
+					detJ[n] = (dxr ^ dxs).norm();
 
-			// loop over primary surface element nodes (which are the integration points as well)
-			// and calculate the contact nodal force
-			for (int n=0; n<nseln; ++n)
-			{
-				// get the local node number
-				int m = sel.m_lnode[n];
-
-				// see if this node's constraint is active
-				// that is, if it has an element associated with it
-				// TODO: is this a good way to test for an active constraint
-				// The rigid wall criteria seems to work much better.
-				if (ss.m_data[m].m_pme != 0)
-				{
-					// This node is active and could lead to a non-zero
-					// contact force.
-					// get the secondary surface element
-					FESurfaceElement& mel = *ss.m_data[m].m_pme;
-					ms.UnpackLM(mel, mLM);
-
-					// calculate the degrees of freedom
-					int nmeln = mel.Nodes();
-					int ndof = 3*(nmeln+1);
-					fe.resize(ndof);
-
-					// calculate the nodal force
-					ContactNodalForce(m, ss, mel, fe);
-
-					// multiply force with weights
-					for (int l=0; l<ndof; ++l) fe[l] *= detJ[n]*w[n];
-					
-					// fill the lm array
-					lm.resize(3*(nmeln+1));
-					lm[0] = sLM[n*3  ];
-					lm[1] = sLM[n*3+1];
-					lm[2] = sLM[n*3+2];
+					// integration weights
+					w[n] = sel.GaussWeights()[n];
+				}
 
-					for (int l=0; l<nmeln; ++l)
+				// loop over primary surface element nodes (which are the integration points as well)
+				// and calculate the contact nodal force
+				for (int n=0; n<nseln; ++n)
+				{
+					// get the local node number
+					int m = sel.m_lnode[n];
+
+					// see if this node's constraint is active
+					// that is, if it has an element associated with it
+					// TODO: is this a good way to test for an active constraint
+					// The rigid wall criteria seems to work much better.
+					if (ss.m_data[m].m_pme != 0)
 					{
-						lm[3*(l+1)  ] = mLM[l*3  ];
-						lm[3*(l+1)+1] = mLM[l*3+1];
-						lm[3*(l+1)+2] = mLM[l*3+2];
+						// This node is active and could lead to a non-zero
+						// contact force.
+						// get the secondary surface element
+						FESurfaceElement& mel = *ss.m_data[m].m_pme;
+						ms.UnpackLM(mel, mLM);
+
+						// calculate the degrees of freedom
+						int nmeln = mel.Nodes();
+						int ndof = 3*(nmeln+1);
+						fe.resize(ndof);
+
+						// calculate the nodal force
+						ContactNodalForce(m, ss, mel, fe);
+
+						// multiply force with weights
+						for (int l=0; l<ndof; ++l) fe[l] *= detJ[n]*w[n];
+					
+						// fill the lm array
+						lm.resize(3*(nmeln+1));
+						lm[0] = sLM[n*3  ];
+						lm[1] = sLM[n*3+1];
+						lm[2] = sLM[n*3+2];
+
+						for (int l=0; l<nmeln; ++l)
+						{
+							lm[3*(l+1)  ] = mLM[l*3  ];
+							lm[3*(l+1)+1] = mLM[l*3+1];
+							lm[3*(l+1)+2] = mLM[l*3+2];
+						}
+
+						// fill the en array
+						en.resize(nmeln+1);
+						en[0] = sel.m_node[n];
+						for (int l=0; l<nmeln; ++l) en[l+1] = mel.m_node[l];
+
+						// assemble into global force vector
+						R.Assemble(en, lm, fe);
 					}
-
-					// fill the en array
-					en.resize(nmeln+1);
-					en[0] = sel.m_node[n];
-					for (int l=0; l<nmeln; ++l) en[l+1] = mel.m_node[l];
-
-					// assemble into global force vector
-					R.Assemble(en, lm, fe);
 				}
 			}
 		}
@@ -858,7 +861,7 @@ void FESlidingInterface::ContactNodalForce(int m, FESlidingSurface& ss, FESurfac
 	mat2d Mki = Mk.inverse();
 
 	// get the secondary surface element node positions
-	for (int k=0; k<nmeln; ++k) rtm[k] = mesh.Node(mel.m_node[k]).m_rt;
+	for (int k=0; k<nmeln; ++k) rtm[k] = mesh.Node(mel.m_node[k]).m_rt();
 
 	// isoparametric coordinates of the projected node
 	// onto the secondary surface element
@@ -1009,20 +1012,7 @@ void FESlidingInterface::ContactNodalForce(int m, FESlidingSurface& ss, FESurfac
 
 void FESlidingInterface::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& tp)
 {
-	FEElementMatrix ke;
-
-	const int MAXMN = FEElement::MAX_NODES;
-	vector<int> lm(3*(MAXMN + 1));
-	vector<int> en(MAXMN+1);
-
-	double *Gr, *Gs, w[6];
-	vec3d r0[6];
-
-	double detJ[6];
-	vec3d dxr, dxs;
-
-	vector<int> sLM;
-	vector<int> mLM;
+	TimerTracker t(&m_stiffnessTimer);
 
 	// do two-pass
 	int npass = (m_btwo_pass?2:1);
@@ -1035,88 +1025,108 @@ void FESlidingInterface::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& t
 
 		// loop over all primary surface elements
 		int ne = ss.Elements();
-		for (int j=0; j<ne; ++j)
+		#pragma omp parallel shared(ne)
 		{
-			// unpack the next element
-			FESurfaceElement& se = ss.Element(j);
-			int nseln = se.Nodes();
+			// per-thread buffers
+			FEElementMatrix ke;
 
-			// get the element's LM array
-			ss.UnpackLM(se, sLM);
+			const int MAXMN = FEElement::MAX_NODES;
+			vector<int> lm(3*(MAXMN + 1));
+			vector<int> en(MAXMN+1);
 
-			// get the nodal coordinates
-			for (int i=0; i<nseln; ++i) r0[i] = ss.GetMesh()->Node(se.m_node[i]).m_r0;
+			double *Gr, *Gs, w[MAXMN];
+			vec3d r0[MAXMN];
 
-			// get all the metrics we need 
-			for (int n=0; n<nseln; ++n)
-			{
-				Gr = se.Gr(n);
-				Gs = se.Gs(n);
+			double detJ[MAXMN];
+			vec3d dxr, dxs;
 
-				// calculate jacobian
-				dxr = dxs = vec3d(0,0,0);
-				for (int k=0; k<nseln; ++k)
-				{
-					dxr.x += Gr[k]*r0[k].x;
-					dxr.y += Gr[k]*r0[k].y;
-					dxr.z += Gr[k]*r0[k].z;
+			vector<int> sLM;
+			vector<int> mLM;
 
-					dxs.x += Gs[k]*r0[k].x;
-					dxs.y += Gs[k]*r0[k].y;
-					dxs.z += Gs[k]*r0[k].z;
-				}
+			#pragma omp for
+			for (int j=0; j<ne; ++j)
+			{
+				// unpack the next element
+				FESurfaceElement& se = ss.Element(j);
+				int nseln = se.Nodes();
 
-				detJ[n] = (dxr ^ dxs).norm();
-				w[n] = se.GaussWeights()[n];
-			}
+				// get the element's LM array
+				ss.UnpackLM(se, sLM);
 
-			// loop over all integration points (that is nodes)
-			for (int n=0; n<nseln; ++n)
-			{
-				int m = se.m_lnode[n];
+				// get the nodal coordinates
+				for (int i=0; i<nseln; ++i) r0[i] = ss.GetMesh()->Node(se.m_node[i]).m_r0();
 
-				// see if this node's constraint is active
-				// that is, if it has an element associated with it
-				if (ss.m_data[m].m_pme != 0)
+				// get all the metrics we need 
+				for (int n=0; n<nseln; ++n)
 				{
-					// get the secondary surface element
-					FESurfaceElement& me = *ss.m_data[m].m_pme;
-
-					// get the secondary surface element's LM array
-					ms.UnpackLM(me, mLM);
+					Gr = se.Gr(n);
+					Gs = se.Gs(n);
 
-					int nmeln = me.Nodes();
-					int ndof = 3*(nmeln+1);
+					// calculate jacobian
+					dxr = dxs = vec3d(0,0,0);
+					for (int k=0; k<nseln; ++k)
+					{
+						dxr.x += Gr[k]*r0[k].x;
+						dxr.y += Gr[k]*r0[k].y;
+						dxr.z += Gr[k]*r0[k].z;
 
-					// calculate the stiffness matrix
-					ke.resize(ndof, ndof);
-					ContactNodalStiffness(m, ss, me, ke);
+						dxs.x += Gs[k]*r0[k].x;
+						dxs.y += Gs[k]*r0[k].y;
+						dxs.z += Gs[k]*r0[k].z;
+					}
 
-					// muliply with weights
-					for (int k=0; k<ndof; ++k)
-						for (int l=0; l<ndof; ++l) ke[k][l] *= detJ[n]*w[n];
+					detJ[n] = (dxr ^ dxs).norm();
+					w[n] = se.GaussWeights()[n];
+				}
 
-					// fill the lm array
-					lm[0] = sLM[n*3  ];
-					lm[1] = sLM[n*3+1];
-					lm[2] = sLM[n*3+2];
+				// loop over all integration points (that is nodes)
+				for (int n=0; n<nseln; ++n)
+				{
+					int m = se.m_lnode[n];
 
-					for (int k=0; k<nmeln; ++k)
+					// see if this node's constraint is active
+					// that is, if it has an element associated with it
+					if (ss.m_data[m].m_pme != 0)
 					{
-						lm[3*(k+1)  ] = mLM[k*3  ];
-						lm[3*(k+1)+1] = mLM[k*3+1];
-						lm[3*(k+1)+2] = mLM[k*3+2];
-					}
-
-					// create the en array
-					en.resize(nmeln+1);
-					en[0] = se.m_node[n];
-					for (int k=0; k<nmeln; ++k) en[k+1] = me.m_node[k];
+						// get the secondary surface element
+						FESurfaceElement& me = *ss.m_data[m].m_pme;
+
+						// get the secondary surface element's LM array
+						ms.UnpackLM(me, mLM);
+
+						int nmeln = me.Nodes();
+						int ndof = 3*(nmeln+1);
+
+						// calculate the stiffness matrix
+						ke.resize(ndof, ndof);
+						ContactNodalStiffness(m, ss, me, ke);
+
+						// muliply with weights
+						for (int k=0; k<ndof; ++k)
+							for (int l=0; l<ndof; ++l) ke[k][l] *= detJ[n]*w[n];
+
+						// fill the lm array
+						lm[0] = sLM[n*3  ];
+						lm[1] = sLM[n*3+1];
+						lm[2] = sLM[n*3+2];
+
+						for (int k=0; k<nmeln; ++k)
+						{
+							lm[3*(k+1)  ] = mLM[k*3  ];
+							lm[3*(k+1)+1] = mLM[k*3+1];
+							lm[3*(k+1)+2] = mLM[k*3+2];
+						}
+
+						// create the en array
+						en.resize(nmeln+1);
+						en[0] = se.m_node[n];
+						for (int k=0; k<nmeln; ++k) en[k+1] = me.m_node[k];
 						
-					// assemble stiffness matrix
-					ke.SetNodes(en);
-					ke.SetIndices(lm);
-					LS.Assemble(ke);
+						// assemble stiffness matrix
+						ke.SetNodes(en);
+						ke.SetIndices(lm);
+						LS.Assemble(ke);
+					}
 				}
 			}
 		}
@@ -1152,7 +1162,7 @@ void FESlidingInterface::ContactNodalStiffness(int m, FESlidingSurface& ss, FESu
 
 	// nodal coordinates
 	vec3d rt[MAXMN];
-	for (int j=0; j<nmeln; ++j) rt[j] = mesh.Node(mel.m_node[j]).m_rt;
+	for (int j=0; j<nmeln; ++j) rt[j] = mesh.Node(mel.m_node[j]).m_rt();
 
 	// node natural coordinates in secondary surface element
 	double r = ss.m_data[m].m_rs[0];
@@ -185,6 +185,9 @@ private:
 	bool	m_bfirst;	//!< flag to indicate the first time we enter Update
 	double	m_normg0;	//!< initial gap norm
 
+	FEClosestPointProjection	m_cppm;	//!< projection onto secondary surface
+	FEClosestPointProjection	m_cpps;	//!< projection onto primary surface (two-pass)
+
 public:
 	DECLARE_FECORE_CLASS();
 };
@@ -30,6 +30,7 @@ SOFTWARE.*/
 #include "FESolidSolver.h"
 #include <FECore/FELinearConstraintManager.h>
 #include <FECore/FEModel.h>
+#include <FECore/sys.h>
 
 FESolidLinearSystem::FESolidLinearSystem(FESolver* solver, FERigidSolver* rigidSolver, FEGlobalMatrix& K, std::vector<double>& F, std::vector<double>& u, bool bsymm, double alpha, int nreq) : FELinearSystem(solver, K, F, u, bsymm)
 {
@@ -37,6 +38,17 @@ FESolidLinearSystem::FESolidLinearSystem(FESolver* solver, FERigidSolver* rigidS
 	m_alpha = alpha;
 	m_nreq = nreq;
 	m_stiffnessScale = 1.0;
+
+	// Elements attached to rigid bodies couple to the same rigid body equations, so the 
+	// rigid contributions are collected per thread and added in the destructor.
+	int nthreads = omp_get_max_threads();
+	if (nthreads < 1) nthreads = 1;
+	m_rigidBuffer.assign(nthreads, FERigidStiffnessBuffer(u));
+}
+
+FESolidLinearSystem::~FESolidLinearSystem()
+{
+	for (size_t i = 0; i < m_rigidBuffer.size(); ++i) m_rigidBuffer[i].Flush(m_K, m_F);
 }
 
 // scale factor for stiffness matrix
@@ -121,7 +133,16 @@ void FESolidLinearSystem::Assemble(const FEElementMatrix& ke)
 		}
 
 		// see if there are any rigid body dofs here
-		#pragma omp critical 
-		m_rigidSolver->RigidStiffness(m_K, m_u, m_F, ke, m_alpha);
+		if (m_rigidSolver->HasRigidNodes(ke.Nodes()))
+		{
+			int n = omp_get_thread_num();
+			if (n < (int)m_rigidBuffer.size())
+				m_rigidSolver->RigidStiffness(m_rigidBuffer[n], ke, m_alpha);
+			else
+			{
+				#pragma omp critical 
+				m_rigidSolver->RigidStiffness(m_K, m_u, m_F, ke, m_alpha);
+			}
+		}
 	}
 }
@@ -28,15 +28,17 @@ SOFTWARE.*/
 #pragma once
 
 #include <FECore/FELinearSystem.h>
+#include "FERigidSolver.h"
 #include "febiomech_api.h"
 
-class FERigidSolver;
-
 class FEBIOMECH_API FESolidLinearSystem : public FELinearSystem
 {
 public:
 	FESolidLinearSystem(FESolver* solver, FERigidSolver* rigidSolver, FEGlobalMatrix& K, std::vector<double>& F, std::vector<double>& u, bool bsymm, double alpha, int nreq);
 
+	// The destructor adds the collected rigid body contributions to the global system
+	~FESolidLinearSystem();
+
 	// Assembly routine
 	// This assembles the element stiffness matrix ke into the global matrix.
 	// The contributions of prescribed degrees of freedom will be stored in m_F
@@ -51,4 +53,7 @@ private:
 	int				m_nreq;
 
 	double	m_stiffnessScale;
+
+	// rigid body contributions, collected per thread
+	std::vector<FERigidStiffnessBuffer>	m_rigidBuffer;
 };
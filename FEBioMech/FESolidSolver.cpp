@@ -253,7 +253,7 @@ void FESolidSolver::UpdateKinematics(vector<double>& ui)
 	{
 		FENode& node = mesh.Node(i);
 		if (node.m_rid == -1)
-			node.m_rt = node.m_r0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
+			node.m_rt() = node.m_r0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
 	}
 
 	// update velocity and accelerations
@@ -269,8 +269,8 @@ void FESolidSolver::UpdateKinematics(vector<double>& ui)
 		for (int i = 0; i<N; ++i)
 		{
 			FENode& n = mesh.Node(i);
-			n.m_at = (n.m_rt - n.m_rp)*b - n.m_vp*a + n.m_ap*c;
-			vec3d vt = n.m_vp + (n.m_ap*(1.0 - m_gamma) + n.m_at*m_gamma)*dt;
+			n.m_at() = (n.m_rt() - n.m_rp())*b - n.m_vp()*a + n.m_ap()*c;
+			vec3d vt = n.m_vp() + (n.m_ap()*(1.0 - m_gamma) + n.m_at()*m_gamma)*dt;
 			n.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vt);
 		}
 
@@ -306,9 +306,9 @@ void FESolidSolver::PrepStep()
 	for (int i=0; i<mesh.Nodes(); ++i)
 	{
 		FENode& ni = mesh.Node(i);
-		ni.m_rp = ni.m_rt;
-		ni.m_vp = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
-		ni.m_ap = ni.m_at;
+		ni.m_rp() = ni.m_rt();
+		ni.m_vp() = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
+		ni.m_ap() = ni.m_at();
 	}
 
 	const FETimeInfo& tp = fem.GetTime();
@@ -406,7 +406,7 @@ bool FESolidSolver::Quasin()
 		bconv = true;
 
 		// solve the equations (returns line search; solution stored in m_ui)
-		double s = QNSolve();
+		double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
 
 		// set initial convergence norms
 		if (m_niter == 0)
@@ -652,7 +652,7 @@ bool FESolidSolver::Residual(vector<double>& R)
 	zero(m_Fr);
 
 	// setup the global vector
-	FEResidualVector RHS(fem, R, m_Fr);
+	FEResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
 
 	// zero rigid body reaction forces
 	m_rigidSolver.Residual();
@@ -765,10 +765,10 @@ void FESolidSolver::InertialForces(FEGlobalVector& R)
 	for (int i=0; i<mesh.Nodes(); ++i)
 	{
 		FENode& node = mesh.Node(i);
-		vec3d& rt = node.m_rt;
-		vec3d& rp = node.m_rp;
-		vec3d& vp = node.m_vp;
-		vec3d& ap = node.m_ap;
+		vec3d& rt = node.m_rt();
+		vec3d& rp = node.m_rp();
+		vec3d& vp = node.m_vp();
+		vec3d& ap = node.m_ap();
 
 		F[3*i  ] = b*(rt.x - rp.x) - a*vp.x + c * ap.x;
 		F[3*i+1] = b*(rt.y - rp.y) - a*vp.y + c * ap.y;
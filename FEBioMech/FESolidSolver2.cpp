@@ -377,23 +377,21 @@ void FESolidSolver2::UpdateKinematics(vector<double>& ui)
 	// update rigid bodies
 	m_rigidSolver.UpdateRigidBodies(m_Ui, ui);
 
-	// total displacements
-	vector<double> U(m_Ut.size());
-	for (size_t i=0; i<m_Ut.size(); ++i) U[i] = ui[i] + m_Ui[i] + m_Ut[i];
-
 	// update flexible nodes
-	// translational dofs
-	scatter(U, mesh, m_dofU[0]);
-	scatter(U, mesh, m_dofU[1]);
-	scatter(U, mesh, m_dofU[2]);
-	// rotational dofs
-	scatter(U, mesh, m_dofSQ[0]);
-	scatter(U, mesh, m_dofSQ[1]);
-	scatter(U, mesh, m_dofSQ[2]);
-    // shell dofs
-    scatter(U, mesh, m_dofSU[0]);
-    scatter(U, mesh, m_dofSU[1]);
-    scatter(U, mesh, m_dofSU[2]);
+	// translational, rotational, and shell dofs
+	// The total displacement is evaluated directly from the equation numbers.
+	const int dofs[9] = { m_dofU[0], m_dofU[1], m_dofU[2], m_dofSQ[0], m_dofSQ[1], m_dofSQ[2], m_dofSU[0], m_dofSU[1], m_dofSU[2] };
+	const int NN = mesh.Nodes();
+#pragma omp parallel for
+	for (int i = 0; i<NN; ++i)
+	{
+		FENode& node = mesh.Node(i);
+		for (int j = 0; j < 9; ++j)
+		{
+			int n = node.m_ID[dofs[j]];
+			if (n >= 0) node.set(dofs[j], ui[n] + m_Ui[n] + m_Ut[n]);
+		}
+	}
 
 	// make sure the boundary conditions are fullfilled
 	int nbcs = fem.BoundaryConditions();
@@ -414,13 +412,14 @@ void FESolidSolver2::UpdateKinematics(vector<double>& ui)
 
 	// Update the spatial nodal positions
 	// Don't update rigid nodes since they are already updated
-	for (int i = 0; i<mesh.Nodes(); ++i)
+#pragma omp parallel for
+	for (int i = 0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
         if (node.m_rid == -1) {
-			node.m_rt = node.m_r0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
+			node.m_rt() = node.m_r0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]);
         }
-        node.m_dt = node.m_d0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2])
+        node.m_dt() = node.m_d0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2])
         - node.get_vec3d(m_dofSU[0], m_dofSU[1], m_dofSU[2]);
 	}
 
@@ -434,11 +433,12 @@ void FESolidSolver2::UpdateKinematics(vector<double>& ui)
 		double a = 1.0 / (m_beta*dt);
 		double b = a / dt;
 		double c = 1.0 - 0.5/m_beta;
+#pragma omp parallel for
 		for (int i=0; i<N; ++i)
 		{
 			FENode& n = mesh.Node(i);
-			n.m_at = (n.m_rt - n.m_rp)*b - n.m_vp*a + n.m_ap*c;
-			vec3d vt = n.m_vp + (n.m_ap*(1.0 - m_gamma) + n.m_at*m_gamma)*dt;
+			n.m_at() = (n.m_rt() - n.m_rp())*b - n.m_vp()*a + n.m_ap()*c;
+			vec3d vt = n.m_vp() + (n.m_ap()*(1.0 - m_gamma) + n.m_at()*m_gamma)*dt;
 			n.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vt);
             
             // shell kinematics
@@ -479,26 +479,19 @@ void FESolidSolver2::UpdateIncrements(vector<double>& Ui, vector<double>& ui, bo
 	m_rigidSolver.UpdateIncrements(Ui, ui, emap);
         
 	// update flexible nodes
-	int n;
-	for (int i=0; i<mesh.Nodes(); ++i)
+	// current position = initial + total at prev conv step + total increment so far + current increment
+	// (displacement, rotational, and shell dofs)
+	const int dofs[9] = { m_dofU[0], m_dofU[1], m_dofU[2], m_dofSQ[0], m_dofSQ[1], m_dofSQ[2], m_dofSU[0], m_dofSU[1], m_dofSU[2] };
+	const int NN = mesh.Nodes();
+#pragma omp parallel for
+	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
-        
-		// displacement dofs
-		// current position = initial + total at prev conv step + total increment so far + current increment
-		if ((n = node.m_ID[m_dofU[0]]) >= 0) Ui[n] += ui[n];
-		if ((n = node.m_ID[m_dofU[1]]) >= 0) Ui[n] += ui[n];
-		if ((n = node.m_ID[m_dofU[2]]) >= 0) Ui[n] += ui[n];
-        
-        // rotational dofs
-        if ((n = node.m_ID[m_dofSQ[0]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofSQ[1]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofSQ[2]]) >= 0) Ui[n] += ui[n];
-        
-        // shell dofs
-        if ((n = node.m_ID[m_dofSU[0]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofSU[1]]) >= 0) Ui[n] += ui[n];
-        if ((n = node.m_ID[m_dofSU[2]]) >= 0) Ui[n] += ui[n];
+		for (int j = 0; j < 9; ++j)
+		{
+			int n = node.m_ID[dofs[j]];
+			if (n >= 0) Ui[n] += ui[n];
+		}
 	}
 
 	for (int i = 0; i < fem.NonlinearConstraints(); ++i)
@@ -555,17 +548,17 @@ void FESolidSolver2::Update2(const vector<double>& ui)
         
 		if (node.m_rid == -1)
 		{
-			vec3d rt = node.m_r0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]) + du;
-			node.m_rt = rt;
+			vec3d rt = node.m_r0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]) + du;
+			node.m_rt() = rt;
 		}
         vec3d db(0, 0, 0);
         int nbx = -node.m_ID[m_dofSU[0]] - 2; if (nbx >= 0) db.x = ui[nbx];
         int nby = -node.m_ID[m_dofSU[1]] - 2; if (nby >= 0) db.y = ui[nby];
         int nbz = -node.m_ID[m_dofSU[2]] - 2; if (nbz >= 0) db.z = ui[nbz];
 
-        vec3d dt = node.m_d0 + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]) + du
+        vec3d dt = node.m_d0() + node.get_vec3d(m_dofU[0], m_dofU[1], m_dofU[2]) + du
         - (node.get_vec3d(m_dofSU[0], m_dofSU[1], m_dofSU[2]) + db);
-        node.m_dt = dt;
+        node.m_dt() = dt;
 	}
 
 	// update model state
@@ -638,19 +631,19 @@ void FESolidSolver2::PrepStep()
 	// store previous mesh state
 	// we need them for velocity and acceleration calculations
 	FEMesh& mesh = fem.GetMesh();
+	mesh.UpdateNodalValues();
 	for (int i=0; i<mesh.Nodes(); ++i)
 	{
 		FENode& ni = mesh.Node(i);
-		ni.m_rp = ni.m_rt;
-		ni.m_vp = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
-		ni.m_ap = ni.m_at;
-        ni.m_dp = ni.m_dt;
-		ni.UpdateValues();
+		ni.m_rp() = ni.m_rt();
+		ni.m_vp() = ni.get_vec3d(m_dofV[0], m_dofV[1], m_dofV[2]);
+		ni.m_ap() = ni.m_at();
+        ni.m_dp() = ni.m_dt();
 
         // initial guess at start of new time step
         // solid
-        ni.m_at = ni.m_ap*(1-0.5/m_beta) - ni.m_vp/(m_beta*dt);
-        vec3d vs = ni.m_vp + (ni.m_at*m_gamma + ni.m_ap*(1-m_gamma))*dt;
+        ni.m_at() = ni.m_ap()*(1-0.5/m_beta) - ni.m_vp()/(m_beta*dt);
+        vec3d vs = ni.m_vp() + (ni.m_at()*m_gamma + ni.m_ap()*(1-m_gamma))*dt;
         ni.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vs);
         
         // solid shell
@@ -783,7 +776,7 @@ bool FESolidSolver2::Quasin()
 		if (m_arcLength > 0) DoArcLength();
 
 		// do the line search
-		double s = DoLineSearch();
+		double s = DoLineSearch(m_niter == 0 ? 0.0 : normEi);
 
 		// set initial convergence norms
 		if (m_niter == 0)
@@ -1202,7 +1195,7 @@ bool FESolidSolver2::Residual(vector<double>& R)
 
 	// setup the global vector
 	zero(R);
-	FEResidualVector RHS(fem, R, m_Fr);
+	FEResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
 
 	// zero rigid body reaction forces
 	m_rigidSolver.Residual();
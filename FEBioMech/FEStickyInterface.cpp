@@ -120,7 +120,7 @@ void FEStickySurface::GetNodalContactTraction(int nface, vec3d* tn)
 
 //-----------------------------------------------------------------------------
 //! Constructor. Initialize default values.
-FEStickyInterface::FEStickyInterface(FEModel* pfem) : FEContactInterface(pfem), ss(pfem), ms(pfem)
+FEStickyInterface::FEStickyInterface(FEModel* pfem) : FEContactInterface(pfem), ss(pfem), ms(pfem), m_cpp(ms)
 {
 	static int count = 1;
 	SetID(count++);
@@ -191,7 +191,7 @@ void FEStickyInterface::BuildMatrixProfile(FEGlobalMatrix& K)
 
 			for (int k=0; k<n; ++k)
 			{
-				vector<int>& id = mesh.Node(en[k]).m_ID;
+				FENodeArray<int>& id = mesh.Node(en[k]).m_ID;
 				lm[6*(k+1)  ] = id[dof_X];
 				lm[6*(k+1)+1] = id[dof_Y];
 				lm[6*(k+1)+2] = id[dof_Z];
@@ -222,11 +222,11 @@ void FEStickyInterface::Activate()
 //!
 void FEStickyInterface::Update()
 {
-	// closest point projection method
-	FEClosestPointProjection cpp(ms);
+	// closest point projection method (refit to the current positions)
+	FEClosestPointProjection& cpp = m_cpp;
 	cpp.HandleSpecialCases(true);
 	cpp.SetTolerance(m_stol);
-	cpp.Init();
+	cpp.Update();
 
 	// get the mesh
 	FEMesh& mesh = *ss.GetMesh();
@@ -242,7 +242,7 @@ void FEStickyInterface::Update()
 		if (pme)
 		{
 			// get the current primary nodal position
-			vec3d rt = ss.Node(i).m_rt;
+			vec3d rt = ss.Node(i).m_rt();
 
 			// get the natural coordinates of the primary projection
 			// onto the secondary element
@@ -252,7 +252,7 @@ void FEStickyInterface::Update()
 			// get the nodal coordinates
 			int ne = pme->Nodes();
 			vec3d y[FEElement::MAX_NODES];
-			for (int l=0; l<ne; ++l) y[l] = mesh.Node( pme->m_node[l] ).m_rt;
+			for (int l=0; l<ne; ++l) y[l] = mesh.Node( pme->m_node[l] ).m_rt();
 
 			// calculate the primary node projection
 			vec3d q = pme->eval(y, r, s);
@@ -283,7 +283,7 @@ void FEStickyInterface::Update()
 		{
 			// get the nodal position of this primary node
 			FENode& node = ss.Node(i);
-			vec3d x = node.m_rt;
+			vec3d x = node.m_rt();
 
 			// find the secondary element
 			vec3d q; vec2d rs;
@@ -317,11 +317,11 @@ void FEStickyInterface::Update()
 
 void FEStickyInterface::ProjectSurface(FEStickySurface& ss, FEStickySurface& ms, bool bmove)
 {
-	// closest point projection method
-	FEClosestPointProjection cpp(ms);
+	// closest point projection method (refit to the current positions)
+	FEClosestPointProjection& cpp = m_cpp;
 	cpp.HandleSpecialCases(true);
 	cpp.SetTolerance(m_stol);
-	cpp.Init();
+	cpp.Update();
 
 	// loop over all primary nodes
 	for (int i=0; i<ss.Nodes(); ++i)
@@ -334,7 +334,7 @@ void FEStickyInterface::ProjectSurface(FEStickySurface& ss, FEStickySurface& ms,
 		sni.pme = 0;
 
 		// get the nodal position of this primary node
-		vec3d x = node.m_rt;
+		vec3d x = node.m_rt();
 
 		// find the secondary element
 		vec3d q; vec2d rs;
@@ -362,7 +362,7 @@ void FEStickyInterface::ProjectSurface(FEStickySurface& ss, FEStickySurface& ms,
 				// move the node if necessary
 				if (bmove && (sni.gap.norm()>0))
 				{
-					node.m_r0 = node.m_rt = q;
+					node.m_r0() = node.m_rt() = q;
 					sni.gap = vec3d(0,0,0);
 				}
 			}
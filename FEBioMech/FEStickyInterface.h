@@ -29,6 +29,7 @@ SOFTWARE.*/
 #pragma once
 #include "FEContactInterface.h"
 #include "FEContactSurface.h"
+#include <FECore/FEClosestPointProjection.h>
 
 //-----------------------------------------------------------------------------
 //! This class describes a contact surface used for sticky contact.
@@ -137,5 +138,9 @@ public:
 	double		m_tmax;		//!< max traction
 	double		m_snap;		//!< snap tolerance
 
+private:
+	FEClosestPointProjection	m_cpp;	//!< projection onto secondary surface
+
+public:
 	DECLARE_FECORE_CLASS();
 };
@@ -70,12 +70,12 @@ bool FESymmetryPlane::Init()
     // for a symmetry plane the constraint on (ux, uy, uz) is
     // nx*ux + ny*uy + nz*uz = 0
     for (int i=0; i<N; ++i) {
-        FENode node = m_surf.Node(i);
+        FENode& node = m_surf.Node(i);
         if (node.HasFlags(FENode::EXCLUDE) == false) {
             FEAugLagLinearConstraint* pLC = new FEAugLagLinearConstraint;
             for (int j=0; j<3; ++j) {
                 FEAugLagLinearConstraint::DOF dof;
-                dof.node = node.GetID() - 1;    // zero-based
+                dof.node = m_surf.NodeIndex(i);    // zero-based
                 switch (j) {
                     case 0:
                         dof.bc = dofs.GetDOF("x");
@@ -101,12 +101,12 @@ bool FESymmetryPlane::Init()
     
     // for nodes that belong to shells, also constraint the shell bottom face displacements
     for (int i=0; i<N; ++i) {
-        FENode node = m_surf.Node(i);
+        FENode& node = m_surf.Node(i);
         if ((node.HasFlags(FENode::EXCLUDE) == false) && (node.HasFlags(FENode::SHELL))) {
             FEAugLagLinearConstraint* pLC = new FEAugLagLinearConstraint;
             for (int j=0; j<3; ++j) {
                 FEAugLagLinearConstraint::DOF dof;
-                dof.node = node.GetID() - 1;    // zero-based
+                dof.node = m_surf.NodeIndex(i);    // zero-based
                 switch (j) {
                     case 0:
                         dof.bc = dofs.GetDOF("sx");
@@ -118,7 +118,7 @@ void FETiedElasticSurface::UpdateNodeNormals()
         ne = el.Nodes();
         
         // get the nodal coordinates
-        for (j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt;
+        for (j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt();
         
         // calculate the normals
         for (j=0; j<ne; ++j)
@@ -265,7 +265,7 @@ void FETiedElasticInterface::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nseln; ++l)
                     {
-                        vector<int>& id = mesh.Node(sn[l]).m_ID;
+                        FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
                         lm[ndpn*l  ] = id[dof_X];
                         lm[ndpn*l+1] = id[dof_Y];
                         lm[ndpn*l+2] = id[dof_Z];
@@ -276,7 +276,7 @@ void FETiedElasticInterface::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nmeln; ++l)
                     {
-                        vector<int>& id = mesh.Node(mn[l]).m_ID;
+                        FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
                         lm[ndpn*(l+nseln)  ] = id[dof_X];
                         lm[ndpn*(l+nseln)+1] = id[dof_Y];
                         lm[ndpn*(l+nseln)+2] = id[dof_Z];
@@ -126,7 +126,7 @@ void FETiedInterface::BuildMatrixProfile(FEGlobalMatrix& K)
 
 				for (int k = 0; k < n; ++k)
 				{
-					vector<int>& id = mesh.Node(en[k]).m_ID;
+					FENodeArray<int>& id = mesh.Node(en[k]).m_ID;
 					lm[6 * (k + 1)] = id[dof_X];
 					lm[6 * (k + 1) + 1] = id[dof_Y];
 					lm[6 * (k + 1) + 2] = id[dof_Z];
@@ -159,7 +159,7 @@ void FETiedInterface::BuildMatrixProfile(FEGlobalMatrix& K)
 
 				for (int k = 0; k < n; ++k)
 				{
-					vector<int>& id = mesh.Node(en[k]).m_ID;
+					FENodeArray<int>& id = mesh.Node(en[k]).m_ID;
 					lm[3 * (k + 1)    ] = id[dof_X];
 					lm[3 * (k + 1) + 1] = id[dof_Y];
 					lm[3 * (k + 1) + 2] = id[dof_Z];
@@ -218,7 +218,7 @@ void FETiedInterface::Update()
 		if (pme)
 		{
 			// get the current primary nodal position
-			vec3d rt = ss.Node(i).m_rt;
+			vec3d rt = ss.Node(i).m_rt();
 
 			// get the natural coordinates of the primary projection
 			// onto the secondary element
@@ -228,7 +228,7 @@ void FETiedInterface::Update()
 			// get the nodal coordinates
 			int ne = pme->Nodes();
 			vec3d y[FEElement::MAX_NODES];
-			for (int l=0; l<ne; ++l) y[l] = mesh.Node( pme->m_node[l] ).m_rt;
+			for (int l=0; l<ne; ++l) y[l] = mesh.Node( pme->m_node[l] ).m_rt();
 
 			// calculate the primary node projection
 			vec3d q = pme->eval(y, r, s);
@@ -265,7 +265,7 @@ void FETiedInterface::ProjectSurface(FETiedContactSurface& ss, FETiedContactSurf
 		ss.m_data[i].m_pme = nullptr;
 
 		// get the nodal position of this primary node
-		vec3d x = node.m_rt;
+		vec3d x = node.m_rt();
 
 		// find the secondary element
 		vec3d q; vec2d rs;
@@ -291,7 +291,7 @@ void FETiedInterface::ProjectSurface(FETiedContactSurface& ss, FETiedContactSurf
 				// move the node if necessary
 				if (bmove && (ss.m_data[i].m_vgap.norm()>0))
 				{
-					node.m_r0 = node.m_rt = q + nu*ss.m_data[i].m_off;
+					node.m_r0() = node.m_rt() = q + nu*ss.m_data[i].m_off;
 					ss.m_data[i].m_vgap = vec3d(0,0,0);
 				}
 
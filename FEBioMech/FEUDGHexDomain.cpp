@@ -137,8 +137,8 @@ void FEUDGHexDomain::UDGHourglassForces(FESolidElement &el, vector<double> &fe)
 	vec3d r0[8], rt[8];
 	for (i=0; i<neln; ++i)
 	{
-		r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
-		rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+		r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
+		rt[i] = m_pMesh->Node(el.m_node[i]).m_rt();
 	}
 
 	double x4 = 0, x5 = 0, x6 = 0, x7 = 0;
@@ -269,8 +269,8 @@ void FEUDGHexDomain::UDGHourglassStiffness(FEModel& fem, FESolidElement& el, mat
 	vec3d r0[8], rt[8];
 	for (i=0; i<neln; ++i)
 	{
-		r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
-		rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+		r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
+		rt[i] = m_pMesh->Node(el.m_node[i]).m_rt();
 	}
 
 	double x4 = 0, x5 = 0, x6 = 0, x7 = 0;
@@ -511,8 +511,8 @@ void FEUDGHexDomain::Update(const FETimeInfo& tp)
 		// nodal coordinates
 		for (int j=0; j<neln; ++j)
 		{
-			r0[j] = m_pMesh->Node(el.m_node[j]).m_r0;
-			rt[j] = m_pMesh->Node(el.m_node[j]).m_rt;
+			r0[j] = m_pMesh->Node(el.m_node[j]).m_r0();
+			rt[j] = m_pMesh->Node(el.m_node[j]).m_rt();
 		}
 
 		// get the integration weights
@@ -553,7 +553,7 @@ void FEUDGHexDomain::Update(const FETimeInfo& tp)
 void FEUDGHexDomain::AvgDefGrad(FESolidElement& el, mat3d& F, double GX[8], double GY[8], double GZ[8])
 {
 	vec3d rt[8];
-	for (int j=0; j<8; ++j) rt[j] = m_pMesh->Node(el.m_node[j]).m_rt;
+	for (int j=0; j<8; ++j) rt[j] = m_pMesh->Node(el.m_node[j]).m_rt();
 
 	F.zero();
 	for (int i=0; i<8; ++i)
@@ -582,11 +582,11 @@ void FEUDGHexDomain::AvgCartDerivs(FESolidElement& el, double GX[8], double GY[8
 	vec3d r[8];
 	if (nstate == 0)
 	{
-		for (int i=0; i<neln; ++i) r[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+		for (int i=0; i<neln; ++i) r[i] = m_pMesh->Node(el.m_node[i]).m_r0();
 	}
 	else
 	{
-		for (int i=0; i<neln; ++i) r[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+		for (int i=0; i<neln; ++i) r[i] = m_pMesh->Node(el.m_node[i]).m_rt();
 	}
 
 	double x1 = r[0].x, y1 = r[0].y, z1 = r[0].z;
@@ -659,11 +659,11 @@ double FEUDGHexDomain::HexVolume(FESolidElement& el, int state)
 	vec3d r[8];
 	if (state == 0)
 	{
-		for (int i=0; i<neln; ++i) r[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+		for (int i=0; i<neln; ++i) r[i] = m_pMesh->Node(el.m_node[i]).m_r0();
 	}
 	else
 	{
-		for (int i=0; i<neln; ++i) r[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+		for (int i=0; i<neln; ++i) r[i] = m_pMesh->Node(el.m_node[i]).m_rt();
 	}
 
 	// get the nodal coordinates
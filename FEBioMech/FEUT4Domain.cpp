@@ -286,7 +286,7 @@ bool FEUT4Domain::Init()
 		FESolidElement& el = m_Elem[i];
 
 		// get the current element coordinates
-		for (j=0; j<4; ++j) r0[j] = m_pMesh->Node(el.m_node[j]).m_r0;
+		for (j=0; j<4; ++j) r0[j] = m_pMesh->Node(el.m_node[j]).m_r0();
 
 		// calculate the initial volume
 		m_Ve0[i] = Ve = TetVolume(r0);
@@ -328,7 +328,7 @@ void FEUT4Domain::Update(const FETimeInfo& tp)
 		FESolidElement& el = m_Elem[i];
 
 		// nodal coordinates
-		for (j=0; j<4; ++j) rt[j] = m_pMesh->Node(el.m_node[j]).m_rt;
+		for (j=0; j<4; ++j) rt[j] = m_pMesh->Node(el.m_node[j]).m_rt();
 
 		// calculate the volume
 		Ve = m_Ve0[i];
@@ -360,8 +360,8 @@ void FEUT4Domain::Update(const FETimeInfo& tp)
 		UT4NODE& node = m_NODE[i];
 
 		// set the material point data
-		pt.m_r0 = m_pMesh->Node(node.inode).m_r0;
-		pt.m_rt = m_pMesh->Node(node.inode).m_rt;
+		pt.m_r0 = m_pMesh->Node(node.inode).m_r0();
+		pt.m_rt = m_pMesh->Node(node.inode).m_rt();
 
 		pt.m_F = node.Fi;
 		pt.m_J = pt.m_F.det();
@@ -818,8 +818,8 @@ void FEUT4Domain::NodalMaterialStiffness(UT4NODE& node, matrix& ke, FESolidMater
 	pt.Init();
 
 	// set the material point data
-	pt.m_r0 = m_pMesh->Node(node.inode).m_r0;
-	pt.m_rt = m_pMesh->Node(node.inode).m_rt;
+	pt.m_r0 = m_pMesh->Node(node.inode).m_r0();
+	pt.m_rt = m_pMesh->Node(node.inode).m_rt();
 
 	pt.m_F = node.Fi;
 	pt.m_J = pt.m_F.det();
@@ -101,7 +101,7 @@ double FEVolumeSurface::Volume()
 
 		// get the nodal coordinates
 		int neln = el.Nodes();
-		for (int j=0; j<neln; ++j) x[j] = mesh.Node(el.m_node[j]).m_rt;
+		for (int j=0; j<neln; ++j) x[j] = mesh.Node(el.m_node[j]).m_rt();
 
 		// loop over integration points
 		double* w = el.GaussWeights();
@@ -201,7 +201,7 @@ void FEVolumeConstraint::UnpackLM(FEElement& el, vector<int>& lm)
 	{
 		int n = el.m_node[i];
 		FENode& node = mesh.Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		lm[3*i  ] = id[m_dofX];
 		lm[3*i+1] = id[m_dofY];
@@ -230,7 +230,7 @@ void FEVolumeConstraint::LoadVector(FEGlobalVector& R, const FETimeInfo& tp)
 
 		// get the nodal coordinates
 		int neln = el.Nodes();
-		for (int j=0; j<neln; ++j) x[j] = mesh.Node(el.m_node[j]).m_rt;
+		for (int j=0; j<neln; ++j) x[j] = mesh.Node(el.m_node[j]).m_rt();
 
 		// allocate element residual vector
 		int ndof = 3*neln;
@@ -297,7 +297,7 @@ void FEVolumeConstraint::StiffnessMatrix(FELinearSystem& LS, const FETimeInfo& t
 
 		// get the nodal coordinates
 		int neln = el.Nodes();
-		for (int j=0; j<neln; ++j) x[j] = mesh.Node(el.m_node[j]).m_rt;
+		for (int j=0; j<neln; ++j) x[j] = mesh.Node(el.m_node[j]).m_rt();
 
 		// allocate the stiffness matrix
 		int ndof = 3*neln;
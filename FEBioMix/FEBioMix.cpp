@@ -241,6 +241,7 @@ REGISTER_FECORE_CLASS(FEPlotPorosity                         , "porosity"
 REGISTER_FECORE_CLASS(FEPlotPerm                             , "permeability"        );
 REGISTER_FECORE_CLASS(FEPlotElectricPotential                , "electric potential"  );
 REGISTER_FECORE_CLASS(FEPlotCurrentDensity                   , "current density"     );
+REGISTER_FECORE_CLASS(FEPlotElectroneutralityIterations      , "electroneutrality iterations");
 REGISTER_FECORE_CLASS(FEPlotFixedChargeDensity               , "fixed charge density");
 REGISTER_FECORE_CLASS(FEPlotReferentialFixedChargeDensity    , "referential fixed charge density");
 REGISTER_FECORE_CLASS(FEPlotNodalFluidFlux                   , "nodal fluid flux"    );
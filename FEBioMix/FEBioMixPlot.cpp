@@ -700,6 +700,22 @@ bool FEPlotElectricPotential::Save(FEDomain &dom, FEDataStream& a)
 	return false;
 }
 
+//-----------------------------------------------------------------------------
+bool FEPlotElectroneutralityIterations::Save(FEDomain &dom, FEDataStream& a)
+{
+	FEMultiphasicSolidDomain* pmd = dynamic_cast<FEMultiphasicSolidDomain*>(&dom);
+    FEMultiphasicShellDomain* psd = dynamic_cast<FEMultiphasicShellDomain*>(&dom);
+	if (pmd || psd)
+	{
+		writeAverageElementValue<double>(dom, a, [](const FEMaterialPoint& mp) {
+			const FESolutesMaterialPoint* pt = (mp.ExtractData<FESolutesMaterialPoint>());
+			return (pt ? (double) pt->m_nzeta : 0.0);
+		});
+		return true;
+	}
+	return false;
+}
+
 //-----------------------------------------------------------------------------
 bool FEPlotCurrentDensity::Save(FEDomain &dom, FEDataStream& a)
 {
@@ -130,6 +130,15 @@ public:
 	bool Save(FEDomain& dom, FEDataStream& a);
 };
 
+//-----------------------------------------------------------------------------
+//! Iterations of the electroneutrality solve
+class FEPlotElectroneutralityIterations : public FEPlotDomainData
+{
+public:
+	FEPlotElectroneutralityIterations(FEModel* pfem) : FEPlotDomainData(pfem, PLT_FLOAT, FMT_ITEM){}
+	bool Save(FEDomain& dom, FEDataStream& a);
+};
+
 //-----------------------------------------------------------------------------
 //! Current density
 class FEPlotCurrentDensity : public FEPlotDomainData
@@ -81,8 +81,8 @@ void FEBiphasicShellDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
         int neln = el.Nodes();
         for (int i=0; i<neln; ++i)
         {
-            x0[i] = m.Node(el.m_node[i]).m_r0;
-            xt[i] = m.Node(el.m_node[i]).m_rt;
+            x0[i] = m.Node(el.m_node[i]).m_r0();
+            xt[i] = m.Node(el.m_node[i]).m_rt();
             pn[i] = m.Node(el.m_node[i]).get(m_dofP);
             qn[i] = m.Node(el.m_node[i]).get(m_dofQ);
         }
@@ -154,7 +154,7 @@ void FEBiphasicShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         // first the displacement dofs
         lm[8*i  ] = id[m_dofU[0]];
@@ -903,8 +903,8 @@ void FEBiphasicShellDomain::UpdateElementStress(int iel)
     double qn[FEElement::MAX_NODES];
     for (int j=0; j<neln; ++j)
     {
-        r0[j] = mesh.Node(el.m_node[j]).m_r0;
-        rt[j] = mesh.Node(el.m_node[j]).m_rt;
+        r0[j] = mesh.Node(el.m_node[j]).m_r0();
+        rt[j] = mesh.Node(el.m_node[j]).m_rt();
         pn[j] = mesh.Node(el.m_node[j]).get(m_dofP);
         qn[j] = mesh.Node(el.m_node[j]).get(m_dofQ);
     }
@@ -1000,8 +1000,8 @@ void FEBiphasicShellDomain::ElementBodyForce(FEBodyForce& BF, FEShellElement& el
     vec3d r0[FEElement::MAX_NODES], rt[FEElement::MAX_NODES];
     for (int i=0; i<neln; ++i)
     {
-        r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
-        rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+        r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
+        rt[i] = m_pMesh->Node(el.m_node[i]).m_rt();
     }
     
     // loop over integration points
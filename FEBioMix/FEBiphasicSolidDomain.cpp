@@ -34,6 +34,7 @@ SOFTWARE.*/
 #include <FECore/FEModel.h>
 #include <FEBioMech/FEBioMech.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEScratchArena.h>
 #include "FEBioMix.h"
 
 //-----------------------------------------------------------------------------
@@ -79,8 +80,8 @@ void FEBiphasicSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
 		for (int i=0; i<neln; ++i)
 		{
             FENode& node = m.Node(el.m_node[i]);
-			x0[i] = node.m_r0;
-			xt[i] = node.m_rt;
+			x0[i] = node.m_r0();
+			xt[i] = node.m_rt();
             if (el.m_bitfc.size()>0 && el.m_bitfc[i] && node.m_ID[m_dofQ] != -1)
                 pn[i] = node.get(m_dofQ);
             else
@@ -191,7 +192,7 @@ void FEBiphasicSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
 	{
 		int n = el.m_node[i];
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
         // first the displacement dofs
         lm[4*i  ] = id[m_dofU[0]];
@@ -208,7 +209,7 @@ void FEBiphasicSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            FENodeArray<int>& id = node.m_ID;
             
             // first the back-face displacement dofs
             lm[4*i  ] = id[m_dofSU[0]];
@@ -243,13 +244,10 @@ void FEBiphasicSolidDomain::InternalForces(FEGlobalVector& R)
 	int degree_d = dofs.GetVariableInterpolationOrder(m_varU);
 	int degree_p = dofs.GetVariableInterpolationOrder(m_varP);
 
-	int NE = (int)m_Elem.size();
-	#pragma omp parallel for shared (NE)
-	for (int i=0; i<NE; ++i)
-	{
-		// element force vector
-		vector<double> fe;
-		vector<int> lm;
+	ParallelAssemble(R, [&](int i) {
+		// use the thread's scratch arena for the element data
+		FEScratchArena& arena = FEScratchArena::ThreadArena();
+		arena.Reset();
 		
 		// get the element
 		FESolidElement& el = m_Elem[i];
@@ -259,7 +257,8 @@ void FEBiphasicSolidDomain::InternalForces(FEGlobalVector& R)
 
 		// get the element force vector and initialize it to zero
 		int ndof = 4*nel_d;
-		fe.assign(ndof, 0);
+		vector<double>& fe = arena.ElementVector(ndof);
+		vector<int>& lm = arena.LM();
 
 		// calculate internal force vector
 		ElementInternalForce(el, fe);
@@ -269,7 +268,7 @@ void FEBiphasicSolidDomain::InternalForces(FEGlobalVector& R)
 
 		// assemble element 'fe'-vector into global R vector
 		R.Assemble(el.m_node, lm, fe);
-	}
+	});
 }
 
 //-----------------------------------------------------------------------------
@@ -492,12 +491,18 @@ void FEBiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
     #pragma omp parallel for shared(NE)
 	for (int iel=0; iel<NE; ++iel)
 	{
+		// skip elements that are excluded from the assembly
+		if (AssembleElement(iel) == false) continue;
+
 		FESolidElement& el = m_Elem[iel];
 
+		// use the thread's scratch arena for the element data
+		FEScratchArena& arena = FEScratchArena::ThreadArena();
+		arena.Reset();
+
 		// element stiffness matrix
-		FEElementMatrix ke(el);
 		int ndof = el.Nodes()*4;
-		ke.resize(ndof, ndof);
+		FEElementMatrix& ke = arena.ElementMatrix(el, ndof, ndof);
 		
 		// calculate the element stiffness matrix
 		ElementBiphasicStiffness(el, ke, bsymm);
@@ -507,7 +512,7 @@ void FEBiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 		// have to create a new lm array and place the equation numbers in the right order.
 		// What we really ought to do is fix the UnpackLM function so that it returns
 		// the LM vector in the right order for poroelastic elements.
-		vector<int> lm;
+		vector<int>& lm = arena.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -525,6 +530,9 @@ void FEBiphasicSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 	#pragma omp parallel for shared(NE)
 	for (int iel=0; iel<NE; ++iel)
 	{
+		// skip elements that are excluded from the assembly
+		if (AssembleElement(iel) == false) continue;
+
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
@@ -566,7 +574,7 @@ bool FEBiphasicSolidDomain::ElementBiphasicStiffness(FESolidElement& el, matrix&
     double Ji[3][3];
     
     // Bp-matrix
-    vector<vec3d> gradNu(FEElement::MAX_NODES), gradNp(FEElement::MAX_NODES);
+    vec3d gradNu[FEElement::MAX_NODES], gradNp[FEElement::MAX_NODES];
     
     // gauss-weights
     double* gw = el.GaussWeights();
@@ -924,8 +932,8 @@ void FEBiphasicSolidDomain::UpdateElementStress(int iel)
 	for (int j=0; j<nel_d; ++j)
 	{
         FENode& node = mesh.Node(el.m_node[j]);
-		r0[j] = node.m_r0;
-		rt[j] = node.m_rt;
+		r0[j] = node.m_r0();
+		rt[j] = node.m_rt();
 	}
 
 	for (int j = 0; j<nel_p; ++j)
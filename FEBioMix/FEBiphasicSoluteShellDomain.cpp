@@ -174,7 +174,7 @@ void FEBiphasicSoluteShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
         
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -256,8 +256,8 @@ void FEBiphasicSoluteShellDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
         int neln = el.Nodes();
         for (int i=0; i<neln; ++i)
         {
-            x0[i] = m.Node(el.m_node[i]).m_r0;
-            xt[i] = m.Node(el.m_node[i]).m_rt;
+            x0[i] = m.Node(el.m_node[i]).m_r0();
+            xt[i] = m.Node(el.m_node[i]).m_rt();
             pn[i] = m.Node(el.m_node[i]).get(m_dofP);
             qn[i] = m.Node(el.m_node[i]).get(m_dofQ);
             cn[i] = m.Node(el.m_node[i]).get(dofc);
@@ -1261,8 +1261,8 @@ void FEBiphasicSoluteShellDomain::UpdateElementStress(int iel)
     double cn[FEElement::MAX_NODES], dn[FEElement::MAX_NODES];
     for (int j=0; j<neln; ++j)
     {
-        r0[j] = mesh.Node(el.m_node[j]).m_r0;
-        rt[j] = mesh.Node(el.m_node[j]).m_rt;
+        r0[j] = mesh.Node(el.m_node[j]).m_r0();
+        rt[j] = mesh.Node(el.m_node[j]).m_rt();
         pn[j] = mesh.Node(el.m_node[j]).get(m_dofP);
         qn[j] = mesh.Node(el.m_node[j]).get(m_dofQ);
         cn[j] = mesh.Node(el.m_node[j]).get(m_dofC + id0);
@@ -176,7 +176,7 @@ void FEBiphasicSoluteSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
         
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         // first the displacement dofs
         lm[5*i  ] = id[m_dofU[0]];
@@ -202,7 +202,7 @@ void FEBiphasicSoluteSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(el.m_node[i]);
-            vector<int>& id = node.m_ID;
+            FENodeArray<int>& id = node.m_ID;
             
             // first the back-face displacement dofs
             lm[5*i  ] = id[m_dofSU[0]];
@@ -270,8 +270,8 @@ void FEBiphasicSoluteSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
         for (int i=0; i<neln; ++i)
         {
             FENode& node = m.Node(el.m_node[i]);
-            x0[i] = node.m_r0;
-            xt[i] = node.m_rt;
+            x0[i] = node.m_r0();
+            xt[i] = node.m_rt();
             pn[i] = m.Node(el.m_node[i]).get(m_dofP);
             if (el.m_bitfc.size()>0 && el.m_bitfc[i]) {
                 pn[i] = (node.m_ID[m_dofQ] != -1) ? node.get(m_dofQ) : node.get(m_dofP);
@@ -1078,8 +1078,8 @@ void FEBiphasicSoluteSolidDomain::UpdateElementStress(int iel)
     for (int j=0; j<neln; ++j)
     {
         FENode& node = mesh.Node(el.m_node[j]);
-        r0[j] = node.m_r0;
-        rt[j] = node.m_rt;
+        r0[j] = node.m_r0();
+        rt[j] = node.m_rt();
         if (el.m_bitfc.size()>0 && el.m_bitfc[j]) {
             pn[j] = (node.m_ID[m_dofQ] != -1) ? node.get(m_dofQ) : node.get(m_dofP);
             ct[j] = (node.m_ID[dofd] != -1) ? node.get(dofd) : node.get(dofc);
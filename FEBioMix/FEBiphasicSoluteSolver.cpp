@@ -234,7 +234,7 @@ bool FEBiphasicSoluteSolver::Quasin()
 		bconv = true;
 
 		// solve the equations (returns line search; solution stored in m_ui)
-		double s = QNSolve();
+		double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
 
 		// extract the pressure increments
 		GetDisplacementData(m_di, m_ui);
@@ -418,7 +418,7 @@ bool FEBiphasicSoluteSolver::Residual(vector<double>& R)
 	zero(m_Fr);
 
 	// setup global RHS vector
-	FEResidualVector RHS(fem, R, m_Fr);
+	FEResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
 
 	// zero rigid body reaction forces
 	m_rigidSolver.Residual();
@@ -668,7 +668,7 @@ void FEBiphasicSoluteSolver::UpdateSolute(vector<double>& ui)
 		FENode& node = mesh.Node(i);
 		
 		// update velocities
-		vec3d vt = (node.m_rt - node.m_rp) / dt;
+		vec3d vt = (node.m_rt() - node.m_rp()) / dt;
 		node.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vt);
 	}
 }
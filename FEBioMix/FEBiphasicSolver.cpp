@@ -204,7 +204,7 @@ bool FEBiphasicSolver::Quasin()
 		bconv = true;
 
 		// solve the equations (returns line search; solution stored in m_ui)
-		double s = QNSolve();
+		double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
 
 		// extract the pressure increments
 		GetDisplacementData(m_di, m_ui);
@@ -391,7 +391,7 @@ bool FEBiphasicSolver::Residual(vector<double>& R)
 	zero(m_Fr);
 
 	// setup global RHS vector
-	FEResidualVector RHS(fem, R, m_Fr);
+	FEResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
 
 	// zero rigid body reaction forces
 	m_rigidSolver.Residual();
@@ -574,31 +574,32 @@ void FEBiphasicSolver::UpdateKinematics(vector<double>& ui)
 //! Updates the poroelastic data
 void FEBiphasicSolver::UpdatePoro(vector<double>& ui)
 {
-    int i, n;
-    
 	FEModel& fem = *GetFEModel();
 	FEMesh& mesh = fem.GetMesh();
 	double dt = fem.GetTime().timeIncrement;
+	const int NN = mesh.Nodes();
 
 	// update poro-elasticity data
-	for (i=0; i<mesh.Nodes(); ++i)
+#pragma omp parallel for
+	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
 
 		// update nodal pressures
-		n = node.m_ID[m_dofP[0]];
+		int n = node.m_ID[m_dofP[0]];
 		if (n >= 0) node.set(m_dofP[0], 0 + m_Ut[n] + m_Ui[n] + ui[n]);
         n = node.m_ID[m_dofQ[0]];
         if (n >= 0) node.set(m_dofQ[0], 0 + m_Ut[n] + m_Ui[n] + ui[n]);
     }
 
 	// update poro-elasticity data
-	for (i=0; i<mesh.Nodes(); ++i)
+#pragma omp parallel for
+	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
 
 		// update velocities
-		vec3d vt = (node.m_rt - node.m_rp) / dt;
+		vec3d vt = (node.m_rt() - node.m_rp()) / dt;
 		node.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vt);
 	}
 }
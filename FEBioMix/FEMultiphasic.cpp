@@ -61,7 +61,7 @@ END_FECORE_CLASS();
 //! Polynomial root solver
 
 // function whose roots needs to be evaluated
-void fn(complex<double>& z, complex<double>& fz, vector<double> a)
+void fn(complex<double>& z, complex<double>& fz, const vector<double>& a)
 {
 	int n = (int)a.size()-1;
 	fz = a[0];
@@ -77,7 +77,7 @@ void fn(complex<double>& z, complex<double>& fz, vector<double> a)
 // deflation
 bool dflate(complex<double> zero, const int i, int& kount,
 			complex<double>& fzero, complex<double>& fzrdfl,
-			complex<double>* zeros, vector<double> a)
+			complex<double>* zeros, const vector<double>& a)
 {
 	complex<double> den;
 	++kount;
@@ -98,7 +98,7 @@ bool dflate(complex<double> zero, const int i, int& kount,
 
 // Muller's method for solving roots of a function
 void muller(bool fnreal, complex<double>* zeros, const int n, const int nprev,
-			const int maxit, const double ep1, const double ep2, vector<double> a)
+			const int maxit, const double ep1, const double ep2, const vector<double>& a)
 {
 	int kount;
 	complex<double> dvdf1p, fzrprv, fzrdfl, divdf1, divdf2;
@@ -160,7 +160,7 @@ void muller(bool fnreal, complex<double>* zeros, const int n, const int nprev,
 
 // Newton's method for finding nearest root of a polynomial
 bool newton(double& zero, const int n, const int maxit, 
-			const double ep1, const double ep2, vector<double> a)
+			const double ep1, const double ep2, const vector<double>& a)
 {
 	bool done = false;
 	bool conv = false;
@@ -206,7 +206,7 @@ bool newton(double& zero, const int n, const int maxit,
 }
 
 // linear
-bool poly1(vector<double> a, double& x)
+bool poly1(const vector<double>& a, double& x)
 {
 	if (a[1]) {
 		x = -a[0]/a[1];
@@ -217,7 +217,7 @@ bool poly1(vector<double> a, double& x)
 }
 
 // quadratic
-bool poly2(vector<double> a, double& x)
+bool poly2(const vector<double>& a, double& x)
 {
 	if (a[2]) {
 		x = (-a[1]+sqrt(SQR(a[1])-4*a[0]*a[2]))/(2*a[2]);
@@ -227,8 +227,75 @@ bool poly2(vector<double> a, double& x)
 	}
 }
 
+// Safeguarded Newton's method for the positive root of the electroneutrality
+// polynomial. The coefficients of this polynomial change sign only once, so
+// it has a single positive root (Descartes' rule of signs). This root is
+// bracketed with Cauchy's bounds and the bracket is narrowed in each iteration.
+// Newton steps that leave the bracket are replaced by bisection steps.
+// Returns false if the root could not be bracketed.
+bool newton_safeguarded(double& zero, const int n, const int maxit,
+			const double ep1, const double ep2, const vector<double>& a, int& niter)
+{
+	niter = 0;
+
+	// skip the zero roots
+	int k0 = 0;
+	while ((k0 < n) && (a[k0] == 0.0)) ++k0;
+	if ((k0 == n) || (a[n] == 0.0)) return false;
+
+	// Cauchy bounds on the positive root
+	double amax = 0.0;
+	for (int i = k0; i<n; ++i) if (fabs(a[i]) > amax) amax = fabs(a[i]);
+	double hi = 1.0 + amax / fabs(a[n]);
+	amax = 0.0;
+	for (int i = k0 + 1; i <= n; ++i) if (fabs(a[i]) > amax) amax = fabs(a[i]);
+	double lo = fabs(a[k0]) / (fabs(a[k0]) + amax);
+
+	// evaluates f and its derivative (divided by x^k0)
+	double f, df;
+	auto eval = [&](double x) {
+		f = a[n]; df = 0.0;
+		for (int i = n - 1; i >= k0; --i) { df = df*x + f; f = f*x + a[i]; }
+	};
+
+	// make sure the root is bracketed
+	eval(lo); double flo = f;
+	eval(hi); double fhi = f;
+	if (flo == 0.0) { zero = lo; return true; }
+	if (fhi == 0.0) { zero = hi; return true; }
+	if (flo*fhi > 0.0) return false;
+
+	// start from the previous solution if it lies inside the bracket
+	double x = zero;
+	if ((x <= lo) || (x >= hi)) x = 0.5*(lo + hi);
+
+	while (niter < maxit)
+	{
+		eval(x);
+		++niter;
+
+		// check absolute convergence
+		if (fabs(f) < ep2) { zero = x; return true; }
+
+		// narrow the bracket
+		if (f*flo > 0.0) { lo = x; flo = f; }
+		else hi = x;
+
+		// Newton step, or bisection if the step leaves the bracket
+		double xn = (df != 0.0 ? x - f / df : lo - 1.0);
+		if ((xn <= lo) || (xn >= hi)) xn = 0.5*(lo + hi);
+
+		// check relative convergence
+		if (fabs(xn - x) < ep1*fabs(xn)) { zero = xn; return true; }
+		x = xn;
+	}
+
+	zero = x;
+	return false;
+}
+
 // higher order
-bool polyn(int n, vector<double> a, double& x)
+bool polyn(int n, const vector<double>& a, double& x, int& niter)
 {
 //	bool fnreal = true;
 //	vector< complex<double> > zeros(n,complex<double>(1,0));
@@ -243,11 +310,14 @@ bool polyn(int n, vector<double> a, double& x)
 			return true;
 		}
 	}*/
+	// fall back to the plain Newton iterations if the root cannot be bracketed
+	if (newton_safeguarded(x, n, maxit, ep1, ep2, a, niter)) return true;
 	return newton(x, n, maxit,ep1, ep2, a);
 }
 
-bool solvepoly(int n, vector<double> a, double& x)
+bool solvepoly(int n, const vector<double>& a, double& x, int& niter)
 {
+	niter = 0;
 	switch (n) {
 		case 1:
 			return poly1(a, x);
@@ -256,9 +326,9 @@ bool solvepoly(int n, vector<double> a, double& x)
 			return poly2(a, x);
 		default:
 			if (a[n]) {
-				return polyn(n, a, x);
+				return polyn(n, a, x, niter);
 			} else {
-				return solvepoly(n-1, a, x);
+				return solvepoly(n-1, a, x, niter);
 			}
 			break;
 	}
@@ -470,41 +540,34 @@ double FEMultiphasic::ElectricPotential(FEMaterialPoint& pt, const bool eform)
 	
 	int i, j;
 	
-	// if not neutral, solve electroneutrality polynomial for zeta
+	// return the cached solution if the domain already solved for this state
 	FESolutesMaterialPoint& set = *pt.ExtractData<FESolutesMaterialPoint>();
+	if (set.m_bzeta)
+	{
+		if (eform) return set.m_zeta;
+		return -m_Rgas*m_Tabs/m_Fc*log(set.m_zeta);
+	}
+
+	// if not neutral, solve electroneutrality polynomial for zeta
 	const int nsol = (int)m_pSolute.size();
 	double cF = FixedChargeDensity(pt);
 
-	vector<double> c(nsol);		// effective concentration
-	vector<double> khat(nsol);	// solubility
-	vector<int> z(nsol);		// charge number
-	for (i=0; i<nsol; ++i) {
-		c[i] = set.m_c[i];
-		khat[i] = m_pSolute[i]->m_pSolub->Solubility(pt);
-		z[i] = m_pSolute[i]->ChargeNumber();
-	}
-	
 	// evaluate polynomial coefficients
+	// (m_zmin is never positive)
 	const int n = m_ndeg;
 	vector<double> a(n+1,0);
-	if (m_zmin < 0) {
-		for (i=0; i<nsol; ++i) {
-			j = z[i] - m_zmin;
-			a[j] += z[i]*khat[i]*c[i];
-		}
-		a[-m_zmin] = cF;
-	} else {
-		for (i=0; i<nsol; ++i) {
-			j = z[i];
-			a[j] += z[i]*khat[i]*c[i];
-		}
-		a[0] = cF;
+	for (i=0; i<nsol; ++i) {
+		int z = m_pSolute[i]->ChargeNumber();
+		double khat = m_pSolute[i]->m_pSolub->Solubility(pt);
+		j = z - m_zmin;
+		a[j] += z*khat*set.m_c[i];
 	}
+	a[-m_zmin] = cF;
 
 	// solve polynomial
 	double psi = set.m_psi;		// use previous solution as initial guess
 	double zeta = exp(-m_Fc*psi/m_Rgas/m_Tabs);
-	if (!solvepoly(n, a, zeta)) {
+	if (!solvepoly(n, a, zeta, set.m_nzeta)) {
 		zeta = 1.0;
 	}
 	
@@ -517,6 +580,40 @@ double FEMultiphasic::ElectricPotential(FEMaterialPoint& pt, const bool eform)
 	return psi;
 }
 
+//-----------------------------------------------------------------------------
+//! Solve for the electric potential and store it at the material point. Subsequent
+//! calls to ElectricPotential (and therefore to all functions that depend on the
+//! partition coefficients) return the cached value until the point state changes
+//! and this function is called again.
+void FEMultiphasic::UpdateElectricPotential(FEMaterialPoint& pt)
+{
+	FESolutesMaterialPoint& set = *pt.ExtractData<FESolutesMaterialPoint>();
+	set.m_bzeta = false;
+	set.m_zeta = ElectricPotential(pt, true);
+	set.m_psi = (m_ndeg == 0 ? 0.0 : -m_Rgas*m_Tabs/m_Fc*log(set.m_zeta));
+	set.m_bzeta = true;
+}
+
+//-----------------------------------------------------------------------------
+//! Evaluate the hydraulic permeability and the solute diffusivities and store them
+//! at the material point. FluidFlux, SoluteFlux and the domain stiffness reuse these
+//! values until the point state changes and this function is called again.
+void FEMultiphasic::UpdateTransportProperties(FEMaterialPoint& pt)
+{
+	FESolutesMaterialPoint& set = *pt.ExtractData<FESolutesMaterialPoint>();
+	const int nsol = (int)m_pSolute.size();
+	set.m_btransp = false;
+	set.m_K = m_pPerm->Permeability(pt);
+	set.m_D.resize(nsol);
+	set.m_D0.resize(nsol);
+	for (int i=0; i<nsol; ++i)
+	{
+		set.m_D[i] = m_pSolute[i]->m_pDiff->Diffusivity(pt);
+		set.m_D0[i] = m_pSolute[i]->m_pDiff->Free_Diffusivity(pt);
+	}
+	set.m_btransp = true;
+}
+
 //-----------------------------------------------------------------------------
 //! partition coefficient
 double FEMultiphasic::PartitionCoefficient(FEMaterialPoint& pt, const int sol)
@@ -866,10 +963,10 @@ vec3d FEMultiphasic::FluidFlux(FEMaterialPoint& pt)
 		gradc[i] = spt.m_gradc[i];
 		
 		// solute diffusivity in mixture
-		D[i] = m_pSolute[i]->m_pDiff->Diffusivity(pt);
+		D[i] = (spt.m_btransp ? spt.m_D[i] : m_pSolute[i]->m_pDiff->Diffusivity(pt));
 		
 		// solute free diffusivity
-		D0[i] = m_pSolute[i]->m_pDiff->Free_Diffusivity(pt);
+		D0[i] = (spt.m_btransp ? spt.m_D0[i] : m_pSolute[i]->m_pDiff->Free_Diffusivity(pt));
 		
 		// solubility
 		khat[i] = m_pSolute[i]->m_pSolub->Solubility(pt);
@@ -882,7 +979,7 @@ vec3d FEMultiphasic::FluidFlux(FEMaterialPoint& pt)
 	mat3dd I(1);
 	
 	// hydraulic permeability
-	mat3ds kt = m_pPerm->Permeability(pt);
+	mat3ds kt = (spt.m_btransp ? spt.m_K : m_pPerm->Permeability(pt));
 	
 	// effective hydraulic permeability
 	mat3ds ke;
@@ -918,10 +1015,10 @@ vec3d FEMultiphasic::SoluteFlux(FEMaterialPoint& pt, const int sol)
 	vec3d gradc = spt.m_gradc[sol];
 	
 	// solute diffusivity in mixture
-	mat3ds D = m_pSolute[sol]->m_pDiff->Diffusivity(pt);
+	mat3ds D = (spt.m_btransp ? spt.m_D[sol] : m_pSolute[sol]->m_pDiff->Diffusivity(pt));
 	
 	// solute free diffusivity
-	double D0 = m_pSolute[sol]->m_pDiff->Free_Diffusivity(pt);
+	double D0 = (spt.m_btransp ? spt.m_D0[sol] : m_pSolute[sol]->m_pDiff->Free_Diffusivity(pt));
 	
 	// solubility
 	double khat = m_pSolute[sol]->m_pSolub->Solubility(pt);
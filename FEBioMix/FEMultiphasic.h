@@ -105,6 +105,12 @@ public:
 	
 	//! electric potential
 	double ElectricPotential(FEMaterialPoint& pt, const bool eform=false);
+
+	//! solve the electroneutrality condition once for the current state and cache the result at the material point
+	void UpdateElectricPotential(FEMaterialPoint& pt);
+
+	//! evaluate the permeability and solute diffusivities once for the current state and cache them at the material point
+	void UpdateTransportProperties(FEMaterialPoint& pt);
 	
 	//! current density
 	vec3d CurrentDensity(FEMaterialPoint& pt);
@@ -85,7 +85,7 @@ void FEMultiphasicShellDomain::UnpackLM(FEElement& el, vector<int>& lm)
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
         
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -139,7 +139,7 @@ void FEMultiphasicShellDomain::UnpackMembraneLM(FEShellElement& el, vector<int>&
         int n = el.m_node[i];
         
         FENode& node = mesh.Node(n);
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -492,8 +492,8 @@ void FEMultiphasicShellDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
         int neln = el.Nodes();
         for (int i=0; i<neln; ++i)
         {
-            x0[i] = m.Node(el.m_node[i]).m_r0;
-            xt[i] = m.Node(el.m_node[i]).m_rt;
+            x0[i] = m.Node(el.m_node[i]).m_r0();
+            xt[i] = m.Node(el.m_node[i]).m_rt();
         }
         
         int n = el.GaussPoints();
@@ -1899,7 +1899,7 @@ void FEMultiphasicShellDomain::ElementMembraneReactionFlux(FEShellElement& el, v
     for (int j=0; j<neln; ++j) {
         FENode& nd = GetFEModel()->GetMesh().Node(el.m_node[j]);
         // nodal positions at front and back surfaces
-        re[j] = nd.m_rt;
+        re[j] = nd.m_rt();
         ri[j] = nd.m_st();
     }
     
@@ -2025,7 +2025,7 @@ bool FEMultiphasicShellDomain::ElementMembraneFluxStiffness(FEShellElement& el,
     vec3d re[FEElement::MAX_NODES], ri[FEElement::MAX_NODES];
     for (int j=0; j<neln; ++j) {
         FENode& nd = GetFEModel()->GetMesh().Node(el.m_node[j]);
-        re[j] = nd.m_rt;
+        re[j] = nd.m_rt();
         ri[j] = nd.m_st();
     }
     
@@ -2229,8 +2229,8 @@ void FEMultiphasicShellDomain::UpdateElementStress(int iel, double dt)
     // get the nodal data
     for (j=0; j<neln; ++j)
     {
-        r0[j] = mesh.Node(el.m_node[j]).m_r0;
-        rt[j] = mesh.Node(el.m_node[j]).m_rt;
+        r0[j] = mesh.Node(el.m_node[j]).m_r0();
+        rt[j] = mesh.Node(el.m_node[j]).m_rt();
         pn[j] = mesh.Node(el.m_node[j]).get(m_dofP);
         qn[j] = mesh.Node(el.m_node[j]).get(m_dofQ);
         for (k=0; k<MAX_CDOFS; ++k) {
@@ -35,6 +35,7 @@ SOFTWARE.*/
 #include "FECore/DOFS.h"
 #include <FEBioMech/FEBioMech.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEScratchArena.h>
 
 #ifndef SQR
 #define SQR(x) ((x)*(x))
@@ -80,7 +81,7 @@ void FEMultiphasicSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
         int n = el.m_node[i];
         FENode& node = m_pMesh->Node(n);
         
-        vector<int>& id = node.m_ID;
+        FENodeArray<int>& id = node.m_ID;
         
         // first the displacement dofs
         lm[ndpn*i  ] = id[m_dofU[0]];
@@ -107,7 +108,7 @@ void FEMultiphasicSolidDomain::UnpackLM(FEElement& el, vector<int>& lm)
     {
         if (sel.m_bitfc[i]) {
             FENode& node = m_pMesh->Node(sel.m_node[i]);
-            vector<int>& id = node.m_ID;
+            FENodeArray<int>& id = node.m_ID;
             
             // first the back-face displacement dofs
             lm[ndpn*i  ] = id[m_dofSU[0]];
@@ -322,6 +323,7 @@ void FEMultiphasicSolidDomain::InitMaterialPoints()
             FEElasticMaterialPoint& pm = *(mp.ExtractData<FEElasticMaterialPoint>());
             FEBiphasicMaterialPoint& pt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
             FESolutesMaterialPoint& ps = *(mp.ExtractData<FESolutesMaterialPoint>());
+            ps.m_bzeta = ps.m_btransp = false;
             
             // initialize effective fluid pressure, its gradient, and fluid flux
             pt.m_p = el.Evaluate(p0, n);
@@ -429,8 +431,8 @@ void FEMultiphasicSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
         int neln = el.Nodes();
         for (int i=0; i<neln; ++i)
         {
-            x0[i] = m.Node(el.m_node[i]).m_r0;
-            xt[i] = m.Node(el.m_node[i]).m_rt;
+            x0[i] = m.Node(el.m_node[i]).m_r0();
+            xt[i] = m.Node(el.m_node[i]).m_rt();
         }
         
         int n = el.GaussPoints();
@@ -486,15 +488,11 @@ void FEMultiphasicSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
 //-----------------------------------------------------------------------------
 void FEMultiphasicSolidDomain::InternalForces(FEGlobalVector& R)
 {
-    size_t NE = m_Elem.size();
-    
     // get nodal DOFS
     int nsol = m_pMat->Solutes();
     int ndpn = 4+nsol;
     
-#pragma omp parallel for
-    for (int i=0; i<NE; ++i)
-    {
+    ParallelAssemble(R, [&](int i) {
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -514,7 +512,7 @@ void FEMultiphasicSolidDomain::InternalForces(FEGlobalVector& R)
         
         // assemble element 'fe'-vector into global R vector
         R.Assemble(el.m_node, lm, fe);
-    }
+    });
 }
 
 //-----------------------------------------------------------------------------
@@ -780,21 +778,25 @@ void FEMultiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 #pragma omp parallel for
     for (int iel=0; iel<NE; ++iel)
     {
+		// skip elements that are excluded from the assembly
+		if (AssembleElement(iel) == false) continue;
+
 		FESolidElement& el = m_Elem[iel];
 
-        // element stiffness matrix
-        FEElementMatrix ke(el);
+		// use the thread's scratch arena for the element data
+		FEScratchArena& arena = FEScratchArena::ThreadArena();
+		arena.Reset();
 
         // allocate stiffness matrix
         int neln = el.Nodes();
         int ndof = neln*ndpn;
-        ke.resize(ndof, ndof);
+        FEElementMatrix& ke = arena.ElementMatrix(el, ndof, ndof);
         
         // calculate the element stiffness matrix
         ElementMultiphasicStiffness(el, ke, bsymm);
 
 		// get the lm vector
-		vector<int> lm;
+		vector<int>& lm = arena.LM();
 		UnpackLM(el, lm);
 		ke.SetIndices(lm);
 
@@ -815,6 +817,9 @@ void FEMultiphasicSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 #pragma omp parallel for
     for (int iel=0; iel<NE; ++iel)
     {
+		// skip elements that are excluded from the assembly
+		if (AssembleElement(iel) == false) continue;
+
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -853,8 +858,12 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
     // jacobian
     double Ji[3][3], detJ;
     
+    // temporaries are taken from the thread's scratch arena
+    FEScratchArena& arena = FEScratchArena::ThreadArena();
+    FEScratchArena::Frame elemFrame(arena);
+
     // Gradient of shape functions
-    vector<vec3d> gradN(neln);
+    vec3d* gradN = arena.Allocate<vec3d>(neln);
     
     // gauss-weights
     double* gw = el.GaussWeights();
@@ -873,6 +882,9 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
     // loop over gauss-points
     for (n=0; n<nint; ++n)
     {
+        // released at the end of this integration point
+        FEScratchArena::Frame pointFrame(arena);
+
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
         FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
         FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
@@ -908,21 +920,21 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
         vec3d w = ppt.m_w;
         vec3d gradp = ppt.m_gradp;
         
-        vector<double> c(spt.m_c);
-        vector<vec3d> gradc(spt.m_gradc);
-        vector<int> z(nsol);
+        const vector<double>& c = spt.m_c;
+        const vector<vec3d>& gradc = spt.m_gradc;
+        int* z = arena.Allocate<int>(nsol);
         
-        vector<double> kappa(spt.m_k);
+        const vector<double>& kappa = spt.m_k;
         
         // get the charge number
         for (isol=0; isol<nsol; ++isol)
             z[isol] = m_pMat->GetSolute(isol)->ChargeNumber();
         
-        vector<double> dkdJ(spt.m_dkdJ);
-        vector< vector<double> > dkdc(spt.m_dkdc);
-        vector< vector<double> > dkdr(spt.m_dkdr);
-        vector< vector<double> > dkdJr(spt.m_dkdJr);
-        vector< vector< vector<double> > > dkdrc(spt.m_dkdrc);
+        const vector<double>& dkdJ = spt.m_dkdJ;
+        const vector< vector<double> >& dkdc = spt.m_dkdc;
+        const vector< vector<double> >& dkdr = spt.m_dkdr;
+        const vector< vector<double> >& dkdJr = spt.m_dkdJr;
+        const vector< vector< vector<double> > >& dkdrc = spt.m_dkdrc;
         
         // evaluate the porosity and its derivative
         double phiw = m_pMat->Porosity(mp);
@@ -933,26 +945,39 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
         // evaluate the osmotic coefficient
         double osmc = m_pMat->GetOsmoticCoefficient()->OsmoticCoefficient(mp);
         
-        // evaluate the permeability
-        mat3ds K = m_pMat->GetPermeability()->Permeability(mp);
+        // evaluate the permeability (cached by the last update)
+        mat3ds K = (spt.m_btransp ? spt.m_K : m_pMat->GetPermeability()->Permeability(mp));
         tens4dmm dKdE = m_pMat->GetPermeability()->Tangent_Permeability_Strain(mp);
         
-        vector<mat3ds> dKdc(nsol);
-        vector<mat3ds> D(nsol);
-        vector<tens4dmm> dDdE(nsol);
-        vector< vector<mat3ds> > dDdc(nsol, vector<mat3ds>(nsol));
-        vector<double> D0(nsol);
-        vector< vector<double> > dD0dc(nsol, vector<double>(nsol));
-        vector<double> dodc(nsol);
-        vector<mat3ds> dTdc(nsol);
-        vector<mat3ds> ImD(nsol);
+        mat3ds* dKdc = arena.Allocate<mat3ds>(nsol);
+        mat3ds* D = arena.Allocate<mat3ds>(nsol);
+        tens4dmm* dDdE = arena.Allocate<tens4dmm>(nsol);
+        mat3ds** dDdc = arena.Allocate2D<mat3ds>(nsol, nsol);
+        double* D0 = arena.Allocate<double>(nsol);
+        double** dD0dc = arena.Allocate2D<double>(nsol, nsol);
+        double* dodc = arena.Allocate<double>(nsol);
+        mat3ds* dTdc = arena.Allocate<mat3ds>(nsol);
+        mat3ds* ImD = arena.Allocate<mat3ds>(nsol);
         mat3dd I(1);
         
+        // evaluate the reaction supplies and their derivatives once per integration point
+        double* zhat = arena.Allocate<double>(nreact);
+        mat3ds* dzhatde = arena.Allocate<mat3ds>(nreact);
+        double** dzhatdc = arena.Allocate2D<double>(nreact, nsol);
+        for (ireact=0; ireact<nreact; ++ireact) {
+            FEChemicalReaction* pri = m_pMat->GetReaction(ireact);
+            zhat[ireact] = pri->ReactionSupply(mp);
+            dzhatde[ireact] = pri->Tangent_ReactionSupply_Strain(mp);
+            for (isol=0; isol<nsol; ++isol)
+                dzhatdc[ireact][isol] = pri->Tangent_ReactionSupply_Concentration(mp, isol);
+        }
+        
         // evaluate the solvent supply and its derivatives
         mat3ds Phie; Phie.zero();
         double Phip = 0;
-        vector<double> Phic(nsol,0);
-        vector<mat3ds> dchatde(nsol);
+        double* Phic = arena.Allocate<double>(nsol);
+        for (isol=0; isol<nsol; ++isol) Phic[isol] = 0;
+        mat3ds* dchatde = arena.Allocate<mat3ds>(nsol);
         if (m_pMat->GetSolventSupply()) {
             Phie = m_pMat->GetSolventSupply()->Tangent_Supply_Strain(mp);
             Phip = m_pMat->GetSolventSupply()->Tangent_Supply_Pressure(mp);
@@ -960,19 +985,18 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
         
         // chemical reactions
         for (i=0; i<nreact; ++i)
-            Phie += m_pMat->GetReaction(i)->m_Vbar*(I*m_pMat->GetReaction(i)->ReactionSupply(mp)
-                                                    +m_pMat->GetReaction(i)->Tangent_ReactionSupply_Strain(mp)*(J*phiw));
+            Phie += m_pMat->GetReaction(i)->m_Vbar*(I*zhat[i] + dzhatde[i]*(J*phiw));
         
         for (isol=0; isol<nsol; ++isol) {
             // evaluate the permeability derivatives
             dKdc[isol] = m_pMat->GetPermeability()->Tangent_Permeability_Concentration(mp,isol);
             
             // evaluate the diffusivity tensor and its derivatives
-            D[isol] = m_pMat->GetSolute(isol)->m_pDiff->Diffusivity(mp);
+            D[isol] = (spt.m_btransp ? spt.m_D[isol] : m_pMat->GetSolute(isol)->m_pDiff->Diffusivity(mp));
             dDdE[isol] = m_pMat->GetSolute(isol)->m_pDiff->Tangent_Diffusivity_Strain(mp);
             
             // evaluate the solute free diffusivity
-            D0[isol] = m_pMat->GetSolute(isol)->m_pDiff->Free_Diffusivity(mp);
+            D0[isol] = (spt.m_btransp ? spt.m_D0[isol] : m_pMat->GetSolute(isol)->m_pDiff->Free_Diffusivity(mp));
             
             // evaluate the derivative of the osmotic coefficient
             dodc[isol] = m_pMat->GetOsmoticCoefficient()->Tangent_OsmoticCoefficient_Concentration(mp,isol);
@@ -995,10 +1019,8 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
             dchatde[isol].zero();
             for (ireact=0; ireact<nreact; ++ireact) {
                 dchatde[isol] += m_pMat->GetReaction(ireact)->m_v[isol]
-                *(I*m_pMat->GetReaction(ireact)->ReactionSupply(mp)
-                  +m_pMat->GetReaction(ireact)->Tangent_ReactionSupply_Strain(mp)*(J*phiw));
-                Phic[isol] += phiw*m_pMat->GetReaction(ireact)->m_Vbar
-                *m_pMat->GetReaction(ireact)->Tangent_ReactionSupply_Concentration(mp, isol);
+                *(I*zhat[ireact] + dzhatde[ireact]*(J*phiw));
+                Phic[isol] += phiw*m_pMat->GetReaction(ireact)->m_Vbar*dzhatdc[ireact][isol];
             }
         }
         
@@ -1011,8 +1033,8 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
         mat3ds Ki = K.inverse();
         mat3ds Ke(0,0,0,0,0,0);
         tens4d G = (dyad1(Ki,I) - dyad4(Ki,I)*2)*2 - ddot(dyad2(Ki,Ki),dKdE);
-        vector<mat3ds> Gc(nsol);
-        vector<mat3ds> dKedc(nsol);
+        mat3ds* Gc = arena.Allocate<mat3ds>(nsol);
+        mat3ds* dKedc = arena.Allocate<mat3ds>(nsol);
         for (isol=0; isol<nsol; ++isol) {
             Ke += ImD[isol]*(kappa[isol]*c[isol]/D0[isol]);
             G += dyad1(ImD[isol],I)*(R*T*c[isol]*J/D0[isol]/phiw*(dkdJ[isol]-kappa[isol]/phiw*dpdJ))
@@ -1031,12 +1053,15 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
         
         // calculate all the matrices
         vec3d vtmp,gp,qpu;
-        vector<vec3d> gc(nsol),qcu(nsol),wc(nsol),jce(nsol);
-        vector< vector<vec3d> > jc(nsol, vector<vec3d>(nsol));
+        vec3d* gc = arena.Allocate<vec3d>(nsol);
+        vec3d* qcu = arena.Allocate<vec3d>(nsol);
+        vec3d* wc = arena.Allocate<vec3d>(nsol);
+        vec3d* jce = arena.Allocate<vec3d>(nsol);
+        vec3d** jc = arena.Allocate2D<vec3d>(nsol, nsol);
         mat3d wu, jue;
-        vector<mat3d> ju(nsol);
-        vector< vector<double> > qcc(nsol, vector<double>(nsol));
-        vector< vector<double> > dchatdc(nsol, vector<double>(nsol));
+        mat3d* ju = arena.Allocate<mat3d>(nsol);
+        double** qcc = arena.Allocate2D<double>(nsol, nsol);
+        double** dchatdc = arena.Allocate2D<double>(nsol, nsol);
         double sum;
         mat3ds De;
         for (i=0; i<neln; ++i)
@@ -1099,11 +1124,9 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
                             sum2 += m_pMat->SBMMolarMass(isbm)*m_pMat->GetReaction(ireact)->m_v[nsol+isbm]*
                             (dkdr[isol][isbm]+(J-phi0)*dkdJr[isol][isbm]-dkdJ[isol]/m_pMat->SBMDensity(isbm));
                         }
-                        double zhat = m_pMat->GetReaction(ireact)->ReactionSupply(mp);
-                        mat3dd zhatI(zhat);
-                        mat3ds dzde = m_pMat->GetReaction(ireact)->Tangent_ReactionSupply_Strain(mp);
-                        qcu[isol] -= ((zhatI+dzde*(J-phi0))*gradN[j])*(sum1*c[isol])
-                        +gradN[j]*(c[isol]*(J-phi0)*sum2*zhat);
+                        mat3dd zhatI(zhat[ireact]);
+                        qcu[isol] -= ((zhatI+dzhatde[ireact]*(J-phi0))*gradN[j])*(sum1*c[isol])
+                        +gradN[j]*(c[isol]*(J-phi0)*sum2*zhat[ireact]);
                     }
                 }
                 
@@ -1144,7 +1167,7 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
                 }
                 
                 // calculate data for the kcc matrix
-                jce.assign(nsol, vec3d(0,0,0));
+                for (isol=0; isol<nsol; ++isol) jce[isol] = vec3d(0,0,0);
                 for (isol=0; isol<nsol; ++isol) {
                     for (jsol=0; jsol<nsol; ++jsol) {
                         if (jsol != isol) {
@@ -1166,8 +1189,7 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
                         // chemical reactions
                         dchatdc[isol][jsol] = 0;
                         for (ireact=0; ireact<nreact; ++ireact) {
-                            dchatdc[isol][jsol] += m_pMat->GetReaction(ireact)->m_v[isol]
-                            *m_pMat->GetReaction(ireact)->Tangent_ReactionSupply_Concentration(mp,jsol);
+                            dchatdc[isol][jsol] += m_pMat->GetReaction(ireact)->m_v[isol]*dzhatdc[ireact][jsol];
                             double sum1 = 0;
                             double sum2 = 0;
                             for (isbm=0; isbm<nsbm; ++isbm) {
@@ -1176,13 +1198,12 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
                                 sum2 += m_pMat->SBMMolarMass(isbm)*m_pMat->GetReaction(ireact)->m_v[nsol+isbm]*
                                 ((J-phi0)*dkdrc[isol][isbm][jsol]-dkdc[isol][jsol]/m_pMat->SBMDensity(isbm));
                             }
-                            double zhat = m_pMat->GetReaction(ireact)->ReactionSupply(mp);
-                            double dzdc = m_pMat->GetReaction(ireact)->Tangent_ReactionSupply_Concentration(mp, jsol);
+                            double dzdc = dzhatdc[ireact][jsol];
                             if (jsol != isol) {
-                                qcc[isol][jsol] -= H[j]*phiw*c[isol]*(dzdc*sum1+zhat*sum2);
+                                qcc[isol][jsol] -= H[j]*phiw*c[isol]*(dzdc*sum1+zhat[ireact]*sum2);
                             }
                             else {
-                                qcc[isol][jsol] -= H[j]*phiw*((zhat+c[isol]*dzdc)*sum1+c[isol]*zhat*sum2);
+                                qcc[isol][jsol] -= H[j]*phiw*((zhat[ireact]+c[isol]*dzdc)*sum1+c[isol]*zhat[ireact]*sum2);
                             }
                         }
                     }
@@ -1230,8 +1251,12 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
     // jacobian
     double Ji[3][3], detJ;
     
+    // temporaries are taken from the thread's scratch arena
+    FEScratchArena& arena = FEScratchArena::ThreadArena();
+    FEScratchArena::Frame elemFrame(arena);
+
     // Gradient of shape functions
-    vector<vec3d> gradN(neln);
+    vec3d* gradN = arena.Allocate<vec3d>(neln);
     
     // gauss-weights
     double* gw = el.GaussWeights();
@@ -1249,6 +1274,9 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
     // loop over gauss-points
     for (n=0; n<nint; ++n)
     {
+        // released at the end of this integration point
+        FEScratchArena::Frame pointFrame(arena);
+
         FEMaterialPoint& mp = *el.GetMaterialPoint(n);
         FEElasticMaterialPoint&  ept = *(mp.ExtractData<FEElasticMaterialPoint >());
         FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
@@ -1284,19 +1312,18 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
         vec3d w = ppt.m_w;
         vec3d gradp = ppt.m_gradp;
         
-        vector<double> c(spt.m_c);
-        vector<vec3d> gradc(spt.m_gradc);
-        vector<int> z(nsol);
+        const vector<double>& c = spt.m_c;
+        const vector<vec3d>& gradc = spt.m_gradc;
+        int* z = arena.Allocate<int>(nsol);
         
-        vector<double> zz(nsol);
-        vector<double> kappa(spt.m_k);
+        const vector<double>& kappa = spt.m_k;
         
         // get the charge number
         for (isol=0; isol<nsol; ++isol)
             z[isol] = m_pMat->GetSolute(isol)->ChargeNumber();
         
-        vector<double> dkdJ(spt.m_dkdJ);
-        vector< vector<double> > dkdc(spt.m_dkdc);
+        const vector<double>& dkdJ = spt.m_dkdJ;
+        const vector< vector<double> >& dkdc = spt.m_dkdc;
         
         // evaluate the porosity and its derivative
         double phiw = m_pMat->Porosity(mp);
@@ -1306,26 +1333,39 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
         // evaluate the osmotic coefficient
         double osmc = m_pMat->GetOsmoticCoefficient()->OsmoticCoefficient(mp);
         
-        // evaluate the permeability
-        mat3ds K = m_pMat->GetPermeability()->Permeability(mp);
+        // evaluate the permeability (cached by the last update)
+        mat3ds K = (spt.m_btransp ? spt.m_K : m_pMat->GetPermeability()->Permeability(mp));
         tens4dmm dKdE = m_pMat->GetPermeability()->Tangent_Permeability_Strain(mp);
         
-        vector<mat3ds> dKdc(nsol);
-        vector<mat3ds> D(nsol);
-        vector<tens4dmm> dDdE(nsol);
-        vector< vector<mat3ds> > dDdc(nsol, vector<mat3ds>(nsol));
-        vector<double> D0(nsol);
-        vector< vector<double> > dD0dc(nsol, vector<double>(nsol));
-        vector<double> dodc(nsol);
-        vector<mat3ds> dTdc(nsol);
-        vector<mat3ds> ImD(nsol);
+        mat3ds* dKdc = arena.Allocate<mat3ds>(nsol);
+        mat3ds* D = arena.Allocate<mat3ds>(nsol);
+        tens4dmm* dDdE = arena.Allocate<tens4dmm>(nsol);
+        mat3ds** dDdc = arena.Allocate2D<mat3ds>(nsol, nsol);
+        double* D0 = arena.Allocate<double>(nsol);
+        double** dD0dc = arena.Allocate2D<double>(nsol, nsol);
+        double* dodc = arena.Allocate<double>(nsol);
+        mat3ds* dTdc = arena.Allocate<mat3ds>(nsol);
+        mat3ds* ImD = arena.Allocate<mat3ds>(nsol);
         mat3dd I(1);
         
+        // evaluate the reaction supplies and their derivatives once per integration point
+        double* zhat = arena.Allocate<double>(nreact);
+        mat3ds* dzhatde = arena.Allocate<mat3ds>(nreact);
+        double** dzhatdc = arena.Allocate2D<double>(nreact, nsol);
+        for (ireact=0; ireact<nreact; ++ireact) {
+            FEChemicalReaction* pri = m_pMat->GetReaction(ireact);
+            zhat[ireact] = pri->ReactionSupply(mp);
+            dzhatde[ireact] = pri->Tangent_ReactionSupply_Strain(mp);
+            for (isol=0; isol<nsol; ++isol)
+                dzhatdc[ireact][isol] = pri->Tangent_ReactionSupply_Concentration(mp, isol);
+        }
+        
         // evaluate the solvent supply and its derivatives
         double phiwhat = 0;
         mat3ds Phie; Phie.zero();
         double Phip = 0;
-        vector<double> Phic(nsol,0);
+        double* Phic = arena.Allocate<double>(nsol);
+        for (isol=0; isol<nsol; ++isol) Phic[isol] = 0;
         if (m_pMat->GetSolventSupply()) {
             phiwhat = m_pMat->GetSolventSupply()->Supply(mp);
             Phie = m_pMat->GetSolventSupply()->Tangent_Supply_Strain(mp);
@@ -1334,19 +1374,18 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
         
         // chemical reactions
         for (i=0; i<nreact; ++i)
-            Phie += m_pMat->GetReaction(i)->m_Vbar*(I*m_pMat->GetReaction(i)->ReactionSupply(mp)
-                                                    +m_pMat->GetReaction(i)->Tangent_ReactionSupply_Strain(mp)*(J*phiw));
+            Phie += m_pMat->GetReaction(i)->m_Vbar*(I*zhat[i] + dzhatde[i]*(J*phiw));
         
         for (isol=0; isol<nsol; ++isol) {
             // evaluate the permeability derivatives
             dKdc[isol] = m_pMat->GetPermeability()->Tangent_Permeability_Concentration(mp,isol);
             
             // evaluate the diffusivity tensor and its derivatives
-            D[isol] = m_pMat->GetSolute(isol)->m_pDiff->Diffusivity(mp);
+            D[isol] = (spt.m_btransp ? spt.m_D[isol] : m_pMat->GetSolute(isol)->m_pDiff->Diffusivity(mp));
             dDdE[isol] = m_pMat->GetSolute(isol)->m_pDiff->Tangent_Diffusivity_Strain(mp);
             
             // evaluate the solute free diffusivity
-            D0[isol] = m_pMat->GetSolute(isol)->m_pDiff->Free_Diffusivity(mp);
+            D0[isol] = (spt.m_btransp ? spt.m_D0[isol] : m_pMat->GetSolute(isol)->m_pDiff->Free_Diffusivity(mp));
             
             // evaluate the derivative of the osmotic coefficient
             dodc[isol] = m_pMat->GetOsmoticCoefficient()->Tangent_OsmoticCoefficient_Concentration(mp,isol);
@@ -1376,8 +1415,8 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
         mat3ds Ki = K.inverse();
         mat3ds Ke(0,0,0,0,0,0);
         tens4d G = (dyad1(Ki,I) - dyad4(Ki,I)*2)*2 - ddot(dyad2(Ki,Ki),dKdE);
-        vector<mat3ds> Gc(nsol);
-        vector<mat3ds> dKedc(nsol);
+        mat3ds* Gc = arena.Allocate<mat3ds>(nsol);
+        mat3ds* dKedc = arena.Allocate<mat3ds>(nsol);
         for (isol=0; isol<nsol; ++isol) {
             Ke += ImD[isol]*(kappa[isol]*c[isol]/D0[isol]);
             G += dyad1(ImD[isol],I)*(R*T*c[isol]*J/D0[isol]/phiw*(dkdJ[isol]-kappa[isol]/phiw*dpdJ))
@@ -1396,11 +1435,13 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
         
         // calculate all the matrices
         vec3d vtmp,gp,qpu;
-        vector<vec3d> gc(nsol),wc(nsol),jce(nsol);
-        vector< vector<vec3d> > jc(nsol, vector<vec3d>(nsol));
+        vec3d* gc = arena.Allocate<vec3d>(nsol);
+        vec3d* wc = arena.Allocate<vec3d>(nsol);
+        vec3d* jce = arena.Allocate<vec3d>(nsol);
+        vec3d** jc = arena.Allocate2D<vec3d>(nsol, nsol);
         mat3d wu, jue;
-        vector<mat3d> ju(nsol);
-        vector< vector<double> > dchatdc(nsol, vector<double>(nsol));
+        mat3d* ju = arena.Allocate<mat3d>(nsol);
+        double** dchatdc = arena.Allocate2D<double>(nsol, nsol);
         double sum;
         mat3ds De;
         for (i=0; i<neln; ++i)
@@ -1489,7 +1530,7 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
                 }
                 
                 // calculate data for the kcc matrix
-                jce.assign(nsol, vec3d(0,0,0));
+                for (isol=0; isol<nsol; ++isol) jce[isol] = vec3d(0,0,0);
                 for (isol=0; isol<nsol; ++isol) {
                     for (jsol=0; jsol<nsol; ++jsol) {
                         if (jsol != isol) {
@@ -1507,8 +1548,7 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
                         // chemical reactions
                         dchatdc[isol][jsol] = 0;
                         for (ireact=0; ireact<nreact; ++ireact)
-                            dchatdc[isol][jsol] += m_pMat->GetReaction(ireact)->m_v[isol]
-                            *m_pMat->GetReaction(ireact)->Tangent_ReactionSupply_Concentration(mp,jsol);
+                            dchatdc[isol][jsol] += m_pMat->GetReaction(ireact)->m_v[isol]*dzhatdc[ireact][jsol];
                     }
                 }
                 
@@ -1603,8 +1643,8 @@ void FEMultiphasicSolidDomain::UpdateElementStress(int iel, double dt)
     for (j=0; j<neln; ++j)
     {
         FENode& node = mesh.Node(el.m_node[j]);
-        r0[j] = node.m_r0;
-        rt[j] = node.m_rt;
+        r0[j] = node.m_r0();
+        rt[j] = node.m_rt();
         if (el.m_bitfc.size()>0 && el.m_bitfc[j]) {
             pn[j] = (node.m_ID[m_dofQ] != -1) ? node.get(m_dofQ) : node.get(m_dofP);
             for (k=0; k<nsol; ++k)
@@ -1641,6 +1681,10 @@ void FEMultiphasicSolidDomain::UpdateElementStress(int iel, double dt)
         FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
         FESolutesMaterialPoint& spt = *(mp.ExtractData<FESolutesMaterialPoint>());
         
+        // the state of this point is about to change, so invalidate the cached potential
+        // and transport properties
+        spt.m_bzeta = spt.m_btransp = false;
+        
         // update SBM referential densities
         pmb->UpdateSolidBoundMolecules(mp);
         
@@ -1660,17 +1704,29 @@ void FEMultiphasicSolidDomain::UpdateElementStress(int iel, double dt)
             spt.m_gradc[k] = gradient(el, &ct[k][0], n);
         }
         
+        // solve the electroneutrality condition once for this state. All the
+        // constitutive functions evaluated below (and the stiffness evaluation
+        // until the next update) reuse this solution.
+        pmb->UpdateElectricPotential(mp);
+        
+        // evaluate the actual solute concentrations. Some diffusivities depend on
+        // them, so they are needed before the transport properties are evaluated.
+        for (k=0; k<nsol; ++k)
+            spt.m_ca[k] = pmb->Concentration(mp,k);
+        
+        // evaluate the permeability and diffusivities once for this state
+        pmb->UpdateTransportProperties(mp);
+        
         // update the fluid and solute fluxes
-        // and evaluate the actual fluid pressure and solute concentration
         ppt.m_w = pmb->FluidFlux(mp);
-        spt.m_psi = pmb->ElectricPotential(mp);
+        spt.m_Ie = vec3d(0,0,0);
         for (k=0; k<nsol; ++k) {
-            spt.m_ca[k] = pmb->Concentration(mp,k);
             spt.m_j[k] = pmb->SoluteFlux(mp,k);
+            spt.m_Ie += spt.m_j[k]*pmb->SoluteChargeNumber(k);
         }
+        spt.m_Ie *= pmb->m_Fc;
         spt.m_cF = pmb->FixedChargeDensity(mp);
         ppt.m_pa = pmb->Pressure(mp);
-        spt.m_Ie = pmb->CurrentDensity(mp);
         pmb->PartitionCoefficientFunctions(mp, spt.m_k, spt.m_dkdJ, spt.m_dkdc,
                                            spt.m_dkdr, spt.m_dkdJr, spt.m_dkdrc);
 
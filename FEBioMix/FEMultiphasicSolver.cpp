@@ -252,7 +252,7 @@ bool FEMultiphasicSolver::Quasin()
 		bconv = true;
 
 		// solve the equations (returns line search; solution stored in m_ui)
-		double s = QNSolve();
+		double s = QNSolve(m_niter == 0 ? 0.0 : normEi);
 
 		// extract the pressure increments
 		GetDisplacementData(m_di, m_ui);
@@ -471,7 +471,7 @@ bool FEMultiphasicSolver::Residual(vector<double>& R)
 	zero(m_Fr);
 
 	// setup global RHS vector
-	FEResidualVector RHS(fem, R, m_Fr);
+	FEResidualVector RHS(fem, R, m_Fr, m_bcolorAssembly);
 
 	// zero rigid body reaction forces
 	m_rigidSolver.Residual();
@@ -791,31 +791,32 @@ void FEMultiphasicSolver::UpdateKinematics(vector<double>& ui)
 //! Updates the poroelastic data
 void FEMultiphasicSolver::UpdatePoro(vector<double>& ui)
 {
-	int i, n;
-
 	FEModel& fem = *GetFEModel();
 	FEMesh& mesh = fem.GetMesh();
 	double dt = fem.GetTime().timeIncrement;
+	const int NN = mesh.Nodes();
 
 	// update poro-elasticity data
-	for (i=0; i<mesh.Nodes(); ++i)
+#pragma omp parallel for
+	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
 
 		// update nodal pressures
-		n = node.m_ID[m_dofP];
+		int n = node.m_ID[m_dofP];
 		if (n >= 0) node.set(m_dofP, 0 + m_Ut[n] + m_Ui[n] + ui[n]);
         n = node.m_ID[m_dofQ];
         if (n >= 0) node.set(m_dofQ, 0 + m_Ut[n] + m_Ui[n] + ui[n]);
     }
 
 	// update poro-elasticity data
-	for (i=0; i<mesh.Nodes(); ++i)
+#pragma omp parallel for
+	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
 
 		// update velocities
-		vec3d vt = (node.m_rt - node.m_rp) / dt;
+		vec3d vt = (node.m_rt() - node.m_rp()) / dt;
 		node.set_vec3d(m_dofV[0], m_dofV[1], m_dofV[2], vt);
 	}
 }
@@ -824,8 +825,6 @@ void FEMultiphasicSolver::UpdatePoro(vector<double>& ui)
 //! Updates the solute data
 void FEMultiphasicSolver::UpdateSolute(vector<double>& ui)
 {
-	int i, j, n;
-	
 	FEModel& fem = *GetFEModel();
 	FEMesh& mesh = fem.GetMesh();
 	double dt = fem.GetTime().timeIncrement;
@@ -836,13 +835,15 @@ void FEMultiphasicSolver::UpdateSolute(vector<double>& ui)
     int MAX_DDOFS = fedofs.GetVariableSize("shell concentration");
     
 	// update solute data
-	for (i=0; i<mesh.Nodes(); ++i)
+	const int NN = mesh.Nodes();
+#pragma omp parallel for
+	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
 		
 		// update nodal concentration
-		for (j=0; j<MAX_CDOFS; ++j) {
-			n = node.m_ID[m_dofC+j];
+		for (int j=0; j<MAX_CDOFS; ++j) {
+			int n = node.m_ID[m_dofC+j];
 			// Force the concentrations to remain positive
 			if (n >= 0) {
 				double ct = 0 + m_Ut[n] + m_Ui[n] + ui[n];
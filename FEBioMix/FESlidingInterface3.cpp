@@ -135,7 +135,7 @@ void FESlidingSurface3::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3*i  ] = id[m_dofX];
@@ -256,7 +256,7 @@ void FESlidingSurface3::UpdateNodeNormals()
 		int ne = el.Nodes();
 		
 		// get the nodal coordinates
-		for (int j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt;
+		for (int j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt();
 		
 		// calculate the normals
 		for (int j=0; j<ne; ++j)
@@ -533,7 +533,7 @@ void FESlidingInterface3::BuildMatrixProfile(FEGlobalMatrix& K)
 									
 					for (l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
 						lm[8*l  ] = id[dof_X];
 						lm[8*l+1] = id[dof_Y];
 						lm[8*l+2] = id[dof_Z];
@@ -546,7 +546,7 @@ void FESlidingInterface3::BuildMatrixProfile(FEGlobalMatrix& K)
 									
 					for (l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
 						lm[8*(l+nseln)  ] = id[dof_X];
 						lm[8*(l+nseln)+1] = id[dof_Y];
 						lm[8*(l+nseln)+2] = id[dof_Z];
@@ -827,9 +827,9 @@ void FESlidingInterface3::ProjectSurface(FESlidingSurface3& ss, FESlidingSurface
             int ne = el.Nodes();
             for (int j=0; j<ne; ++j)
             {
-                vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt;
-                vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt;
-                vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt;
+                vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt();
+                vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt();
+                vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt();
                 vec3d n = (rp - r0)^(rm - r0);
                 normal[el.m_lnode[j]] += n;
             }
@@ -842,7 +842,7 @@ void FESlidingInterface3::ProjectSurface(FESlidingSurface3& ss, FESlidingSurface
             FENode& node = ss.Node(i);
             
             // get the spatial nodal coordinates
-            vec3d rt = node.m_rt;
+            vec3d rt = node.m_rt();
             vec3d nu = normal[i];
             
             // project onto the secondary surface
@@ -860,7 +860,7 @@ void FESlidingInterface3::ProjectSurface(FESlidingSurface3& ss, FESlidingSurface
                 // to Gerard's notes.
                 double gap = nu*(rt - q);
                 
-                if (gap>0) node.m_r0 = node.m_rt = q;
+                if (gap>0) node.m_r0() = node.m_rt() = q;
             }
         }
     }
@@ -1106,7 +1106,7 @@ void FESlidingInterface3::Update()
 				FENode& node = ms.Node(n);
 				
 				// project it onto the primary surface
-				FESurfaceElement* pse = np.Project(node.m_rt, ms.m_nn[n], rs);
+				FESurfaceElement* pse = np.Project(node.m_rt(), ms.m_nn[n], rs);
 				
 				if (pse)
 				{
@@ -1115,7 +1115,7 @@ void FESlidingInterface3::Update()
 					vec3d q = ss.Local2Global(*pse, rs[0], rs[1]);
 					
 					// calculate the gap function
-					double g = ms.m_nn[n]*(node.m_rt - q);
+					double g = ms.m_nn[n]*(node.m_rt() - q);
 					
 					if (fabs(g) <= R)
 					{
@@ -268,7 +268,7 @@ void FESlidingSurfaceBiphasic::UpdateNodeNormals()
         int ne = el.Nodes();
         
         // get the nodal coordinates
-        for (int j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt;
+        for (int j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt();
         
         // calculate the normals
         for (int j=0; j<ne; ++j)
@@ -595,7 +595,7 @@ void FESlidingInterfaceBiphasic::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nseln; ++l)
                     {
-                        vector<int>& id = mesh.Node(sn[l]).m_ID;
+                        FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
                         lm[7*l  ] = id[dof_X];
                         lm[7*l+1] = id[dof_Y];
                         lm[7*l+2] = id[dof_Z];
@@ -607,7 +607,7 @@ void FESlidingInterfaceBiphasic::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nmeln; ++l)
                     {
-                        vector<int>& id = mesh.Node(mn[l]).m_ID;
+                        FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
                         lm[7*(l+nseln)  ] = id[dof_X];
                         lm[7*(l+nseln)+1] = id[dof_Y];
                         lm[7*(l+nseln)+2] = id[dof_Z];
@@ -774,9 +774,9 @@ void FESlidingInterfaceBiphasic::ProjectSurface(FESlidingSurfaceBiphasic& ss, FE
             int ne = el.Nodes();
             for (int j=0; j<ne; ++j)
             {
-                vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt;
-                vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt;
-                vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt;
+                vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt();
+                vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt();
+                vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt();
                 vec3d n = (rp - r0)^(rm - r0);
                 normal[el.m_lnode[j]] += n;
             }
@@ -789,7 +789,7 @@ void FESlidingInterfaceBiphasic::ProjectSurface(FESlidingSurfaceBiphasic& ss, FE
             FENode& node = ss.Node(i);
             
             // get the spatial nodal coordinates
-            vec3d rt = node.m_rt;
+            vec3d rt = node.m_rt();
             vec3d nu = normal[i];
             
             // project onto the secondary surface
@@ -807,7 +807,7 @@ void FESlidingInterfaceBiphasic::ProjectSurface(FESlidingSurfaceBiphasic& ss, FE
                 // to Gerard's notes.
                 double gap = nu*(rt - q);
                 
-                if (gap>0) node.m_r0 = node.m_rt = q;
+                if (gap>0) node.m_r0() = node.m_rt() = q;
             }
         }
     }
@@ -1042,7 +1042,7 @@ void FESlidingInterfaceBiphasic::Update()
                 
                 // project it onto the primary surface
                 double rs[2] = {0,0};
-                FESurfaceElement* pse = np.Project(node.m_rt, ms.m_nn[n], rs);
+                FESurfaceElement* pse = np.Project(node.m_rt(), ms.m_nn[n], rs);
                 
                 if (pse)
                 {
@@ -1051,7 +1051,7 @@ void FESlidingInterfaceBiphasic::Update()
                     vec3d q = ss.Local2Global(*pse, rs[0], rs[1]);
                     
                     // calculate the gap function
-                    double g = ms.m_nn[n]*(node.m_rt - q);
+                    double g = ms.m_nn[n]*(node.m_rt() - q);
                     
                     if (fabs(g) <= R)
                     {
@@ -275,7 +275,7 @@ void FESlidingSurfaceBiphasicMixed::UpdateNodeNormals()
         int ne = el.Nodes();
         
         // get the nodal coordinates
-        for (int j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt;
+        for (int j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt();
         
         // calculate the normals
         for (int j=0; j<ne; ++j)
@@ -531,7 +531,7 @@ void FESlidingSurfaceBiphasicMixed::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3 * i    ] = id[m_dofX];
@@ -642,7 +642,7 @@ void FESlidingInterfaceBiphasicMixed::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nseln; ++l)
                     {
-                        vector<int>& id = mesh.Node(sn[l]).m_ID;
+                        FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
                         lm[7*l  ] = id[dof_X];
                         lm[7*l+1] = id[dof_Y];
                         lm[7*l+2] = id[dof_Z];
@@ -654,7 +654,7 @@ void FESlidingInterfaceBiphasicMixed::BuildMatrixProfile(FEGlobalMatrix& K)
                     
                     for (l=0; l<nmeln; ++l)
                     {
-                        vector<int>& id = mesh.Node(mn[l]).m_ID;
+                        FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
                         lm[7*(l+nseln)  ] = id[dof_X];
                         lm[7*(l+nseln)+1] = id[dof_Y];
                         lm[7*(l+nseln)+2] = id[dof_Z];
@@ -825,9 +825,9 @@ void FESlidingInterfaceBiphasicMixed::ProjectSurface(FESlidingSurfaceBiphasicMix
             int ne = el.Nodes();
             for (int j=0; j<ne; ++j)
             {
-                vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt;
-                vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt;
-                vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt;
+                vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt();
+                vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt();
+                vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt();
                 vec3d n = (rp - r0)^(rm - r0);
                 normal[el.m_lnode[j]] += n;
             }
@@ -840,7 +840,7 @@ void FESlidingInterfaceBiphasicMixed::ProjectSurface(FESlidingSurfaceBiphasicMix
             FENode& node = ss.Node(i);
             
             // get the spatial nodal coordinates
-            vec3d rt = node.m_rt;
+            vec3d rt = node.m_rt();
             vec3d nu = normal[i];
             
             // project onto the secondary surface
@@ -858,7 +858,7 @@ void FESlidingInterfaceBiphasicMixed::ProjectSurface(FESlidingSurfaceBiphasicMix
                 // to Gerard's notes.
                 double gap = nu*(rt - q);
                 
-                if (gap>0) node.m_r0 = node.m_rt = q;
+                if (gap>0) node.m_r0() = node.m_rt() = q;
             }
         }
     }
@@ -1098,7 +1098,7 @@ void FESlidingInterfaceBiphasicMixed::Update()
                 
                 // project it onto the primary surface
                 double rs[2] = {0,0};
-                FESurfaceElement* pse = np.Project(node.m_rt, ms.m_nn[n], rs);
+                FESurfaceElement* pse = np.Project(node.m_rt(), ms.m_nn[n], rs);
                 
                 if (pse)
                 {
@@ -1107,7 +1107,7 @@ void FESlidingInterfaceBiphasicMixed::Update()
                     vec3d q = ss.Local2Global(*pse, rs[0], rs[1]);
                     
                     // calculate the gap function
-                    double g = ms.m_nn[n]*(node.m_rt - q);
+                    double g = ms.m_nn[n]*(node.m_rt() - q);
                     
                     if (fabs(g) <= R)
                     {
@@ -133,7 +133,7 @@ void FESlidingSurfaceMP::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 
 		FENode& node = m_pMesh->Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[3*i  ] = id[m_dofX];
@@ -288,7 +288,7 @@ void FESlidingSurfaceMP::UpdateNodeNormals()
 		ne = el.Nodes();
 		
 		// get the nodal coordinates
-		for (j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt;
+		for (j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt();
 		
 		// calculate the normals
 		for (j=0; j<ne; ++j)
@@ -609,7 +609,7 @@ void FESlidingInterfaceMP::BuildMatrixProfile(FEGlobalMatrix& K)
                     
 					for (l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
 						lm[ndpn*l  ] = id[dof_X];
 						lm[ndpn*l+1] = id[dof_Y];
 						lm[ndpn*l+2] = id[dof_Z];
@@ -624,7 +624,7 @@ void FESlidingInterfaceMP::BuildMatrixProfile(FEGlobalMatrix& K)
                     
 					for (l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
 						lm[ndpn*(l+nseln)  ] = id[dof_X];
 						lm[ndpn*(l+nseln)+1] = id[dof_Y];
 						lm[ndpn*(l+nseln)+2] = id[dof_Z];
@@ -956,9 +956,9 @@ void FESlidingInterfaceMP::ProjectSurface(FESlidingSurfaceMP& ss, FESlidingSurfa
             int ne = el.Nodes();
             for (int j=0; j<ne; ++j)
             {
-                vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt;
-                vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt;
-                vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt;
+                vec3d r0 = ss.Node(el.m_lnode[ j         ]).m_rt();
+                vec3d rp = ss.Node(el.m_lnode[(j+   1)%ne]).m_rt();
+                vec3d rm = ss.Node(el.m_lnode[(j+ne-1)%ne]).m_rt();
                 vec3d n = (rp - r0)^(rm - r0);
                 normal[el.m_lnode[j]] += n;
             }
@@ -971,7 +971,7 @@ void FESlidingInterfaceMP::ProjectSurface(FESlidingSurfaceMP& ss, FESlidingSurfa
             FENode& node = ss.Node(i);
             
             // get the spatial nodal coordinates
-            vec3d rt = node.m_rt;
+            vec3d rt = node.m_rt();
             vec3d nu = normal[i];
             
             // project onto the secondary surface
@@ -989,7 +989,7 @@ void FESlidingInterfaceMP::ProjectSurface(FESlidingSurfaceMP& ss, FESlidingSurfa
                 // to Gerard's notes.
                 double gap = nu*(rt - q);
                 
-                if (gap>0) node.m_r0 = node.m_rt = q;
+                if (gap>0) node.m_r0() = node.m_rt() = q;
             }
         }
     }
@@ -1232,7 +1232,7 @@ void FESlidingInterfaceMP::Update()
 				FENode& node = ms.Node(n);
 				
 				// project it onto the primary surface
-				FESurfaceElement* pse = project.Project(node.m_rt, ms.m_nn[n], rs);
+				FESurfaceElement* pse = project.Project(node.m_rt(), ms.m_nn[n], rs);
 				
 				if (pse)
 				{
@@ -1241,7 +1241,7 @@ void FESlidingInterfaceMP::Update()
 					vec3d q = ss.Local2Global(*pse, rs[0], rs[1]);
 					
 					// calculate the gap function
-					double g = ms.m_nn[n]*(node.m_rt - q);
+					double g = ms.m_nn[n]*(node.m_rt() - q);
 					
 					if (fabs(g) <= R)
 					{
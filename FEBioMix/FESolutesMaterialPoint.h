@@ -57,6 +57,13 @@ public:
 	vector<double>	m_ca;		//!< actual solute concentration
     vector<double>  m_crp;      //!< referential actual solute concentration at previous time step
 	double			m_psi;		//!< electric potential
+	double			m_zeta;		//!< cached electroneutrality solution (exponential form of m_psi)
+	bool			m_bzeta;	//!< true if m_zeta is valid for the current state of this point
+	int				m_nzeta;	//!< nr of iterations of the last electroneutrality solve
+	mat3ds			m_K;		//!< cached hydraulic permeability
+	vector<mat3ds>	m_D;		//!< cached solute diffusivity
+	vector<double>	m_D0;		//!< cached solute free diffusivity
+	bool			m_btransp;	//!< true if m_K, m_D and m_D0 are valid for the current state of this point
 	vec3d			m_Ie;		//!< current density
 	double			m_cF;		//!< fixed charge density in current configuration
 	int				m_nsbm;		//!< number of solid-bound molecules
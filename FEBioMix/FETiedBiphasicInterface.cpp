@@ -157,7 +157,7 @@ void FETiedBiphasicSurface::UpdateNodeNormals()
 		ne = el.Nodes();
 		
 		// get the nodal coordinates
-		for (j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt;
+		for (j=0; j<ne; ++j) y[j] = Node(el.m_lnode[j]).m_rt();
 		
 		// calculate the normals
 		for (j=0; j<ne; ++j)
@@ -304,7 +304,7 @@ void FETiedBiphasicInterface::BuildMatrixProfile(FEGlobalMatrix& K)
 									
 					for (l=0; l<nseln; ++l)
 					{
-						vector<int>& id = mesh.Node(sn[l]).m_ID;
+						FENodeArray<int>& id = mesh.Node(sn[l]).m_ID;
 						lm[7*l  ] = id[dof_X];
 						lm[7*l+1] = id[dof_Y];
 						lm[7*l+2] = id[dof_Z];
@@ -316,7 +316,7 @@ void FETiedBiphasicInterface::BuildMatrixProfile(FEGlobalMatrix& K)
 									
 					for (l=0; l<nmeln; ++l)
 					{
-						vector<int>& id = mesh.Node(mn[l]).m_ID;
+						FENodeArray<int>& id = mesh.Node(mn[l]).m_ID;
 						lm[7*(l+nseln)  ] = id[dof_X];
 						lm[7*(l+nseln)+1] = id[dof_Y];
 						lm[7*(l+nseln)+2] = id[dof_Z];
@@ -84,7 +84,7 @@ void FETriphasicDomain::UnpackLM(FEElement& el, vector<int>& lm)
 		int n = el.m_node[i];
 		FENode& node = m_pMesh->Node(n);
 
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 
 		// first the displacement dofs
 		lm[6*i  ] = id[m_dofU[0]];
@@ -252,8 +252,8 @@ void FETriphasicDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
 		int neln = el.Nodes();
 		for (int i=0; i<neln; ++i)
 		{
-			x0[i] = m.Node(el.m_node[i]).m_r0;
-			xt[i] = m.Node(el.m_node[i]).m_rt;
+			x0[i] = m.Node(el.m_node[i]).m_r0();
+			xt[i] = m.Node(el.m_node[i]).m_rt();
             pn[i] = m.Node(el.m_node[i]).get(m_dofP);
 		}
 
@@ -1235,8 +1235,8 @@ void FETriphasicDomain::UpdateElementStress(int iel)
 	double pn[FEElement::MAX_NODES], ct[2][FEElement::MAX_NODES];
 	for (int j=0; j<neln; ++j)
 	{
-		r0[j] = mesh.Node(el.m_node[j]).m_r0;
-		rt[j] = mesh.Node(el.m_node[j]).m_rt;
+		r0[j] = mesh.Node(el.m_node[j]).m_r0();
+		rt[j] = mesh.Node(el.m_node[j]).m_rt();
 		pn[j] = mesh.Node(el.m_node[j]).get(m_dofP);
 		ct[0][j] = mesh.Node(el.m_node[j]).get(id0);
 		ct[1][j] = mesh.Node(el.m_node[j]).get(id1);
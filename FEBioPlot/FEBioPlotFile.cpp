@@ -874,10 +874,10 @@ void FEBioPlotFile::WriteNodeSection(FEMesh& m)
 	for (int i=0; i<m.Nodes(); ++i)
 	{
 		FENode& node = m.Node(i);
-		*((int*) (&X[0] + 4*i)) = i;
-		X[4*i+1] = (float) node.m_r0.x;
-		X[4*i+2] = (float) node.m_r0.y;
-		X[4*i+3] = (float) node.m_r0.z;
+		*((int*) (&X[0] + 4*i)) = (m.IsReordered() ? node.GetID() - 1 : i);
+		X[4*i+1] = (float) node.m_r0().x;
+		X[4*i+2] = (float) node.m_r0().y;
+		X[4*i+3] = (float) node.m_r0().z;
 	}
 	m_ar.WriteChunk(PLT_NODE_COORDS, X);
 }
@@ -99,10 +99,10 @@ bool FEBioEigenSolver::Run()
 		for (int j = 0; j < mesh.Nodes(); ++j)
 		{
 			FENode& node = mesh.Node(j);
-			node.m_rt = node.m_r0;
-			n = node.m_ID[0]; if (n >= 0) node.m_rt.x += eigenVectors[i][n];
-			n = node.m_ID[1]; if (n >= 0) node.m_rt.y += eigenVectors[i][n];
-			n = node.m_ID[2]; if (n >= 0) node.m_rt.z += eigenVectors[i][n];
+			node.m_rt() = node.m_r0();
+			n = node.m_ID[0]; if (n >= 0) node.m_rt().x += eigenVectors[i][n];
+			n = node.m_ID[1]; if (n >= 0) node.m_rt().y += eigenVectors[i][n];
+			n = node.m_ID[2]; if (n >= 0) node.m_rt().z += eigenVectors[i][n];
 		}
 
 		plt.Write(*fem, eigenValues[i]);
@@ -153,27 +153,27 @@ bool FEContactDiagnostic::Init()
 	const double eps = 0.5;
 	mesh.CreateNodes(16);
 	mesh.SetDOFS(MAX_DOFS);
-	mesh.Node( 0).m_r0 = vec3d(0,0,0);
-	mesh.Node( 1).m_r0 = vec3d(1,0,0);
-	mesh.Node( 2).m_r0 = vec3d(1,1,0);
-	mesh.Node( 3).m_r0 = vec3d(0,1,0);
-	mesh.Node( 4).m_r0 = vec3d(0,0,1);
-	mesh.Node( 5).m_r0 = vec3d(1,0,1);
-	mesh.Node( 6).m_r0 = vec3d(1,1,1);
-	mesh.Node( 7).m_r0 = vec3d(0,1,1);
-	mesh.Node( 8).m_r0 = vec3d(0,0,1-eps);
-	mesh.Node( 9).m_r0 = vec3d(1,0,1-eps);
-	mesh.Node(10).m_r0 = vec3d(1,1,1-eps);
-	mesh.Node(11).m_r0 = vec3d(0,1,1-eps);
-	mesh.Node(12).m_r0 = vec3d(0,0,2-eps);
-	mesh.Node(13).m_r0 = vec3d(1,0,2-eps);
-	mesh.Node(14).m_r0 = vec3d(1,1,2-eps);
-	mesh.Node(15).m_r0 = vec3d(0,1,2-eps);
+	mesh.Node( 0).m_r0() = vec3d(0,0,0);
+	mesh.Node( 1).m_r0() = vec3d(1,0,0);
+	mesh.Node( 2).m_r0() = vec3d(1,1,0);
+	mesh.Node( 3).m_r0() = vec3d(0,1,0);
+	mesh.Node( 4).m_r0() = vec3d(0,0,1);
+	mesh.Node( 5).m_r0() = vec3d(1,0,1);
+	mesh.Node( 6).m_r0() = vec3d(1,1,1);
+	mesh.Node( 7).m_r0() = vec3d(0,1,1);
+	mesh.Node( 8).m_r0() = vec3d(0,0,1-eps);
+	mesh.Node( 9).m_r0() = vec3d(1,0,1-eps);
+	mesh.Node(10).m_r0() = vec3d(1,1,1-eps);
+	mesh.Node(11).m_r0() = vec3d(0,1,1-eps);
+	mesh.Node(12).m_r0() = vec3d(0,0,2-eps);
+	mesh.Node(13).m_r0() = vec3d(1,0,2-eps);
+	mesh.Node(14).m_r0() = vec3d(1,1,2-eps);
+	mesh.Node(15).m_r0() = vec3d(0,1,2-eps);
 
 	for (int i=0; i<16; ++i)
 	{
 		FENode& node = mesh.Node(i);
-		node.m_rt = node.m_r0;
+		node.m_rt() = node.m_r0();
 	}
 
 	// --- create a material ---
@@ -272,9 +272,9 @@ void FEContactDiagnostic::deriv_residual(DenseMatrix& K)
 
 		switch (nj)
 		{
-		case 0: node.m_rt.x += dx; break;
-		case 1: node.m_rt.y += dx; break;
-		case 2: node.m_rt.z += dx; break;
+		case 0: node.m_rt().x += dx; break;
+		case 1: node.m_rt().y += dx; break;
+		case 2: node.m_rt().z += dx; break;
 		}
 
 		fem.Update();
@@ -286,9 +286,9 @@ void FEContactDiagnostic::deriv_residual(DenseMatrix& K)
 
 		switch (nj)
 		{
-		case 0: node.m_rt.x -= dx; break;
-		case 1: node.m_rt.y -= dx; break;
-		case 2: node.m_rt.z -= dx; break;
+		case 0: node.m_rt().x -= dx; break;
+		case 1: node.m_rt().y -= dx; break;
+		case 2: node.m_rt().z -= dx; break;
 		}
 
 		fem.Update();
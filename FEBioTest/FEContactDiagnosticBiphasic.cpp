@@ -239,9 +239,9 @@ void FEContactDiagnosticBiphasic::deriv_residual(matrix& K)
         
         switch (nj)
         {
-            case 0: node.add(dof_x, dx); node.m_rt.x += dx; break;
-            case 1: node.add(dof_y, dx); node.m_rt.y += dx; break;
-            case 2: node.add(dof_z, dx); node.m_rt.z += dx; break;
+            case 0: node.add(dof_x, dx); node.m_rt().x += dx; break;
+            case 1: node.add(dof_y, dx); node.m_rt().y += dx; break;
+            case 2: node.add(dof_z, dx); node.m_rt().z += dx; break;
             case 3: node.add(dof_p, dx); break;
         }
         
@@ -253,9 +253,9 @@ void FEContactDiagnosticBiphasic::deriv_residual(matrix& K)
         
         switch (nj)
         {
-            case 0: node.sub(dof_x, dx); node.m_rt.x -= dx; break;
-            case 1: node.sub(dof_y, dx); node.m_rt.y -= dx; break;
-            case 2: node.sub(dof_z, dx); node.m_rt.z -= dx; break;
+            case 0: node.sub(dof_x, dx); node.m_rt().x -= dx; break;
+            case 1: node.sub(dof_y, dx); node.m_rt().y -= dx; break;
+            case 2: node.sub(dof_z, dx); node.m_rt().z -= dx; break;
             case 3: node.sub(dof_p, dx); break;
         }
         
@@ -318,18 +318,18 @@ bool FEContactBiphasicTangentHex8::Init()
     mesh.SetDOFS(MAX_DOFS);
     vec3d dr(0,0,eps);
     for (int i=0; i<8; ++i) {
-        mesh.Node(i).m_r0 = r[i];
+        mesh.Node(i).m_r0() = r[i];
         mesh.Node(i).set(dof_p, p[i]);
     }
     for (int i=8; i<16; ++i) {
-        mesh.Node(i).m_r0 = r[i] - dr;
+        mesh.Node(i).m_r0() = r[i] - dr;
         mesh.Node(i).set(dof_p, p[i]+eps);
     }
     
     for (int i=0; i<16; ++i)
     {
         FENode& node = mesh.Node(i);
-        node.m_rt = node.m_r0;
+        node.m_rt() = node.m_r0();
     }
     
     // get the material
@@ -465,18 +465,18 @@ bool FEContactBiphasicTangentHex20::Init()
     mesh.SetDOFS(MAX_DOFS);
     vec3d dr(0,0,eps);
     for (int i=0; i<20; ++i) {
-        mesh.Node(i).m_r0 = r[i];
+        mesh.Node(i).m_r0() = r[i];
         mesh.Node(i).set(dof_p, p[i]);
     }
     for (int i=20; i<40; ++i) {
-        mesh.Node(i).m_r0 = r[i] - dr;
+        mesh.Node(i).m_r0() = r[i] - dr;
         mesh.Node(i).set(dof_p, p[i]+eps);
     }
     
     for (int i=0; i<40; ++i)
     {
         FENode& node = mesh.Node(i);
-        node.m_rt = node.m_r0;
+        node.m_rt() = node.m_r0();
     }
     
     // get the material
@@ -68,8 +68,8 @@ bool FEEASShellTangentUnloaded::Init()
     for (i=0; i<NELN; ++i)
     {
         FENode& n = m.Node(i);
-        n.m_rt = n.m_r0 = r[i];
-        n.m_dt = n.m_d0 = D[i];
+        n.m_rt() = n.m_r0() = r[i];
+        n.m_dt() = n.m_d0() = D[i];
         n.m_rid = -1;
     }
     
@@ -270,9 +270,9 @@ void FEEASShellTangentDiagnostic::deriv_residual(matrix& ke)
         
         switch (nj)
         {
-            case 0: node.add(dof_X, dx); node.m_rt.x += dx; break;
-            case 1: node.add(dof_Y, dx); node.m_rt.y += dx; break;
-            case 2: node.add(dof_Z, dx); node.m_rt.z += dx; break;
+            case 0: node.add(dof_X, dx); node.m_rt().x += dx; break;
+            case 1: node.add(dof_Y, dx); node.m_rt().y += dx; break;
+            case 2: node.add(dof_Z, dx); node.m_rt().z += dx; break;
             case 3: node.add(dof_SX, dx); break;
             case 4: node.add(dof_SY, dx); break;
             case 5: node.add(dof_SZ, dx); break;
@@ -286,9 +286,9 @@ void FEEASShellTangentDiagnostic::deriv_residual(matrix& ke)
         
         switch (nj)
         {
-            case 0: node.sub(dof_X, dx); node.m_rt.x -= dx; break;
-            case 1: node.sub(dof_Y, dx); node.m_rt.y -= dx; break;
-            case 2: node.sub(dof_Z, dx); node.m_rt.z -= dx; break;
+            case 0: node.sub(dof_X, dx); node.m_rt().x -= dx; break;
+            case 1: node.sub(dof_Y, dx); node.m_rt().y -= dx; break;
+            case 2: node.sub(dof_Z, dx); node.m_rt().z -= dx; break;
             case 3: node.sub(dof_SX, dx); break;
             case 4: node.sub(dof_SY, dx); break;
             case 5: node.sub(dof_SZ, dx); break;
@@ -102,7 +102,7 @@ bool FEFluidFSITangentUniaxial::Init()
     for (i=0; i<8; ++i)
     {
         FENode& n = m.Node(i);
-        n.m_rt = n.m_r0 = r[i];
+        n.m_rt() = n.m_r0() = r[i];
         n.m_rid = -1;
         
         // set displacement BC's
@@ -355,9 +355,9 @@ void FEFluidFSITangentDiagnostic::deriv_residual(matrix& ke)
         
         switch (nj)
         {
-            case 0: node.add(dof_X, dx); node.m_rt.x += dx; break;
-            case 1: node.add(dof_Y, dx); node.m_rt.y += dx; break;
-            case 2: node.add(dof_Z, dx); node.m_rt.z += dx; break;
+            case 0: node.add(dof_X, dx); node.m_rt().x += dx; break;
+            case 1: node.add(dof_Y, dx); node.m_rt().y += dx; break;
+            case 2: node.add(dof_Z, dx); node.m_rt().z += dx; break;
             case 3: node.add(dof_WX, dx); break;
             case 4: node.add(dof_WY, dx); break;
             case 5: node.add(dof_WZ, dx); break;
@@ -373,9 +373,9 @@ void FEFluidFSITangentDiagnostic::deriv_residual(matrix& ke)
         
         switch (nj)
         {
-            case 0: node.sub(dof_X, dx); node.m_rt.x -= dx; break;
-            case 1: node.sub(dof_Y, dx); node.m_rt.y -= dx; break;
-            case 2: node.sub(dof_Z, dx); node.m_rt.z -= dx; break;
+            case 0: node.sub(dof_X, dx); node.m_rt().x -= dx; break;
+            case 1: node.sub(dof_Y, dx); node.m_rt().y -= dx; break;
+            case 2: node.sub(dof_Z, dx); node.m_rt().z -= dx; break;
             case 3: node.sub(dof_WX, dx); break;
             case 4: node.sub(dof_WY, dx); break;
             case 5: node.sub(dof_WZ, dx); break;
@@ -95,7 +95,7 @@ bool FEFluidTangentUniaxial::Init()
 	for (i=0; i<8; ++i)
     {
         FENode& n = m.Node(i);
-        n.m_rt = n.m_r0 = r[i];
+        n.m_rt() = n.m_r0() = r[i];
         n.m_rid = -1;
         
         // set displacement BC's
@@ -192,7 +192,7 @@ bool FEFluidTangentUniaxialSS::Init()
 	for (i = 0; i<8; ++i)
 	{
 		FENode& n = m.Node(i);
-		n.m_rt = n.m_r0 = r[i];
+		n.m_rt() = n.m_r0() = r[i];
 		n.m_rid = -1;
 
 		// set displacement BC's
@@ -120,7 +120,7 @@ bool FEMultiphasicTangentUniaxial::Init()
 	for (i=0; i<8; ++i)
     {
         FENode& n = m.Node(i);
-        n.m_rt = n.m_rp = n.m_r0 = r[i];
+        n.m_rt() = n.m_rp() = n.m_r0() = r[i];
         n.m_rid = -1;
         
         // set displacement BC's
@@ -383,9 +383,9 @@ void FEMultiphasicTangentDiagnostic::deriv_residual(matrix& ke)
         
         switch (nj)
         {
-            case 0: node.add(dof_x, dx); node.m_rt.x += dx; break;
-            case 1: node.add(dof_y, dx); node.m_rt.y += dx; break;
-            case 2: node.add(dof_z, dx); node.m_rt.z += dx; break;
+            case 0: node.add(dof_x, dx); node.m_rt().x += dx; break;
+            case 1: node.add(dof_y, dx); node.m_rt().y += dx; break;
+            case 2: node.add(dof_z, dx); node.m_rt().z += dx; break;
             case 3: node.add(dof_p, dx); break;
             default: node.add(dof_c + nj-4, dx); break;
         }
@@ -398,9 +398,9 @@ void FEMultiphasicTangentDiagnostic::deriv_residual(matrix& ke)
         
         switch (nj)
         {
-            case 0: node.sub(dof_x, dx); node.m_rt.x -= dx; break;
-            case 1: node.sub(dof_y, dx); node.m_rt.y -= dx; break;
-            case 2: node.sub(dof_z, dx); node.m_rt.z -= dx; break;
+            case 0: node.sub(dof_x, dx); node.m_rt().x -= dx; break;
+            case 1: node.sub(dof_y, dx); node.m_rt().y -= dx; break;
+            case 2: node.sub(dof_z, dx); node.m_rt().z -= dx; break;
             case 3: node.sub(dof_p, dx); break;
             default: node.sub(dof_c + nj-4, dx); break;
         }
@@ -106,7 +106,7 @@ bool FETangentUniaxial::Init()
 	for (i=0; i<8; ++i)
 	{
 		FENode& n = m.Node(i);
-		n.m_rt = n.m_r0 = r[i];
+		n.m_rt() = n.m_r0() = r[i];
 		n.m_rid = -1;
 
 		// set displacement BC's
@@ -200,7 +200,7 @@ bool FETangentSimpleShear::Init()
 	for (i = 0; i<8; ++i)
 	{
 		FENode& n = m.Node(i);
-		n.m_rt = n.m_r0 = r[i];
+		n.m_rt() = n.m_r0() = r[i];
 		n.m_rid = -1;
 
 		// set displacement BC's
@@ -415,9 +415,9 @@ void FETangentDiagnostic::deriv_residual(matrix& ke)
 
 		switch (nj)
 		{
-		case 0: node.add(dof_X, dx); node.m_rt.x += dx; break;
-		case 1: node.add(dof_Y, dx); node.m_rt.y += dx; break;
-		case 2: node.add(dof_Z, dx); node.m_rt.z += dx; break;
+		case 0: node.add(dof_X, dx); node.m_rt().x += dx; break;
+		case 1: node.add(dof_Y, dx); node.m_rt().y += dx; break;
+		case 2: node.add(dof_Z, dx); node.m_rt().z += dx; break;
 		}
 
 
@@ -428,9 +428,9 @@ void FETangentDiagnostic::deriv_residual(matrix& ke)
 
 		switch (nj)
 		{
-		case 0: node.sub(dof_X, dx); node.m_rt.x -= dx; break;
-		case 1: node.sub(dof_Y, dx); node.m_rt.y -= dx; break;
-		case 2: node.sub(dof_Z, dx); node.m_rt.z -= dx; break;
+		case 0: node.sub(dof_X, dx); node.m_rt().x -= dx; break;
+		case 1: node.sub(dof_Y, dx); node.m_rt().y -= dx; break;
+		case 2: node.sub(dof_Z, dx); node.m_rt().z -= dx; break;
 		}
 
 		fem.Update();
@@ -232,9 +232,9 @@ void FETiedBiphasicDiagnostic::deriv_residual(matrix& K)
         
         switch (nj)
         {
-            case 0: node.add(dof_x, dx); node.m_rt.x += dx; break;
-            case 1: node.add(dof_y, dx); node.m_rt.y += dx; break;
-            case 2: node.add(dof_z, dx); node.m_rt.z += dx; break;
+            case 0: node.add(dof_x, dx); node.m_rt().x += dx; break;
+            case 1: node.add(dof_y, dx); node.m_rt().y += dx; break;
+            case 2: node.add(dof_z, dx); node.m_rt().z += dx; break;
             case 3: node.add(dof_p, dx); break;
         }
         
@@ -246,9 +246,9 @@ void FETiedBiphasicDiagnostic::deriv_residual(matrix& K)
         
         switch (nj)
         {
-            case 0: node.sub(dof_x, dx); node.m_rt.x -= dx; break;
-            case 1: node.sub(dof_y, dx); node.m_rt.y -= dx; break;
-            case 2: node.sub(dof_z, dx); node.m_rt.z -= dx; break;
+            case 0: node.sub(dof_x, dx); node.m_rt().x -= dx; break;
+            case 1: node.sub(dof_y, dx); node.m_rt().y -= dx; break;
+            case 2: node.sub(dof_z, dx); node.m_rt().z -= dx; break;
             case 3: node.sub(dof_p, dx); break;
         }
         
@@ -309,14 +309,14 @@ bool FETiedBiphasicTangentHex8::Init()
     mesh.CreateNodes(16);
     mesh.SetDOFS(MAX_DOFS);
     for (int i=0; i<16; ++i) {
-        mesh.Node(i).m_r0 = r[i];
+        mesh.Node(i).m_r0() = r[i];
         mesh.Node(i).set(dof_p, p[i]);
     }
     
     for (int i=0; i<16; ++i)
     {
         FENode& node = mesh.Node(i);
-        node.m_rt = node.m_r0;
+        node.m_rt() = node.m_r0();
     }
     
     // get the material
@@ -449,14 +449,14 @@ bool FETiedBiphasicTangentHex20::Init()
     mesh.CreateNodes(40);
     mesh.SetDOFS(MAX_DOFS);
     for (int i=0; i<40; ++i) {
-        mesh.Node(i).m_r0 = r[i];
+        mesh.Node(i).m_r0() = r[i];
         mesh.Node(i).set(dof_p, p[i]);
     }
     
     for (int i=0; i<40; ++i)
     {
         FENode& node = mesh.Node(i);
-        node.m_rt = node.m_r0;
+        node.m_rt() = node.m_r0();
     }
     
     // get the material
@@ -33,7 +33,10 @@ SOFTWARE.*/
 #include <FECore/FEMaterial.h>
 #include <FECore/FEDomain.h>
 #include <FECore/FEShellDomain.h>
+#include <FECore/FEElementLibrary.h>
+#include <FECore/FEElementTraits.h>
 #include <FECore/log.h>
+#include <algorithm>
 
 //=============================================================================
 FEBModel::NodeSet::NodeSet() {}
@@ -219,6 +222,7 @@ FEBModel::Surface* FEBModel::Part::FindSurface(const string& name)
 //=============================================================================
 FEBModel::FEBModel()
 {
+	m_breorder = false;
 }
 
 FEBModel::~FEBModel()
@@ -284,6 +288,20 @@ bool FEBModel::BuildPart(FEModel& fem, Part& part, const FETransform& T)
 		NLT[nid] = i + N0;
 	}
 
+	// See if we need to reorder the nodes. 
+	// order[i] is the part node that will be stored at position i.
+	vector<int> order;
+	if (m_breorder && (NN > 0))
+	{
+		vector<int> PLT(NLT.size(), -1);
+		for (size_t i=0; i<NLT.size(); ++i) if (NLT[i] >= 0) PLT[i] = NLT[i] - N0;
+		ReorderPartNodes(part, PLT, noff, order);
+		for (int i=0; i<NN; ++i) NLT[part.GetNode(order[i]).id - noff] = i + N0;
+
+		// let the mesh know, so that output can be written in user order
+		mesh.SetReordered(true);
+	}
+
 	// build element-index lookup table
 	int eoff = -1; maxID = 0;
 	int E0 = mesh.Elements();
@@ -313,17 +331,18 @@ bool FEBModel::BuildPart(FEModel& fem, Part& part, const FETransform& T)
 	}
 
 	// create the nodes
-	int nid = N0;
+	// (the node ID is always based on the part order, not the storage order)
 	mesh.AddNodes(NN);
 	int n = 0;
 	for (int j = 0; j<NN; ++j)
 	{
-		NODE& partNode = part.GetNode(j);
+		int m = (order.empty() ? j : order[j]);
+		NODE& partNode = part.GetNode(m);
 		FENode& meshNode = mesh.Node(N0 + n++);
 
-		meshNode.SetID(++nid);
-		meshNode.m_r0 = T.Transform(partNode.r);
-		meshNode.m_rt = meshNode.m_r0;
+		meshNode.SetID(N0 + m + 1);
+		meshNode.m_r0() = T.Transform(partNode.r);
+		meshNode.m_rt() = meshNode.m_r0();
 	}
 	assert(n == NN);
 
@@ -362,17 +381,38 @@ bool FEBModel::BuildPart(FEModel& fem, Part& part, const FETransform& T)
 		string domName = partName + partDomain.Name();
 		dom->SetName(domName);
 
+		// When reordering, the elements are sorted by their lowest node index, 
+		// so that neighboring elements share nodes that are close in memory.
+		vector<int> elemOrder(elems);
+		for (int j = 0; j<elems; ++j) elemOrder[j] = j;
+		if (m_breorder && (elems > 0))
+		{
+			int ne = dom->ElementRef(0).Nodes();
+			vector<int> key(elems);
+			for (int j = 0; j<elems; ++j)
+			{
+				const ELEMENT& domElement = partDomain.GetElement(j);
+				int nmin = NLT[domElement.node[0] - noff];
+				for (int n = 1; n<ne; ++n) nmin = std::min(nmin, NLT[domElement.node[n] - noff]);
+				key[j] = nmin;
+			}
+			std::stable_sort(elemOrder.begin(), elemOrder.end(), [&key](int a, int b) { return key[a] < key[b]; });
+		}
+
 		// process element data
+		// (as for nodes, the element ID is based on the part order)
 		for (int j = 0; j<elems; ++j)
 		{
-			const ELEMENT& domElement = partDomain.GetElement(j);
+			int m = elemOrder[j];
+			const ELEMENT& domElement = partDomain.GetElement(m);
 
 			FEElement& el = dom->ElementRef(j);
-			el.SetID(++eid);
+			el.SetID(eid + m + 1);
 
 			int ne = el.Nodes();
 			for (int n = 0; n<ne; ++n) el.m_node[n] = NLT[domElement.node[n] - noff];
 		}
+		eid += elems;
 
 		if (partDomain.m_defaultShellThickness != 0.0)
 		{
@@ -465,7 +505,19 @@ bool FEBModel::BuildPart(FEModel& fem, Part& part, const FETransform& T)
 		feset->SetName(name);
 
 		FEDomain* dom = mesh.FindDomain(name);
-		if (dom) feset->Create(dom);
+		if (dom)
+		{
+			if (m_breorder)
+			{
+				// keep the set in user order, since data maps refer to its local indices
+				int NE = dom->Elements();
+				vector<int> domList(NE);
+				for (int j = 0; j < NE; ++j) domList[j] = dom->ElementRef(j).GetID();
+				std::sort(domList.begin(), domList.end());
+				feset->Create(dom, domList);
+			}
+			else feset->Create(dom);
+		}
 		else feset->Create(elist);
 
 		mesh.AddElementSet(feset);
@@ -515,3 +567,128 @@ bool FEBModel::BuildPart(FEModel& fem, Part& part, const FETransform& T)
 
 	return true;
 }
+
+//-----------------------------------------------------------------------------
+// helper function for ReorderPartNodes. Does a breadth-first search from node n0, 
+// visiting only nodes whose tag is not equal to ntag. Returns the depth of the level
+// structure and the node of minimal degree in the last level.
+static int bfs_last_level(const vector< vector<int> >& NNL, int n0, vector<int>& tag, int ntag, vector<int>& queue, int& nlast)
+{
+	queue.clear();
+	vector<int> level;
+	queue.push_back(n0); tag[n0] = ntag;
+	level.push_back(0);
+	nlast = n0;
+	int depth = 0;
+	for (size_t i = 0; i < queue.size(); ++i)
+	{
+		int n = queue[i];
+		int l = level[i];
+		if (l > depth)
+		{
+			depth = l;
+			nlast = n;
+		}
+		else if ((l == depth) && (NNL[n].size() < NNL[nlast].size())) nlast = n;
+
+		const vector<int>& nl = NNL[n];
+		for (size_t j = 0; j < nl.size(); ++j)
+		{
+			int m = nl[j];
+			if (tag[m] != ntag)
+			{
+				tag[m] = ntag;
+				queue.push_back(m);
+				level.push_back(l + 1);
+			}
+		}
+	}
+	return depth;
+}
+
+//-----------------------------------------------------------------------------
+// Calculates a reverse Cuthill-McKee ordering of the part's nodes, based on the 
+// element connectivity of its domains. PLT maps a node ID (minus noff) to the 
+// part's node index. On return, order[i] is the part node stored at position i.
+void FEBModel::ReorderPartNodes(Part& part, const vector<int>& PLT, int noff, vector<int>& order)
+{
+	int NN = part.Nodes();
+
+	// build the node-node adjacency
+	vector< vector<int> > NNL(NN);
+	for (int i = 0; i < part.Domains(); ++i)
+	{
+		const Domain& dom = part.GetDomain(i);
+		FEElementTraits* traits = FEElementLibrary::GetElementTraits(dom.ElementSpec().etype);
+		if (traits == nullptr) continue;
+		int neln = traits->m_neln;
+
+		for (int j = 0; j < dom.Elements(); ++j)
+		{
+			const ELEMENT& el = dom.GetElement(j);
+			for (int a = 0; a < neln; ++a)
+			{
+				int na = PLT[el.node[a] - noff];
+				for (int b = 0; b < neln; ++b)
+				{
+					int nb = PLT[el.node[b] - noff];
+					if (na != nb) NNL[na].push_back(nb);
+				}
+			}
+		}
+	}
+	for (int i = 0; i < NN; ++i)
+	{
+		vector<int>& nl = NNL[i];
+		std::sort(nl.begin(), nl.end());
+		nl.erase(std::unique(nl.begin(), nl.end()), nl.end());
+	}
+
+	// process each connected component
+	order.clear();
+	order.reserve(NN);
+	vector<int> tag(NN, -1), queue;
+	vector<bool> visited(NN, false);
+	int ntag = 0;
+	for (int i = 0; i < NN; ++i)
+	{
+		if (visited[i]) continue;
+
+		// find a pseudo-peripheral node of this component
+		int root = i, nlast;
+		int depth = bfs_last_level(NNL, root, tag, ntag++, queue, nlast);
+		for (int k = 0; k < 5; ++k)
+		{
+			int nnext;
+			int d = bfs_last_level(NNL, nlast, tag, ntag++, queue, nnext);
+			if (d <= depth) break;
+			root = nlast;
+			nlast = nnext;
+			depth = d;
+		}
+
+		// Cuthill-McKee ordering from the root, visiting neighbors in order of increasing degree
+		size_t n0 = order.size();
+		order.push_back(root);
+		visited[root] = true;
+		for (size_t k = n0; k < order.size(); ++k)
+		{
+			const vector<int>& nl = NNL[order[k]];
+			size_t m0 = order.size();
+			for (size_t j = 0; j < nl.size(); ++j)
+			{
+				int m = nl[j];
+				if (visited[m] == false)
+				{
+					visited[m] = true;
+					order.push_back(m);
+				}
+			}
+			std::stable_sort(order.begin() + m0, order.end(), [&NNL](int a, int b) { return NNL[a].size() < NNL[b].size(); });
+		}
+
+		// reverse it
+		std::reverse(order.begin() + n0, order.end());
+	}
+	assert((int)order.size() == NN);
+}
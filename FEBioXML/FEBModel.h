@@ -262,6 +262,16 @@ public:
 
 	bool BuildPart(FEModel& fem, Part& part, const FETransform& T = FETransform());
 
+public:
+	// When set, BuildPart will store the nodes and elements of a part in a 
+	// cache-friendly order. The node and element IDs remain in user numbering.
+	void SetMeshReordering(bool b) { m_breorder = b; }
+	bool MeshReordering() const { return m_breorder; }
+
+private:
+	void ReorderPartNodes(Part& part, const vector<int>& PLT, int noff, vector<int>& order);
+
 private:
 	std::vector<Part*>	m_Part;
+	bool				m_breorder;	//!< reorder nodes and elements for data locality
 };
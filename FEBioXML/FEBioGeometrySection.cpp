@@ -88,9 +88,9 @@ void FEBioGeometrySection1x::ParseNodeSection(XMLTag& tag)
 	int N0 = mesh.Nodes();
 
 	// get the largest nodal ID
-	// (It is assumed that nodes are sorted by ID so the last node should have the largest ID)
+	// (The last node does not necessarily have the largest ID, e.g. when the mesh was reordered)
 	int max_id = 0;
-	if (N0 > 0) max_id = mesh.Node(N0 - 1).GetID();
+	for (int i = 0; i < N0; ++i) if (mesh.Node(i).GetID() > max_id) max_id = mesh.Node(i).GetID();
 
 	// first we need to figure out how many nodes there are
 	XMLTag t(tag);
@@ -115,8 +115,8 @@ void FEBioGeometrySection1x::ParseNodeSection(XMLTag& tag)
 	for (int i = 0; i<nodes; ++i)
 	{
 		FENode& node = mesh.Node(N0 + i);
-		value(tag, node.m_r0);
-		node.m_rt = node.m_r0;
+		value(tag, node.m_r0());
+		node.m_rt() = node.m_r0();
 
 		// get the nodal ID
 		int nid = -1;
@@ -524,9 +524,9 @@ void FEBioGeometrySection2::ParseNodeSection(XMLTag& tag)
 	int N0 = mesh.Nodes();
 
 	// get the largest nodal ID
-	// (It is assumed that nodes are sorted by ID so the last node should have the largest ID)
+	// (The last node does not necessarily have the largest ID, e.g. when the mesh was reordered)
 	int max_id = 0;
-	if (N0 > 0) max_id = mesh.Node(N0 - 1).GetID();
+	for (int i = 0; i < N0; ++i) if (mesh.Node(i).GetID() > max_id) max_id = mesh.Node(i).GetID();
 
 	// first we need to figure out how many nodes there are
 	XMLTag t(tag);
@@ -551,8 +551,8 @@ void FEBioGeometrySection2::ParseNodeSection(XMLTag& tag)
 	for (int i = 0; i<nodes; ++i)
 	{
 		FENode& node = mesh.Node(N0 + i);
-		value(tag, node.m_r0);
-		node.m_rt = node.m_r0;
+		value(tag, node.m_r0());
+		node.m_rt() = node.m_r0();
 
 		// get the nodal ID
 		int nid = -1;
@@ -987,6 +987,15 @@ void FEBioGeometrySection25::Parse(XMLTag& tag)
 	FEModelBuilder* feb = GetBuilder();
 	feb->m_maxid = 0;
 
+	// see if the mesh should be reordered
+	const char* szreorder = tag.AttributeValue("reorder", true);
+	if (szreorder)
+	{
+		if      (strcmp(szreorder, "true" ) == 0) m_feb.SetMeshReordering(true);
+		else if (strcmp(szreorder, "false") == 0) m_feb.SetMeshReordering(false);
+		else throw XMLReader::InvalidAttributeValue(tag, "reorder", szreorder);
+	}
+
 	// read all sections
 	++tag;
 	do
@@ -1179,9 +1188,9 @@ void FEBioGeometrySection25::ParseNodeSection(XMLTag& tag)
 	int N0 = mesh.Nodes();
 
 	// get the largest nodal ID
-	// (It is assumed that nodes are sorted by ID so the last node should have the largest ID)
+	// (The last node does not necessarily have the largest ID, e.g. when the mesh was reordered)
 	int max_id = 0;
-	if (N0 > 0) max_id = mesh.Node(N0 - 1).GetID();
+	for (int i = 0; i < N0; ++i) if (mesh.Node(i).GetID() > max_id) max_id = mesh.Node(i).GetID();
 
 	// first we need to figure out how many nodes there are
 	XMLTag t(tag);
@@ -1206,8 +1215,8 @@ void FEBioGeometrySection25::ParseNodeSection(XMLTag& tag)
 	for (int i = 0; i<nodes; ++i)
 	{
 		FENode& node = mesh.Node(N0 + i);
-		value(tag, node.m_r0);
-		node.m_rt = node.m_r0;
+		value(tag, node.m_r0());
+		node.m_rt() = node.m_r0();
 
 		// get the nodal ID
 		int nid = -1;
@@ -53,6 +53,15 @@ void FEBioMeshSection::Parse(XMLTag& tag)
 	assert(feb.Parts() == 0);
 	FEBModel::Part* part = feb.AddPart("");
 
+	// see if the mesh should be reordered
+	const char* szreorder = tag.AttributeValue("reorder", true);
+	if (szreorder)
+	{
+		if      (strcmp(szreorder, "true" ) == 0) feb.SetMeshReordering(true);
+		else if (strcmp(szreorder, "false") == 0) feb.SetMeshReordering(false);
+		else throw XMLReader::InvalidAttributeValue(tag, "reorder", szreorder);
+	}
+
 	// read all sections
 	++tag;
 	do
@@ -428,6 +437,17 @@ void FEBioMeshDomainsSection::ParseSolidDomainSection(XMLTag& tag)
 		else throw XMLReader::InvalidAttributeValue(tag, "three_field", sz3field);
 	}
 
+	// see if the reference gradients should be cached
+	const char* szcache = tag.AttributeValue("cache_gradients", true);
+	if (szcache)
+	{
+		FE_Element_Spec espec = partDomain->ElementSpec();
+		if      (strcmp(szcache, "on" ) == 0) espec.m_bcache_grad0 = true;
+		else if (strcmp(szcache, "off") == 0) espec.m_bcache_grad0 = false;
+		else throw XMLReader::InvalidAttributeValue(tag, "cache_gradients", szcache);
+		partDomain->SetElementSpec(espec);
+	}
+
 	// read additional parameters
 	if (tag.isleaf() == false)
 	{
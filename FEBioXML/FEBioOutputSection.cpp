@@ -132,6 +132,16 @@ void FEBioOutputSection::ParseLogfile(XMLTag &tag)
 				else if (strcmp(sz, "off") == 0) prec->SetComments(false); 
 			}
 
+			sz = tag.AttributeValue("binary", true);
+			if (sz != 0)
+			{
+				bool b = false;
+				if      (strcmp(sz, "on" ) == 0) b = true;
+				else if (strcmp(sz, "off") == 0) b = false;
+				else throw XMLReader::InvalidAttributeValue(tag, "binary", sz);
+				if (prec->SetBinary(b) == false) throw XMLReader::InvalidAttributeValue(tag, "binary", sz);
+			}
+
 			const char* sztmp = "set";
 			if (GetFileReader()->GetFileVersion() >= 0x0205) sztmp = "node_set";
 			sz = tag.AttributeValue(sztmp, true);
@@ -182,6 +192,16 @@ void FEBioOutputSection::ParseLogfile(XMLTag &tag)
 				else if (strcmp(sz, "off") == 0) prec->SetComments(false); 
 			}
 
+			sz = tag.AttributeValue("binary", true);
+			if (sz != 0)
+			{
+				bool b = false;
+				if      (strcmp(sz, "on" ) == 0) b = true;
+				else if (strcmp(sz, "off") == 0) b = false;
+				else throw XMLReader::InvalidAttributeValue(tag, "binary", sz);
+				if (prec->SetBinary(b) == false) throw XMLReader::InvalidAttributeValue(tag, "binary", sz);
+			}
+
 			const char* sztmp = "elset";
 			if (GetFileReader()->GetFileVersion() >= 0x0205) sztmp = "elem_set";
 
@@ -233,6 +253,16 @@ void FEBioOutputSection::ParseLogfile(XMLTag &tag)
 				else if (strcmp(sz, "off") == 0) prec->SetComments(false); 
 			}
 
+			sz = tag.AttributeValue("binary", true);
+			if (sz != 0)
+			{
+				bool b = false;
+				if      (strcmp(sz, "on" ) == 0) b = true;
+				else if (strcmp(sz, "off") == 0) b = false;
+				else throw XMLReader::InvalidAttributeValue(tag, "binary", sz);
+				if (prec->SetBinary(b) == false) throw XMLReader::InvalidAttributeValue(tag, "binary", sz);
+			}
+
 			prec->SetItemList(tag.szvalue());
 
 			GetFEBioImport()->AddDataRecord(prec);
@@ -273,6 +303,16 @@ void FEBioOutputSection::ParseLogfile(XMLTag &tag)
                 if      (strcmp(sz, "on") == 0) prec->SetComments(true);
                 else if (strcmp(sz, "off") == 0) prec->SetComments(false); 
             }
+
+            sz = tag.AttributeValue("binary", true);
+            if (sz != 0)
+            {
+                bool b = false;
+                if      (strcmp(sz, "on" ) == 0) b = true;
+                else if (strcmp(sz, "off") == 0) b = false;
+                else throw XMLReader::InvalidAttributeValue(tag, "binary", sz);
+                if (prec->SetBinary(b) == false) throw XMLReader::InvalidAttributeValue(tag, "binary", sz);
+            }
             
             prec->SetItemList(tag.szvalue());
             
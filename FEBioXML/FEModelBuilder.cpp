@@ -403,11 +403,17 @@ FEModelBuilder::NodeSetSet* FEModelBuilder::FindNodeSetSet(const char* szname)
 void FEModelBuilder::BuildNodeList()
 {
 	// find the min, max ID
-	// (We assume that they are given by the first and last node)
+	// (Note that these are not necessarily the first and last node, e.g. when the mesh was reordered)
 	FEMesh& mesh = m_fem.GetMesh();
 	int NN = mesh.Nodes();
 	int nmin = mesh.Node(0).GetID();
-	int nmax = mesh.Node(NN - 1).GetID();
+	int nmax = nmin;
+	for (int i = 1; i<NN; ++i)
+	{
+		int nid = mesh.Node(i).GetID();
+		if (nid < nmin) nmin = nid;
+		if (nid > nmax) nmax = nid;
+	}
 	assert(nmax >= nmin);
 
 	// get the range
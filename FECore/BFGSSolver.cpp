@@ -58,8 +58,14 @@ bool BFGSSolver::Init()
 	int neq = m_pns->m_neq;
 
 	// allocate storage for BFGS update vectors
-	m_V.resize(m_max_buf_size, neq);
-	m_W.resize(m_max_buf_size, neq);
+	// (the vectors themselves are allocated in Update)
+	m_V.resize(m_max_buf_size);
+	m_W.resize(m_max_buf_size);
+	for (int i = 0; i < m_max_buf_size; ++i)
+	{
+		if (m_V[i].size() != neq) vector<double>().swap(m_V[i]);
+		if (m_W[i].size() != neq) vector<double>().swap(m_W[i]);
+	}
 
 	m_D.resize(neq);
 	m_G.resize(neq);
@@ -87,6 +93,7 @@ bool BFGSSolver::Update(double s, vector<double>& ui, vector<double>& R0, vector
 {
 	// calculate the BFGS update vectors
 	int neq = m_neq;
+#pragma omp parallel for
 	for (int i = 0; i<neq; ++i)
 	{
 		m_D[i] = s*ui[i];
@@ -94,8 +101,8 @@ bool BFGSSolver::Update(double s, vector<double>& ui, vector<double>& R0, vector
 		m_H[i] = R0[i]*s;
 	}
 
-	double dg = m_D*m_G;
-	double dh = m_D*m_H;
+	double dg = vdot(neq, &m_D[0], &m_G[0]);
+	double dh = vdot(neq, &m_D[0], &m_H[0]);
 	double dgi = 1.0 / dg;
 	double r = dg / dh;
 
@@ -118,9 +125,13 @@ bool BFGSSolver::Update(double s, vector<double>& ui, vector<double>& R0, vector
 	// do the update only when allowed
 	if ((m_nups < m_max_buf_size) || (m_cycle_buffer == true))
 	{
-		double* vn = m_V[n];
-		double* wn = m_W[n];
+		if (m_V[n].size() != neq) m_V[n].resize(neq);
+		if (m_W[n].size() != neq) m_W[n].resize(neq);
+
+		double* vn = &m_V[n][0];
+		double* wn = &m_W[n][0];
 
+#pragma omp parallel for
 		for (int i=0; i<neq; ++i)	
 		{
 			vn[i] = -m_H[i]*c - m_G[i];
@@ -158,17 +169,23 @@ void BFGSSolver::SolveEquations(vector<double>& x, vector<double>& b)
 	}
 
 	// loop over all update vectors
-	for (int i=nups-1; i>=0; --i)
+	// The update of tmp with vector i is fused with the dot product for vector i-1.
+	if (nups > 0)
 	{
-		int n = (n0 + i) % m_max_buf_size;
-
-		double* vi = m_V[n];
-		double* wi = m_W[n];
-
-		double wr = 0;
-		for (int j = 0; j<m_neq; j++) wr += wi[j] * tmp[j];
-
-		for (int j = 0; j<m_neq; j++) tmp[j] += vi[j] * wr;
+		int nl = (n0 + nups - 1) % m_max_buf_size;
+		double wr = vdot(m_neq, &m_W[nl][0], &tmp[0]);
+		for (int i = nups - 1; i >= 0; --i)
+		{
+			int n = (n0 + i) % m_max_buf_size;
+			const double* vi = &m_V[n][0];
+
+			if (i > 0)
+			{
+				int m = (n0 + i - 1) % m_max_buf_size;
+				wr = vaxpy_dot(m_neq, wr, vi, &tmp[0], &m_W[m][0]);
+			}
+			else vaxpy(m_neq, wr, vi, &tmp[0]);
+		}
 	}
 
 	// perform a backsubstitution
@@ -178,16 +195,30 @@ void BFGSSolver::SolveEquations(vector<double>& x, vector<double>& b)
 	}
 
 	// loop again over all update vectors
-	for (int i = 0; i<nups; ++i)
+	// The update of x with vector i is fused with the dot product for vector i+1.
+	if (nups > 0)
 	{
-		int n = (n0 + i) % m_max_buf_size;
-
-		double* vi = m_V[n];
-		double* wi = m_W[n];
-
-		double vr = 0;
-		for (int j = 0; j<m_neq; ++j) vr += vi[j] * x[j];
-
-		for (int j = 0; j<m_neq; ++j) x[j] += wi[j] * vr;
+		double vr = vdot(m_neq, &m_V[n0][0], &x[0]);
+		for (int i = 0; i < nups; ++i)
+		{
+			int n = (n0 + i) % m_max_buf_size;
+			const double* wi = &m_W[n][0];
+
+			if (i < nups - 1)
+			{
+				int m = (n0 + i + 1) % m_max_buf_size;
+				vr = vaxpy_dot(m_neq, vr, wi, &x[0], &m_V[m][0]);
+			}
+			else vaxpy(m_neq, vr, wi, &x[0]);
+		}
 	}
 }
+
+//-----------------------------------------------------------------------------
+size_t BFGSSolver::UpdateMemory() const
+{
+	size_t mem = 0;
+	for (size_t i = 0; i < m_V.size(); ++i) mem += m_V[i].capacity() * sizeof(double);
+	for (size_t i = 0; i < m_W.size(); ++i) mem += m_W[i].capacity() * sizeof(double);
+	return mem;
+}
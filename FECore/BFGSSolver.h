@@ -52,14 +52,19 @@ public:
 	//! solve the equations
 	void SolveEquations(vector<double>& x, vector<double>& b) override;
 
+	//! return the memory used by the update vectors
+	size_t UpdateMemory() const override;
+
 public:
 	// keep a pointer to the linear solver
 	LinearSolver*	m_plinsolve;	//!< pointer to linear solver
 	int				m_neq;		//!< number of equations
 
 	// BFGS update vectors
-	matrix			m_V;		//!< BFGS update vector
-	matrix			m_W;		//!< BFGS update vector
+	// These are stored in a ring buffer of m_max_buf_size vectors. The vectors
+	// are allocated when they are first needed.
+	vector< vector<double> >	m_V;		//!< BFGS update vector
+	vector< vector<double> >	m_W;		//!< BFGS update vector
 	vector<double>	m_D, m_G, m_H;	//!< temp vectors for calculating BFGS update vectors
 
 	vector<double>	tmp;
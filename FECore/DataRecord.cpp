@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "DataRecord.h"
+#include "DataRecordReader.h"
 #include "DumpStream.h"
 #include "FEModel.h"
 #include "FEAnalysis.h"
@@ -51,6 +52,8 @@ DataRecord::DataRecord(FEModel* pfem, const char* szfile, int ntype) : m_type(nt
 	strcpy(m_szdelim, " ");
 	
 	m_bcomm = true;
+	m_bbinary = false;
+	m_bheader = false;
 
 	m_fp = 0;
 	m_szfile[0] = 0;
@@ -91,6 +94,24 @@ void DataRecord::SetFormat(const char* sz)
 	strcpy(m_szfmt, sz);
 }
 
+//-----------------------------------------------------------------------------
+bool DataRecord::SetBinary(bool b)
+{
+	// binary data can only be written to a separate data file
+	if (b && (m_szfile[0] == 0)) return false;
+	if (b == m_bbinary) return true;
+
+	// reopen the file in the correct mode
+	// (nothing was written to the file yet)
+	if (m_fp) fclose(m_fp);
+	m_fp = fopen(m_szfile, (b ? "wb" : "wt"));
+	if (m_fp == 0) feLogErrorEx(m_pfem, "FAILED CREATING DATA FILE %s\n\n", m_szfile);
+
+	m_bbinary = b;
+	m_bheader = false;
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 bool DataRecord::Initialize()
 {
@@ -98,6 +119,90 @@ bool DataRecord::Initialize()
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Evaluate all the data for all the items. The values are stored per field,
+// i.e. the value of field j for item i is stored in m_val[j*items + i].
+void DataRecord::evaluateItems()
+{
+	PrepareEvaluation();
+
+	int nitems = (int)m_item.size();
+	int ndata = Size();
+	m_val.resize((size_t)nitems*ndata);
+	if (ParallelEvaluation())
+	{
+#pragma omp parallel for
+		for (int i = 0; i < nitems; ++i)
+		{
+			for (int j = 0; j < ndata; ++j) m_val[(size_t)j*nitems + i] = Evaluate(m_item[i], j);
+		}
+	}
+	else
+	{
+		for (int i = 0; i < nitems; ++i)
+		{
+			for (int j = 0; j < ndata; ++j) m_val[(size_t)j*nitems + i] = Evaluate(m_item[i], j);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+static void fwrite_string(const char* sz, FILE* fp)
+{
+	int l = (int)strlen(sz);
+	fwrite(&l, sizeof(int), 1, fp);
+	if (l > 0) fwrite(sz, 1, l, fp);
+}
+
+//-----------------------------------------------------------------------------
+void DataRecord::writeBinaryHeader()
+{
+	FILE* fp = m_fp;
+	unsigned int magic = DRF_MAGIC, version = DRF_VERSION;
+	int nitems = (int)m_item.size();
+	int ndata = Size();
+	fwrite(&magic  , sizeof(unsigned int), 1, fp);
+	fwrite(&version, sizeof(unsigned int), 1, fp);
+	fwrite(&m_type , sizeof(int), 1, fp);
+	fwrite(&ndata  , sizeof(int), 1, fp);
+	fwrite(&nitems , sizeof(int), 1, fp);
+	fwrite_string(m_szname, fp);
+
+	// the field names are taken from the data expression
+	char szcopy[MAX_STRING] = { 0 };
+	strcpy(szcopy, m_szdata);
+	char* sz = szcopy;
+	for (int j = 0; j < ndata; ++j)
+	{
+		char* ch = (sz ? strchr(sz, ';') : 0);
+		if (ch) *ch++ = 0;
+
+		int ntype = DRF_FLOAT64;
+		fwrite(&ntype, sizeof(int), 1, fp);
+		fwrite_string(sz ? sz : "", fp);
+		sz = ch;
+	}
+
+	if (nitems > 0) fwrite(&m_item[0], sizeof(int), nitems, fp);
+
+	m_bheader = true;
+}
+
+//-----------------------------------------------------------------------------
+void DataRecord::writeBinaryStep(int nstep, double time)
+{
+	FILE* fp = m_fp;
+	if (m_bheader == false) writeBinaryHeader();
+
+	unsigned int tag = DRF_STEP;
+	int nitems = (int)m_item.size();
+	fwrite(&tag   , sizeof(unsigned int), 1, fp);
+	fwrite(&nstep , sizeof(int), 1, fp);
+	fwrite(&time  , sizeof(double), 1, fp);
+	fwrite(&nitems, sizeof(int), 1, fp);
+	if (m_val.empty() == false) fwrite(&m_val[0], sizeof(double), m_val.size(), fp);
+}
+
 //-----------------------------------------------------------------------------
 std::string DataRecord::printToString(int i)
 {
@@ -106,9 +211,10 @@ std::string DataRecord::printToString(int i)
 
 	ss << m_item[i] << m_szdelim;
 	int nd = Size();
+	int nitems = (int)m_item.size();
 	for (int j = 0; j<nd; ++j)
 	{
-		double val = Evaluate(m_item[i], j);
+		double val = m_val[(size_t)j*nitems + i];
 		ss << val;
 		if (j != nd - 1) ss << m_szdelim;
 		else ss << "\n";
@@ -121,6 +227,7 @@ std::string DataRecord::printToString(int i)
 std::string DataRecord::printToFormatString(int i)
 {
 	int ndata = Size();
+	int nitems = (int)m_item.size();
 	char szfmt[MAX_STRING];
 	strcpy(szfmt, m_szfmt);
 
@@ -155,7 +262,7 @@ std::string DataRecord::printToFormatString(int i)
 				*ch = '%'; sz = ch + 2;
 				if (j<ndata)
 				{
-					double val = Evaluate(nitem, j++);
+					double val = m_val[(size_t)(j++)*nitems + i];
 					ss << val;
 				}
 			}
@@ -200,8 +307,22 @@ bool DataRecord::Write()
 	feLogEx(m_pfem, "Time = %.9lg\n", ftime);
 	feLogEx(m_pfem, "Data = %s\n", m_szname);
 
-	// write some comments
+	// evaluate the data
+	evaluateItems();
+
+	// binary data is written in one block per time step
 	FILE* fp = m_fp;
+	if (m_bbinary)
+	{
+		if (fp)
+		{
+			writeBinaryStep(nstep, ftime);
+			fflush(fp);
+		}
+		return true;
+	}
+
+	// write some comments
 	if (fp && m_bcomm)
 	{
 		// we save the data in a seperate file
@@ -323,6 +444,7 @@ void DataRecord::Serialize(DumpStream &ar)
 	ar & m_bcomm;
 	ar & m_item;
 	ar & m_szdata;
+	ar & m_bbinary;
 
 	// when we're loading we need to reinitialize the file
 	if (ar.IsLoading())
@@ -334,7 +456,10 @@ void DataRecord::Serialize(DumpStream &ar)
 		if (m_szfile[0] != 0)
 		{
 			// reopen data file for appending
-			m_fp = fopen(m_szfile, "a+");
+			m_fp = fopen(m_szfile, (m_bbinary ? "ab" : "a+"));
 		}
+
+		// the binary header was written before the restart
+		m_bheader = m_bbinary;
 	}
 }
@@ -71,6 +71,9 @@ public:
 	void SetFormat(const char* sz);
 	void SetComments(bool b) { m_bcomm = b; }
 
+	//! Write the data in binary format (requires a data file)
+	bool SetBinary(bool b);
+
 public:
 	virtual bool Initialize();
 	virtual double Evaluate(int item, int ndata) = 0;
@@ -79,7 +82,19 @@ public:
 	virtual void Parse(const char* sz) = 0;
 	virtual int Size() const = 0;
 
+protected:
+	//! This is called before the items are evaluated. Derived classes should build
+	//! their lookup tables here, since Evaluate may be called from multiple threads.
+	virtual void PrepareEvaluation() {}
+
+	//! Return true if Evaluate can be called in parallel for different items
+	virtual bool ParallelEvaluation() const { return false; }
+
 private:
+	void evaluateItems();
+	void writeBinaryHeader();
+	void writeBinaryStep(int nstep, double time);
+
 	std::string printToString(int i);
 	std::string printToFormatString(int i);
 
@@ -94,6 +109,10 @@ protected:
 	char	m_szdelim[MAX_DELIM];	//!< data delimitor
 	char	m_szdata[MAX_STRING];	//!< data expression
 	char	m_szfmt[MAX_STRING];	//!< max format string
+	bool	m_bbinary;				//!< write data in binary format
+	bool	m_bheader;				//!< binary header was written
+
+	std::vector<double>	m_val;		//!< evaluated values, stored per field
 
 protected:
 	char	m_szfile[MAX_STRING];	//!< file name of data record
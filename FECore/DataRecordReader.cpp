@@ -0,0 +1,157 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#include "stdafx.h"
+#include "DataRecordReader.h"
+
+//-----------------------------------------------------------------------------
+DataRecordReader::DataRecordReader()
+{
+	m_fp = 0;
+	m_ntype = 0;
+}
+
+//-----------------------------------------------------------------------------
+DataRecordReader::~DataRecordReader()
+{
+	Close();
+}
+
+//-----------------------------------------------------------------------------
+void DataRecordReader::Close()
+{
+	if (m_fp) fclose(m_fp);
+	m_fp = 0;
+	m_ntype = 0;
+	m_name.clear();
+	m_field.clear();
+	m_item.clear();
+}
+
+//-----------------------------------------------------------------------------
+bool DataRecordReader::readString(std::string& s)
+{
+	int l = 0;
+	if (fread(&l, sizeof(int), 1, m_fp) != 1) return false;
+	if (l < 0) return false;
+	s.resize(l);
+	if ((l > 0) && (fread(&s[0], 1, l, m_fp) != (size_t)l)) return false;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool DataRecordReader::Open(const char* szfile)
+{
+	Close();
+	m_fp = fopen(szfile, "rb");
+	if (m_fp == 0) return false;
+
+	// check the magic number and version
+	unsigned int magic = 0, version = 0;
+	if ((fread(&magic, sizeof(unsigned int), 1, m_fp) != 1) || (magic != DRF_MAGIC)) { Close(); return false; }
+	if ((fread(&version, sizeof(unsigned int), 1, m_fp) != 1) || (version != DRF_VERSION)) { Close(); return false; }
+
+	// read the record info
+	int nfields = 0, nitems = 0;
+	if (fread(&m_ntype , sizeof(int), 1, m_fp) != 1) { Close(); return false; }
+	if (fread(&nfields, sizeof(int), 1, m_fp) != 1) { Close(); return false; }
+	if (fread(&nitems , sizeof(int), 1, m_fp) != 1) { Close(); return false; }
+	if ((nfields < 0) || (nitems < 0)) { Close(); return false; }
+	if (readString(m_name) == false) { Close(); return false; }
+
+	// read the fields
+	m_field.resize(nfields);
+	for (int i = 0; i < nfields; ++i)
+	{
+		int ntype = -1;
+		if ((fread(&ntype, sizeof(int), 1, m_fp) != 1) || (ntype != DRF_FLOAT64)) { Close(); return false; }
+		if (readString(m_field[i]) == false) { Close(); return false; }
+	}
+
+	// read the item IDs
+	m_item.resize(nitems);
+	if ((nitems > 0) && (fread(&m_item[0], sizeof(int), nitems, m_fp) != (size_t)nitems)) { Close(); return false; }
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool DataRecordReader::NextStep(int& nstep, double& time, std::vector<double>& data)
+{
+	if (m_fp == 0) return false;
+
+	unsigned int tag = 0;
+	if ((fread(&tag, sizeof(unsigned int), 1, m_fp) != 1) || (tag != DRF_STEP)) return false;
+
+	int nitems = 0;
+	if (fread(&nstep, sizeof(int), 1, m_fp) != 1) return false;
+	if (fread(&time, sizeof(double), 1, m_fp) != 1) return false;
+	if ((fread(&nitems, sizeof(int), 1, m_fp) != 1) || (nitems != Items())) return false;
+
+	size_t N = (size_t)Fields()*(size_t)Items();
+	data.resize(N);
+	if ((N > 0) && (fread(&data[0], sizeof(double), N, m_fp) != N)) return false;
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// The CSV file has one row per item and time step, with the columns:
+// step, time, item, field1, field2, ...
+bool DataRecordReader::ExportCSV(const char* szfile)
+{
+	if (m_fp == 0) return false;
+
+	FILE* fp = fopen(szfile, "wt");
+	if (fp == 0) return false;
+
+	fprintf(fp, "step,time,item");
+	for (int j = 0; j < Fields(); ++j) fprintf(fp, ",%s", m_field[j].c_str());
+	fprintf(fp, "\n");
+
+	int nstep;
+	double time;
+	std::vector<double> data;
+	int NI = Items();
+	int NF = Fields();
+	while (NextStep(nstep, time, data))
+	{
+		for (int i = 0; i < NI; ++i)
+		{
+			fprintf(fp, "%d,%.9lg,%d", nstep, time, m_item[i]);
+			for (int j = 0; j < NF; ++j) fprintf(fp, ",%.12lg", data[j*NI + i]);
+			fprintf(fp, "\n");
+		}
+	}
+
+	fclose(fp);
+
+	return true;
+}
@@ -0,0 +1,105 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#pragma once
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "fecore_api.h"
+
+//-----------------------------------------------------------------------------
+// Layout of the binary data files that are written by data records when the 
+// binary output option is used. All values are stored in native byte order.
+//
+// header:
+//   uint32  magic number (DRF_MAGIC)
+//   uint32  version number (DRF_VERSION)
+//   int32   record type (FE_DATA_NODE, FE_DATA_ELEM, ...)
+//   int32   number of fields (nfields)
+//   int32   number of items (nitems)
+//   string  record name
+//   nfields x (int32 field type, string field name)
+//   int32[nitems] item IDs
+//
+// for each time step:
+//   uint32  step tag (DRF_STEP)
+//   int32   time step number
+//   float64 time
+//   int32   number of items (same as in header)
+//   nfields x (nitems values of the field's type)
+//
+// Strings are stored as an int32 length, followed by the characters (no terminating zero).
+// Currently, only the DRF_FLOAT64 field type is written.
+#define DRF_MAGIC	0x44424546		// "FEBD"
+#define DRF_VERSION	1
+#define DRF_STEP	0x50455453		// "STEP"
+#define DRF_FLOAT64	0
+
+//-----------------------------------------------------------------------------
+//! Class for reading binary data files
+class FECORE_API DataRecordReader
+{
+public:
+	DataRecordReader();
+	~DataRecordReader();
+
+	//! open a file and read the header
+	bool Open(const char* szfile);
+
+	//! close the file
+	void Close();
+
+	//! read the next time step. The values are returned in field order, i.e.
+	//! the value of field j, item i is stored at data[j*Items() + i].
+	bool NextStep(int& nstep, double& time, std::vector<double>& data);
+
+	//! export the entire file to a CSV file
+	bool ExportCSV(const char* szfile);
+
+public:
+	int Type() const { return m_ntype; }
+	const std::string& Name() const { return m_name; }
+
+	int Fields() const { return (int)m_field.size(); }
+	const std::string& FieldName(int i) const { return m_field[i]; }
+
+	int Items() const { return (int)m_item.size(); }
+	int ItemID(int i) const { return m_item[i]; }
+
+private:
+	bool readString(std::string& s);
+
+private:
+	FILE*	m_fp;
+	int		m_ntype;
+	std::string					m_name;
+	std::vector<std::string>	m_field;
+	std::vector<int>			m_item;
+};
@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FECoreKernel.h"
 #include "FEModel.h"
 #include "FEDomain.h"
+#include <algorithm>
 
 REGISTER_SUPER_CLASS(FELogElemData, FEELEMLOGDATA_ID)
 
@@ -73,13 +74,12 @@ double ElementDataRecord::Evaluate(int item, int ndata)
 	if (m_ELT.empty()) BuildELT();
 
 	// find the element
-	FEMesh& mesh = m_pfem->GetMesh();
 	int index = item - m_offset;
 	if ((index >= 0) && (index < m_ELT.size()))
 	{
 		ELEMREF& e = m_ELT[index];
 		assert((e.ndom != -1) && (e.nid != -1));
-		FEElement* pe = &mesh.Domain(e.ndom).ElementRef(e.nid); assert(pe);
+		FEElement* pe = e.pe; assert(pe);
 		assert(pe->GetID() == item);
 
 		// get the element value
@@ -88,6 +88,14 @@ double ElementDataRecord::Evaluate(int item, int ndata)
 	else return 0.0;
 }
 
+//-----------------------------------------------------------------------------
+// The lookup table stores element pointers, which are invalidated when the domains
+// are recreated (e.g. after a remesh), so it is rebuilt for every evaluation.
+void ElementDataRecord::PrepareEvaluation()
+{
+	BuildELT();
+}
+
 //-----------------------------------------------------------------------------
 void ElementDataRecord::BuildELT()
 {
@@ -117,6 +125,7 @@ void ElementDataRecord::BuildELT()
 	{
 		m_ELT[i].ndom = -1;
 		m_ELT[i].nid  = -1;
+		m_ELT[i].pe   = 0;
 	}
 
 	// build lookup table
@@ -131,6 +140,7 @@ void ElementDataRecord::BuildELT()
 			int id = el.GetID() - minID;
 			m_ELT[id].ndom = i;
 			m_ELT[id].nid  = j;
+			m_ELT[id].pe   = &el;
 		}
 	}
 }
@@ -157,6 +167,9 @@ void ElementDataRecord::SelectAllItems()
 			FEElement& el = dom.ElementRef(j);
 			m_item[n] = el.GetID();
 		}
+
+		// output the domain's elements in user order
+		if (m.IsReordered()) std::sort(m_item.begin() + (n - NE), m_item.begin() + n);
 	}
 }
 
@@ -52,6 +52,7 @@ class FECORE_API ElementDataRecord : public DataRecord
 	{
 		int	ndom;
 		int	nid;
+		FEElement*	pe;
 	};
 
 public:
@@ -62,6 +63,10 @@ public:
 	int Size() const;
 	void SetItemList(FEElementSet* pg);
 
+protected:
+	void PrepareEvaluation() override;
+	bool ParallelEvaluation() const override { return true; }
+
 protected:
 	void BuildELT();
 
@@ -37,10 +37,48 @@ SOFTWARE.*/
 #include "DumpMemStream.h"
 #include "FELinearConstraintManager.h"
 #include "FEShellDomain.h"
+#include "FESolidDomain.h"
 #include "FEMeshAdaptor.h"
+#include "FEMaterial.h"
+#include "FEModelParam.h"
 
 REGISTER_SUPER_CLASS(FEAnalysis, FEANALYSIS_ID);
 
+//-----------------------------------------------------------------------------
+// helper function that bakes the time-invariant mapped parameters of a model
+// component (and its properties) at the integration points of a domain.
+static void bake_parameters(FECoreBase* pc, FEMeshPartition& dom)
+{
+	FEParameterList& pl = pc->GetParameterList();
+	FEParamIterator it = pl.first();
+	for (int i = 0; i < pl.Parameters(); ++i, ++it)
+	{
+		FEParam& p = *it;
+		if (p.type() == FE_PARAM_DOUBLE_MAPPED)
+		{
+			for (int j = 0; j < p.dim(); ++j) p.value<FEParamDouble>(j).Bake(dom);
+		}
+	}
+
+	for (int i = 0; i < pc->Properties(); ++i)
+	{
+		FECoreBase* pci = pc->GetProperty(i);
+		if (pci) bake_parameters(pci, dom);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// bake the material parameters of all domains
+static void bake_material_parameters(FEMesh& mesh)
+{
+	for (int i = 0; i < mesh.Domains(); ++i)
+	{
+		FEDomain& dom = mesh.Domain(i);
+		FEMaterial* mat = dom.GetMaterial();
+		if (mat) bake_parameters(mat, dom);
+	}
+}
+
 BEGIN_FECORE_CLASS(FEAnalysis, FECoreBase)
 	ADD_PARAMETER(m_ntime       , FE_RANGE_GREATER_OR_EQUAL(-1) , "time_steps");
 	ADD_PARAMETER(m_dt0         , FE_RANGE_GREATER_OR_EQUAL(0.0), "step_size");
@@ -271,6 +309,14 @@ bool FEAnalysis::Activate()
 	// be applied after initial conditions.
 	for (int i=0; i<(int) m_MC.size(); ++i) m_MC[i]->Activate();
 
+	// Some model components (e.g. contact interfaces with offsets) can modify the
+	// reference coordinates, so we need to update the cached reference gradients.
+	for (int i=0; i<ndom; ++i)
+	{
+		FESolidDomain* dom = dynamic_cast<FESolidDomain*>(&mesh.Domain(i));
+		if (dom && dom->ReferenceGradientCache()) dom->UpdateReferenceGradientCache();
+	}
+
 	// Next, we need to determine which degrees of freedom are active. 
 	// We start by resetting all nodal degrees of freedom.
 	for (int i=0; i<mesh.Nodes(); ++i)
@@ -298,6 +344,10 @@ bool FEAnalysis::Activate()
             dom.Activate();
     }
 
+	// Evaluate the material parameters that are mapped, but don't change over time
+	// at all integration points, so they don't need to be re-evaluated by the materials.
+	bake_material_parameters(mesh);
+
 	return true;
 }
 
@@ -531,6 +581,14 @@ int FEAnalysis::SolveTimeStep()
 						// reinitialize it
 						InitSolver();
 
+						// the domains may have changed, so rebake the parameters
+						bake_material_parameters(fem.GetMesh());
+
+						// and discard the element colorings
+						FEMesh& mesh = fem.GetMesh();
+						for (int i = 0; i < mesh.Domains(); ++i) mesh.Domain(i).ResetElementColoring();
+						for (int i = 0; i < mesh.Surfaces(); ++i) mesh.Surface(i).ResetElementColoring();
+
 						// inform listeners that the mesh was remeshed
 						fem.DoCallback(CB_REMESH);
 					}
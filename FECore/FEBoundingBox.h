@@ -42,6 +42,10 @@ public:
 	// center of box
 	vec3d center() const { return (r0 + r1)*0.5; }
 
+	// corners of box
+	const vec3d& minPoint() const { return r0; }
+	const vec3d& maxPoint() const { return r1; }
+
 	// dimensions of box
 	double width() const { return (r1.x - r0.x); }
 	double height() const { return (r1.y - r0.y); }
@@ -45,11 +45,11 @@ FEBox::FEBox(const FEMesh& mesh)
 	int N = mesh.Nodes();
 	if (N > 0)
 	{
-		m_r0 = m_r1 = mesh.Node(0).m_rt;
+		m_r0 = m_r1 = mesh.Node(0).m_rt();
 		for (int i=1; i<N; ++i)
 		{
 			const FENode& ni = mesh.Node(i);
-			add(ni.m_rt);
+			add(ni.m_rt());
 		}
 	}
 }
@@ -60,11 +60,11 @@ FEBox::FEBox(const FEMeshPartition& dom)
 	int N = dom.Nodes();
 	if (N > 0)
 	{
-		m_r0 = m_r1 = dom.Node(0).m_rt;
+		m_r0 = m_r1 = dom.Node(0).m_rt();
 		for (int i=1; i<N; ++i)
 		{
 			const FENode& ni = dom.Node(i);
-			add(ni.m_rt);
+			add(ni.m_rt());
 		}
 	}
 }
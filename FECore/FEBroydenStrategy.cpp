@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "LinearSolver.h"
 #include "FEException.h"
 #include "FENewtonSolver.h"
+#include "vector.h"
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -51,10 +52,17 @@ bool FEBroydenStrategy::Init()
 	int neq = m_pns->m_neq;
 
 	// allocate storage for Broyden update vectors
-	m_R.resize(m_max_buf_size, neq);
-	m_D.resize(m_max_buf_size, neq);
+	// (the vectors themselves are allocated in Update)
+	m_E.resize(m_max_buf_size);
+	m_D.resize(m_max_buf_size);
+	for (int i = 0; i < m_max_buf_size; ++i)
+	{
+		if (m_E[i].size() != neq) vector<double>().swap(m_E[i]);
+		if (m_D[i].size() != neq) vector<double>().swap(m_D[i]);
+	}
 	m_rho.resize(m_max_buf_size);
 	m_q.resize(neq, 0.0);
+	m_r.resize(neq, 0.0);
 
 	m_neq = neq;
 	m_nups = 0;
@@ -92,28 +100,24 @@ bool FEBroydenStrategy::Update(double s, vector<double>& ui, vector<double>& R0,
 		int n1 = (m_nups >= m_max_buf_size ? (m_nups) % m_max_buf_size : m_nups);
 
 		// loop over update vectors
-		for (int j = 0; j<nups; ++j)
-		{
-			int n = (n0 + j) % m_max_buf_size;
-
-			double w = 0.0;
-			for (int i = 0; i<m_neq; ++i) w += (m_D[n][i] * m_q[i]);
-
-			double g = m_rho[n] * w;
-			for (int i = 0; i<m_neq; ++i) m_q[i] += g*(m_D[n][i] - m_R[n][i]);
-		}
+		applyUpdates(n0, nups);
 
 		// form and store the next update vector
-		double rhoi = 0.0;
-		for (int i = 0; i<m_neq; ++i)
+		if (m_E[n1].size() != m_neq) m_E[n1].resize(m_neq);
+		if (m_D[n1].size() != m_neq) m_D[n1].resize(m_neq);
+		double* en = &m_E[n1][0];
+		double* dn = &m_D[n1][0];
+		int neq = m_neq;
+#pragma omp parallel for
+		for (int i = 0; i<neq; ++i)
 		{
 			double ri = m_q[i] - ui[i];
 			double di = -s*ui[i];
-			m_R[n1][i] = ri;
-			m_D[n1][i] = di;
-
-			rhoi += di*ri;
+			m_r[i] = ri;
+			dn[i] = di;
+			en[i] = di - ri;
 		}
+		double rhoi = vdot(neq, dn, &m_r[0]);
 		m_rho[n1] = 1.0 / (rhoi);
 	}
 
@@ -154,32 +158,58 @@ void FEBroydenStrategy::SolveEquations(vector<double>& x, vector<double>& b)
 			if (m_plinsolve->BackSolve(m_q, b) == false)
 				throw LinearSolverFailed();
 
-			for (int j = 0; j<nups - 1; ++j)
-			{
-				int n = (n0 + j) % m_max_buf_size;
-
-				double w = 0.0;
-				for (int i = 0; i<m_neq; ++i) w += (m_D[n][i] * m_q[i]);
-
-				double g = m_rho[n] * w;
-				for (int i = 0; i<m_neq; ++i) m_q[i] += g*(m_D[n][i] - m_R[n][i]);
-			}
+			applyUpdates(n0, nups - 1);
 
 			m_bnewStep = false;
 		}
 
 		// calculate solution
-		double rho = 0.0;
-		for (int i = 0; i<m_neq; ++i) rho += m_D[n1][i] * m_q[i];
+		const double* dn = &m_D[n1][0];
+		const double* en = &m_E[n1][0];
+		double rho = vdot(m_neq, dn, &m_q[0]);
 		rho *= m_rho[n1];
 
-		for (int i = 0; i<m_neq; ++i)
+		int neq = m_neq;
+#pragma omp parallel for
+		for (int i = 0; i<neq; ++i)
 		{
-			x[i] = m_q[i] + rho*(m_D[n1][i] - m_R[n1][i]);
+			x[i] = m_q[i] + rho*en[i];
 		}
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Apply the updates n0, ..., n0 + nups - 1 to q. 
+// The update of q with vector j is fused with the dot product for vector j+1.
+void FEBroydenStrategy::applyUpdates(int n0, int nups)
+{
+	if (nups <= 0) return;
+
+	double* q = &m_q[0];
+	double w = vdot(m_neq, &m_D[n0 % m_max_buf_size][0], q);
+	for (int j = 0; j<nups; ++j)
+	{
+		int n = (n0 + j) % m_max_buf_size;
+		double g = m_rho[n] * w;
+
+		if (j < nups - 1)
+		{
+			int m = (n0 + j + 1) % m_max_buf_size;
+			w = vaxpy_dot(m_neq, g, &m_E[n][0], q, &m_D[m][0]);
+		}
+		else vaxpy(m_neq, g, &m_E[n][0], q);
+	}
+}
+
+//-----------------------------------------------------------------------------
+size_t FEBroydenStrategy::UpdateMemory() const
+{
+	size_t mem = 0;
+	for (size_t i = 0; i < m_E.size(); ++i) mem += m_E[i].capacity() * sizeof(double);
+	for (size_t i = 0; i < m_D.size(); ++i) mem += m_D[i].capacity() * sizeof(double);
+	return mem;
+}
+
 /*
 //-----------------------------------------------------------------------------
 //! perform a quasi-Newton udpate
@@ -50,6 +50,13 @@ public:
 	//! Presolve update
 	virtual void PreSolveUpdate() override;
 
+	//! return the memory used by the update vectors
+	size_t UpdateMemory() const override;
+
+private:
+	// apply the stored updates to m_q
+	void applyUpdates(int n0, int nups);
+
 private:
 	// keep a pointer to the linear solver
 	LinearSolver*	m_plinsolve;	//!< pointer to linear solver
@@ -58,8 +65,11 @@ private:
 	bool		m_bnewStep;
 
 	// Broyden update vectors
-	matrix			m_R;		//!< Broyden update vector "r"
-	matrix			m_D;		//!< Broydeb update vector "delta"
+	// These are stored in a ring buffer of m_max_buf_size vectors. The vectors
+	// are allocated when they are first needed.
+	vector< vector<double> >	m_E;		//!< Broyden update vector "delta - r"
+	vector< vector<double> >	m_D;		//!< Broyden update vector "delta"
 	vector<double>	m_rho;		//!< temp vectors for calculating Broyden update vectors
 	vector<double>	m_q;		//!< temp storage for q
+	vector<double>	m_r;		//!< temp storage for r
 };
@@ -41,23 +41,34 @@ FEClosestPointProjection::FEClosestPointProjection(FESurface& s) : m_surf(s)
 	m_bspecial = false;
 	m_projectBoundary = false;
 	m_handleQuads = false;
-
-	// calculate node-element list
-	m_NEL.Create(m_surf);
-	m_EEL.Create(&m_surf);
+	m_binit = false;
 }
 
 //-----------------------------------------------------------------------------
 //! Initialization of data structures
 bool FEClosestPointProjection::Init()
 {
+	// calculate node-element list
+	m_NEL.Create(m_surf);
+	m_EEL.Create(&m_surf);
+
 	// initialize the nearest neighbor search
 	m_SNQ.Attach(&m_surf);
 	m_SNQ.Init();
 
+	m_binit = true;
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+//! The surface topology does not change during the analysis, so the node-element
+//! lists are kept and only the bounding boxes of the search tree are recomputed.
+void FEClosestPointProjection::Update()
+{
+	if (m_binit == false) Init();
+	else m_SNQ.Update();
+}
+
 //-----------------------------------------------------------------------------
 // helper function for projecting a point onto an edge
 bool Project2Edge(const vec3d& p0, const vec3d& p1, const vec3d& x, vec3d& q)
@@ -90,7 +101,7 @@ FESurfaceElement* FEClosestPointProjection::Project(vec3d& x, vec3d& q, vec2d& r
 	int m = m_surf.NodeIndex(mn);
 
 	// get the nodal position
-	vec3d rm = mesh.Node(m).m_rt;
+	vec3d rm = mesh.Node(m).m_rt();
 
 	// now that we found the closest node, lets see if we can find 
 	// the best element
@@ -177,8 +188,8 @@ FESurfaceElement* FEClosestPointProjection::Project(vec3d& x, vec3d& q, vec2d& r
 						if ((nk1 == m) || (nk2 == m))
 						{
 							// try to project it on the edge
-							vec3d p0 = mesh.Node(nk1).m_rt;
-							vec3d p1 = mesh.Node(nk2).m_rt;
+							vec3d p0 = mesh.Node(nk1).m_rt();
+							vec3d p1 = mesh.Node(nk2).m_rt();
 							if (Project2Edge(p0, p1, x, q))
 							{
 								// see if this is a closer projection
@@ -298,7 +309,7 @@ FESurfaceElement* FEClosestPointProjection::Project(int n, vec3d& q, vec2d& r)
 	FEMesh& mesh = *m_surf.GetMesh();
 
 	// get the node's position
-	vec3d x = mesh.Node(n).m_rt;
+	vec3d x = mesh.Node(n).m_rt();
 	
 	// see if we need to initialize the NQ structure
 //	if (binit_nq) m_SNQ.Init();
@@ -306,29 +317,21 @@ FESurfaceElement* FEClosestPointProjection::Project(int n, vec3d& q, vec2d& r)
 	// let's find the closest node
 //	int mn = m_SNQ.Find(x);
 
-	// do it the hard way
+	// find the closest node, excluding the node itself
 	int mn = -1;
-	double d0;
-	int N = m_surf.Nodes();
-	for (int i=0; i<N; ++i)
+	vector<int> closest;
+	int nc = m_SNQ.FindKNearest(x, 2, closest);
+	for (int i=0; i<nc; ++i)
 	{
-		if (m_surf.NodeIndex(i) != n)
-		{
-			vec3d r = m_surf.Node(i).m_rt;
-			double d = (r - x)*(r - x);
-			if ((mn == -1) || (d < d0))
-			{
-				d0 = d;
-				mn = i;
-			}
-		}
+		if (m_surf.NodeIndex(closest[i]) != n) { mn = closest[i]; break; }
 	}
+	if (mn == -1) return 0;
 	
 	// mn is a local index, so get the global node number too
 	int m = m_surf.NodeIndex(mn);
 	
 	// get the nodal position
-	vec3d r0 = mesh.Node(m).m_rt;
+	vec3d r0 = mesh.Node(m).m_rt();
 
 	// check the distance
 	double D = (x - r0).norm();
@@ -44,6 +44,10 @@ public:
 	//! Initialization
 	bool Init();
 
+	//! Update the search structures to the current nodal positions. The first
+	//! call initializes them; later calls only refit the nearest-neighbor search.
+	void Update();
+
 	//! Project a point onto surface
 	FESurfaceElement* Project(vec3d& x, vec3d& q, vec2d& r);
 
@@ -75,6 +79,7 @@ protected:
 	bool	m_bspecial;	//!< try to handle special cases
 	bool	m_projectBoundary;	//!< allow boundary projections
 	bool	m_handleQuads;
+	bool	m_binit;	//!< search structures are initialized
 
 protected:
 	FESurface&		m_surf;		//!< reference to surface
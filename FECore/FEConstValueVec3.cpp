@@ -158,8 +158,8 @@ vec3d FELocalVectorGenerator::operator () (const FEMaterialPoint& mp)
 	FEElement* el = mp.m_elem; assert(el);
 
 	FEMeshPartition* dom = el->GetMeshPartition();
-	vec3d r0 = dom->Node(el->m_lnode[m_n[0]]).m_r0;
-	vec3d r1 = dom->Node(el->m_lnode[m_n[1]]).m_r0;
+	vec3d r0 = dom->Node(el->m_lnode[m_n[0]]).m_r0();
+	vec3d r1 = dom->Node(el->m_lnode[m_n[1]]).m_r0();
 
 	vec3d n = r1 - r0;
 	n.unit();
@@ -62,7 +62,7 @@ bool FEDataGenerator::Generate(FENodeDataMap& map)
 	for (int i = 0; i<N; ++i)
 	{
 		const FENode* ni = set.Node(i);
-		vec3d ri = ni->m_r0;
+		vec3d ri = ni->m_r0();
 		switch (dataType)
 		{
 		case FE_DOUBLE: { double d; value(ri, d); map.setValue(i, d); } break;
@@ -94,7 +94,7 @@ bool FEDataGenerator::Generate(FESurfaceMap& map)
 		int nf = face.ntype;
 		for (int j=0; j<nf; ++j)
 		{
-			vec3d ri = mesh.Node(face.node[j]).m_r0;
+			vec3d ri = mesh.Node(face.node[j]).m_r0();
 			switch (dataType)
 			{
 			case FE_DOUBLE: { double d; value(ri, d); map.setValue(i, j, d); } break;
@@ -127,7 +127,7 @@ bool FEDataGenerator::Generate(FEDomainMap& map)
 			int ne = el.Nodes();
 			for (int j = 0; j < ne; ++j)
 			{
-				vec3d ri = mesh.Node(el.m_node[j]).m_r0;
+				vec3d ri = mesh.Node(el.m_node[j]).m_r0();
 				switch (dataType)
 				{
 				case FE_DOUBLE: { double d; value(ri, d); map.setValue(i, j, d); } break;
@@ -143,7 +143,7 @@ bool FEDataGenerator::Generate(FEDomainMap& map)
 			// calculate element center
 			vec3d r(0, 0, 0);
 			int ne = el.Nodes();
-			for (int j = 0; j < ne; ++j) r += mesh.Node(el.m_node[j]).m_r0;
+			for (int j = 0; j < ne; ++j) r += mesh.Node(el.m_node[j]).m_r0();
 			r /= ne;
 
 			// evaluate
@@ -86,6 +86,12 @@ public:
 		return *this;
 	}
 
+	template <class T> FEDataStream& operator << (const std::vector<T>& a)
+	{
+		for (const T& ai : a) (*this) << ai;
+		return *this;
+	}
+
 	void assign(size_t count, float f) { m_a.assign(count, f); }
 	void reserve(size_t count) { m_a.reserve(count); }
 	void push_back(const float& f) { m_a.push_back(f); }
@@ -34,6 +34,9 @@ SOFTWARE.*/
 //-----------------------------------------------------------------------------
 bool FEDiscreteDomain::Create(int nelems, FE_Element_Spec espec)
 { 
+	// the elements change, so any existing coloring is no longer valid
+	ResetElementColoring();
+
 	m_Elem.resize(nelems); 
 	for (int i = 0; i < nelems; ++i)
 	{
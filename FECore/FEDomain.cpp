@@ -61,7 +61,7 @@ void FEDomain::CreateMaterialPointData()
 
 		vec3d r[FEElement::MAX_NODES];
 		int ne = el.Nodes();
-		for (int i = 0; i < ne; ++i) r[i] = mesh->Node(el.m_node[i]).m_r0;
+		for (int i = 0; i < ne; ++i) r[i] = mesh->Node(el.m_node[i]).m_r0();
 
 		for (int k = 0; k < el.GaussPoints(); ++k)
 		{
@@ -161,7 +161,7 @@ void FEDomain::UnpackLM(FEElement& el, const FEDofList& dof, vector<int>& lm)
 	{
 		int n = el.m_node[i];
 		FENode& node = mesh->Node(n);
-		vector<int>& id = node.m_ID;
+		FENodeArray<int>& id = node.m_ID;
 		for (int j = 0; j<ndofs; ++j) lm[i*ndofs + j] = id[dof[j]];
 	}
 }
@@ -173,6 +173,7 @@ void FEDomain::BuildMatrixProfile(FEGlobalMatrix& M)
 	const int NE = Elements();
 	for (int j = 0; j<NE; ++j)
 	{
+		if (AssembleElement(j) == false) continue;
 		FEElement& el = ElementRef(j);
 		UnpackLM(el, elm);
 		M.build_add(elm);
@@ -34,6 +34,9 @@ SOFTWARE.*/
 //-----------------------------------------------------------------------------
 bool FEDomain2D::Create(int nelems, FE_Element_Spec espec)
 {
+	// the elements change, so any existing coloring is no longer valid
+	ResetElementColoring();
+
 	m_Elem.resize(nelems);
 	for (int i = 0; i < nelems; ++i)
 	{
@@ -76,7 +79,7 @@ double FEDomain2D::invjac0(FEElement2D& el, double Ji[2][2], int n)
     double y[FEElement::MAX_NODES];
     for (int i=0; i<neln; ++i)
     {
-        vec3d& ri = m_pMesh->Node(el.m_node[i]).m_r0;
+        vec3d& ri = m_pMesh->Node(el.m_node[i]).m_r0();
 		x[i] = ri.x;
 		y[i] = ri.y;
     }
@@ -122,7 +125,7 @@ double FEDomain2D::invjact(FEElement2D& el, double Ji[2][2], int n)
     double y[FEElement::MAX_NODES];
     for (int i=0; i<neln; ++i)
     {
-        vec3d& ri = m_pMesh->Node(el.m_node[i]).m_rt;
+        vec3d& ri = m_pMesh->Node(el.m_node[i]).m_rt();
 		x[i] = ri.x;
 		y[i] = ri.y;
     }
@@ -269,7 +272,7 @@ double FEDomain2D::detJ0(FEElement2D &el, int n)
     double y[FEElement::MAX_NODES];
     for (int i=0; i<neln; ++i)
     {
-        vec3d& ri = m_pMesh->Node(el.m_node[i]).m_r0;
+        vec3d& ri = m_pMesh->Node(el.m_node[i]).m_r0();
 		x[i] = ri.x;
 		y[i] = ri.y;
     }
@@ -300,7 +303,7 @@ double FEDomain2D::detJt(FEElement2D &el, int n)
     double y[FEElement::MAX_NODES];
     for (int i=0; i<neln; ++i)
     {
-        vec3d& ri = m_pMesh->Node(el.m_node[i]).m_rt;
+        vec3d& ri = m_pMesh->Node(el.m_node[i]).m_rt();
         x[i] = ri.x;
         y[i] = ri.y;
     }
@@ -339,7 +342,7 @@ void FEDomain2D::CoBaseVectors(FEElement2D& el, int j, vec2d g[2])
     g[0] = g[1] = vec2d(0,0);
     for (int i=0; i<n; ++i)
     {
-        vec2d rt = vec2d(m.Node(el.m_node[i]).m_rt.x,m.Node(el.m_node[i]).m_rt.y);
+        vec2d rt = vec2d(m.Node(el.m_node[i]).m_rt().x,m.Node(el.m_node[i]).m_rt().y);
         g[0] += rt*Hr[i];
         g[1] += rt*Hs[i];
     }
@@ -382,7 +385,7 @@ void FEDomain2D::CoBaseVectorDerivatives(FEElement2D& el, int j, vec2d dg[2][2])
     
     for (int i=0; i<n; ++i)
     {
-        vec2d rt = vec2d(m.Node(el.m_node[i]).m_rt.x,m.Node(el.m_node[i]).m_rt.y);
+        vec2d rt = vec2d(m.Node(el.m_node[i]).m_rt().x,m.Node(el.m_node[i]).m_rt().y);
         dg[0][0] += rt*Hrr[i]; dg[0][1] += rt*Hsr[i];
         dg[1][0] += rt*Hrs[i]; dg[1][1] += rt*Hss[i];
     }
@@ -0,0 +1,157 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "FEDomainDecomposition.h"
+#include "FENodeNodeList.h"
+#include "FEMesh.h"
+#include <assert.h>
+using namespace std;
+
+//-----------------------------------------------------------------------------
+// Breadth-first traversal from node nroot. The visited nodes are appended to
+// order and marked in tag. Returns the last node that was visited, which is 
+// (one of) the nodes furthest away from nroot.
+static int bfs_order(FENodeNodeList& NNL, int nroot, vector<int>& tag, vector<int>& order)
+{
+	size_t n0 = order.size();
+	order.push_back(nroot);
+	tag[nroot] = 1;
+	for (size_t i = n0; i < order.size(); ++i)
+	{
+		int n = order[i];
+		int nval = NNL.Valence(n);
+		int* pn = NNL.NodeList(n);
+		for (int j = 0; j < nval; ++j)
+		{
+			int m = pn[j];
+			if (tag[m] == 0)
+			{
+				tag[m] = 1;
+				order.push_back(m);
+			}
+		}
+	}
+	return order.back();
+}
+
+//-----------------------------------------------------------------------------
+FEDomainDecomposition::FEDomainDecomposition()
+{
+}
+
+//-----------------------------------------------------------------------------
+bool FEDomainDecomposition::Create(FEMesh& mesh, int nparts, int overlap)
+{
+	int N = mesh.Nodes();
+	if ((N == 0) || (nparts < 1)) return false;
+	if (nparts > N) nparts = N;
+	if (overlap < 0) overlap = 0;
+
+	// build the node-node graph
+	FENodeNodeList NNL;
+	NNL.Create(mesh);
+
+	// Order all nodes, one connected component at a time. For each component,
+	// we first find a pseudo-peripheral node and then traverse from there so
+	// that consecutive nodes in the order are close in the graph.
+	vector<int> order; order.reserve(N);
+	vector<int> tag(N, 0), tmp(N, 0), tmpOrder;
+	for (int n = 0; n < N; ++n)
+	{
+		if (tag[n] == 0)
+		{
+			tmpOrder.clear();
+			int nroot = bfs_order(NNL, n, tmp, tmpOrder);
+			bfs_order(NNL, nroot, tag, order);
+		}
+	}
+	assert((int)order.size() == N);
+
+	// cut the ordering into nparts pieces
+	m_tag.assign(N, -1);
+	m_owned.assign(nparts, vector<int>());
+	for (int i = 0; i < nparts; ++i)
+	{
+		int n0 = (int)(((long long)N*i) / nparts);
+		int n1 = (int)(((long long)N*(i + 1)) / nparts);
+		vector<int>& owned = m_owned[i];
+		owned.assign(order.begin() + n0, order.begin() + n1);
+		for (int j = 0; j < (int)owned.size(); ++j) m_tag[owned[j]] = i;
+	}
+
+	// add the overlap layers
+	m_nodes.assign(nparts, vector<int>());
+#pragma omp parallel for
+	for (int i = 0; i < nparts; ++i)
+	{
+		vector<int>& nodes = m_nodes[i];
+		nodes = m_owned[i];
+
+		vector<bool> inPart(N, false);
+		for (int j = 0; j < (int)nodes.size(); ++j) inPart[nodes[j]] = true;
+
+		size_t l0 = 0;
+		for (int l = 0; l < overlap; ++l)
+		{
+			size_t l1 = nodes.size();
+			for (size_t j = l0; j < l1; ++j)
+			{
+				int n = nodes[j];
+				int nval = NNL.Valence(n);
+				int* pn = NNL.NodeList(n);
+				for (int k = 0; k < nval; ++k)
+				{
+					int m = pn[k];
+					if (inPart[m] == false)
+					{
+						inPart[m] = true;
+						nodes.push_back(m);
+					}
+				}
+			}
+			l0 = l1;
+		}
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void FEDomainDecomposition::Equations(FEMesh& mesh, int i, vector<int>& eq) const
+{
+	eq.clear();
+	const vector<int>& nodes = m_nodes[i];
+	for (size_t j = 0; j < nodes.size(); ++j)
+	{
+		FENode& node = mesh.Node(nodes[j]);
+		for (size_t k = 0; k < node.m_ID.size(); ++k)
+		{
+			if (node.m_ID[k] >= 0) eq.push_back(node.m_ID[k]);
+		}
+	}
+}
@@ -0,0 +1,71 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "fecore_api.h"
+#include <vector>
+
+class FEMesh;
+
+//-----------------------------------------------------------------------------
+//! This class partitions the nodes of a mesh into a number of subdomains.
+
+//! The partitioning is done on the node-node graph (see FENodeNodeList). For each
+//! connected component, the nodes are ordered by a breadth-first traversal that
+//! starts from a pseudo-peripheral node, and this ordering is cut into pieces of
+//! (nearly) equal size. Each subdomain can be extended with a number of overlap
+//! layers (ghost nodes). The decomposition is used by domain-decomposition
+//! preconditioners (e.g. additive Schwarz).
+class FECORE_API FEDomainDecomposition
+{
+public:
+	//! default constructor
+	FEDomainDecomposition();
+
+	//! Partition the mesh into nparts subdomains, each extended by 'overlap' layers of ghost nodes
+	bool Create(FEMesh& mesh, int nparts, int overlap);
+
+	//! number of subdomains
+	int Subdomains() const { return (int) m_owned.size(); }
+
+	//! the subdomain that owns node n
+	int NodeSubdomain(int n) const { return m_tag[n]; }
+
+	//! nodes owned by subdomain i (without ghost nodes)
+	const std::vector<int>& OwnedNodes(int i) const { return m_owned[i]; }
+
+	//! all nodes of subdomain i (including ghost nodes)
+	const std::vector<int>& Nodes(int i) const { return m_nodes[i]; }
+
+	//! Collect the (zero-based) equation numbers of the nodes of subdomain i (including ghost nodes)
+	void Equations(FEMesh& mesh, int i, std::vector<int>& eq) const;
+
+private:
+	std::vector<int>				m_tag;		//!< subdomain that owns each node
+	std::vector< std::vector<int> >	m_owned;	//!< owned nodes of each subdomain
+	std::vector< std::vector<int> >	m_nodes;	//!< nodes (including overlap) of each subdomain
+};
@@ -33,6 +33,7 @@ SOFTWARE.*/
 #include "FEDomain.h"
 #include "DumpStream.h"
 #include "FEModel.h"
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 FEElementSet::FEElementSet(FEModel* fem) : FEItemList(fem)
@@ -111,6 +112,11 @@ void FEElementSet::Create(FEDomainList& domList)
 			FEElement& el = dom->ElementRef(i);
 			m_Elem[NT + i] = el.GetID();
 		}
+
+		// list the domain's elements in user order, which differs
+		// from the storage order when the mesh was reordered.
+		if (dom->GetMesh()->IsReordered()) std::sort(m_Elem.begin() + NT, m_Elem.begin() + NT + NE);
+
 		NT += NE;
 	}
 
@@ -32,8 +32,10 @@ SOFTWARE.*/
 #include "FEModel.h"
 
 //-----------------------------------------------------------------------------
-FEGlobalVector::FEGlobalVector(FEModel& fem, vector<double>& R, vector<double>& Fr) : m_fem(fem), m_R(R), m_Fr(Fr)
+FEGlobalVector::FEGlobalVector(FEModel& fem, vector<double>& R, vector<double>& Fr, bool bcolored) : m_fem(fem), m_R(R), m_Fr(Fr)
 {
+	m_bcolored = bcolored;
+	m_bexclusive = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -49,6 +51,17 @@ void FEGlobalVector::Assemble(vector<int>& en, vector<int>& elm, vector<double>&
 
 	// assemble the element residual into the global residual
 	int ndof = (int)fe.size();
+	if (m_bexclusive)
+	{
+		for (int i=0; i<ndof; ++i)
+		{
+			int I = elm[i];
+			if (I >= 0) R[I] += fe[i];
+			else if (-I-2 >= 0) m_Fr[-I-2] -= fe[i];
+		}
+		return;
+	}
+
 	for (int i=0; i<ndof; ++i)
 	{
 		int I = elm[i];
@@ -39,8 +39,8 @@ class FEModel;
 class FECORE_API FEGlobalVector
 {
 public:
-	//! constructor
-	FEGlobalVector(FEModel& fem, vector<double>& R, vector<double>& Fr);
+	//! constructor (bcolored requests a colored element assembly from the domains)
+	FEGlobalVector(FEModel& fem, vector<double>& R, vector<double>& Fr, bool bcolored = false);
 
 	//! destructor
 	virtual ~FEGlobalVector();
@@ -65,8 +65,18 @@ public:
 
 	operator vector<double>& () { return m_R; }
 
+public:
+	//! returns true if domains should assemble their element vectors color-by-color
+	bool ColoredAssembly() const { return m_bcolored; }
+
+	//! Domains set this during a colored element loop. While set, concurrent calls to
+	//! Assemble do not share nodes, so the nodal entries are updated without atomics.
+	void SetExclusiveAccess(bool b) { m_bexclusive = b; }
+
 protected:
 	FEModel&			m_fem;	//!< model
 	vector<double>&		m_R;	//!< residual
 	vector<double>&		m_Fr;	//!< nodal reaction forces \todo I want to remove this
+	bool				m_bcolored;		//!< use colored element assembly
+	bool				m_bexclusive;	//!< concurrent element vectors don't share nodes
 };
@@ -294,7 +294,7 @@ int findNodeInMesh(FEMesh& mesh, const vec3d& r, double tol = 1e-12)
 		FENode& node = mesh.Node(i);
 		if (node.HasFlags(FENode::EXCLUDE) == false)
 		{
-			vec3d ri = mesh.Node(i).m_r0;
+			vec3d ri = mesh.Node(i).m_r0();
 			if ((ri - r).norm2() < tol) return i;
 		}
 	}
@@ -319,8 +319,8 @@ void FEHexRefine::UpdateNewNodes(FEModel& fem)
 		if (m_edgeList[i] != -1)
 		{
 			const FEEdgeList::EDGE& edge = topo.Edge(i);
-			vec3d r0 = mesh.Node(edge.node[0]).m_r0;
-			vec3d r1 = mesh.Node(edge.node[1]).m_r0;
+			vec3d r0 = mesh.Node(edge.node[0]).m_r0();
+			vec3d r1 = mesh.Node(edge.node[1]).m_r0();
 			newPos[n++] = (r0 + r1)*0.5;
 		}
 	}
@@ -331,7 +331,7 @@ void FEHexRefine::UpdateNewNodes(FEModel& fem)
 			const FEFaceList::FACE& face = topo.Face(i);
 			vec3d r0(0, 0, 0);
 			int nn = face.ntype;
-			for (int j = 0; j < nn; ++j) r0 += mesh.Node(face.node[j]).m_r0;
+			for (int j = 0; j < nn; ++j) r0 += mesh.Node(face.node[j]).m_r0();
 			r0 /= (double)nn;
 			newPos[n++] = r0;
 		}
@@ -344,7 +344,7 @@ void FEHexRefine::UpdateNewNodes(FEModel& fem)
 
 			vec3d r0(0, 0, 0);
 			int nn = el.Nodes();
-			for (int j = 0; j < nn; ++j) r0 += mesh.Node(el.m_node[j]).m_r0;
+			for (int j = 0; j < nn; ++j) r0 += mesh.Node(el.m_node[j]).m_r0();
 			r0 /= (double)nn;
 			newPos[n++] = r0;
 		}
@@ -437,13 +437,13 @@ void FEHexRefine::UpdateNewNodes(FEModel& fem)
 		{
 			const FEEdgeList::EDGE& edge = topo.Edge(i);
 			FENode& node = mesh.Node(m_edgeList[i]);
-			vec3d r0 = mesh.Node(edge.node[0]).m_r0;
-			vec3d r1 = mesh.Node(edge.node[1]).m_r0;
-			node.m_r0 = (r0 + r1)*0.5;
+			vec3d r0 = mesh.Node(edge.node[0]).m_r0();
+			vec3d r1 = mesh.Node(edge.node[1]).m_r0();
+			node.m_r0() = (r0 + r1)*0.5;
 
-			r0 = mesh.Node(edge.node[0]).m_rt;
-			r1 = mesh.Node(edge.node[1]).m_rt;
-			node.m_rt = (r0 + r1)*0.5;
+			r0 = mesh.Node(edge.node[0]).m_rt();
+			r1 = mesh.Node(edge.node[1]).m_rt();
+			node.m_rt() = (r0 + r1)*0.5;
 		}
 	}
 	for (int i = 0; i < topo.Faces(); ++i)
@@ -455,14 +455,14 @@ void FEHexRefine::UpdateNewNodes(FEModel& fem)
 			int nn = face.ntype;
 
 			vec3d r0(0, 0, 0);
-			for (int j = 0; j < nn; ++j) r0 += mesh.Node(face.node[j]).m_r0;
+			for (int j = 0; j < nn; ++j) r0 += mesh.Node(face.node[j]).m_r0();
 			r0 /= (double)nn;
-			node.m_r0 = r0;
+			node.m_r0() = r0;
 
 			vec3d rt(0, 0, 0);
-			for (int j = 0; j < nn; ++j) rt += mesh.Node(face.node[j]).m_rt;
+			for (int j = 0; j < nn; ++j) rt += mesh.Node(face.node[j]).m_rt();
 			rt /= (double)nn;
-			node.m_rt = rt;
+			node.m_rt() = rt;
 		}
 	}
 	for (int i=0; i < topo.Elements(); ++i)
@@ -475,14 +475,14 @@ void FEHexRefine::UpdateNewNodes(FEModel& fem)
 			FENode& node = mesh.Node(m_elemList[i]);
 
 			vec3d r0(0, 0, 0);
-			for (int j = 0; j < nn; ++j) r0 += mesh.Node(el.m_node[j]).m_r0;
+			for (int j = 0; j < nn; ++j) r0 += mesh.Node(el.m_node[j]).m_r0();
 			r0 /= (double)nn;
-			node.m_r0 = r0;
+			node.m_r0() = r0;
 
 			vec3d rt(0, 0, 0);
-			for (int j = 0; j < nn; ++j) rt += mesh.Node(el.m_node[j]).m_rt;
+			for (int j = 0; j < nn; ++j) rt += mesh.Node(el.m_node[j]).m_rt();
 			rt /= (double)nn;
-			node.m_rt = rt;
+			node.m_rt() = rt;
 		}
 	}
 
@@ -247,9 +247,9 @@ bool FEHexRefine2D::BuildSplitLists(FEModel& fem)
 		const FEFaceList::FACE& face = topo.Face(i);
 
 		// calculate face normal
-		vec3d r0 = mesh.Node(face.node[0]).m_r0;
-		vec3d r1 = mesh.Node(face.node[1]).m_r0;
-		vec3d r2 = mesh.Node(face.node[2]).m_r0;
+		vec3d r0 = mesh.Node(face.node[0]).m_r0();
+		vec3d r1 = mesh.Node(face.node[1]).m_r0();
+		vec3d r2 = mesh.Node(face.node[2]).m_r0();
 		vec3d n = (r1 - r0) ^ (r2 - r0); n.unit();
 		if (fabs(n.z) < 0.999)
 		{
@@ -344,8 +344,8 @@ void FEHexRefine2D::UpdateNewNodes(FEModel& fem)
 		if (m_edgeList[i] >= 0)
 		{
 			const FEEdgeList::EDGE& edge = topo.Edge(i);
-			vec3d r0 = mesh.Node(edge.node[0]).m_r0;
-			vec3d r1 = mesh.Node(edge.node[1]).m_r0;
+			vec3d r0 = mesh.Node(edge.node[0]).m_r0();
+			vec3d r1 = mesh.Node(edge.node[1]).m_r0();
 			newPos[n++] = (r0 + r1)*0.5;
 		}
 	}
@@ -356,7 +356,7 @@ void FEHexRefine2D::UpdateNewNodes(FEModel& fem)
 			const FEFaceList::FACE& face = topo.Face(i);
 			vec3d r0(0, 0, 0);
 			int nn = face.ntype;
-			for (int j = 0; j < nn; ++j) r0 += mesh.Node(face.node[j]).m_r0;
+			for (int j = 0; j < nn; ++j) r0 += mesh.Node(face.node[j]).m_r0();
 			r0 /= (double)nn;
 			newPos[n++] = r0;
 		}
@@ -433,13 +433,13 @@ void FEHexRefine2D::UpdateNewNodes(FEModel& fem)
 		{
 			const FEEdgeList::EDGE& edge = topo.Edge(i);
 			FENode& node = mesh.Node(m_edgeList[i]);
-			vec3d r0 = mesh.Node(edge.node[0]).m_r0;
-			vec3d r1 = mesh.Node(edge.node[1]).m_r0;
-			node.m_r0 = (r0 + r1)*0.5;
+			vec3d r0 = mesh.Node(edge.node[0]).m_r0();
+			vec3d r1 = mesh.Node(edge.node[1]).m_r0();
+			node.m_r0() = (r0 + r1)*0.5;
 
-			r0 = mesh.Node(edge.node[0]).m_rt;
-			r1 = mesh.Node(edge.node[1]).m_rt;
-			node.m_rt = (r0 + r1)*0.5;
+			r0 = mesh.Node(edge.node[0]).m_rt();
+			r1 = mesh.Node(edge.node[1]).m_rt();
+			node.m_rt() = (r0 + r1)*0.5;
 		}
 	}
 	for (int i = 0; i < topo.Faces(); ++i)
@@ -451,14 +451,14 @@ void FEHexRefine2D::UpdateNewNodes(FEModel& fem)
 			int nn = face.ntype;
 
 			vec3d r0(0, 0, 0);
-			for (int j = 0; j < nn; ++j) r0 += mesh.Node(face.node[j]).m_r0;
+			for (int j = 0; j < nn; ++j) r0 += mesh.Node(face.node[j]).m_r0();
 			r0 /= (double)nn;
-			node.m_r0 = r0;
+			node.m_r0() = r0;
 
 			vec3d rt(0, 0, 0);
-			for (int j = 0; j < nn; ++j) rt += mesh.Node(face.node[j]).m_rt;
+			for (int j = 0; j < nn; ++j) rt += mesh.Node(face.node[j]).m_rt();
 			rt /= (double)nn;
-			node.m_rt = rt;
+			node.m_rt() = rt;
 		}
 	}
 
@@ -0,0 +1,254 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#include "stdafx.h"
+#include "FEKdTree.h"
+#include <algorithm>
+#include <limits>
+#include <assert.h>
+
+// max number of points in a leaf
+#define KDTREE_LEAF_SIZE	8
+
+//-----------------------------------------------------------------------------
+// square distance of a point to a box (zero if the point is inside the box)
+static inline double box_dist2(const vec3d& x, const vec3d& r0, const vec3d& r1)
+{
+	double dx = (x.x < r0.x ? r0.x - x.x : (x.x > r1.x ? x.x - r1.x : 0.0));
+	double dy = (x.y < r0.y ? r0.y - x.y : (x.y > r1.y ? x.y - r1.y : 0.0));
+	double dz = (x.z < r0.z ? r0.z - x.z : (x.z > r1.z ? x.z - r1.z : 0.0));
+	return dx*dx + dy*dy + dz*dz;
+}
+
+//-----------------------------------------------------------------------------
+FEKdTree::FEKdTree()
+{
+}
+
+//-----------------------------------------------------------------------------
+void FEKdTree::Clear()
+{
+	m_point.clear();
+	m_index.clear();
+	m_node.clear();
+}
+
+//-----------------------------------------------------------------------------
+void FEKdTree::Build(const std::vector<vec3d>& points)
+{
+	Clear();
+	m_point = points;
+	int N = (int)points.size();
+	if (N == 0) return;
+
+	m_index.resize(N);
+	for (int i = 0; i < N; ++i) m_index[i] = i;
+
+	m_node.reserve(2 * (N / KDTREE_LEAF_SIZE + 1));
+	BuildNode(0, N);
+}
+
+//-----------------------------------------------------------------------------
+// recursively build the tree. Returns the index of the new node.
+int FEKdTree::BuildNode(int start, int count)
+{
+	int n = (int)m_node.size();
+	NODE node;
+	node.start = start;
+	node.count = count;
+	node.left = node.right = -1;
+	UpdateBox(node);
+	m_node.push_back(node);
+
+	if (count > KDTREE_LEAF_SIZE)
+	{
+		// split along the longest box dimension at the median
+		vec3d d = node.r1 - node.r0;
+		int axis = 0;
+		if ((d.y > d.x) && (d.y >= d.z)) axis = 1;
+		else if ((d.z > d.x) && (d.z > d.y)) axis = 2;
+
+		const std::vector<vec3d>& r = m_point;
+		int* pi = &m_index[0] + start;
+		int m = count / 2;
+		std::nth_element(pi, pi + m, pi + count, [&](int a, int b) {
+			double xa = (axis == 0 ? r[a].x : (axis == 1 ? r[a].y : r[a].z));
+			double xb = (axis == 0 ? r[b].x : (axis == 1 ? r[b].y : r[b].z));
+			return (xa < xb) || ((xa == xb) && (a < b));
+		});
+
+		// note that m_node can be reallocated, so we cannot keep a reference to node
+		int left  = BuildNode(start, m);
+		int right = BuildNode(start + m, count - m);
+		m_node[n].left  = left;
+		m_node[n].right = right;
+	}
+
+	return n;
+}
+
+//-----------------------------------------------------------------------------
+// calculate the bounding box of a node's points
+void FEKdTree::UpdateBox(NODE& node)
+{
+	const vec3d& r = m_point[m_index[node.start]];
+	node.r0 = node.r1 = r;
+	for (int i = 1; i < node.count; ++i)
+	{
+		const vec3d& ri = m_point[m_index[node.start + i]];
+		if (ri.x < node.r0.x) node.r0.x = ri.x;
+		if (ri.x > node.r1.x) node.r1.x = ri.x;
+		if (ri.y < node.r0.y) node.r0.y = ri.y;
+		if (ri.y > node.r1.y) node.r1.y = ri.y;
+		if (ri.z < node.r0.z) node.r0.z = ri.z;
+		if (ri.z > node.r1.z) node.r1.z = ri.z;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FEKdTree::Refit(const std::vector<vec3d>& points)
+{
+	assert(points.size() == m_point.size());
+	m_point = points;
+
+	// children are always stored after their parents, so we can update bottom-up
+	for (int i = (int)m_node.size() - 1; i >= 0; --i)
+	{
+		NODE& node = m_node[i];
+		if (node.left == -1) UpdateBox(node);
+		else
+		{
+			const NODE& a = m_node[node.left];
+			const NODE& b = m_node[node.right];
+			node.r0 = vec3d(std::min(a.r0.x, b.r0.x), std::min(a.r0.y, b.r0.y), std::min(a.r0.z, b.r0.z));
+			node.r1 = vec3d(std::max(a.r1.x, b.r1.x), std::max(a.r1.y, b.r1.y), std::max(a.r1.z, b.r1.z));
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+int FEKdTree::FindNearest(const vec3d& x) const
+{
+	if (m_point.empty()) return -1;
+
+	// this is called once per query point, so avoid any heap allocations
+	int closest = -1;
+	double dist = 0.0;
+	KNearest(x, 1, &closest, &dist);
+	return closest;
+}
+
+//-----------------------------------------------------------------------------
+int FEKdTree::FindKNearest(const vec3d& x, int k, std::vector<int>& closestPoints) const
+{
+	int N = (int)m_point.size();
+	if (k > N) k = N;
+	closestPoints.resize(k);
+	if (k <= 0) return 0;
+
+	std::vector<double> dist(k);
+	return KNearest(x, k, &closestPoints[0], &dist[0]);
+}
+
+//-----------------------------------------------------------------------------
+// The lists closestPoints and dist must have room for k entries, and k must be
+// between 1 and the number of points. 
+int FEKdTree::KNearest(const vec3d& x, int k, int* closestPoints, double* dist) const
+{
+	// current list of closest points, sorted by distance (ties are sorted by index)
+	for (int i = 0; i < k; ++i) dist[i] = std::numeric_limits<double>::max();
+	int n = 0;
+
+	// depth-first traversal, visiting the closest child first
+	int stack[128];
+	int ns = 0;
+	stack[ns++] = 0;
+	while (ns > 0)
+	{
+		const NODE& node = m_node[stack[--ns]];
+
+		double dmax = (n < k ? std::numeric_limits<double>::max() : dist[k - 1]);
+		if (box_dist2(x, node.r0, node.r1) > dmax) continue;
+
+		if (node.left == -1)
+		{
+			for (int i = 0; i < node.count; ++i)
+			{
+				int m = m_index[node.start + i];
+				vec3d dr = m_point[m] - x;
+				double d2 = dr*dr;
+				if ((n == k) && ((d2 > dist[k - 1]) || ((d2 == dist[k - 1]) && (m > closestPoints[k - 1])))) continue;
+
+				// insert in sorted list
+				int l = (n < k ? n++ : k - 1);
+				while ((l > 0) && ((d2 < dist[l - 1]) || ((d2 == dist[l - 1]) && (m < closestPoints[l - 1]))))
+				{
+					dist[l] = dist[l - 1];
+					closestPoints[l] = closestPoints[l - 1];
+					--l;
+				}
+				dist[l] = d2;
+				closestPoints[l] = m;
+			}
+		}
+		else
+		{
+			const NODE& a = m_node[node.left];
+			const NODE& b = m_node[node.right];
+			double da = box_dist2(x, a.r0, a.r1);
+			double db = box_dist2(x, b.r0, b.r1);
+			assert(ns + 2 <= 128);
+			if (da <= db)
+			{
+				stack[ns++] = node.right;
+				stack[ns++] = node.left;
+			}
+			else
+			{
+				stack[ns++] = node.left;
+				stack[ns++] = node.right;
+			}
+		}
+	}
+
+	return n;
+}
+
+//-----------------------------------------------------------------------------
+void FEKdTree::FindNearest(const std::vector<vec3d>& x, std::vector<int>& closestPoints) const
+{
+	int N = (int)x.size();
+	closestPoints.resize(N);
+#pragma omp parallel for schedule(dynamic, 256)
+	for (int i = 0; i < N; ++i)
+	{
+		closestPoints[i] = FindNearest(x[i]);
+	}
+}
@@ -0,0 +1,90 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#pragma once
+#include "vec3d.h"
+#include <vector>
+#include "fecore_api.h"
+
+//-----------------------------------------------------------------------------
+//! A k-d tree for nearest-neighbour queries on a point cloud.
+//! Each tree node stores the bounding box of its points, which is used for pruning
+//! the search. This allows the tree to be refitted when the points move without
+//! changing the tree structure: the queries remain exact, although they become 
+//! less efficient as the points move further away from their original positions. 
+//! All queries are const and can be called concurrently from multiple threads.
+class FECORE_API FEKdTree
+{
+	struct NODE
+	{
+		vec3d	r0, r1;		// bounding box
+		int		start;		// first point in index list
+		int		count;		// number of points
+		int		left;		// index of left child (-1 for leaves)
+		int		right;		// index of right child (-1 for leaves)
+	};
+
+public:
+	FEKdTree();
+
+	//! build the tree for the given points
+	void Build(const std::vector<vec3d>& points);
+
+	//! update the point positions, but keep the tree structure
+	//! (the number of points must not change)
+	void Refit(const std::vector<vec3d>& points);
+
+	//! number of points in the tree
+	int Points() const { return (int)m_point.size(); }
+
+	//! clear all data
+	void Clear();
+
+	//! find the index of the point closest to x (returns -1 if the tree is empty)
+	int FindNearest(const vec3d& x) const;
+
+	//! find the k points closest to x, sorted by distance. Returns the number of points found.
+	int FindKNearest(const vec3d& x, int k, std::vector<int>& closestPoints) const;
+
+	//! find the closest points for a list of points (evaluated in parallel)
+	void FindNearest(const std::vector<vec3d>& x, std::vector<int>& closestPoints) const;
+
+private:
+	int BuildNode(int start, int count);
+	void UpdateBox(NODE& node);
+
+	// find the k closest points. The caller provides storage for k indices and distances.
+	int KNearest(const vec3d& x, int k, int* closestPoints, double* dist) const;
+
+private:
+	std::vector<vec3d>	m_point;	//!< point positions
+	std::vector<int>	m_index;	//!< point indices, ordered by tree leaves
+	std::vector<NODE>	m_node;		//!< tree nodes (root is first)
+};
@@ -29,7 +29,9 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "FELineSearch.h"
 #include "FENewtonSolver.h"
+#include "FEModel.h"
 #include "DumpStream.h"
+#include "Timer.h"
 #include <vector>
 using namespace std;
 
@@ -38,13 +40,14 @@ FELineSearch::FELineSearch(FENewtonSolver* pns) : m_pns(pns)
 	m_LSmin = 0.01;
 	m_LStol = 0.9;
 	m_LSiter = 5;
+	m_LSenergy = false;
 }
 
 // serialization
 void FELineSearch::Serialize(DumpStream& ar)
 {
 	if (ar.IsShallow()) return;
-	ar & m_LSmin & m_LStol & m_LSiter;
+	ar & m_LSmin & m_LStol & m_LSiter & m_LSenergy;
 }
 
 //! Performs a linesearch on a NR iteration
@@ -54,7 +57,7 @@ void FELineSearch::Serialize(DumpStream& ar)
 //! \todo Find a different way to update the deformation based on the ls.
 //! For instance, define a di so that ui = s*di. Also, define the 
 //! position of the nodes at the previous iteration.
-double FELineSearch::DoLineSearch(double s)
+double FELineSearch::DoLineSearch(double s, double E0)
 {
 	assert(m_pns);
 
@@ -77,18 +80,24 @@ double FELineSearch::DoLineSearch(double s)
 
 	double rmin = fabs(r0);
 
-	FENewtonStrategy* ns = m_pns->m_qnstrategy;
+	// energy that a step needs to fall below to satisfy the energy convergence norm.
+	// On the first iteration, the initial energy norm is given by r0.
+	double Etol = 0.0;
+	if (m_LSenergy && (m_pns->m_Etol > 0.0))
+	{
+		Etol = m_pns->m_Etol*(E0 > 0.0 ? E0 : fabs(r0));
+	}
+
+	// the step at which the model state (and R1) was last evaluated
+	double slast = -1.0;
 
 	// ul = ls*ui
 	vector<double> ul(ui.size());
 	do
 	{
-		// Update geometry
-		vcopys(ul, ui, s);
-		m_pns->Update(ul);
-
-		// calculate residual at this point
-		ns->Residual(R1, false);
+		// Update geometry and calculate residual at this point
+		EvaluateStep(ul, ui, s);
+		slast = s;
 
 		// make sure we are still in a valid range
 		if (s < m_LSmin)
@@ -99,12 +108,9 @@ double FELineSearch::DoLineSearch(double s)
 			// so let's try it here too
 			s = 0.5;
 
-			// reupdate  
-			vcopys(ul, ui, s);
-			m_pns->Update(ul);
-
-			// recalculate residual at this point
-			ns->Residual(R1, false);
+			// reupdate and recalculate residual at this point
+			EvaluateStep(ul, ui, s);
+			slast = s;
 
 			// return and hope for the best
 			break;
@@ -113,6 +119,13 @@ double FELineSearch::DoLineSearch(double s)
 		// calculate energies
 		r1 = ui*R1;
 
+		// accept this step if it already satisfies the energy convergence norm
+		if ((Etol > 0.0) && (fabs(s*r1) <= Etol))
+		{
+			smin = s;
+			break;
+		}
+
 		if ((n == 0) || (fabs(r1) < rmin))
 		{
 			smin = s;
@@ -153,10 +166,28 @@ double FELineSearch::DoLineSearch(double s)
 	{
 		// max nr of iterations reached.
 		// we choose the line step that reached the smallest energy
+		// The model is only updated again if this was not the last step evaluated.
 		s = smin;
-		vcopys(ul, ui, s);
-		m_pns->Update(ul);
-		ns->Residual(R1, false);
+		if (s != slast) EvaluateStep(ul, ui, s);
 	}
 	return s;
 }
+
+//-----------------------------------------------------------------------------
+// The update and residual evaluations are added to the solver's update and residual
+// timers, so these include the work done in the line search.
+void FELineSearch::EvaluateStep(vector<double>& ul, const vector<double>& ui, double s)
+{
+	FEModel* fem = m_pns->GetFEModel();
+
+	vcopys(ul, ui, s);
+	{
+		TimerTracker t(fem->GetTimer(TimerID::Timer_Update));
+		m_pns->Update(ul);
+	}
+
+	{
+		TimerTracker t(fem->GetTimer(TimerID::Timer_Residual));
+		m_pns->m_qnstrategy->Residual(m_pns->m_R1, false);
+	}
+}
@@ -27,6 +27,7 @@ SOFTWARE.*/
 
 
 #pragma once
+#include <vector>
 
 class FENewtonSolver;
 class DumpStream;
@@ -37,8 +38,10 @@ class FELineSearch
 public:
 	FELineSearch(FENewtonSolver* pns);
 
-	// Do a line search. ls is the initial search step
-	double DoLineSearch(double ls = 1.0);
+	// Do a line search. ls is the initial search step. E0 is the initial energy norm
+	// of the time step, used by the energy acceptance test (if zero, as on the first
+	// iteration, the energy of the search direction is used).
+	double DoLineSearch(double ls = 1.0, double E0 = 0.0);
 
 	// serialization
 	void Serialize(DumpStream& ar);
@@ -47,6 +50,11 @@ public:
 	double	m_LSmin;		//!< minimum line search step
 	double	m_LStol;		//!< line search tolerance
 	int		m_LSiter;		//!< max nr of line search iterations
+	bool	m_LSenergy;		//!< accept a step as soon as it satisfies the energy convergence norm
+
+private:
+	// update the model to the step s along ui and evaluate the residual there
+	void EvaluateStep(std::vector<double>& ul, const std::vector<double>& ui, double s);
 
 private:
 	FENewtonSolver*	m_pns;
@@ -187,7 +187,7 @@ bool FEMMGRemesh::MMG::build_mmg_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMe
 	for (int i = 0; i < NN; ++i)
 	{
 		FENode& vi = mesh.Node(i);
-		vec3d r = vi.m_r0;
+		vec3d r = vi.m_r0();
 		MMG3D_Set_vertex(mmgMesh, r.x, r.y, r.z, 0, i + 1);
 	}
 
@@ -307,8 +307,8 @@ bool FEMMGRemesh::MMG::build_mmg_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMe
 				int a = el.m_node[ET_TET[j][0]];
 				int b = el.m_node[ET_TET[j][1]];
 
-				vec3d ra = mesh.Node(a).m_r0;
-				vec3d rb = mesh.Node(b).m_r0;
+				vec3d ra = mesh.Node(a).m_r0();
+				vec3d rb = mesh.Node(b).m_r0();
 
 				double L = (ra - rb).norm2();
 
@@ -371,7 +371,7 @@ bool FEMMGRemesh::MMG::build_new_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMo
 
 	// get old node positions
 	vector<vec3d> oldNodePos(N0);
-	for (int i = 0; i < N0; ++i) oldNodePos[i] = mesh.Node(i).m_r0;
+	for (int i = 0; i < N0; ++i) oldNodePos[i] = mesh.Node(i).m_r0();
 
 	// copy nodal positions
 	vector<vec3d> nodePos0(nodes);
@@ -400,22 +400,24 @@ bool FEMMGRemesh::MMG::build_new_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMo
 		FEOctreeSearch octree(&mesh);
 		octree.Init();
 
+		// locate all the nodes
+		vector<FEElement*> nodeElem;
+		vector<vec3d> nodeIso;
+		if (octree.FindElements(nodePos0, nodeElem, nodeIso) > 0)
+		{
+			assert(false);
+			return false;
+		}
+
 		// update solution
 		for (int i = 0; i < nodes; ++i)
 		{
-			vec3d ri = nodePos0[i];
-
-			double r[3] = { 0 };
-			FESolidElement* el = (FESolidElement*)octree.FindElement(ri, r);
-			if (el == nullptr)
-			{
-				assert(false);
-				return false;
-			}
+			FESolidElement* el = (FESolidElement*)nodeElem[i];
+			double r[3] = { nodeIso[i].x, nodeIso[i].y, nodeIso[i].z };
 
 			// get the nodal coordinates
 			vec3d rt[FEElement::MAX_NODES];
-			for (int j = 0; j < el->Nodes(); ++j) rt[j] = mesh.Node(el->m_node[j]).m_rt;
+			for (int j = 0; j < el->Nodes(); ++j) rt[j] = mesh.Node(el->m_node[j]).m_rt();
 
 			nodePos[i] = el->evaluate(rt, r[0], r[1], r[2]);
 
@@ -433,6 +435,10 @@ bool FEMMGRemesh::MMG::build_new_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMo
 	{
 		// --- Do moving least-squares transfer ---
 
+		// search tree for finding the closest old nodes
+		FEKdTree tree;
+		tree.Build(oldNodePos);
+
 		// loop over all the new nodes
 		for (int i = 0; i < nodes; ++i)
 		{
@@ -441,11 +447,11 @@ bool FEMMGRemesh::MMG::build_new_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMo
 
 			// Find the closest M points
 			vector<int> closestNodes;
-			int M = findNeirestNeighbors(oldNodePos, x, 8, closestNodes);
+			int M = tree.FindKNearest(x, 8, closestNodes);
 			assert(M > 4);
 
 			// the last node is the farthest and determines the radius
-			vec3d& r = mesh.Node(closestNodes[M - 1]).m_r0;
+			vec3d& r = mesh.Node(closestNodes[M - 1]).m_r0();
 			double L = sqrt((r - x)*(r - x));
 
 			// add some offset to make sure none of the points will have a weight of zero.
@@ -459,8 +465,8 @@ bool FEMMGRemesh::MMG::build_new_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMo
 			for (int m = 0; m < M; ++m)
 			{
 				FENode& node = mesh.Node(closestNodes[m]);
-				vec3d uj = node.m_rt - node.m_r0;
-				vec3d rj = x - node.m_r0;
+				vec3d uj = node.m_rt() - node.m_r0();
+				vec3d rj = x - node.m_r0();
 
 				Xi[m] = rj;
 				Ui[m] = uj;
@@ -476,7 +482,7 @@ bool FEMMGRemesh::MMG::build_new_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMo
 				FENode& node = mesh.Node(closestNodes[0]);
 
 				// just use this point
-				nodePos[i] = node.m_rt;
+				nodePos[i] = node.m_rt();
 				for (int l = 0; l < MAX_DOFS; ++l)
 				{
 					nodeVal[i][l] = node.get(l);
@@ -555,8 +561,8 @@ bool FEMMGRemesh::MMG::build_new_mesh(MMG5_pMesh mmgMesh, MMG5_pSol mmgSol, FEMo
 	{
 		FENode& node = mesh.Node(i);
 		node.SetDOFS(MAX_DOFS);
-		node.m_r0 = nodePos0[i];
-		node.m_rt = nodePos[i];
+		node.m_r0() = nodePos0[i];
+		node.m_rt() = nodePos[i];
 		for (int j = 0; j < node.m_ID.size(); ++j) {
 			node.set(j, nodeVal[i][j]);
 		}
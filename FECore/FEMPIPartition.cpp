@@ -0,0 +1,225 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#include "stdafx.h"
+#include "FEMPIPartition.h"
+#include "FEDomainDecomposition.h"
+#include "FEModel.h"
+#include "FEMesh.h"
+#include "FEDomain.h"
+#include "log.h"
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+using namespace std;
+
+//-----------------------------------------------------------------------------
+FEMPIPartition::FEMPIPartition()
+{
+	m_fem = nullptr;
+	m_rank = 0;
+}
+
+//-----------------------------------------------------------------------------
+FEMPIPartition::~FEMPIPartition()
+{
+	Clear();
+}
+
+//-----------------------------------------------------------------------------
+int FEMPIPartition::Rank()
+{
+	int rank = 0;
+#ifdef USE_MPI
+	int binit = 0;
+	MPI_Initialized(&binit);
+	if (binit) MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+	return rank;
+}
+
+//-----------------------------------------------------------------------------
+int FEMPIPartition::Ranks()
+{
+	int ranks = 1;
+#ifdef USE_MPI
+	int binit = 0;
+	MPI_Initialized(&binit);
+	if (binit) MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+#endif
+	return ranks;
+}
+
+//-----------------------------------------------------------------------------
+void FEMPIPartition::SumAll(double* x, int n)
+{
+#ifdef USE_MPI
+	if ((Ranks() == 1) || (n == 0)) return;
+
+	// Note that we don't use MPI_Allreduce, since it does not guarantee that
+	// all ranks get the same result. The ranks make the same decisions based on
+	// these values (e.g. convergence checks), so they must be identical.
+	vector<double> tmp(x, x + n);
+	MPI_Reduce(&tmp[0], x, n, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+	MPI_Bcast(x, n, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+bool FEMPIPartition::Create(FEModel* fem, int overlap)
+{
+	Clear();
+
+	m_fem = fem;
+	m_rank = Rank();
+	int ranks = Ranks();
+
+	FEMesh& mesh = fem->GetMesh();
+	int NN = mesh.Nodes();
+
+	// partition the nodes
+	FEDomainDecomposition dd;
+	if (dd.Create(mesh, ranks, overlap) == false) return false;
+	if (dd.Subdomains() != ranks)
+	{
+		feLogErrorEx(fem, "The mesh has fewer nodes than there are ranks.");
+		return false;
+	}
+
+	// the equations of our subdomain
+	dd.Equations(mesh, m_rank, m_sub);
+
+	// a nodal equation is owned by the rank that owns the node
+	m_nodeRank.resize(NN);
+	int maxeq = -1;
+	for (int i = 0; i < NN; ++i)
+	{
+		m_nodeRank[i] = dd.NodeSubdomain(i);
+		FENode& node = mesh.Node(i);
+		for (int j = 0; j < node.dofs(); ++j) if (node.m_ID[j] > maxeq) maxeq = node.m_ID[j];
+	}
+	m_eqRank.assign(maxeq + 1, -1);
+	for (int i = 0; i < NN; ++i)
+	{
+		FENode& node = mesh.Node(i);
+		for (int j = 0; j < node.dofs(); ++j)
+		{
+			int n = node.m_ID[j];
+			if (n >= 0) m_eqRank[n] = m_nodeRank[i];
+		}
+	}
+
+	// Restrict the assembly to the elements that touch our subdomain
+	// or that are attached to a rigid node.
+	vector<bool> tag(NN, false);
+	const vector<int>& nodes = dd.Nodes(m_rank);
+	for (size_t i = 0; i < nodes.size(); ++i) tag[nodes[i]] = true;
+
+	int nelems = 0, nlocal = 0;
+	for (int i = 0; i < mesh.Domains(); ++i)
+	{
+		FEDomain& dom = mesh.Domain(i);
+		int NE = dom.Elements();
+		vector<bool> mask(NE, false);
+		for (int j = 0; j < NE; ++j)
+		{
+			FEElement& el = dom.ElementRef(j);
+			for (int k = 0; k < el.Nodes(); ++k)
+			{
+				int n = el.m_node[k];
+				if (tag[n] || (mesh.Node(n).m_rid >= 0)) { mask[j] = true; break; }
+			}
+			if (mask[j]) nlocal++;
+		}
+		dom.SetAssemblyMask(mask);
+		nelems += NE;
+	}
+
+	feLogEx(fem, "MPI partition: rank %d of %d\n", m_rank + 1, ranks);
+	feLogEx(fem, "\tNr of owned nodes ......................... : %d\n", (int)dd.OwnedNodes(m_rank).size());
+	feLogEx(fem, "\tNr of subdomain equations ................. : %d\n", (int)m_sub.size());
+	feLogEx(fem, "\tNr of assembled elements .................. : %d (of %d)\n", nlocal, nelems);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void FEMPIPartition::Clear()
+{
+	if (m_fem)
+	{
+		FEMesh& mesh = m_fem->GetMesh();
+		for (int i = 0; i < mesh.Domains(); ++i) mesh.Domain(i).SetAssemblyMask(vector<bool>());
+	}
+	m_fem = nullptr;
+	m_eqRank.clear();
+	m_nodeRank.clear();
+	m_sub.clear();
+}
+
+//-----------------------------------------------------------------------------
+void FEMPIPartition::GatherOwnedRows(vector<double>& R) const
+{
+	int N = (int)R.size();
+	for (int i = 0; i < N; ++i)
+	{
+		if (EquationRank(i) != m_rank) R[i] = 0.0;
+	}
+	if (N > 0) SumAll(&R[0], N);
+}
+
+//-----------------------------------------------------------------------------
+void FEMPIPartition::GatherNodalLoads() const
+{
+	FEMesh& mesh = m_fem->GetMesh();
+	int NN = mesh.Nodes();
+	int ndofs = mesh.NodeDOFS();
+	if ((NN == 0) || (ndofs == 0)) return;
+
+	vector<double> F(NN*ndofs, 0.0);
+	for (int i = 0; i < NN; ++i)
+	{
+		if (m_nodeRank[i] == m_rank)
+		{
+			FENode& node = mesh.Node(i);
+			for (int j = 0; j < ndofs; ++j) F[i*ndofs + j] = node.get_load(j);
+		}
+	}
+
+	SumAll(&F[0], NN*ndofs);
+
+	for (int i = 0; i < NN; ++i)
+	{
+		FENode& node = mesh.Node(i);
+		for (int j = 0; j < ndofs; ++j) node.set_load(j, F[i*ndofs + j]);
+	}
+}
@@ -0,0 +1,98 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#pragma once
+#include "fecore_api.h"
+#include <vector>
+
+class FEModel;
+
+//-----------------------------------------------------------------------------
+//! Partition of a model over the ranks of an MPI run.
+
+//! Every rank reads the complete model. The mesh nodes are divided over the 
+//! ranks (see FEDomainDecomposition) and each rank's subdomain is extended with
+//! a number of ghost node layers. A rank only assembles the elements that touch
+//! its subdomain. This is enough to form the residual and stiffness matrix rows 
+//! of the equations that the rank owns, as well as the complete matrix block of
+//! its subdomain. Equations that do not belong to a node (e.g. rigid body dofs 
+//! and Lagrange multipliers) are owned by rank 0. Since elements that are attached
+//! to rigid nodes contribute to the rigid body equations, these elements are 
+//! assembled on all ranks.
+//! When FEBio is built without MPI (i.e. USE_MPI is not defined), there is only one rank.
+class FECORE_API FEMPIPartition
+{
+public:
+	FEMPIPartition();
+	~FEMPIPartition();
+
+	//! the rank of this process
+	static int Rank();
+
+	//! the number of ranks
+	static int Ranks();
+
+	//! Sum the vector x over all ranks. The sum is formed on rank 0 and sent
+	//! to all other ranks, so that all ranks hold identical values.
+	static void SumAll(double* x, int n);
+
+public:
+	//! Partition the mesh over the ranks, with the given number of ghost node layers.
+	//! This also restricts the element assembly of the mesh domains to the elements
+	//! that are needed by this rank.
+	bool Create(FEModel* fem, int overlap);
+
+	//! Remove the assembly restriction from the mesh domains
+	void Clear();
+
+	//! the equations of this rank's subdomain, including the ghost nodes' equations
+	//! (This does not include equations that do not belong to a node.)
+	const std::vector<int>& SubdomainEquations() const { return m_sub; }
+
+	//! see if equation i belongs to a node
+	bool IsNodalEquation(int i) const { return ((i < (int) m_eqRank.size()) && (m_eqRank[i] >= 0)); }
+
+	//! the rank that owns equation i
+	int EquationRank(int i) const { return (IsNodalEquation(i) ? m_eqRank[i] : 0); }
+
+	//! Combine a vector of which each rank only formed the rows of its own 
+	//! equations. Afterwards, all ranks hold the complete vector.
+	void GatherOwnedRows(std::vector<double>& R) const;
+
+	//! Same as GatherOwnedRows, but for the nodal loads (i.e. reaction forces)
+	void GatherNodalLoads() const;
+
+private:
+	FEModel*			m_fem;
+	int					m_rank;		//!< rank of this process
+	std::vector<int>	m_eqRank;	//!< rank that owns each nodal equation (-1 for other equations)
+	std::vector<int>	m_nodeRank;	//!< rank that owns each node
+	std::vector<int>	m_sub;		//!< equations of this rank's subdomain
+};
@@ -89,7 +89,7 @@ mat3d FEMat3dLocalElementMap::operator () (const FEMaterialPoint& mp)
 	FEElement& el = *mp.m_elem;
 
 	vec3d r0[FEElement::MAX_NODES];
-	for (int i=0; i<el.Nodes(); ++i) r0[i] = mesh.Node(el.m_node[i]).m_r0;
+	for (int i=0; i<el.Nodes(); ++i) r0[i] = mesh.Node(el.m_node[i]).m_r0();
 
 	vec3d a, b, c, d;
 	mat3d Q;
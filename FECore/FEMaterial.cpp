@@ -62,6 +62,15 @@ mat3d FEMaterial::GetLocalCS(const FEMaterialPoint& mp)
 	else return m_Q(mp);
 }
 
+//-----------------------------------------------------------------------------
+// see if the local coordinate system is the same at all material points
+bool FEMaterial::IsLocalCSConstant()
+{
+	if (m_Q.isConst() == false) return false;
+	FEMaterial* parent = dynamic_cast<FEMaterial*>(GetParent());
+	return (parent ? parent->IsLocalCSConstant() : true);
+}
+
 //-----------------------------------------------------------------------------
 //! Initial material.
 bool FEMaterial::Init()
@@ -67,6 +67,9 @@ public:
 	// evaluate local coordinate system at material point
 	mat3d GetLocalCS(const FEMaterialPoint& mp);
 
+	// see if the local coordinate system is the same at all material points
+	bool IsLocalCSConstant();
+
 public:
 	//! Assign a domain to this material
 	void AddDomain(FEDomain* dom);
@@ -67,6 +67,8 @@ FEDataMap* CreateDataMap(int mapType)
 FEMesh::FEMesh(FEModel* fem) : m_fem(fem)
 {
 	m_LUT = 0;
+	m_ndofs = 0;
+	m_breordered = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -93,7 +95,20 @@ void FEMesh::Serialize(DumpStream& ar)
 	ar.LockPointerTable();
 	{
 		// store the node list
-		ar & m_Node;
+		// The dof data is owned by the mesh, so it needs to be allocated
+		// before the nodes can be read.
+		if (ar.IsShallow() == false)
+		{
+			int NN = Nodes();
+			int ndofs = m_ndofs;
+			ar & NN & ndofs & m_breordered;
+			if (ar.IsLoading())
+			{
+				if (NN > 0) CreateNodes(NN);
+				SetDOFS(ndofs);
+			}
+		}
+		for (int i = 0; i < Nodes(); ++i) ar & m_Node[i];
 	}
 	ar.UnlockPointerTable();
 
@@ -213,6 +228,7 @@ void FEMesh::CreateNodes(int nodes)
 {
 	assert(nodes);
 	m_Node.resize(nodes);
+	ResizeNodalData();
 
 	// set the default node IDs
 	for (int i=0; i<nodes; ++i) Node(i).SetID(i+1);
@@ -234,14 +250,70 @@ void FEMesh::AddNodes(int nodes)
 	if (N0 > 0) n0 = m_Node[N0-1].GetID() + 1;
 
 	m_Node.resize(N0 + nodes);
+	ResizeNodalData();
 	for (int i=0; i<nodes; ++i) m_Node[i+N0].SetID(n0+i);
 }
 
 //-----------------------------------------------------------------------------
+// This allocates the nodal dof arrays. Existing dof data is reset.
 void FEMesh::SetDOFS(int n)
+{
+	m_ndofs = n;
+	int NN = Nodes();
+	m_val_t.assign(NN*n, 0.0);
+	m_val_p.assign(NN*n, 0.0);
+	m_Fr.assign(NN*n, 0.0);
+	m_BC.assign(NN*n, 0);
+	m_ID.assign(NN*n, -1);
+	BindNodalData();
+}
+
+//-----------------------------------------------------------------------------
+// The node list was resized. The data of the remaining nodes is kept and the
+// data of any new nodes is reset.
+void FEMesh::ResizeNodalData()
+{
+	int NN = Nodes();
+	m_r0.resize(NN, vec3d(0,0,0));
+	m_rt.resize(NN, vec3d(0,0,0));
+	m_at.resize(NN, vec3d(0,0,0));
+	m_rp.resize(NN, vec3d(0,0,0));
+	m_vp.resize(NN, vec3d(0,0,0));
+	m_ap.resize(NN, vec3d(0,0,0));
+	m_d0.resize(NN, vec3d(0,0,0));
+	m_dt.resize(NN, vec3d(0,0,0));
+	m_dp.resize(NN, vec3d(0,0,0));
+	m_val_t.resize(NN*m_ndofs, 0.0);
+	m_val_p.resize(NN*m_ndofs, 0.0);
+	m_Fr.resize(NN*m_ndofs, 0.0);
+	m_BC.resize(NN*m_ndofs, 0);
+	m_ID.resize(NN*m_ndofs, -1);
+	BindNodalData();
+}
+
+//-----------------------------------------------------------------------------
+// The node data pointers need to be reassigned each time the node list or the
+// nodal arrays are reallocated.
+void FEMesh::BindNodalData()
 {
 	int NN = Nodes();
-	for (int i=0; i<NN; ++i) m_Node[i].SetDOFS(n);
+	for (int i=0; i<NN; ++i)
+	{
+		m_Node[i].SetGeometryPointers(&m_r0[i], &m_rt[i], &m_at[i], &m_rp[i], &m_vp[i], &m_ap[i], &m_d0[i], &m_dt[i], &m_dp[i]);
+
+		if (m_ndofs > 0)
+		{
+			int n = i*m_ndofs;
+			m_Node[i].SetDataPointers(m_ndofs, &m_ID[n], &m_val_t[n], &m_val_p[n], &m_Fr[n], &m_BC[n]);
+		}
+		else m_Node[i].SetDataPointers(0, 0, 0, 0, 0, 0);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FEMesh::UpdateNodalValues()
+{
+	m_val_p = m_val_t;
 }
 
 //-----------------------------------------------------------------------------
@@ -281,10 +353,10 @@ void FEMesh::UpdateBox()
 {
 	if (Nodes() > 0)
 	{
-		m_box = FEBoundingBox(Node(0).m_rt);
+		m_box = FEBoundingBox(Node(0).m_rt());
 		for (int i=1; i<Nodes(); ++i)
 		{
-			m_box.add(Node(i).m_rt);
+			m_box.add(Node(i).m_rt());
 		}
 	}
 	else m_box = FEBoundingBox(vec3d(0,0,0));
@@ -341,6 +413,22 @@ void FEMesh::InitMaterialPoints()
 void FEMesh::Clear()
 {
 	m_Node.clear();
+	m_ndofs = 0;
+	m_breordered = false;
+	m_r0.clear();
+	m_rt.clear();
+	m_at.clear();
+	m_rp.clear();
+	m_vp.clear();
+	m_ap.clear();
+	m_d0.clear();
+	m_dt.clear();
+	m_dp.clear();
+	m_ID.clear();
+	m_val_t.clear();
+	m_val_p.clear();
+	m_Fr.clear();
+	m_BC.clear();
 	for (size_t i=0; i<m_Domain.size (); ++i) delete m_Domain [i];
 
 	// TODO: Surfaces are currently managed by the classes that use them so don't delete them
@@ -377,10 +465,10 @@ void FEMesh::Reset()
 	{
 		FENode& node = Node(i);
 
-		node.m_rp = node.m_rt = node.m_r0;
-		node.m_vp = vec3d(0,0,0);
-		node.m_ap = node.m_at = vec3d(0,0,0);
-        node.m_dp = node.m_dt = node.m_d0;
+		node.m_rp() = node.m_rt() = node.m_r0();
+		node.m_vp() = vec3d(0,0,0);
+		node.m_ap() = node.m_at() = vec3d(0,0,0);
+        node.m_dp() = node.m_dt() = node.m_d0();
 
 		// reset ID arrays
 		int ndof = (int)node.dofs();
@@ -732,13 +820,17 @@ FESurface* FEMesh::ElementBoundarySurface(std::vector<FEDomain*> domains, bool b
 
 	for (int i = 0; i < domains.size(); i++)
 	{
+		// the neighbor list is indexed by the element's position in the mesh
+		int noff = 0;
+		for (int n = 0; (n < Domains()) && (&Domain(n) != domains[i]); ++n) noff += Domain(n).Elements();
+
 		for (int j = 0; j < domains[i]->Elements(); j++)
 		{
 			FEElement& el = domains[i]->ElementRef(j);
 			int nf = el.Faces();
 			for (int k = 0; k<nf; ++k)
 			{
-				FEElement* pen = EEL.Neighbor(el.GetID()-1, k);
+				FEElement* pen = EEL.Neighbor(noff + j, k);
 				if ((pen == nullptr) && boutside) ++NF;
 				else if (pen && (std::find(domains.begin(), domains.end(), pen->GetMeshPartition()) == domains.end()) && boutside) ++NF;
 				if ((pen != nullptr) && (el.GetID() < pen->GetID()) && binside && (std::find(domains.begin(), domains.end(), pen->GetMeshPartition()) != domains.end())) ++NF;
@@ -756,13 +848,16 @@ FESurface* FEMesh::ElementBoundarySurface(std::vector<FEDomain*> domains, bool b
 	NF = 0;
 	for (int i = 0; i < domains.size(); i++)
 	{
+		int noff = 0;
+		for (int n = 0; (n < Domains()) && (&Domain(n) != domains[i]); ++n) noff += Domain(n).Elements();
+
 		for (int j = 0; j < domains[i]->Elements(); j++)
 		{
 			FEElement& el = domains[i]->ElementRef(j);
 			int nf = el.Faces();
 			for (int k = 0; k < nf; ++k)
 			{
-				FEElement* pen = EEL.Neighbor(el.GetID()-1, k);
+				FEElement* pen = EEL.Neighbor(noff + j, k);
 				if (((pen == nullptr) && boutside) ||
 					(pen && (std::find(domains.begin(), domains.end(), pen->GetMeshPartition()) == domains.end()) && boutside) ||
 					((pen != nullptr) && (el.GetID() < pen->GetID()) && binside && (std::find(domains.begin(), domains.end(), pen->GetMeshPartition()) != domains.end())))
@@ -808,7 +903,7 @@ FESurface* FEMesh::ElementBoundarySurface(std::vector<FEDomain*> domains, bool b
 void FEMesh::GetInitialNodalCoordinates(const FEElement& el, vec3d* node)
 {
 	const int neln = el.Nodes();
-	for (int i=0; i<neln; ++i) node[i] = Node(el.m_node[i]).m_r0;
+	for (int i=0; i<neln; ++i) node[i] = Node(el.m_node[i]).m_r0();
 }
 
 //-----------------------------------------------------------------------------
@@ -816,7 +911,7 @@ void FEMesh::GetInitialNodalCoordinates(const FEElement& el, vec3d* node)
 void FEMesh::GetNodalCoordinates(const FEElement& el, vec3d* node)
 {
 	const int neln = el.Nodes();
-	for (int i=0; i<neln; ++i) node[i] = Node(el.m_node[i]).m_rt;
+	for (int i=0; i<neln; ++i) node[i] = Node(el.m_node[i]).m_rt();
 }
 
 //=============================================================================
@@ -103,6 +103,23 @@ public:
 	//! Set the number of degrees of freedom on this mesh
 	void SetDOFS(int n);
 
+	//! return the number of degrees of freedom per node
+	int NodeDOFS() const { return m_ndofs; }
+
+	//! copy the current nodal values to the previous values for all nodes
+	void UpdateNodalValues();
+
+	//! nodal position arrays, indexed by the node's index in the mesh
+	//! (Use these in loops that gather the coordinates of many nodes.)
+	const vec3d* ReferencePositions() const { return &m_r0[0]; }
+	const vec3d* CurrentPositions() const { return &m_rt[0]; }
+	const vec3d* PreviousPositions() const { return &m_rp[0]; }
+
+	//! nodal director arrays, indexed by the node's index in the mesh
+	const vec3d* ReferenceDirectors() const { return &m_d0[0]; }
+	const vec3d* CurrentDirectors() const { return &m_dt[0]; }
+	const vec3d* PreviousDirectors() const { return &m_dp[0]; }
+
 	//! update bounding box
 	void UpdateBox();
 
@@ -241,6 +258,10 @@ public:
 	// Get the FE model
 	FEModel* GetFEModel() const { return m_fem; }
 
+	//! set/get whether the nodes and elements are stored in a different order than their IDs
+	void SetReordered(bool b) { m_breordered = b; }
+	bool IsReordered() const { return m_breordered; }
+
 	// update the domains of the mesh
 	void Update(const FETimeInfo& tp);
 
@@ -256,8 +277,35 @@ protected:
 	double SolidElementVolume(FESolidElement& el);
 	double ShellElementVolume(FEShellElement& el);
 
+private:
+	//! resize the nodal arrays after nodes were added
+	void ResizeNodalData();
+
+	//! assign the nodal geometry and dof data to the nodes
+	void BindNodalData();
+
 private:
 	vector<FENode>		m_Node;		//!< nodes
+
+	// nodal geometry data, stored as separate arrays for all nodes
+	vector<vec3d>		m_r0;		//!< initial positions
+	vector<vec3d>		m_rt;		//!< current positions
+	vector<vec3d>		m_at;		//!< nodal accelerations
+	vector<vec3d>		m_rp;		//!< positions at previous time step
+	vector<vec3d>		m_vp;		//!< previous velocities
+	vector<vec3d>		m_ap;		//!< previous accelerations
+	vector<vec3d>		m_d0;		//!< initial directors
+	vector<vec3d>		m_dt;		//!< current directors
+	vector<vec3d>		m_dp;		//!< directors at previous time step
+
+	// nodal dof data, stored as separate arrays for all nodes
+	// (node i, dof j is at i*m_ndofs + j)
+	int					m_ndofs;	//!< nr of dofs per node
+	vector<int>			m_ID;		//!< nodal equation numbers
+	vector<double>		m_val_t;	//!< current nodal dof values
+	vector<double>		m_val_p;	//!< previous nodal dof values
+	vector<double>		m_Fr;		//!< equivalent nodal forces
+	vector<int>			m_BC;		//!< nodal boundary condition flags
 	vector<FEDomain*>	m_Domain;	//!< list of domains
 	vector<FESurface*>	m_Surf;		//!< surfaces
 	vector<FEEdge*>		m_Edge;		//!< Edges
@@ -276,6 +324,8 @@ private:
 	FENodeElemList	m_NEL;
 	FEElementLUT*	m_LUT;
 
+	bool		m_breordered;	//!< nodes and elements were reordered at load time
+
 	FEModel*	m_fem;
 private:
 	//! hide the copy constructor
@@ -181,3 +181,80 @@ void FEMeshPartition::ForEachElement(std::function<void(FEElement& el)> f)
 	int NE = Elements();
 	for (int i = 0; i < NE; ++i) f(ElementRef(i));
 }
+
+//-----------------------------------------------------------------------------
+// Calculates a greedy coloring of the partition's elements, such that no two elements 
+// of the same color share a node.
+const std::vector< std::vector<int> >& FEMeshPartition::ElementColoring()
+{
+	int NE = Elements();
+	if (m_colors.empty() && (NE > 0))
+	{
+		FEMesh& mesh = *GetMesh();
+
+		// the colors that have been assigned to the elements of each node
+		vector< vector<int> > nodeColors(mesh.Nodes());
+
+		// tag[c] == i means color c cannot be used for element i
+		vector<int> tag;
+		for (int i = 0; i < NE; ++i)
+		{
+			FEElement& el = ElementRef(i);
+			int ne = el.Nodes();
+			for (int j = 0; j < ne; ++j)
+			{
+				const vector<int>& nc = nodeColors[el.m_node[j]];
+				for (size_t k = 0; k < nc.size(); ++k) tag[nc[k]] = i;
+			}
+
+			// find the first available color
+			int c = 0;
+			while ((c < (int)tag.size()) && (tag[c] == i)) c++;
+			if (c == (int)tag.size())
+			{
+				tag.push_back(-1);
+				m_colors.push_back(vector<int>());
+			}
+
+			m_colors[c].push_back(i);
+			for (int j = 0; j < ne; ++j) nodeColors[el.m_node[j]].push_back(c);
+		}
+	}
+	return m_colors;
+}
+
+//-----------------------------------------------------------------------------
+void FEMeshPartition::ResetElementColoring()
+{
+	m_colors.clear();
+}
+
+//-----------------------------------------------------------------------------
+void FEMeshPartition::ParallelAssemble(FEGlobalVector& R, std::function<void(int iel)> f)
+{
+	if (R.ColoredAssembly())
+	{
+		const vector< vector<int> >& colors = ElementColoring();
+		R.SetExclusiveAccess(true);
+		for (size_t c = 0; c < colors.size(); ++c)
+		{
+			const vector<int>& elemList = colors[c];
+			int NE = (int)elemList.size();
+			#pragma omp parallel for shared(NE)
+			for (int i = 0; i < NE; ++i)
+			{
+				if (AssembleElement(elemList[i])) f(elemList[i]);
+			}
+		}
+		R.SetExclusiveAccess(false);
+	}
+	else
+	{
+		int NE = Elements();
+		#pragma omp parallel for shared(NE)
+		for (int i = 0; i < NE; ++i)
+		{
+			if (AssembleElement(i)) f(i);
+		}
+	}
+}
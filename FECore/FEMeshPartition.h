@@ -134,6 +134,28 @@ public:
 	int DataExports() const { return (int)m_Data.size(); }
 	FEDataExport* GetDataExport(int i) { return m_Data[i]; }
 
+public:
+	//! Get the element coloring. Elements of the same color do not share nodes, so
+	//! their element vectors can be assembled concurrently without atomics.
+	//! (The coloring is calculated on the first call, which must be outside a parallel region.)
+	const std::vector< std::vector<int> >& ElementColoring();
+
+	//! Discard the element coloring. This must be called when the elements or their
+	//! connectivity change, e.g. in Create or after a remesh.
+	void ResetElementColoring();
+
+	//! Calls f for each element (by index) in parallel, where f assembles into R. If R 
+	//! requests a colored assembly, the elements are processed color-by-color and R
+	//! is assembled without atomics. Otherwise, all elements are processed at once.
+	void ParallelAssemble(FEGlobalVector& R, std::function<void(int iel)> f);
+
+	//! Restrict the assembly to the elements for which the mask is true. This is
+	//! used in MPI runs (see FEMPIPartition). An empty mask assembles all elements.
+	void SetAssemblyMask(const std::vector<bool>& mask) { m_asmMask = mask; }
+
+	//! see if element i needs to be assembled
+	bool AssembleElement(int i) const { return (m_asmMask.empty() || m_asmMask[i]); }
+
 public:
 	bool IsActive() const { return m_bactive; }
 	void SetActive(bool b) { m_bactive = b; }
@@ -149,4 +171,6 @@ protected:
 
 private:
 	vector<FEDataExport*>	m_Data;	//!< list of data export classes
+	vector< vector<int> >	m_colors;	//!< element coloring (see ElementColoring)
+	vector<bool>			m_asmMask;	//!< element assembly mask (see SetAssemblyMask)
 };
@@ -110,7 +110,7 @@ public:
 
 		// allocate timers
 		// Make sure enough timers are allocated for all the TimerIds!
-		m_timers.resize(6);
+		m_timers.resize(7);
 	}
 
 	void Serialize(DumpStream& ar);
@@ -901,7 +901,7 @@ void FEModel::InitShells()
 				int* en = &el.m_node[0];
 
 				// get the nodes
-				for (int j = 0; j<n; ++j) r0[j] = mesh.Node(en[j]).m_r0;
+				for (int j = 0; j<n; ++j) r0[j] = mesh.Node(en[j]).m_r0();
 				for (int j = 0; j<n; ++j)
 				{
 					int m0 = j;
@@ -923,7 +923,7 @@ void FEModel::InitShells()
 	// assign initial directors to shell nodes
 	// make sure we average the directors
 	for (int i = 0; i<NN; ++i)
-		if (ND[i] > 0) mesh.Node(i).m_d0 = D[i] / ND[i];
+		if (ND[i] > 0) mesh.Node(i).m_d0() = D[i] / ND[i];
 
 	// do any other shell initialization 
 	for (int nd = 0; nd<mesh.Domains(); ++nd)
@@ -1232,7 +1232,7 @@ FEParamValue FEModel::GetMeshParameter(const ParamString& paramString)
 		if (node)
 		{
 			ParamString paramString = next.next();
-			if      (paramString == "position"      ) return GetComponent(node->m_rt, paramString.next());
+			if      (paramString == "position"      ) return GetComponent(node->m_rt(), paramString.next());
 			// TODO: the m_Fr is not a vec3d any more, so not sure what to do here.
 			//       In any case, this should probably be handled by the FEMechModel
 //			else if (paramString == "reaction_force") return GetComponent(node->m_Fr, paramString.next());
@@ -1652,6 +1652,7 @@ void FEModel::CopyFrom(FEModel& fem)
 	FEMesh& mesh = GetMesh();
 	int N = sourceMesh.Nodes();
 	mesh.CreateNodes(N);
+	mesh.SetDOFS(sourceMesh.NodeDOFS());
 	for (int i=0; i<N; ++i)
 	{
 		mesh.Node(i) = sourceMesh.Node(i);
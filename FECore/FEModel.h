@@ -75,7 +75,8 @@ enum TimerID {
 	Timer_Reform,
 	Timer_Residual,
 	Timer_Stiffness,
-	Timer_QNUpdate
+	Timer_QNUpdate,
+	Timer_LineSearch
 };
 
 //-----------------------------------------------------------------------------
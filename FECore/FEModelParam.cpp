@@ -32,6 +32,8 @@ SOFTWARE.*/
 #include "FEDataArray.h"
 #include "DumpStream.h"
 #include "FEConstValueVec3.h"
+#include "FEMeshPartition.h"
+#include "FEElement.h"
 
 //---------------------------------------------------------------------------------------
 FEModelParam::FEModelParam()
@@ -61,6 +63,7 @@ FEParamDouble::FEParamDouble(const FEParamDouble& p)
 	m_val = p.m_val->copy();
 	m_scl = p.m_scl;
 	m_dom = p.m_dom;
+	m_bake = p.m_bake;
 }
 
 // set the value
@@ -74,6 +77,7 @@ void FEParamDouble::operator = (double v)
 // set the valuator
 void FEParamDouble::setValuator(FEScalarValuator* val)
 {
+	m_bake.clear();
 	if (m_val) delete m_val;
 	m_val = val;
 	if (val) val->SetModelParam(this);
@@ -103,6 +107,67 @@ bool FEParamDouble::Init()
 	return (m_val ? m_val->Init() : true);
 }
 
+bool FEParamDouble::Bake(FEMeshPartition& dom)
+{
+	// constant values are cheap enough to evaluate
+	if ((m_val == nullptr) || m_val->isConst()) return false;
+	if (m_val->isTimeInvariant() == false) return false;
+
+	BakedValues b;
+	b.dom = &dom;
+	int NE = dom.Elements();
+	b.offset.resize(NE + 1);
+	b.offset[0] = 0;
+	for (int i = 0; i < NE; ++i) b.offset[i + 1] = b.offset[i] + dom.ElementRef(i).GaussPoints();
+	b.val.resize(b.offset[NE]);
+
+	for (int i = 0; i < NE; ++i)
+	{
+		FEElement& el = dom.ElementRef(i);
+		assert(el.GetLocalID() == i);
+		for (int n = 0; n < el.GaussPoints(); ++n)
+		{
+			FEMaterialPoint* mp = el.GetMaterialPoint(n);
+			if (mp == nullptr) return false;
+			b.val[b.offset[i] + n] = (*m_val)(*mp);
+		}
+	}
+
+	// replace the values of this domain if they were baked before
+	for (size_t i = 0; i < m_bake.size(); ++i)
+	{
+		if (m_bake[i].dom == &dom) { m_bake[i] = b; return true; }
+	}
+	m_bake.push_back(b);
+	return true;
+}
+
+void FEParamDouble::ClearBake()
+{
+	m_bake.clear();
+}
+
+const double* FEParamDouble::bakedValue(const FEMaterialPoint& pt) const
+{
+	const FEElement* el = pt.m_elem;
+	if (el == nullptr) return nullptr;
+
+	const FEMeshPartition* dom = el->GetMeshPartition();
+	for (size_t i = 0; i < m_bake.size(); ++i)
+	{
+		const BakedValues& b = m_bake[i];
+		if (b.dom == dom)
+		{
+			int lid = el->GetLocalID();
+			if ((lid < 0) || (lid + 1 >= (int)b.offset.size())) return nullptr;
+			int n0 = b.offset[lid];
+			if ((pt.m_index >= 0) && (pt.m_index < b.offset[lid + 1] - n0)) return &b.val[n0 + pt.m_index];
+			return nullptr;
+		}
+	}
+	return nullptr;
+}
+
 //---------------------------------------------------------------------------------------
 FEParamVec3::FEParamVec3()
 {
@@ -32,6 +32,9 @@ SOFTWARE.*/
 #include "FEMat3dValuator.h"
 #include "FEMat3dsValuator.h"
 #include "FEItemList.h"
+#include <vector>
+
+class FEMeshPartition;
 
 //---------------------------------------------------------------------------------------
 // Base for model parameters.
@@ -79,11 +82,28 @@ public:
 	FEScalarValuator* valuator();
 
 	// evaluate the parameter at a material point
-	double operator () (const FEMaterialPoint& pt) { return m_scl*(*m_val)(pt); }
+	double operator () (const FEMaterialPoint& pt)
+	{
+		if (m_bake.empty() == false)
+		{
+			const double* v = bakedValue(pt);
+			if (v) return m_scl*(*v);
+		}
+		return m_scl*(*m_val)(pt);
+	}
 
 	// is this a const value
 	bool isConst() const;
 
+	// Evaluate the valuator at all integration points of the domain and store the values.
+	// Returns false (and stores nothing) if the parameter is constant, or if its
+	// value can change over time. Note that the scale factor is not baked in, so
+	// load controlled parameters can still be baked.
+	bool Bake(FEMeshPartition& dom);
+
+	// remove all baked values
+	void ClearBake();
+
 	// get the const value (return value undefined if param is not const)
 	double& constValue();
 	double constValue() const;
@@ -92,8 +112,21 @@ public:
 
 	bool Init();
 
+private:
+	// returns the baked value at a material point, or null if not baked
+	const double* bakedValue(const FEMaterialPoint& pt) const;
+
 private:
 	FEScalarValuator*	m_val;
+
+	// values of the valuator at the integration points of a domain
+	struct BakedValues
+	{
+		FEMeshPartition*	dom;
+		std::vector<int>	offset;	// offset into val for each element (size = elements + 1)
+		std::vector<double>	val;	// values at integration points
+	};
+	std::vector<BakedValues>	m_bake;
 };
 
 //=======================================================================================
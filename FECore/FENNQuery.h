@@ -30,23 +30,17 @@ SOFTWARE.*/
 #include "vec3d.h"
 #include <vector>
 #include "fecore_api.h"
+#include "FEKdTree.h"
 
 class FESurface;
 
 //-----------------------------------------------------------------------------
-//! This class is a helper class to locate the nearest neighbour on a surface
+//! This class is a helper class to locate the nearest neighbour on a surface.
+//! The queries do not modify the search structure, so they can be called 
+//! concurrently from multiple threads.
 
 class FECORE_API FENNQuery
 {
-public:
-	struct NODE
-	{
-		int		i;	// index of node
-		vec3d	r;	// position of node
-		double	d1;	// distance to pivot 1
-		double	d2;	// distance to pivot 2
-	};
-
 public:
 	FENNQuery(FESurface* ps = 0);
 	virtual ~FENNQuery();
@@ -55,25 +49,28 @@ public:
 	void Init();
 	void InitReference();
 
+	//! update the search structures with the current nodal positions
+	//! (this is faster than Init, but queries slow down when the nodes moved a lot)
+	void Update();
+
 	//! attach to a surface
 	void Attach(FESurface* ps) { m_ps = ps; }
 
 	//! find the neirest neighbour of r
-	int Find(vec3d x);	
-	int FindReference(vec3d x);	
+	int Find(vec3d x) const;
+	int FindReference(vec3d x) const;
 
-protected:
-	int FindRadius(double r);
+	//! find the k nearest neighbours of x, sorted by distance
+	int FindKNearest(const vec3d& x, int k, std::vector<int>& closestNodes) const;
+
+	//! find the nearest neighbours of a list of points
+	void Find(const std::vector<vec3d>& x, std::vector<int>& closestNodes) const;
 
 protected:
 	FESurface*	m_ps;	//!< the surface to search
-	std::vector<NODE>	m_bk;	// BK tree
-
-	vec3d	m_q1;	// pivot 1
-	vec3d	m_q2;	// pivot 2
-
-	int		m_imin;	// last found index
+	FEKdTree	m_tree;	//!< search tree of the surface nodes
 };
 
 // function for finding the k closest neighbors
+// (This does a linear search. Use FEKdTree when searching the same points repeatedly.)
 int findNeirestNeighbors(const std::vector<vec3d>& point, const vec3d& x, int k, std::vector<int>& closestNodes);
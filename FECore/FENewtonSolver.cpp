@@ -39,6 +39,7 @@ SOFTWARE.*/
 #include "FEDomain.h"
 #include "DumpStream.h"
 #include "FELinearSystem.h"
+#include "FEMPIPartition.h"
 
 //-----------------------------------------------------------------------------
 // define the parameter list
@@ -46,6 +47,7 @@ BEGIN_FECORE_CLASS(FENewtonSolver, FESolver)
 	ADD_PARAMETER(m_lineSearch->m_LStol , FE_RANGE_GREATER_OR_EQUAL(0.0), "lstol"   );
 	ADD_PARAMETER(m_lineSearch->m_LSmin , FE_RANGE_GREATER_OR_EQUAL(0.0), "lsmin"   );
 	ADD_PARAMETER(m_lineSearch->m_LSiter, FE_RANGE_GREATER_OR_EQUAL(0), "lsiter"  );
+	ADD_PARAMETER(m_lineSearch->m_LSenergy, "lsenergy");
 	ADD_PARAMETER(m_maxref              , FE_RANGE_GREATER_OR_EQUAL(0.0), "max_refs");
 	ADD_PARAMETER(m_bzero_diagonal      , "check_zero_diagonal");
 	ADD_PARAMETER(m_zero_tol            , "zero_diagonal_tol"  );
@@ -54,6 +56,8 @@ BEGIN_FECORE_CLASS(FENewtonSolver, FESolver)
 	ADD_PARAMETER(m_breformAugment      , "reform_augment");
 	ADD_PARAMETER(m_bdivreform          , "diverge_reform");
 	ADD_PARAMETER(m_bdoreforms          , "do_reforms"  );
+	ADD_PARAMETER(m_breuseStiffness     , "reuse_stiffness");
+	ADD_PARAMETER(m_reformRatio         , FE_RANGE_GREATER(0.0), "reform_ratio");
 	ADD_PARAMETER(m_Etol                , "etol"        );
 	ADD_PARAMETER(m_Rtol                , "rtol"        );
 	ADD_PARAMETER(m_Rmin, FE_RANGE_GREATER_OR_EQUAL(0.0), "min_residual");
@@ -79,6 +83,8 @@ FENewtonSolver::FENewtonSolver(FEModel* pfem) : FESolver(pfem)
 	m_maxref = 15;
 
 	m_nref = 0;
+	m_nreuse = 0;
+	m_nrateReform = 0;
 
     m_neq = 0;
     m_plinsolve = 0;
@@ -107,6 +113,8 @@ FENewtonSolver::FENewtonSolver(FEModel* pfem) : FESolver(pfem)
 	m_force_partition = 0;
 	m_breformtimestep = true;
 	m_breformAugment = false;
+	m_breuseStiffness = false;
+	m_reformRatio = 0.5;
 }
 
 //-----------------------------------------------------------------------------
@@ -201,15 +209,22 @@ bool FENewtonSolver::ReformStiffness()
 		// calculate the global stiffness matrix
 	    bret = StiffnessMatrix();
 
+		// in MPI runs, each rank only formed the rhs adjustment of its own equations
+		const FEMPIPartition* mpi = m_plinsolve->GetMPIPartition();
+		if (mpi) mpi->GatherOwnedRows(m_Fd);
+
 		// check for zero diagonals
 		if (m_bzero_diagonal)
 		{
 			// get the stiffness matrix
+			// (In MPI runs, each rank checks the equations it owns.)
 			SparseMatrix& K = *m_pK;
 			vector<int> zd;
 			int neq = K.Rows();
 			for (int i=0; i<neq; ++i)
 			{
+				if (mpi && (mpi->EquationRank(i) != FEMPIPartition::Rank())) continue;
+
 				double di = fabs(K.diag(i));
 				if (di <= m_zero_tol)
 				{
@@ -217,7 +232,11 @@ bool FENewtonSolver::ReformStiffness()
 				}
 			}
 
-			if (zd.empty() == false) throw ZeroDiagonal(-1, -1);
+			// all ranks must agree
+			double nzd = (double) zd.size();
+			if (mpi) FEMPIPartition::SumAll(&nzd, 1);
+
+			if (nzd > 0) throw ZeroDiagonal(-1, -1);
 		}
 	}
 
@@ -245,6 +264,17 @@ bool FENewtonSolver::ReformStiffness()
     return bret;
 }
 
+//-----------------------------------------------------------------------------
+void FENewtonSolver::GatherResidual(vector<double>& R)
+{
+	const FEMPIPartition* mpi = (m_plinsolve ? m_plinsolve->GetMPIPartition() : nullptr);
+	if (mpi)
+	{
+		mpi->GatherOwnedRows(R);
+		mpi->GatherNodalLoads();
+	}
+}
+
 //-----------------------------------------------------------------------------
 //! get the RHS
 std::vector<double> FENewtonSolver::GetLoadVector()
@@ -381,6 +411,13 @@ bool FENewtonSolver::AllocateLinearSystem()
 		return false;
 	}
 
+	// in MPI runs, the linear solver must be able to solve the distributed system
+	if ((FEMPIPartition::Ranks() > 1) && (m_plinsolve->GetMPIPartition() == nullptr))
+	{
+		feLogError("The selected linear solver does not support MPI runs.\nPlease select a solver that does (e.g. schwarz_cg).");
+		return false;
+	}
+
 	// clean up the stiffness matrix if we have one
 	if (m_pK) delete m_pK; m_pK = 0;
 
@@ -584,6 +621,13 @@ bool FENewtonSolver::SolveStep()
 		feLog("\nconvergence summary\n");
 		feLog("    number of iterations   : %d\n", m_niter);
 		feLog("    number of reformations : %d\n", m_nref);
+		if (m_breuseStiffness)
+		{
+			feLog("    stiffness reuse        : %d steps reused, %d reforms on slow convergence\n", m_nreuse, m_nrateReform);
+		}
+
+		size_t mem = m_qnstrategy->UpdateMemory();
+		if (mem > 0) feLog("    QN update memory (MB)  : %.1lf\n", mem / (1024.0*1024.0));
 	}
 
 	return bret;
@@ -825,6 +869,19 @@ bool FENewtonSolver::QNInit()
 	// see if we reform at the start of every time step
 	bool breform = (m_breformtimestep || (m_qnstrategy->m_maxups == 0));
 
+	// When reusing the stiffness matrix, we keep the factorization of the previous time step.
+	// The stiffness matrix is also needed to evaluate the residual contribution of the
+	// prescribed increments (m_Fd), so we can only do this when no increments are prescribed.
+	if (m_breuseStiffness && (m_bforceReform == false))
+	{
+		breform = ((m_ui*m_ui) != 0.0);
+		if (breform == false)
+		{
+			zero(m_Fd);
+			m_nreuse++;
+		}
+	}
+
 	// if the force reform flag was set, we force a reform
 	// (This will be the case for the first time this is called, or when the previous time step failed)
 	if (m_bforceReform)
@@ -901,11 +958,20 @@ void FENewtonSolver::SolveEquations(std::vector<double>& u, std::vector<double>&
 }
 
 //-----------------------------------------------------------------------------
-double FENewtonSolver::DoLineSearch()
+// E0 is the initial energy norm of the time step, which the line search uses for
+// its energy acceptance test. Solvers that track the energy norm themselves pass it
+// in. If it is negative, the norm maintained by CheckConvergence is used.
+double FENewtonSolver::DoLineSearch(double E0)
 {
+	if (E0 < 0.0) E0 = (m_niter == 0 ? 0.0 : m_energyNorm.norm0);
+
 	// the geometry is also updated in the line search
 	m_ls = 1.0;
-	if (m_lineSearch && (m_lineSearch->m_LStol > 0.0)) m_ls = m_lineSearch->DoLineSearch();
+	if (m_lineSearch && (m_lineSearch->m_LStol > 0.0))
+	{
+		TRACK_TIME(TimerID::Timer_LineSearch);
+		m_ls = m_lineSearch->DoLineSearch(1.0, E0);
+	}
 	else
 	{
 		// Update geometry
@@ -926,13 +992,13 @@ double FENewtonSolver::DoLineSearch()
 }
 
 //-----------------------------------------------------------------------------
-double FENewtonSolver::QNSolve()
+double FENewtonSolver::QNSolve(double E0)
 {
 	// solve linear system of equations
 	SolveEquations(m_ui, m_R0);
 
 	// perform a linesearch
-	return DoLineSearch();
+	return DoLineSearch(E0);
 }
 
 //-----------------------------------------------------------------------------
@@ -948,11 +1014,27 @@ bool FENewtonSolver::QNUpdate()
 	// see if the force reform flag was set
 	bool breform = m_bforceReform; m_bforceReform = false;
 
+	// When reusing the stiffness matrix, we only reform when the residual did not contract enough
+	bool bskipUpdate = false;
+	if (m_breuseStiffness && (breform == false))
+	{
+		double r0 = m_R0*m_R0;
+		double r1 = m_R1*m_R1;
+		if ((r0 > 0.0) && (sqrt(r1 / r0) > m_reformRatio))
+		{
+			feLog("Residual contraction ratio %lg exceeds reform ratio.\n", sqrt(r1 / r0));
+			m_nrateReform++;
+			breform = true;
+		}
+
+		// for full-Newton, we keep the matrix (i.e. modified Newton)
+		if (m_maxups == 0) bskipUpdate = true;
+	}
 	// for full-Newton, we skip QN update
-	if (m_maxups == 0) breform = true;
+	else if (m_maxups == 0) breform = true;
 
 	// if not, do a QN update
-	if (breform == false)
+	if ((breform == false) && (bskipUpdate == false))
 	{
 		TRACK_TIME(TimerID::Timer_QNUpdate);
 
@@ -1029,6 +1111,7 @@ bool FENewtonSolver::DoAugmentations()
 		{
 			TRACK_TIME(TimerID::Timer_Residual);
 			Residual(m_R0);
+			GatherResidual(m_R0);
 		}
 
 		m_qnstrategy->PreSolveUpdate();
@@ -127,8 +127,9 @@ public:	// Quasi-Newton methods
 	//! Do a qn update
 	bool QNUpdate();
 
-	//! solve the equations using QN method (returns line search size)
-	double QNSolve();
+	//! solve the equations using QN method (returns line search size).
+	//! E0 is the initial energy norm of the time step (see DoLineSearch)
+	double QNSolve(double E0 = -1.0);
 
 	//! Force a stiffness reformation during next update
 	void QNForceReform(bool b);
@@ -159,8 +160,9 @@ public:
 	//! solve the equations
 	void SolveEquations(std::vector<double>& u, std::vector<double>& R);
 
-	//! do a line search
-	double DoLineSearch();
+	//! do a line search (E0 is the initial energy norm of the time step, or negative
+	//! to use the norm maintained by CheckConvergence)
+	double DoLineSearch(double E0 = -1.0);
 
 public:
 	//! Set the solution strategy
@@ -182,6 +184,11 @@ public:
 	//! calculates the global residual vector (needs to be overwritten by derived classes)
 	virtual bool Residual(vector<double>& R) = 0;
 
+	//! In MPI runs each rank only forms the residual rows of its own equations
+	//! (see FEMPIPartition). This combines the rows of all ranks, so that every
+	//! rank holds the complete residual. This must be called after Residual.
+	void GatherResidual(vector<double>& R);
+
 	//! Check convergence. Derived classes that don't override Quasin, should implement this
 	//! niter = iteration number
 	//! ui    = search direction
@@ -229,9 +236,13 @@ public:
 	bool				m_bforceReform;		//!< forces a reform in QNInit
 	bool				m_bdivreform;		//!< reform when diverging
 	bool				m_bdoreforms;		//!< do reformations
+	bool				m_breuseStiffness;	//!< keep the factored stiffness matrix across time steps
+	double				m_reformRatio;		//!< residual contraction ratio above which the stiffness is reformed (when reusing)
 
 	// counters
 	int		m_nref;			//!< nr of stiffness retormations
+	int		m_nreuse;		//!< nr of time steps that started with a reused stiffness matrix
+	int		m_nrateReform;	//!< nr of reformations triggered by the residual contraction ratio
 
 	// Error handling
 	bool	m_bzero_diagonal;	//!< check for zero diagonals
@@ -80,7 +80,9 @@ bool FENewtonStrategy::ReformStiffness()
 //! calculate the residual
 bool FENewtonStrategy::Residual(std::vector<double>& R, bool binit)
 {
-	return m_pns->Residual(R);
+	if (m_pns->Residual(R) == false) return false;
+	m_pns->GatherResidual(R);
+	return true;
 }
 
 void FENewtonStrategy::Serialize(DumpStream& ar)
@@ -71,6 +71,9 @@ public:
 	//! calculate the residual
 	virtual bool Residual(std::vector<double>& R, bool binit);
 
+	//! return the memory (in bytes) that is allocated for the update vectors
+	virtual size_t UpdateMemory() const { return 0; }
+
 public:
 	int		m_maxups;		//!< max nr of QN iters permitted between stiffness reformations
 	int		m_max_buf_size;	//!< max buffer size for update vector storage
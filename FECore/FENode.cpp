@@ -29,6 +29,7 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "FENode.h"
 #include "DumpStream.h"
+#include <assert.h>
 
 //=============================================================================
 // FENode
@@ -43,31 +44,63 @@ FENode::FENode()
 
 	// default ID
 	m_nID = -1;
+
+	// the geometry and dof data are assigned by the mesh
+	SetGeometryPointers(0, 0, 0, 0, 0, 0, 0, 0, 0);
+	m_BC = 0;
+	m_val_t = 0;
+	m_val_p = 0;
+	m_Fr = 0;
 }
 
 //-----------------------------------------------------------------------------
+// The dof storage is allocated by the mesh, so this only resets the dof data.
 void FENode::SetDOFS(int n)
 {
-	// initialize dof stuff
-	m_ID.assign(n, -1);
-	m_BC.assign(n, 0);
-	m_val_t.assign(n, 0.0);
-	m_val_p.assign(n, 0.0);
-	m_Fr.assign(n, 0.0);
+	assert(n == dofs());
+	int N = dofs();
+	for (int i=0; i<N; ++i)
+	{
+		m_ID[i] = -1;
+		m_BC[i] = 0;
+		m_val_t[i] = 0.0;
+		m_val_p[i] = 0.0;
+		m_Fr[i] = 0.0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FENode::SetDataPointers(int ndofs, int* ID, double* val_t, double* val_p, double* Fr, int* BC)
+{
+	m_ID.set(ID, ndofs);
+	m_val_t = val_t;
+	m_val_p = val_p;
+	m_Fr = Fr;
+	m_BC = BC;
+}
+
+//-----------------------------------------------------------------------------
+void FENode::SetGeometryPointers(vec3d* r0, vec3d* rt, vec3d* at, vec3d* rp, vec3d* vp, vec3d* ap, vec3d* d0, vec3d* dt, vec3d* dp)
+{
+	m_pr0 = r0;
+	m_prt = rt;
+	m_pat = at;
+	m_prp = rp;
+	m_pvp = vp;
+	m_pap = ap;
+	m_pd0 = d0;
+	m_pdt = dt;
+	m_pdp = dp;
 }
 
 //-----------------------------------------------------------------------------
-FENode::FENode(const FENode& n)
+// The moved node takes over the geometry and dof data of n. This is only used
+// when the mesh reallocates its node list, after which the mesh reassigns the
+// data pointers anyway.
+FENode::FENode(FENode&& n)
 {
-	m_r0 = n.m_r0;
-	m_rt = n.m_rt;
-	m_at = n.m_at;
-	m_rp = n.m_rp;
-	m_vp = n.m_vp;
-	m_ap = n.m_ap;
-	m_d0 = n.m_d0;
-    m_dt = n.m_dt;
-    m_dp = n.m_dp;
+	SetGeometryPointers(n.m_pr0, n.m_prt, n.m_pat, n.m_prp, n.m_pvp, n.m_pap, n.m_pd0, n.m_pdt, n.m_pdp);
+	n.SetGeometryPointers(0, 0, 0, 0, 0, 0, 0, 0, 0);
 
 	m_nID = n.m_nID;
 	m_rid = n.m_rid;
@@ -78,30 +111,45 @@ FENode::FENode(const FENode& n)
 	m_val_t = n.m_val_t;
 	m_val_p = n.m_val_p;
 	m_Fr = n.m_Fr;
+	n.SetDataPointers(0, 0, 0, 0, 0, 0);
 }
 
 //-----------------------------------------------------------------------------
 FENode& FENode::operator = (const FENode& n)
 {
-	m_r0 = n.m_r0;
-	m_rt = n.m_rt;
-	m_at = n.m_at;
-	m_rp = n.m_rp;
-	m_vp = n.m_vp;
-	m_ap = n.m_ap;
-	m_d0 = n.m_d0;
-    m_dt = n.m_dt;
-    m_dp = n.m_dp;
+	// copy the geometry data into our own storage
+	if (m_prt != n.m_prt)
+	{
+		m_r0() = n.m_r0();
+		m_rt() = n.m_rt();
+		m_at() = n.m_at();
+		m_rp() = n.m_rp();
+		m_vp() = n.m_vp();
+		m_ap() = n.m_ap();
+		m_d0() = n.m_d0();
+		m_dt() = n.m_dt();
+		m_dp() = n.m_dp();
+	}
 
 	m_nID = n.m_nID;
 	m_rid = n.m_rid;
 	m_nstate = n.m_nstate;
 
-	m_ID = n.m_ID;
-	m_BC = n.m_BC;
-	m_val_t = n.m_val_t;
-	m_val_p = n.m_val_p;
-	m_Fr = n.m_Fr;
+	// copy the dof data into our own storage
+	// (never write past our own slots, even when the sizes don't match)
+	assert(dofs() == n.dofs());
+	if (m_val_t != n.m_val_t)
+	{
+		int N = (dofs() < n.dofs() ? dofs() : n.dofs());
+		for (int i=0; i<N; ++i)
+		{
+			m_ID[i] = n.m_ID[i];
+			m_BC[i] = n.m_BC[i];
+			m_val_t[i] = n.m_val_t[i];
+			m_val_p[i] = n.m_val_p[i];
+			m_Fr[i] = n.m_Fr[i];
+		}
+	}
 
 	return (*this);
 }
@@ -111,19 +159,22 @@ FENode& FENode::operator = (const FENode& n)
 void FENode::Serialize(DumpStream& ar)
 {
 	ar & m_nID;
-	ar & m_rt & m_at;
-	ar & m_rp & m_vp & m_ap;
-	ar & m_Fr;
-	ar & m_val_t & m_val_p;
-    ar & m_dt & m_dp;
+	ar & m_rt() & m_at();
+	ar & m_rp() & m_vp() & m_ap();
+
+	// the dof storage is allocated by the mesh before the nodes are serialized
+	int N = dofs();
+	for (int i=0; i<N; ++i) ar & m_Fr[i];
+	for (int i=0; i<N; ++i) ar & m_val_t[i] & m_val_p[i];
+	ar & m_dt() & m_dp();
 	if (ar.IsShallow() == false)
 	{
 		ar & m_nstate;
-		ar & m_ID;
-		ar & m_BC;
-		ar & m_r0;
+		for (int i=0; i<N; ++i) ar & m_ID[i];
+		for (int i=0; i<N; ++i) ar & m_BC[i];
+		ar & m_r0();
 		ar & m_rid;
-		ar & m_d0;
+		ar & m_d0();
 	}
 }
 
@@ -131,5 +182,6 @@ void FENode::Serialize(DumpStream& ar)
 //! Update nodal values, which copies the current values to the previous array
 void FENode::UpdateValues()
 {
-	m_val_p = m_val_t;
+	int N = dofs();
+	for (int i=0; i<N; ++i) m_val_p[i] = m_val_t[i];
 }
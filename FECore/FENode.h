@@ -34,6 +34,28 @@ SOFTWARE.*/
 
 class DumpStream;
 
+//-----------------------------------------------------------------------------
+//! A node's slice of one of the nodal arrays that are owned by the mesh.
+//! It behaves like a fixed-size array. 
+template <class T> class FENodeArray
+{
+public:
+	FENodeArray() : m_p(0), m_n(0) {}
+
+	T& operator [] (int i) { return m_p[i]; }
+	const T& operator [] (int i) const { return m_p[i]; }
+
+	size_t size() const { return (size_t) m_n; }
+
+private:
+	void set(T* p, int n) { m_p = p; m_n = n; }
+
+	T*	m_p;	//!< first value of this node
+	int	m_n;	//!< number of values
+
+	friend class FENode;
+};
+
 //-----------------------------------------------------------------------------
 //! This class defines a finite element node
 
@@ -44,6 +66,13 @@ class DumpStream;
 //! gives the equation number in the linear system of equations, (b) -1 if the
 //! dof is fixed, and (c) < -1 if the dof corresponds to a prescribed dof. In
 //! that case the corresponding equation number is given by -ID-2.
+//!
+//! The nodal positions, directors, equation numbers, nodal dof values, loads,
+//! and boundary condition flags are not stored in the node itself, but in
+//! contiguous arrays that are owned by the mesh (see FEMesh::BindNodalData).
+//! The node only keeps pointers to its slice of these arrays. For this reason,
+//! nodes cannot be copy-constructed. Assigning a node copies the data into the
+//! slots of the assigned node.
 
 class FECORE_API FENode
 {
@@ -60,13 +89,13 @@ public:
 	//! default constructor
 	FENode();
 
-	//! copy constructor
-	FENode(const FENode& n);
+	//! move constructor (used by the mesh when the node list is reallocated)
+	FENode(FENode&& n);
 
-	//! assignment operator
+	//! assignment operator (copies the dof data, which must have the same size)
 	FENode& operator = (const FENode& n);
 
-	//! Set the number of DOFS
+	//! Reset the DOFS (n must match the number of dofs allocated by the mesh)
 	void SetDOFS(int n);
 
 	//! Get the nodal ID
@@ -100,18 +129,28 @@ protected:
 	int		m_nID;	//!< nodal ID
 
 public: // geometry data
-	vec3d	m_r0;	//!< initial position
-	vec3d	m_rt;	//!< current position
+	vec3d& m_r0() { return *m_pr0; }	//!< initial position
+	vec3d& m_rt() { return *m_prt; }	//!< current position
 
-	vec3d	m_at;	//!< nodal acceleration
+	vec3d& m_at() { return *m_pat; }	//!< nodal acceleration
 
-	vec3d	m_rp;	//!< position of node at previous time step
-	vec3d	m_vp;	//!< previous velocity
-	vec3d	m_ap;	//!< previous acceleration
+	vec3d& m_rp() { return *m_prp; }	//!< position of node at previous time step
+	vec3d& m_vp() { return *m_pvp; }	//!< previous velocity
+	vec3d& m_ap() { return *m_pap; }	//!< previous acceleration
 
-	vec3d   m_d0;   //!< initial director
-	vec3d	m_dt;	//!< current director
-    vec3d   m_dp;   //!< director at previous time step
+	vec3d& m_d0() { return *m_pd0; }	//!< initial director
+	vec3d& m_dt() { return *m_pdt; }	//!< current director
+	vec3d& m_dp() { return *m_pdp; }	//!< director at previous time step
+
+	const vec3d& m_r0() const { return *m_pr0; }
+	const vec3d& m_rt() const { return *m_prt; }
+	const vec3d& m_at() const { return *m_pat; }
+	const vec3d& m_rp() const { return *m_prp; }
+	const vec3d& m_vp() const { return *m_pvp; }
+	const vec3d& m_ap() const { return *m_pap; }
+	const vec3d& m_d0() const { return *m_pd0; }
+	const vec3d& m_dt() const { return *m_pdt; }
+	const vec3d& m_dp() const { return *m_pdp; }
 
 public:	// rigid body data
 	unsigned int	m_nstate;	//!< node state flags
@@ -149,16 +188,38 @@ public:
 	int dofs() const { return (int) m_ID.size(); }
     
 public:
-    vec3d   m_s0() { return m_r0 - m_d0; }
-    vec3d   m_st() { return m_rt - m_dt; }
-    vec3d   m_sp() { return m_rp - m_dp; }
+    vec3d   m_s0() const { return m_r0() - m_d0(); }
+    vec3d   m_st() const { return m_rt() - m_dt(); }
+    vec3d   m_sp() const { return m_rp() - m_dp(); }
+
+private:
+	//! hide the copy constructor, since the copy would share the dof data
+	FENode(const FENode& n);
+
+	//! set the pointers to the dof data (called by FEMesh)
+	void SetDataPointers(int ndofs, int* ID, double* val_t, double* val_p, double* Fr, int* BC);
+
+	//! set the pointers to the geometry data (called by FEMesh)
+	void SetGeometryPointers(vec3d* r0, vec3d* rt, vec3d* at, vec3d* rp, vec3d* vp, vec3d* ap, vec3d* d0, vec3d* dt, vec3d* dp);
+
+	friend class FEMesh;
 
 private:
-	std::vector<int>		m_BC;		//!< boundary condition array
-	std::vector<double>		m_val_t;	//!< current nodal DOF values
-	std::vector<double>		m_val_p;	//!< previous nodal DOF values
-	std::vector<double>		m_Fr;		//!< equivalent nodal forces
+	vec3d*		m_pr0;		//!< initial position
+	vec3d*		m_prt;		//!< current position
+	vec3d*		m_pat;		//!< nodal acceleration
+	vec3d*		m_prp;		//!< previous position
+	vec3d*		m_pvp;		//!< previous velocity
+	vec3d*		m_pap;		//!< previous acceleration
+	vec3d*		m_pd0;		//!< initial director
+	vec3d*		m_pdt;		//!< current director
+	vec3d*		m_pdp;		//!< previous director
+
+	int*		m_BC;		//!< boundary condition array
+	double*		m_val_t;	//!< current nodal DOF values
+	double*		m_val_p;	//!< previous nodal DOF values
+	double*		m_Fr;		//!< equivalent nodal forces
 
 public:
-	std::vector<int>		m_ID;	//!< nodal equation numbers
+	FENodeArray<int>	m_ID;	//!< nodal equation numbers
 };
@@ -188,7 +188,7 @@ vec3d FENormalProjection::Project(const vec3d& x, const vec3d& N)
 	{
 		FEMesh& mesh = *m_surf.GetMesh();
 		vec3d r[FEElement::MAX_NODES];
-		for (int i=0; i<pe->Nodes(); ++i) r[i] = mesh.Node(pe->m_node[i]).m_rt;
+		for (int i=0; i<pe->Nodes(); ++i) r[i] = mesh.Node(pe->m_node[i]).m_rt();
 		vec3d q = pe->eval(r, rs[0], rs[1]);
 		return q;
 	}
@@ -206,7 +206,7 @@ vec3d FENormalProjection::Project2(const vec3d& x, const vec3d& N)
 	{
 		FEMesh& mesh = *m_surf.GetMesh();
 		vec3d r[FEElement::MAX_NODES];
-		for (int i = 0; i<pe->Nodes(); ++i) r[i] = mesh.Node(pe->m_node[i]).m_rt;
+		for (int i = 0; i<pe->Nodes(); ++i) r[i] = mesh.Node(pe->m_node[i]).m_rt();
 		vec3d q = pe->eval(r, rs[0], rs[1]);
 		return q;
 	}
@@ -98,11 +98,11 @@ bool OTnode::ElementIntersectsNode(const int iel)
 	FESurfaceElement& el = m_ps->Element(iel);
 	int N = el.Nodes();
 	vector<vec3d> fenode(N);
-	fenode[0] = mesh.Node(el.m_node[0]).m_rt;
+	fenode[0] = mesh.Node(el.m_node[0]).m_rt();
 	vec3d fmin = fenode[0];
 	vec3d fmax = fenode[0];
 	for (i=1; i<N; ++i) {
-		fenode[i] = mesh.Node(el.m_node[i]).m_rt;
+		fenode[i] = mesh.Node(el.m_node[i]).m_rt();
 		if (fenode[i].x < fmin.x) fmin.x = fenode[i].x;
 		if (fenode[i].x > fmax.x) fmax.x = fenode[i].x;
 		if (fenode[i].y < fmin.y) fmin.y = fenode[i].y;
@@ -277,11 +277,11 @@ void FEOctree::Init(const double stol)
 		root.selist[i] = i;
 	
 	// Find the bounding box of the surface
-	vec3d fenode = (m_ps->Node(0)).m_rt;
+	vec3d fenode = (m_ps->Node(0)).m_rt();
 	root.cmin = fenode;
 	root.cmax = fenode;
 	for (i=1; i<m_ps->Nodes(); ++i) {
-		fenode = (m_ps->Node(i)).m_rt;
+		fenode = (m_ps->Node(i)).m_rt();
 		if (fenode.x < root.cmin.x) root.cmin.x = fenode.x;
 		if (fenode.x > root.cmax.x) root.cmax.x = fenode.x;
 		if (fenode.y < root.cmin.y) root.cmin.y = fenode.y;
@@ -26,257 +26,374 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "FEOctreeSearch.h"
 #include "FEMesh.h"
-#include "FEElementList.h"
 #include "FESolidDomain.h"
+#include <algorithm>
+using namespace std;
 
 //-----------------------------------------------------------------------------
-FEOctreeSearch::Block::Block(FEMesh* mesh, int level)
-{
-	m_parent = nullptr;
-	m_mesh = mesh;
-	m_level = level;
-}
+// max depth of the traversal stack
+#define MAX_STACK	128
 
 //-----------------------------------------------------------------------------
-FEOctreeSearch::Block::Block(FEOctreeSearch::Block* parent, int level)
+// clamp the iso-parametric coordinates to the reference domain of an element
+static void clamp_to_reference_element(FESolidElement& el, double r[3])
 {
-	m_parent = parent;
-	m_mesh = parent->m_mesh;
-	m_level = level;
+	switch (el.Shape())
+	{
+	case ET_HEX8:
+	case ET_HEX20:
+	case ET_HEX27:
+		for (int i = 0; i < 3; ++i)
+		{
+			if (r[i] < -1.0) r[i] = -1.0;
+			if (r[i] >  1.0) r[i] =  1.0;
+		}
+		break;
+	case ET_TET4:
+	case ET_TET5:
+	case ET_TET10:
+		{
+			for (int i = 0; i < 3; ++i) if (r[i] < 0.0) r[i] = 0.0;
+			double s = r[0] + r[1] + r[2];
+			if (s > 1.0) { r[0] /= s; r[1] /= s; r[2] /= s; }
+		}
+		break;
+	case ET_PENTA6:
+	case ET_PENTA15:
+		{
+			for (int i = 0; i < 2; ++i) if (r[i] < 0.0) r[i] = 0.0;
+			double s = r[0] + r[1];
+			if (s > 1.0) { r[0] /= s; r[1] /= s; }
+			if (r[2] < -1.0) r[2] = -1.0;
+			if (r[2] >  1.0) r[2] =  1.0;
+		}
+		break;
+	default:
+		break;
+	}
 }
 
-//-----------------------------------------------------------------------------
-FEOctreeSearch::Block::~Block()
-{ 
-	Clear(); 
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+FEOctreeSearch::FEOctreeSearch(FEMesh* mesh)
+{
+	m_mesh = mesh;
+	m_max_level = 48;
+	m_max_elem = 8;
 }
 
 //-----------------------------------------------------------------------------
-void FEOctreeSearch::Block::Clear()
+FEOctreeSearch::~FEOctreeSearch()
 {
-	for (size_t i = 0; i < m_children.size(); ++i) delete m_children[i];
-	m_children.clear();
+
 }
 
 //-----------------------------------------------------------------------------
-// Create the eight children of an octree node and find their contents
-
-void FEOctreeSearch::Block::CreateChildren(const int max_level, const int max_elem)
+bool FEOctreeSearch::Init(double inflate)
 {
-	vec3d dc = (m_cmax - m_cmin) / 2;
-	for (int i = 0; i <= 1; ++i) {
-		for (int j = 0; j <= 1; ++j) {
-			for (int k = 0; k <= 1; ++k) {
-				Block* node = new Block(this, m_level + 1);
-
-				// evaluate bounding box by subdividing parent node box
-				node->m_cmin = vec3d(m_cmin.x + i*dc.x,
-					m_cmin.y + j*dc.y,
-					m_cmin.z + k*dc.z);
-				node->m_cmax = vec3d(m_cmax.x - (1 - i)*dc.x,
-					m_cmax.y - (1 - j)*dc.y,
-					m_cmax.z - (1 - k)*dc.z);
-
-				// find all elements in this child node
-				node->FillBlock();
-
-				if (node->m_selist.size()) {
-					// use recursion to create children of this node
-					// as long as node contains too many elements
-					// and max octree levels not exceeded
-					if ((node->m_level < max_level) &&
-						(node->m_selist.size() > max_elem))
-						node->CreateChildren(max_level, max_elem);
-				}
+	if (m_mesh == nullptr) return false;
 
-				// store this node
-				m_children.push_back(node);
-			}
+	m_block.clear();
+	m_elem.clear();
+
+	// Create the list of all solid elements
+	// (other elements, e.g. shells, cannot be searched)
+	for (int i = 0; i < m_mesh->Domains(); ++i)
+	{
+		FESolidDomain* dom = dynamic_cast<FESolidDomain*>(&m_mesh->Domain(i));
+		if (dom)
+		{
+			for (int j = 0; j < dom->Elements(); ++j) m_elem.push_back(&dom->Element(j));
 		}
 	}
-}
+	int NE = (int)m_elem.size();
+	if (NE == 0) return false;
 
-//-----------------------------------------------------------------------------
-// Find all elements that fall inside a block
+	// calculate the element bounding boxes and centers
+	vector<FEBoundingBox> box(NE);
+	vector<vec3d> c(NE);
+	for (int i = 0; i < NE; ++i)
+	{
+		FEElement& el = *m_elem[i];
+		int neln = el.Nodes();
+		FEBoundingBox bi(m_mesh->Node(el.m_node[0]).m_r0());
+		for (int j = 1; j < neln; ++j) bi.add(m_mesh->Node(el.m_node[j]).m_r0());
 
-void FEOctreeSearch::Block::FillBlock()
-{
-	// Loop over all elements in the parent node
-	for (int i = 0; i<(int)m_parent->m_selist.size(); ++i) {
-		FEElement* pe = m_parent->m_selist[i];
-		if (ElementIntersectsNode(pe)) {
-			// add this surface element to the current node
-			m_selist.push_back(pe);
+		// inflate a little for round-off
+		double dr = bi.radius()*1e-6;
+		bi.inflate(dr, dr, dr);
+
+		box[i] = bi;
+		c[i] = bi.center();
+	}
+
+	// Find the bounding box of the mesh and
+	// expand it by the search tolerance
+	FEBoundingBox mbox = box[0];
+	for (int i = 1; i < NE; ++i) { mbox.add(box[i].minPoint()); mbox.add(box[i].maxPoint()); }
+	double d = (mbox.maxPoint() - mbox.minPoint()).norm()*inflate;
+	m_rmin = mbox.minPoint() - vec3d(d, d, d);
+	m_rmax = mbox.maxPoint() + vec3d(d, d, d);
+
+	// build the hierarchy
+	vector<int> order(NE);
+	for (int i = 0; i < NE; ++i) order[i] = i;
+	m_block.reserve(2 * (NE / m_max_elem + 1));
+	m_block.push_back(Block());
+	Build(0, 0, NE, 0, order, c);
+
+	// store the elements and their boxes in hierarchy order, so that the
+	// elements of a leaf are contiguous in memory
+	vector<FEElement*> elem(m_elem);
+	m_xmin.resize(NE); m_ymin.resize(NE); m_zmin.resize(NE);
+	m_xmax.resize(NE); m_ymax.resize(NE); m_zmax.resize(NE);
+	for (int i = 0; i < NE; ++i)
+	{
+		int n = order[i];
+		m_elem[i] = elem[n];
+		const vec3d& r0 = box[n].minPoint();
+		const vec3d& r1 = box[n].maxPoint();
+		m_xmin[i] = r0.x; m_ymin[i] = r0.y; m_zmin[i] = r0.z;
+		m_xmax[i] = r1.x; m_ymax[i] = r1.y; m_zmax[i] = r1.z;
+	}
+
+	// now we can calculate the bounding boxes of the blocks
+	// (children are always stored after their parent)
+	for (int i = (int)m_block.size() - 1; i >= 0; --i)
+	{
+		Block& b = m_block[i];
+		if (b.m_count > 0)
+		{
+			int n0 = b.m_first;
+			b.m_cmin = vec3d(m_xmin[n0], m_ymin[n0], m_zmin[n0]);
+			b.m_cmax = vec3d(m_xmax[n0], m_ymax[n0], m_zmax[n0]);
+			for (int n = n0 + 1; n < n0 + b.m_count; ++n)
+			{
+				if (m_xmin[n] < b.m_cmin.x) b.m_cmin.x = m_xmin[n];
+				if (m_ymin[n] < b.m_cmin.y) b.m_cmin.y = m_ymin[n];
+				if (m_zmin[n] < b.m_cmin.z) b.m_cmin.z = m_zmin[n];
+				if (m_xmax[n] > b.m_cmax.x) b.m_cmax.x = m_xmax[n];
+				if (m_ymax[n] > b.m_cmax.y) b.m_cmax.y = m_ymax[n];
+				if (m_zmax[n] > b.m_cmax.z) b.m_cmax.z = m_zmax[n];
+			}
+		}
+		else
+		{
+			const Block& b0 = m_block[b.m_first];
+			const Block& b1 = m_block[b.m_first + 1];
+			b.m_cmin.x = (b0.m_cmin.x < b1.m_cmin.x ? b0.m_cmin.x : b1.m_cmin.x);
+			b.m_cmin.y = (b0.m_cmin.y < b1.m_cmin.y ? b0.m_cmin.y : b1.m_cmin.y);
+			b.m_cmin.z = (b0.m_cmin.z < b1.m_cmin.z ? b0.m_cmin.z : b1.m_cmin.z);
+			b.m_cmax.x = (b0.m_cmax.x > b1.m_cmax.x ? b0.m_cmax.x : b1.m_cmax.x);
+			b.m_cmax.y = (b0.m_cmax.y > b1.m_cmax.y ? b0.m_cmax.y : b1.m_cmax.y);
+			b.m_cmax.z = (b0.m_cmax.z > b1.m_cmax.z ? b0.m_cmax.z : b1.m_cmax.z);
 		}
 	}
+
+	return true;
 }
 
 //-----------------------------------------------------------------------------
-// Determine whether a surface element intersects a node
-
-bool FEOctreeSearch::Block::ElementIntersectsNode(FEElement* pel)
+// Split the elements [i0, i1) of block nb at the median of their centers
+// along the longest axis. Only the topology is created here; the block boxes
+// are calculated in Init.
+void FEOctreeSearch::Build(int nb, int i0, int i1, int level, vector<int>& order, const vector<vec3d>& c)
 {
-	// Extract FE node coordinates from element
-	// and determine bounding box of element
-	FEMesh& mesh = *m_mesh;
-	FEElement& el = *pel;
-	int N = el.Nodes();
-	vector<vec3d> fenode(N);
-	fenode[0] = mesh.Node(el.m_node[0]).m_r0;
-	vec3d fmin = fenode[0];
-	vec3d fmax = fenode[0];
-	for (int i = 1; i<N; ++i) {
-		fenode[i] = mesh.Node(el.m_node[i]).m_r0;
-		if (fenode[i].x < fmin.x) fmin.x = fenode[i].x;
-		if (fenode[i].x > fmax.x) fmax.x = fenode[i].x;
-		if (fenode[i].y < fmin.y) fmin.y = fenode[i].y;
-		if (fenode[i].y > fmax.y) fmax.y = fenode[i].y;
-		if (fenode[i].z < fmin.z) fmin.z = fenode[i].z;
-		if (fenode[i].z > fmax.z) fmax.z = fenode[i].z;
+	if ((i1 - i0 <= m_max_elem) || (level >= m_max_level))
+	{
+		m_block[nb].m_first = i0;
+		m_block[nb].m_count = i1 - i0;
+		return;
 	}
 
-	// Check if bounding boxes of OT node and surface element overlap
-	if ((fmax.x < m_cmin.x) || (fmin.x > m_cmax.x)) return false;
-	if ((fmax.y < m_cmin.y) || (fmin.y > m_cmax.y)) return false;
-	if ((fmax.z < m_cmin.z) || (fmin.z > m_cmax.z)) return false;
+	// find the longest axis of the box around the element centers
+	FEBoundingBox cbox(c[order[i0]]);
+	for (int i = i0 + 1; i < i1; ++i) cbox.add(c[order[i]]);
+	double w[3] = { cbox.width(), cbox.height(), cbox.depth() };
+	int axis = 0;
+	if (w[1] > w[axis]) axis = 1;
+	if (w[2] > w[axis]) axis = 2;
+
+	// split at the median
+	int im = (i0 + i1) / 2;
+	switch (axis)
+	{
+	case 0: nth_element(order.begin() + i0, order.begin() + im, order.begin() + i1, [&](int a, int b) { return c[a].x < c[b].x; }); break;
+	case 1: nth_element(order.begin() + i0, order.begin() + im, order.begin() + i1, [&](int a, int b) { return c[a].y < c[b].y; }); break;
+	case 2: nth_element(order.begin() + i0, order.begin() + im, order.begin() + i1, [&](int a, int b) { return c[a].z < c[b].z; }); break;
+	}
 
-	// At this point we find that bounding boxes overlap.
-	// Technically that does not prove that the surface element is
-	// inside the octree node, but any additional check would be
-	// more expensive.
+	// create the children
+	int nc = (int)m_block.size();
+	m_block.push_back(Block());
+	m_block.push_back(Block());
+	m_block[nb].m_first = nc;
+	m_block[nb].m_count = 0;
 
-	return true;
+	Build(nc    , i0, im, level + 1, order, c);
+	Build(nc + 1, im, i1, level + 1, order, c);
 }
 
 //-----------------------------------------------------------------------------
-bool FEOctreeSearch::Block::IsInside(const vec3d& r) const
+// see if element i contains x. If so, r returns the iso-parametric coordinates
+bool FEOctreeSearch::ElementContains(int i, const vec3d& x, double r[3]) const
 {
-	if ((r.x < m_cmin.x) || (r.x > m_cmax.x)) return false;
-	if ((r.y < m_cmin.y) || (r.y > m_cmax.y)) return false;
-	if ((r.z < m_cmin.z) || (r.z > m_cmax.z)) return false;
-	return true;
+	FESolidElement& e = *((FESolidElement*)m_elem[i]);
+	FESolidDomain* dom = static_cast<FESolidDomain*>(e.GetMeshPartition());
+
+	// If the point x lies inside the box, we apply a Newton method to find
+	// the isoparametric coordinates r
+	return dom->ProjectToReferenceElement(e, x, r);
 }
 
 //-----------------------------------------------------------------------------
-FEElement* FEOctreeSearch::Block::FindElement(const vec3d& y, double r[3])
+// squared distance from x to a box (zero if x lies inside the box)
+double FEOctreeSearch::BoxDistance2(const vec3d& cmin, const vec3d& cmax, const vec3d& x) const
 {
-	if (IsInside(y))
+	double dx = (x.x < cmin.x ? cmin.x - x.x : (x.x > cmax.x ? x.x - cmax.x : 0.0));
+	double dy = (x.y < cmin.y ? cmin.y - x.y : (x.y > cmax.y ? x.y - cmax.y : 0.0));
+	double dz = (x.z < cmin.z ? cmin.z - x.z : (x.z > cmax.z ? x.z - cmax.z : 0.0));
+	return dx*dx + dy*dy + dz*dz;
+}
+
+//-----------------------------------------------------------------------------
+FEElement* FEOctreeSearch::FindElement(const vec3d& x, double r[3])
+{
+	if (m_block.empty()) return nullptr;
+
+	// quick check against the mesh box
+	if ((x.x < m_rmin.x) || (x.x > m_rmax.x)) return nullptr;
+	if ((x.y < m_rmin.y) || (x.y > m_rmax.y)) return nullptr;
+	if ((x.z < m_rmin.z) || (x.z > m_rmax.z)) return nullptr;
+
+	int stack[MAX_STACK];
+	int ns = 0;
+	stack[ns++] = 0;
+	while (ns > 0)
 	{
-		if (m_children.empty() == false)
+		const Block& b = m_block[stack[--ns]];
+		if ((x.x < b.m_cmin.x) || (x.x > b.m_cmax.x)) continue;
+		if ((x.y < b.m_cmin.y) || (x.y > b.m_cmax.y)) continue;
+		if ((x.z < b.m_cmin.z) || (x.z > b.m_cmax.z)) continue;
+
+		if (b.m_count == 0)
 		{
-			for (int i = 0; i < m_children.size(); ++i)
-			{
-				FEElement* pe = m_children[i]->FindElement(y, r);
-				if (pe) return pe;
-			}
+			stack[ns++] = b.m_first + 1;
+			stack[ns++] = b.m_first;
 		}
 		else
 		{
-			vec3d x[FEElement::MAX_NODES];
-			int NE = (int)m_selist.size();
-			for (int i = 0; i<NE; ++i)
+			// Test the element boxes of this leaf in chunks. The box tests are
+			// done first in a branch-free loop, so that they can be vectorized.
+			const int M = 16;
+			int hit[M];
+			int n1 = b.m_first + b.m_count;
+			for (int n0 = b.m_first; n0 < n1; n0 += M)
 			{
-				// get the next element
-				FESolidElement& e = *((FESolidElement*)m_selist[i]);
-
-				// get the element nodal coordinates
-				int neln = e.Nodes();
-				for (int j = 0; j<neln; ++j) x[j] = m_mesh->Node(e.m_node[j]).m_r0;
-
-				// first, as a quick check, we see if y lies in the bounding box defined by x
-				FEBoundingBox box(x[0]);
-				for (int j = 1; j<neln; ++j) box.add(x[j]);
-
-				// inflate a little for round-off
-				double dr = box.radius()*1e-6;
-				box.inflate(dr, dr, dr);
-
-				if (box.IsInside(y))
+				int m = (n1 - n0 < M ? n1 - n0 : M);
+				const double* xmin = &m_xmin[n0]; const double* xmax = &m_xmax[n0];
+				const double* ymin = &m_ymin[n0]; const double* ymax = &m_ymax[n0];
+				const double* zmin = &m_zmin[n0]; const double* zmax = &m_zmax[n0];
+				for (int k = 0; k < m; ++k)
 				{
-					FESolidDomain* dom = dynamic_cast<FESolidDomain*>(e.GetMeshPartition());
+					hit[k] = (x.x >= xmin[k]) & (x.x <= xmax[k]) &
+							 (x.y >= ymin[k]) & (x.y <= ymax[k]) &
+							 (x.z >= zmin[k]) & (x.z <= zmax[k]);
+				}
 
-					// If the point y lies inside the box, we apply a Newton method to find
-					// the isoparametric coordinates r
-					if (dom->ProjectToReferenceElement(e, y, r)) return &e;
+				for (int k = 0; k < m; ++k)
+				{
+					if (hit[k] && ElementContains(n0 + k, x, r)) return m_elem[n0 + k];
 				}
 			}
 		}
 	}
-	
-	return nullptr;
-}
-
-//////////////////////////////////////////////////////////////////////
-// Construction/Destruction
-//////////////////////////////////////////////////////////////////////
-
-FEOctreeSearch::FEOctreeSearch(FEMesh* mesh)
-{
-	m_root = nullptr;
-	m_mesh = mesh;
-	m_max_level = 6;
-	m_max_elem = 9;
-}
-
-//-----------------------------------------------------------------------------
-FEOctreeSearch::~FEOctreeSearch()
-{
 
+	return nullptr;
 }
 
 //-----------------------------------------------------------------------------
-bool FEOctreeSearch::Init(double inflate)
+FEElement* FEOctreeSearch::FindClosestElement(const vec3d& x, double r[3])
 {
-	if (m_mesh == nullptr) return false;
+	FEElement* pe = FindElement(x, r);
+	if (pe || m_block.empty()) return pe;
+
+	// Find the element whose box is closest to x. Ties (e.g. when x lies in
+	// several boxes) are broken by the distance to the box center.
+	int imin = -1;
+	double dmin = 0.0, cmin = 0.0;
+
+	int stack[MAX_STACK];
+	int ns = 0;
+	stack[ns++] = 0;
+	while (ns > 0)
+	{
+		const Block& b = m_block[stack[--ns]];
+		if ((imin >= 0) && (BoxDistance2(b.m_cmin, b.m_cmax, x) > dmin)) continue;
 
-	// Set up the root node in the octree
-	if (m_root) delete m_root;
-	m_root = new Block(m_mesh, 0);
-
-	Block& root = *m_root;
-
-	// Create the list of all surface elements in the root node
-	FEElementList EL(*m_mesh);
-	int nel = m_mesh->Elements();
-	for (FEElementList::iterator it = EL.begin(); it != EL.end(); ++it)
-		root.m_selist.push_back(it);
-
-	// Find the bounding box of the mesh
-	vec3d r0 = (m_mesh->Node(0)).m_r0;
-	root.m_cmin = r0;
-	root.m_cmax = r0;
-	for (int i = 1; i<m_mesh->Nodes(); ++i) {
-		vec3d r = (m_mesh->Node(i)).m_r0;
-		if (r.x < root.m_cmin.x) root.m_cmin.x = r.x;
-		if (r.x > root.m_cmax.x) root.m_cmax.x = r.x;
-		if (r.y < root.m_cmin.y) root.m_cmin.y = r.y;
-		if (r.y > root.m_cmax.y) root.m_cmax.y = r.y;
-		if (r.z < root.m_cmin.z) root.m_cmin.z = r.z;
-		if (r.z > root.m_cmax.z) root.m_cmax.z = r.z;
-	}
+		if (b.m_count == 0)
+		{
+			// visit the closer child first
+			const Block& b0 = m_block[b.m_first];
+			const Block& b1 = m_block[b.m_first + 1];
+			if (BoxDistance2(b0.m_cmin, b0.m_cmax, x) <= BoxDistance2(b1.m_cmin, b1.m_cmax, x))
+			{
+				stack[ns++] = b.m_first + 1;
+				stack[ns++] = b.m_first;
+			}
+			else
+			{
+				stack[ns++] = b.m_first;
+				stack[ns++] = b.m_first + 1;
+			}
+		}
+		else
+		{
+			for (int n = b.m_first; n < b.m_first + b.m_count; ++n)
+			{
+				vec3d emin(m_xmin[n], m_ymin[n], m_zmin[n]);
+				vec3d emax(m_xmax[n], m_ymax[n], m_zmax[n]);
+				double dn = BoxDistance2(emin, emax, x);
+				if ((imin >= 0) && (dn > dmin)) continue;
 
-	// expand bounding box by search tolerance stol
-	double d = (root.m_cmax - root.m_cmin).norm()*inflate;
-	root.m_cmin -= vec3d(d, d, d);
-	root.m_cmax += vec3d(d, d, d);
-
-	// figure out the levels
-	int level = (int) (log((double)nel) / log(8.0));
-	if (level < 1) level = 1;
-	if (level > m_max_level) level = m_max_level - 1;
-
-	// Recursively create children of this root
-	if (root.m_selist.size()) {
-		if ((root.m_level < m_max_level) &&
-			(root.m_selist.size() > m_max_elem))
-			root.CreateChildren(level, m_max_elem);
+				double cn = (x - (emin + emax)*0.5).norm2();
+				if ((imin < 0) || (dn < dmin) || (cn < cmin))
+				{
+					imin = n;
+					dmin = dn;
+					cmin = cn;
+				}
+			}
+		}
 	}
+	if (imin < 0) return nullptr;
 
-	return true;
+	// find the (extrapolated) iso-parametric coordinates and clamp them to the element
+	FESolidElement& e = *((FESolidElement*)m_elem[imin]);
+	ElementContains(imin, x, r);
+	clamp_to_reference_element(e, r);
+	return &e;
 }
 
 //-----------------------------------------------------------------------------
-FEElement* FEOctreeSearch::FindElement(const vec3d& x, double r[3])
+int FEOctreeSearch::FindElements(const vector<vec3d>& x, vector<FEElement*>& el, vector<vec3d>& r, bool closest)
 {
-	return m_root->FindElement(x, r);
+	int N = (int)x.size();
+	el.assign(N, nullptr);
+	r.assign(N, vec3d(0, 0, 0));
+
+	int nfail = 0;
+#pragma omp parallel for reduction(+:nfail)
+	for (int i = 0; i < N; ++i)
+	{
+		double ri[3] = { 0 };
+		FEElement* pe = (closest ? FindClosestElement(x[i], ri) : FindElement(x[i], ri));
+		el[i] = pe;
+		if (pe) r[i] = vec3d(ri[0], ri[1], ri[2]);
+		else nfail++;
+	}
+
+	return nfail;
 }
@@ -27,38 +27,26 @@ SOFTWARE.*/
 
 #include "vec3d.h"
 #include "vector.h"
-#include <set>
 
 class FEElement;
 class FEMesh;
 
 //-----------------------------------------------------------------------------
-//! This class is a helper class to find ray intersection with a surface
+//! This class is a helper class to find the element that contains a point
 
+//! The solid elements of the mesh are stored in a bounding volume hierarchy
+//! of axis-aligned boxes. The bounding boxes of the elements are computed once
+//! in Init. The search structures are not modified by the queries, so the Find
+//! functions can be called concurrently from multiple threads.
 class FECORE_API FEOctreeSearch
 {
-	class Block
+	// A node of the hierarchy. Interior nodes store the index of the first of
+	// their two (consecutive) children. Leaves store a range of elements.
+	struct Block
 	{
-	public:
-		Block(FEMesh* mesh, int level);
-		Block(Block* parent, int level);
-		~Block();
-		void Clear();
-		void CreateChildren(int max_level, int max_elem);
-		void FillBlock();
-		bool ElementIntersectsNode(FEElement* pe);
-
-		FEElement* FindElement(const vec3d& y, double r[3]);
-
-		bool IsInside(const vec3d& r) const;
-
-	public:
-		int					m_level;		//!< node level
-		vec3d				m_cmin, m_cmax;	//!< node bounding box
-		vector<FEElement*>	m_selist;		//!< list of surface elements inside this node
-		vector<Block*>		m_children;		//!< children of this node
-		FEMesh*				m_mesh;			//!< the mesh to search
-		Block*				m_parent;
+		vec3d	m_cmin, m_cmax;	//!< bounding box
+		int		m_first;		//!< first child (interior) or first element (leaf)
+		int		m_count;		//!< nr of elements (zero for interior nodes)
 	};
 
 public:
@@ -68,11 +56,35 @@ public:
 	//! initialize search structures
 	bool Init(double inflate = 0.005);
 
+	//! Find the element that contains x, and its iso-parametric coordinates r.
+	//! Returns nullptr if no element contains x.
 	FEElement* FindElement(const vec3d& x, double r[3]);
 
+	//! Same as FindElement, but if no element contains x, the closest element
+	//! is returned and r is clamped to the reference domain of that element.
+	FEElement* FindClosestElement(const vec3d& x, double r[3]);
+
+	//! Locate a list of points in parallel. Returns the number of points that
+	//! were not found (the corresponding element pointer is set to nullptr).
+	int FindElements(const std::vector<vec3d>& x, std::vector<FEElement*>& el, std::vector<vec3d>& r, bool closest = false);
+
+private:
+	void Build(int nb, int i0, int i1, int level, std::vector<int>& order, const std::vector<vec3d>& c);
+
+	bool ElementContains(int i, const vec3d& x, double r[3]) const;
+
+	double BoxDistance2(const vec3d& cmin, const vec3d& cmax, const vec3d& x) const;
+
 protected:
-	FEMesh*		m_mesh;			//!< the surface to search
-	Block*		m_root;			//!< root node in octree
-	int			m_max_level;	//!< maximum allowable number of levels in octree
-	int			m_max_elem;		//!< maximum allowable number of elements in any node
+	FEMesh*		m_mesh;			//!< the mesh to search
+	int			m_max_level;	//!< maximum depth of the hierarchy
+	int			m_max_elem;		//!< maximum allowable number of elements in a leaf
+	vec3d		m_rmin, m_rmax;	//!< (inflated) bounding box of the mesh
+
+	std::vector<Block>		m_block;	//!< the nodes of the hierarchy (root is first)
+	std::vector<FEElement*>	m_elem;		//!< the elements, in hierarchy order
+
+	// element bounding boxes, in hierarchy order
+	std::vector<double>	m_xmin, m_ymin, m_zmin;
+	std::vector<double>	m_xmax, m_ymax, m_zmax;
 };
@@ -165,7 +165,7 @@ bool FEParabolicMap::Generate(FESurfaceMap& map)
 		// nodal coordinates
 		FEMesh& mesh = *ps->GetMesh();
 		vec3d rt[FEElement::MAX_NODES];
-		for (int j = 0; j<neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt;
+		for (int j = 0; j<neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt();
 
 		// repeat over integration points
 		ke.zero();
@@ -238,7 +238,7 @@ bool FEParabolicMap::Generate(FESurfaceMap& map)
 		// nodal coordinates
 		FEMesh& mesh = *ps->GetMesh();
 		vec3d rt[FEElement::MAX_NODES];
-		for (int j = 0; j<neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt;
+		for (int j = 0; j<neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt();
 
 		// repeat over integration points
 		for (int n = 0; n<nint; ++n)
@@ -114,7 +114,7 @@ void FEPrescribedDOF::GetNodalValues(int n, std::vector<double>& val)
 	const FENode& node = *nset.Node(n);
 
 	FEMaterialPoint mp;
-	mp.m_r0 = node.m_r0;
+	mp.m_r0 = node.m_r0();
 	mp.m_index = n;
 
 	val[0] = m_scale(mp);
@@ -114,7 +114,7 @@ void FESPRProjection::Project(FESolidDomain& dom, const vector< vector<double> >
 		if (tag[in] <= 1)
 		{
 			// get the nodal position
-			vec3d rc = node.m_rt;
+			vec3d rc = node.m_rt();
 
 			// get the element patch
 			int ne = NEL.Valence(in);
@@ -191,7 +191,7 @@ void FESPRProjection::Project(FESolidDomain& dom, const vector< vector<double> >
 						int em = el.m_node[k];
 						if (tag[em] != 1)
 						{
-							vec3d r = mesh.Node(em).m_rt - rc;
+							vec3d r = mesh.Node(em).m_rt() - rc;
 							pk[0] = 1.0; pk[1] = r.x; pk[2] = r.y; pk[3] = r.z;
 							if (NDOF >=  7) { pk[4] = r.x*r.y; pk[5] = r.y*r.z; pk[6] = r.x*r.z; }
 							if (NDOF >= 10) { pk[7] = r.x*r.x; pk[8] = r.y*r.y; pk[9] = r.z*r.z; }
@@ -157,6 +157,19 @@ FEScalarValuator* FEMathValue::copy()
 	return newExpr;
 }
 
+bool FEMathValue::isTimeInvariant()
+{
+	// model parameters can be changed by load controllers
+	for (size_t i = 0; i < m_vars.size(); ++i)
+	{
+		if (m_vars[i].type == 0) return false;
+	}
+
+	// see if the expression depends on time
+	if (m_math.Variables() < 4) return false;
+	return (is_dependent(m_math.GetExpression(), *m_math.Variable(3)) == false);
+}
+
 double FEMathValue::operator()(const FEMaterialPoint& pt)
 {
 	std::vector<double> var(4 + m_vars.size());
@@ -48,6 +48,10 @@ public:
 	virtual bool isConst() { return false; }
 
 	virtual double* constValue() { return nullptr; }
+
+	// Returns true if the value at a material point does not change over time
+	// (i.e. it only depends on the position and the material point's element).
+	virtual bool isTimeInvariant() { return isConst(); }
 };
 
 //---------------------------------------------------------------------------------------
@@ -93,6 +97,8 @@ public:
 
 	FEScalarValuator* copy() override;
 
+	bool isTimeInvariant() override;
+
 	void setMathString(const std::string& s);
 
 	bool create(FECoreBase* pc = 0);
@@ -118,6 +124,8 @@ public:
 
 	FEScalarValuator* copy() override;
 
+	bool isTimeInvariant() override { return true; }
+
 private:
 	FEDataMap*	m_val;
 };
@@ -133,6 +141,8 @@ public:
 
 	FEScalarValuator* copy() override;
 
+	bool isTimeInvariant() override { return true; }
+
 private:
 	FENodeDataMap*		m_val;
 };
@@ -0,0 +1,157 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#include "stdafx.h"
+#include "FEScratchArena.h"
+#include "FEElement.h"
+
+// total number of heap allocations made by the arenas
+static size_t arena_allocations = 0;
+
+// minimum size (in doubles) of the temporary blocks
+#define MIN_BLOCK_SIZE	4096
+
+//-----------------------------------------------------------------------------
+FEScratchArena::Frame::Frame(FEScratchArena& arena) : m_arena(arena)
+{
+	m_block = arena.m_block;
+	m_offset = arena.m_offset;
+}
+
+//-----------------------------------------------------------------------------
+FEScratchArena::Frame::~Frame()
+{
+	m_arena.m_block = m_block;
+	m_arena.m_offset = m_offset;
+}
+
+//-----------------------------------------------------------------------------
+FEScratchArena::FEScratchArena()
+{
+	m_capfe = 0;
+	m_caplm[0] = m_caplm[1] = 0;
+	m_capke[0] = m_capke[1] = m_capke[2] = 0;
+	m_block = 0;
+	m_offset = 0;
+}
+
+//-----------------------------------------------------------------------------
+FEScratchArena& FEScratchArena::ThreadArena()
+{
+	static thread_local FEScratchArena arena;
+	return arena;
+}
+
+//-----------------------------------------------------------------------------
+void FEScratchArena::CountAllocation()
+{
+#pragma omp atomic
+	arena_allocations++;
+}
+
+//-----------------------------------------------------------------------------
+size_t FEScratchArena::Allocations()
+{
+	return arena_allocations;
+}
+
+//-----------------------------------------------------------------------------
+void FEScratchArena::ResetAllocations()
+{
+	arena_allocations = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Releases the temporaries. This is also where we check if any of the arrays 
+// that were handed out had to grow since the last call.
+void FEScratchArena::Reset()
+{
+	m_block = 0;
+	m_offset = 0;
+
+	if (m_fe.capacity() != m_capfe) { m_capfe = m_fe.capacity(); CountAllocation(); }
+	for (int i = 0; i < 2; ++i)
+	{
+		if (m_lm[i].capacity() != m_caplm[i]) { m_caplm[i] = m_lm[i].capacity(); CountAllocation(); }
+	}
+
+	size_t capke[3] = { m_ke.Nodes().capacity(), m_ke.RowIndices().capacity(), m_ke.ColumnsIndices().capacity() };
+	for (int i = 0; i < 3; ++i)
+	{
+		if (capke[i] != m_capke[i]) { m_capke[i] = capke[i]; CountAllocation(); }
+	}
+}
+
+//-----------------------------------------------------------------------------
+FEElementMatrix& FEScratchArena::ElementMatrix(const FEElement& el, int nr, int nc)
+{
+	// matrix::resize only reallocates when the size changes
+	if ((m_ke.rows() != nr) || (m_ke.columns() != nc))
+	{
+		m_ke.resize(nr, nc);
+		CountAllocation();
+	}
+	m_ke.SetNodes(el.m_node);
+	return m_ke;
+}
+
+//-----------------------------------------------------------------------------
+std::vector<double>& FEScratchArena::ElementVector(int n)
+{
+	m_fe.assign(n, 0.0);
+	return m_fe;
+}
+
+//-----------------------------------------------------------------------------
+double* FEScratchArena::AllocateDoubles(size_t n)
+{
+	if (n == 0) return nullptr;
+
+	// find a block that has enough room left
+	while (m_block < m_blocks.size())
+	{
+		std::vector<double>& b = m_blocks[m_block];
+		if (m_offset + n <= b.size())
+		{
+			double* p = &b[m_offset];
+			m_offset += n;
+			return p;
+		}
+		m_block++;
+		m_offset = 0;
+	}
+
+	// we need a new block
+	m_blocks.push_back(std::vector<double>(n > MIN_BLOCK_SIZE ? n : MIN_BLOCK_SIZE));
+	CountAllocation();
+	m_block = m_blocks.size() - 1;
+	m_offset = n;
+	return &(m_blocks[m_block][0]);
+}
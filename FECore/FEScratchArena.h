@@ -0,0 +1,124 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+
+#pragma once
+#include "FEGlobalMatrix.h"
+#include "fecore_api.h"
+#include <vector>
+
+class FEElement;
+
+//-----------------------------------------------------------------------------
+//! Per-thread scratch memory for element loops.
+//!
+//! Each thread owns one arena (see ThreadArena), so element routines can get an
+//! element matrix, an element vector, LM arrays and integration point temporaries
+//! without going to the heap. All storage is kept between elements, so once the
+//! arena has grown to the size of the largest element, the loops are allocation-free.
+//! The arena counts the heap allocations it makes, which can be used to check this.
+class FECORE_API FEScratchArena
+{
+public:
+	//! Releases the temporaries allocated inside its scope when it goes out of scope.
+	class FECORE_API Frame
+	{
+	public:
+		Frame(FEScratchArena& arena);
+		~Frame();
+
+	private:
+		FEScratchArena&	m_arena;
+		size_t			m_block;
+		size_t			m_offset;
+	};
+
+public:
+	FEScratchArena();
+
+	//! return the arena of the calling thread
+	static FEScratchArena& ThreadArena();
+
+	//! release all temporaries (the memory is kept for later use)
+	void Reset();
+
+	//! get the element matrix, sized nr x nc and set to the element's nodes.
+	//! (The values are not initialized.)
+	FEElementMatrix& ElementMatrix(const FEElement& el, int nr, int nc);
+
+	//! get the element vector, sized n and set to zero
+	std::vector<double>& ElementVector(int n);
+
+	//! get an LM array (two are available, e.g. for separate row and column dofs)
+	std::vector<int>& LM(int i = 0) { return m_lm[i]; }
+
+	//! get uninitialized storage for n objects of type T. This is only meant for
+	//! plain data types (double, vec3d, mat3d, ...), since no constructors are called.
+	template <class T> T* Allocate(size_t n)
+	{
+		size_t nd = (n*sizeof(T) + sizeof(double) - 1) / sizeof(double);
+		return reinterpret_cast<T*>(AllocateDoubles(nd));
+	}
+
+	//! get uninitialized storage for an nr x nc array of type T, which is indexed as a[i][j].
+	//! (The same restrictions as for Allocate apply.)
+	template <class T> T** Allocate2D(size_t nr, size_t nc)
+	{
+		T** a = Allocate<T*>(nr);
+		for (size_t i = 0; i < nr; ++i) a[i] = Allocate<T>(nc);
+		return a;
+	}
+
+public:
+	//! total number of heap allocations made by all arenas so far
+	static size_t Allocations();
+
+	//! reset the allocation counter
+	static void ResetAllocations();
+
+private:
+	double* AllocateDoubles(size_t n);
+
+	void CountAllocation();
+
+private:
+	FEElementMatrix		m_ke;		//!< element matrix
+	std::vector<double>	m_fe;		//!< element vector
+	std::vector<int>	m_lm[2];	//!< LM arrays
+
+	// capacities seen at the last Reset, used for detecting allocations
+	size_t	m_capfe;
+	size_t	m_caplm[2];
+	size_t	m_capke[3];
+
+	// temporary storage, allocated in blocks that are never released
+	std::vector< std::vector<double> >	m_blocks;
+	size_t	m_block;	//!< current block
+	size_t	m_offset;	//!< next free entry in current block
+};
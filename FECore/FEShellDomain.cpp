@@ -72,7 +72,7 @@ void FEShellDomain::GetCurrentNodalCoordinates(const FEShellElement& el, vec3d*
 {
     int neln = el.Nodes();
     if (!back)
-        for (int i = 0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+        for (int i = 0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_rt();
     else
         for (int i = 0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_st();
 }
@@ -85,7 +85,7 @@ void FEShellDomain::GetCurrentNodalCoordinates(const FEShellElement& el, vec3d*
     if (!back) {
         for (int i = 0; i<neln; ++i) {
             FENode& nd = m_pMesh->Node(el.m_node[i]);
-            rt[i] = nd.m_rt*alpha + nd.m_rp*(1 - alpha);
+            rt[i] = nd.m_rt()*alpha + nd.m_rp()*(1 - alpha);
         }
     }
     else {
@@ -102,7 +102,7 @@ void FEShellDomain::GetReferenceNodalCoordinates(const FEShellElement& el, vec3d
 {
     int neln = el.Nodes();
     if (!back)
-        for (int i = 0; i<neln; ++i) r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+        for (int i = 0; i<neln; ++i) r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
     else
         for (int i = 0; i<neln; ++i) r0[i] = m_pMesh->Node(el.m_node[i]).m_s0();
 }
@@ -113,7 +113,7 @@ void FEShellDomain::GetPreviousNodalCoordinates(const FEShellElement& el, vec3d*
 {
     int neln = el.Nodes();
     if (!back)
-        for (int i = 0; i<neln; ++i) rp[i] = m_pMesh->Node(el.m_node[i]).m_rp;
+        for (int i = 0; i<neln; ++i) rp[i] = m_pMesh->Node(el.m_node[i]).m_rp();
     else
         for (int i = 0; i<neln; ++i) rp[i] = m_pMesh->Node(el.m_node[i]).m_sp();
 }
@@ -134,6 +134,9 @@ FEShellDomainOld::FEShellDomainOld(FEModel* fem) : FEShellDomain(fem)
 //-----------------------------------------------------------------------------
 bool FEShellDomainOld::Create(int nelems, FE_Element_Spec espec)
 {
+	// the elements change, so any existing coloring is no longer valid
+	ResetElementColoring();
+
 	m_Elem.resize(nelems);
 	for (int i = 0; i < nelems; ++i)
 	{
@@ -159,7 +162,7 @@ double FEShellDomainOld::Volume(FEShellElement& se)
 	vec3d r0[FEElement::MAX_NODES], D0[FEElement::MAX_NODES];
 	for (int i = 0; i<neln; ++i)
 	{
-		r0[i] = Node(el.m_lnode[i]).m_r0;
+		r0[i] = Node(el.m_lnode[i]).m_r0();
 		D0[i] = el.m_D0[i];
 	}
 
@@ -212,7 +215,7 @@ void FEShellDomainOld::InitShells()
 		int ne = el.Nodes();
 		for (int j = 0; j<ne; ++j)
 		{
-			vec3d d0 = mesh.Node(el.m_node[j]).m_d0;
+			vec3d d0 = mesh.Node(el.m_node[j]).m_d0();
 			d0.unit();
 			el.m_D0[j] = d0 * el.m_h0[j];
 		}
@@ -228,6 +231,9 @@ FEShellDomainNew::FEShellDomainNew(FEModel* fem) : FEShellDomain(fem)
 //-----------------------------------------------------------------------------
 bool FEShellDomainNew::Create(int nelems, FE_Element_Spec espec)
 {
+	// the elements change, so any existing coloring is no longer valid
+	ResetElementColoring();
+
 	m_Elem.resize(nelems);
 	for (int i = 0; i < nelems; ++i)
 	{
@@ -253,8 +259,8 @@ double FEShellDomainNew::Volume(FEShellElement& se)
 	vec3d r0[FEElement::MAX_NODES], D0[FEElement::MAX_NODES];
 	for (int i = 0; i<neln; ++i)
 	{
-		r0[i] = Node(el.m_lnode[i]).m_r0;
-		D0[i] = Node(el.m_lnode[i]).m_d0;
+		r0[i] = Node(el.m_lnode[i]).m_r0();
+		D0[i] = Node(el.m_lnode[i]).m_d0();
 	}
 
 	int nint = el.GaussPoints();
@@ -41,11 +41,17 @@ FESolidDomain::FESolidDomain(FEModel* pfem) : FEDomain(FE_DOMAIN_SOLID, pfem), m
     m_dofSU.AddDof(pfem->GetDOFIndex("sx"));
 	m_dofSU.AddDof(pfem->GetDOFIndex("sy"));
 	m_dofSU.AddDof(pfem->GetDOFIndex("sz"));
+
+	m_bcache_grad0 = false;
+	m_bgrad0_valid = false;
 }
 
 //-----------------------------------------------------------------------------
 bool FESolidDomain::Create(int nsize, FE_Element_Spec espec)
 {
+	// the elements change, so any existing coloring is no longer valid
+	ResetElementColoring();
+
 	// allocate elements
     m_Elem.resize(nsize);
 	for (int i = 0; i < nsize; ++i)
@@ -55,6 +61,9 @@ bool FESolidDomain::Create(int nsize, FE_Element_Spec espec)
 		el.SetMeshPartition(this);
 	}
 
+	m_bcache_grad0 = espec.m_bcache_grad0;
+	m_bgrad0_valid = false;
+
 	// set element type
 	if (espec.etype != FE_ELEM_INVALID_TYPE)
 		ForEachElement([=](FEElement& el) { el.SetType(espec.etype); });
@@ -83,6 +92,15 @@ void FESolidDomain::CopyFrom(FEMeshPartition* pd)
     FESolidDomain* psd = dynamic_cast<FESolidDomain*>(pd);
     m_Elem = psd->m_Elem;
 	ForEachElement([=](FEElement& el) { el.SetMeshPartition(this); });
+
+	m_bcache_grad0 = psd->m_bcache_grad0;
+	m_bgrad0_valid = psd->m_bgrad0_valid;
+	m_grad0_ip  = psd->m_grad0_ip;
+	m_grad0_off = psd->m_grad0_off;
+	m_detJ0 = psd->m_detJ0;
+	m_G0x = psd->m_G0x;
+	m_G0y = psd->m_G0y;
+	m_G0z = psd->m_G0z;
 }
 
 //-----------------------------------------------------------------------------
@@ -102,11 +120,8 @@ bool FESolidDomain::Init()
 			const int NELN = FEElement::MAX_NODES;
 			vec3d r0[NELN], r[NELN], v[NELN], a[NELN];
 			int neln = el.Nodes();
-			for (int j = 0; j < neln; ++j)
-			{
-				FENode& node = m_pMesh->Node(el.m_node[j]);
-				r0[j] = node.m_r0;
-			}
+			const vec3d* X = m_pMesh->ReferencePositions();
+			for (int j = 0; j < neln; ++j) r0[j] = X[el.m_node[j]];
 
 			// initialize reference Jacobians
 			double Ji[3][3];
@@ -125,6 +140,9 @@ bool FESolidDomain::Init()
 				mp.m_r0 = el.Evaluate(r0, n);
 			}
 		});
+
+		// build the reference gradient cache
+		if (m_bcache_grad0) UpdateReferenceGradientCache();
 	}
 	catch (NegativeJacobian e)
 	{
@@ -132,9 +150,113 @@ bool FESolidDomain::Init()
 		return false;
 	}
 
+	// report the memory used by the gradient cache
+	if (m_bcache_grad0)
+	{
+		double mem = (double) (m_detJ0.size() + m_G0x.size() + m_G0y.size() + m_G0z.size())*sizeof(double);
+		mem += (double) (m_grad0_ip.size() + m_grad0_off.size())*sizeof(int);
+		feLog("Domain %s: cached reference shape gradients (%.1lf MB)\n", GetName().c_str(), mem / (1024.0*1024.0));
+	}
+
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+void FESolidDomain::SetReferenceGradientCache(bool b)
+{
+	m_bcache_grad0 = b;
+	if (b == false)
+	{
+		m_bgrad0_valid = false;
+		m_grad0_ip.clear();
+		m_grad0_off.clear();
+		m_detJ0.clear();
+		m_G0x.clear();
+		m_G0y.clear();
+		m_G0z.clear();
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! Evaluate the reference Jacobians and shape function gradients at all integration
+//! points and store them. This also updates the element's inverse reference Jacobians.
+//! Note that this must be called each time the reference coordinates change.
+void FESolidDomain::UpdateReferenceGradientCache()
+{
+	if (m_bcache_grad0 == false) return;
+
+	// make sure the functions below evaluate the gradients
+	m_bgrad0_valid = false;
+
+	// determine the offsets
+	int NE = Elements();
+	m_grad0_ip.resize(NE + 1);
+	m_grad0_off.resize(NE + 1);
+	m_grad0_ip[0] = m_grad0_off[0] = 0;
+	for (int i = 0; i < NE; ++i)
+	{
+		FESolidElement& el = m_Elem[i];
+		m_grad0_ip [i + 1] = m_grad0_ip [i] + el.GaussPoints();
+		m_grad0_off[i + 1] = m_grad0_off[i] + el.GaussPoints()*el.Nodes();
+	}
+
+	// allocate storage
+	m_detJ0.resize(m_grad0_ip[NE]);
+	m_G0x.resize(m_grad0_off[NE]);
+	m_G0y.resize(m_grad0_off[NE]);
+	m_G0z.resize(m_grad0_off[NE]);
+
+	// evaluate the gradients
+	// NOTE: exceptions cannot propagate out of the parallel region, so
+	//       we catch them here and rethrow afterwards.
+	int nerr = -1, err_iel = 0, err_ng = 0;
+	double err_vol = 0.0;
+#pragma omp parallel for
+	for (int i = 0; i < NE; ++i)
+	{
+		FESolidElement& el = m_Elem[i];
+		int neln = el.Nodes();
+		int nint = el.GaussPoints();
+		try {
+			vec3d G[FEElement::MAX_NODES];
+			double Ji[3][3];
+			for (int n = 0; n < nint; ++n)
+			{
+				double J0 = invjac0(el, Ji, n);
+				el.m_J0i[n] = mat3d(Ji);
+				el.GetMaterialPoint(n)->m_J0 = J0;
+
+				ShapeGradient0(el, n, G);
+
+				m_detJ0[m_grad0_ip[i] + n] = J0;
+				int noff = m_grad0_off[i] + n*neln;
+				for (int j = 0; j < neln; ++j)
+				{
+					m_G0x[noff + j] = G[j].x;
+					m_G0y[noff + j] = G[j].y;
+					m_G0z[noff + j] = G[j].z;
+				}
+			}
+		}
+		catch (NegativeJacobian e)
+		{
+#pragma omp critical
+			{
+				if ((nerr == -1) || (i < nerr))
+				{
+					nerr = i;
+					err_iel = e.m_iel;
+					err_ng = e.m_ng;
+					err_vol = e.m_vol;
+				}
+			}
+		}
+	}
+	if (nerr != -1) throw NegativeJacobian(err_iel, err_ng, err_vol, &m_Elem[nerr]);
+
+	m_bgrad0_valid = true;
+}
+
 //-----------------------------------------------------------------------------
 // Reset data
 void FESolidDomain::Reset()
@@ -148,11 +270,15 @@ void FESolidDomain::Reset()
 //! This function finds the element in which point y lies and returns
 //! the isoparametric coordinates in r if an element is found
 //! (This has only been implemeneted for hexes!)
+//! Note that this checks all elements in the current configuration. Since the
+//! nodes move between calls, this does not use FEOctreeSearch, which is built 
+//! once for the reference configuration and is better suited for many queries.
 FESolidElement* FESolidDomain::FindElement(const vec3d& y, double r[3])
 {
     int i, j;
     int NE = Elements();
     vec3d x[FEElement::MAX_NODES];
+    const vec3d* xt = m_pMesh->CurrentPositions();
     for (i=0; i<NE; ++i)
     {
         // get the next element
@@ -161,7 +287,7 @@ FESolidElement* FESolidDomain::FindElement(const vec3d& y, double r[3])
         
         // get the element nodal coordinates
         int neln = e.Nodes();
-        for (j=0; j<neln; ++j) x[j] = m_pMesh->Node(e.m_node[j]).m_rt;
+        for (j=0; j<neln; ++j) x[j] = xt[e.m_node[j]];
         
         // first, as a quick check, we see if y lies in the bounding box defined by x
         FEBoundingBox box(x[0]);
@@ -191,6 +317,7 @@ FESolidElement* FESolidDomain::FindReferenceElement(const vec3d& y, double r[3])
 {
 	int NE = Elements();
 	vec3d x[FEElement::MAX_NODES];
+	const vec3d* X = m_pMesh->ReferencePositions();
 	for (int i = 0; i<NE; ++i)
 	{
 		// get the next element
@@ -198,7 +325,7 @@ FESolidElement* FESolidDomain::FindReferenceElement(const vec3d& y, double r[3])
 
 		// get the element nodal coordinates
 		int neln = e.Nodes();
-		for (int j = 0; j<neln; ++j) x[j] = m_pMesh->Node(e.m_node[j]).m_r0;
+		for (int j = 0; j<neln; ++j) x[j] = X[e.m_node[j]];
 
 		// first, as a quick check, we see if y lies in the bounding box defined by x
 		FEBoundingBox box(x[0]);
@@ -223,7 +350,8 @@ void FESolidDomain::ProjectToElement(FESolidElement& el, const vec3d& p, double
 
 	// get the element nodal coordinates
 	int ne = el.Nodes();
-	for (int i = 0; i<ne; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+	const vec3d* x = m_pMesh->CurrentPositions();
+	for (int i = 0; i<ne; ++i) rt[i] = x[el.m_node[i]];
 
     r[0] = r[1] = r[2] = 0;
     const double tol = 1e-5;
@@ -271,7 +399,8 @@ bool FESolidDomain::ProjectToReferenceElement(FESolidElement& el, const vec3d& p
 
 	// get the element nodal coordinates
 	int ne = el.Nodes();
-	for (int i = 0; i<ne; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+	const vec3d* X = m_pMesh->ReferencePositions();
+	for (int i = 0; i<ne; ++i) rt[i] = X[el.m_node[i]];
 
     r[0] = r[1] = r[2] = 0;
     const double tol = 1e-5;
@@ -351,18 +480,16 @@ bool FESolidDomain::ProjectToReferenceElement(FESolidElement& el, const vec3d& p
 void FESolidDomain::GetCurrentNodalCoordinates(const FESolidElement& el, vec3d* rt)
 {
 	int neln = el.Nodes();
-	for (int i = 0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+	const vec3d* x = m_pMesh->CurrentPositions();
+	for (int i = 0; i<neln; ++i) rt[i] = x[el.m_node[i]];
 
 	// check for solid-shell interface nodes
 	if (el.m_bitfc.empty() == false)
 	{
+		const vec3d* d = m_pMesh->CurrentDirectors();
 		for (int i = 0; i<neln; ++i)
 		{
-			if (el.m_bitfc[i])
-			{
-				FENode& nd = m_pMesh->Node(el.m_node[i]);
-				rt[i] -= nd.m_dt;
-			}
+			if (el.m_bitfc[i]) rt[i] -= d[el.m_node[i]];
 		}
 	}
 }
@@ -372,9 +499,11 @@ void FESolidDomain::GetCurrentNodalCoordinates(const FESolidElement& el, vec3d*
 void FESolidDomain::GetCurrentNodalCoordinates(const FESolidElement& el, vec3d* rt, double alpha)
 {
 	int neln = el.Nodes();
+	const vec3d* x = m_pMesh->CurrentPositions();
+	const vec3d* xp = m_pMesh->PreviousPositions();
 	for (int i = 0; i<neln; ++i) {
-		FENode& nd = m_pMesh->Node(el.m_node[i]);
-		rt[i] = nd.m_rt*alpha + nd.m_rp*(1 - alpha);
+		int n = el.m_node[i];
+		rt[i] = x[n]*alpha + xp[n]*(1 - alpha);
 	}
 
 	// check for solid-shell interface nodes
@@ -384,7 +513,7 @@ void FESolidDomain::GetCurrentNodalCoordinates(const FESolidElement& el, vec3d*
 		{
 			if (el.m_bitfc[i]) {
 				FENode& nd = m_pMesh->Node(el.m_node[i]);
-				rt[i] -= nd.m_d0 + rt[i] - nd.m_r0
+				rt[i] -= nd.m_d0() + rt[i] - nd.m_r0()
 					- nd.get_vec3d(m_dofSU[0], m_dofSU[1], m_dofSU[2])*alpha
 					- nd.get_vec3d_prev(m_dofSU[0], m_dofSU[1], m_dofSU[2])*(1 - alpha);
 			}
@@ -398,18 +527,16 @@ void FESolidDomain::GetCurrentNodalCoordinates(const FESolidElement& el, vec3d*
 void FESolidDomain::GetReferenceNodalCoordinates(const FESolidElement& el, vec3d* r0)
 {
 	int neln = el.Nodes();
-	for (int i = 0; i<neln; ++i) r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+	const vec3d* X = m_pMesh->ReferencePositions();
+	for (int i = 0; i<neln; ++i) r0[i] = X[el.m_node[i]];
 
 	// check for solid-shell interface nodes
 	if (el.m_bitfc.empty() == false)
 	{
+		const vec3d* D = m_pMesh->ReferenceDirectors();
 		for (int i = 0; i<neln; ++i)
 		{
-			if (el.m_bitfc[i])
-			{
-				FENode& nd = m_pMesh->Node(el.m_node[i]);
-				r0[i] -= nd.m_d0;
-			}
+			if (el.m_bitfc[i]) r0[i] -= D[el.m_node[i]];
 		}
 	}
 }
@@ -419,18 +546,16 @@ void FESolidDomain::GetReferenceNodalCoordinates(const FESolidElement& el, vec3d
 void FESolidDomain::GetPreviousNodalCoordinates(const FESolidElement& el, vec3d* rp)
 {
 	int neln = el.Nodes();
-	for (int i = 0; i<neln; ++i) rp[i] = m_pMesh->Node(el.m_node[i]).m_rp;
+	const vec3d* xp = m_pMesh->PreviousPositions();
+	for (int i = 0; i<neln; ++i) rp[i] = xp[el.m_node[i]];
 
 	// check for solid-shell interface nodes
 	if (el.m_bitfc.empty() == false)
 	{
+		const vec3d* dp = m_pMesh->PreviousDirectors();
 		for (int i = 0; i<neln; ++i)
 		{
-			if (el.m_bitfc[i])
-			{
-				FENode& nd = m_pMesh->Node(el.m_node[i]);
-				rp[i] -= nd.m_dp;
-			}
+			if (el.m_bitfc[i]) rp[i] -= dp[el.m_node[i]];
 		}
 	}
 }
@@ -1025,6 +1150,15 @@ double FESolidDomain::defgradp(FESolidElement &el, mat3d &F, int n)
 //! The return value is the determinant of the Jacobian (not the inverse!)
 double FESolidDomain::invjac0(const FESolidElement& el, double Ji[3][3], int n)
 {
+	// see if we can use the cache
+	if (m_bgrad0_valid && (el.GetMeshPartition() == this))
+	{
+		const mat3d& Ji0 = el.m_J0i[n];
+		for (int i = 0; i < 3; ++i)
+			for (int j = 0; j < 3; ++j) Ji[i][j] = Ji0(i, j);
+		return m_detJ0[m_grad0_ip[el.GetLocalID()] + n];
+	}
+
     // nodal coordinates
     vec3d r0[FEElement::MAX_NODES];
 	GetReferenceNodalCoordinates(el, r0);
@@ -1758,6 +1892,10 @@ double FESolidDomain::detJt(FESolidElement &el, int n, const double alpha)
 //! Calculate jacobian with respect to reference frame
 double FESolidDomain::detJ0(FESolidElement &el, int n)
 {
+	// see if we can use the cache
+	if (m_bgrad0_valid && (el.GetMeshPartition() == this))
+		return m_detJ0[m_grad0_ip[el.GetLocalID()] + n];
+
     // nodal coordinates
     vec3d r0[FEElement::MAX_NODES];
 	GetReferenceNodalCoordinates(el, r0);
@@ -1931,7 +2069,7 @@ void FESolidDomain::ContraBaseVectors(FESolidElement& el, int j, vec3d gcnt[3],
 
 void FESolidDomain::CoBaseVectorDerivatives(FESolidElement& el, int j, vec3d dg[3][3])
 {
-    FEMesh& m = *m_pMesh;
+    const vec3d* x = m_pMesh->CurrentPositions();
     
     // get the nr of nodes
     int n = el.Nodes();
@@ -1947,7 +2085,7 @@ void FESolidDomain::CoBaseVectorDerivatives(FESolidElement& el, int j, vec3d dg[
     
     for (int i=0; i<n; ++i)
     {
-        vec3d rt = m.Node(el.m_node[i]).m_rt;
+        vec3d rt = x[el.m_node[i]];
         dg[0][0] += rt*Hrr[i]; dg[0][1] += rt*Hsr[i]; dg[0][2] += rt*Htr[i];
         dg[1][0] += rt*Hrs[i]; dg[1][1] += rt*Hss[i]; dg[1][2] += rt*Hts[i];
         dg[2][0] += rt*Hrt[i]; dg[2][1] += rt*Hst[i]; dg[2][2] += rt*Htt[i];
@@ -1960,7 +2098,7 @@ void FESolidDomain::CoBaseVectorDerivatives(FESolidElement& el, int j, vec3d dg[
 
 void FESolidDomain::CoBaseVectorDerivatives0(FESolidElement& el, int j, vec3d dg[3][3])
 {
-    FEMesh& m = *m_pMesh;
+    const vec3d* x = m_pMesh->ReferencePositions();
     
     // get the nr of nodes
     int n = el.Nodes();
@@ -1976,7 +2114,7 @@ void FESolidDomain::CoBaseVectorDerivatives0(FESolidElement& el, int j, vec3d dg
     
     for (int i=0; i<n; ++i)
     {
-        vec3d rt = m.Node(el.m_node[i]).m_r0;
+        vec3d rt = x[el.m_node[i]];
         dg[0][0] += rt*Hrr[i]; dg[0][1] += rt*Hsr[i]; dg[0][2] += rt*Htr[i];
         dg[1][0] += rt*Hrs[i]; dg[1][1] += rt*Hss[i]; dg[1][2] += rt*Hts[i];
         dg[2][0] += rt*Hrt[i]; dg[2][1] += rt*Hst[i]; dg[2][2] += rt*Htt[i];
@@ -1989,7 +2127,8 @@ void FESolidDomain::CoBaseVectorDerivatives0(FESolidElement& el, int j, vec3d dg
 
 void FESolidDomain::CoBaseVectorDerivatives(FESolidElement& el, int j, vec3d dg[3][3], const double alpha)
 {
-    FEMesh& m = *m_pMesh;
+    const vec3d* x = m_pMesh->CurrentPositions();
+    const vec3d* xp = m_pMesh->PreviousPositions();
     
     // get the nr of nodes
     int n = el.Nodes();
@@ -2005,7 +2144,7 @@ void FESolidDomain::CoBaseVectorDerivatives(FESolidElement& el, int j, vec3d dg[
     
     for (int i=0; i<n; ++i)
     {
-        vec3d rt = m.Node(el.m_node[i]).m_rt*alpha + m.Node(el.m_node[i]).m_rp*(1.0-alpha);
+        vec3d rt = x[el.m_node[i]]*alpha + xp[el.m_node[i]]*(1.0-alpha);
         dg[0][0] += rt*Hrr[i]; dg[0][1] += rt*Hsr[i]; dg[0][2] += rt*Htr[i];
         dg[1][0] += rt*Hrs[i]; dg[1][1] += rt*Hss[i]; dg[1][2] += rt*Hts[i];
         dg[2][0] += rt*Hrt[i]; dg[2][1] += rt*Hst[i]; dg[2][2] += rt*Htt[i];
@@ -2246,6 +2385,18 @@ double FESolidDomain::ShapeGradient(FESolidElement& el, int n, vec3d* GradH, con
 //-----------------------------------------------------------------------------
 double FESolidDomain::ShapeGradient0(FESolidElement& el, int n, vec3d* GradH)
 {
+	// see if we can use the cache
+	if (m_bgrad0_valid && (el.GetMeshPartition() == this))
+	{
+		int ne = el.Nodes();
+		int noff = m_grad0_off[el.GetLocalID()] + n*ne;
+		const double* Gx = &m_G0x[noff];
+		const double* Gy = &m_G0y[noff];
+		const double* Gz = &m_G0z[noff];
+		for (int i = 0; i < ne; ++i) GradH[i] = vec3d(Gx[i], Gy[i], Gz[i]);
+		return m_detJ0[m_grad0_ip[el.GetLocalID()] + n];
+	}
+
     // calculate jacobian
     double Ji[3][3];
     double detJ0 = invjac0(el, Ji, n);
@@ -2327,7 +2478,8 @@ double FESolidDomain::Volume(FESolidElement& el)
 	vec3d r0[FEElement::MAX_NODES];
 
 	int neln = el.Nodes();
-	for (int i = 0; i<neln; ++i) r0[i] = Node(el.m_lnode[i]).m_r0;
+	const vec3d* X = m_pMesh->ReferencePositions();
+	for (int i = 0; i<neln; ++i) r0[i] = X[el.m_node[i]];
 
 	int nint = el.GaussPoints();
 	double *w = el.GaussWeights();
@@ -2436,7 +2588,7 @@ void FESolidDomain::LoadVector(
 			for (int j = 0; j < neln; ++j)
 			{
 				FENode& node = mesh.Node(el.m_node[j]);
-				vector<int>& ID = node.m_ID;
+				FENodeArray<int>& ID = node.m_ID;
 				for (int k = 0; k < dofPerNode; ++k)
 				{
 					lm[dofPerNode*j + k] = ID[dofList[k]];
@@ -2511,7 +2663,7 @@ void FESolidDomain::LoadStiffness(FELinearSystem& LS, const FEDofList& dofList_a
 		for (int j = 0; j < neln; ++j)
 		{
 			FENode& node = mesh.Node(el.m_node[j]);
-			std::vector<int>& ID = node.m_ID;
+			FENodeArray<int>& ID = node.m_ID;
 
 			for (int k = 0; k < dofPerNode_a; ++k)
 				lma[dofPerNode_a*j + k] = ID[dofList_a[k]];
@@ -233,6 +233,18 @@ public:
 	//! calculate the volume of an element
 	double Volume(FESolidElement& el);
 
+public:
+	//! Turn the cache of reference shape gradients on or off. 
+	//! When on, the cache is built during Init. 
+	void SetReferenceGradientCache(bool b);
+
+	//! returns true if the reference shape gradients are cached
+	bool ReferenceGradientCache() const { return m_bcache_grad0; }
+
+	//! Rebuild the cached reference shape gradients. This must be called
+	//! whenever the reference nodal coordinates have changed.
+	void UpdateReferenceGradientCache();
+
 public:
 	//! get the current nodal coordinates
 	void GetCurrentNodalCoordinates(const FESolidElement& el, vec3d* rt);
@@ -272,4 +284,15 @@ protected:
 
 	FEDofList	m_dofU;
 	FEDofList	m_dofSU;
+
+private:
+	// Cache of reference shape gradients and Jacobians.
+	// The data is stored per integration point, with the shape function gradients
+	// stored as separate x,y,z arrays, each in (element, integration point, node) order.
+	bool			m_bcache_grad0;		//!< cache is requested
+	bool			m_bgrad0_valid;		//!< cache has been evaluated
+	vector<int>		m_grad0_ip;			//!< offset of the first integration point of each element
+	vector<int>		m_grad0_off;		//!< offset of the first gradient of each element
+	vector<double>	m_detJ0;			//!< reference Jacobian at integration points
+	vector<double>	m_G0x, m_G0y, m_G0z;	//!< reference shape function gradients
 };
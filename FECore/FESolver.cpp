@@ -45,6 +45,7 @@ BEGIN_FECORE_CLASS(FESolver, FECoreBase)
 	ADD_PARAMETER(m_eq_scheme, "equation_scheme");
 	ADD_PARAMETER(m_eq_order , "equation_order" );
 	ADD_PARAMETER(m_bwopt    , "optimize_bw");
+	ADD_PARAMETER(m_bcolorAssembly, "colored_assembly");
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
@@ -61,6 +62,7 @@ FESolver::FESolver(FEModel* fem) : FECoreBase(fem)
 	m_neq = 0;
 
 	m_bwopt = 0;
+	m_bcolorAssembly = false;
 
 	m_eq_scheme = EQUATION_SCHEME::STAGGERED;
 	m_eq_order = EQUATION_ORDER::NORMAL_ORDER;
@@ -168,6 +168,7 @@ public:
 
 public: //TODO Move these parameters elsewhere
 	int					m_bwopt;	    //!< bandwidth optimization flag
+	bool				m_bcolorAssembly;	//!< assemble domain residuals color-by-color (see FEMeshPartition::ElementColoring)
 	int					m_msymm;		//!< matrix symmetry flag for linear solver allocation
 	int					m_eq_scheme;	//!< equation number scheme (used in InitEquations)
 	int					m_eq_order;		//!< normal or reverse ordering
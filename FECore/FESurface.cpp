@@ -52,6 +52,9 @@ FESurface::~FESurface()
 //-----------------------------------------------------------------------------
 void FESurface::Create(int nsize, int elemType)
 {
+	// the elements change, so any existing coloring is no longer valid
+	ResetElementColoring();
+
 	m_el.resize(nsize);
 	for (int i = 0; i < nsize; ++i)
 	{
@@ -676,7 +679,7 @@ vec3d FESurface::Position(FESurfaceElement& el, double r, double s)
 
 	// get the elements nodal positions
 	vec3d y[FEElement::MAX_NODES];
-    if (!m_bshellb) for (int i = 0; i<ne; ++i) y[i] = mesh.Node(el.m_node[i]).m_rt;
+    if (!m_bshellb) for (int i = 0; i<ne; ++i) y[i] = mesh.Node(el.m_node[i]).m_rt();
     else for (int i = 0; i<ne; ++i) y[i] = mesh.Node(el.m_node[i]).m_st();
 
 	double H[FEElement::MAX_NODES];
@@ -695,7 +698,7 @@ vec3d FESurface::Position(FESurfaceElement& el, double r, double s)
 void FESurface::NodalCoordinates(FESurfaceElement& el, vec3d* re)
 {
 	int ne = el.Nodes();
-	if (!m_bshellb) for (int i = 0; i < ne; ++i) re[i] = Node(el.m_lnode[i]).m_rt;
+	if (!m_bshellb) for (int i = 0; i < ne; ++i) re[i] = Node(el.m_lnode[i]).m_rt();
     else for (int i = 0; i < ne; ++i) re[i] = Node(el.m_lnode[i]).m_st();
 }
 
@@ -716,7 +719,7 @@ vec3d FESurface::ProjectToSurface(FESurfaceElement& el, vec3d x, double& r, doub
 
 	// get the elements nodal positions
 	vec3d y[FEElement::MAX_NODES];
-    if (!m_bshellb) for (int i=0; i<ne; ++i) y[i] = mesh.Node(el.m_node[i]).m_rt;
+    if (!m_bshellb) for (int i=0; i<ne; ++i) y[i] = mesh.Node(el.m_node[i]).m_rt();
     else for (int i=0; i<ne; ++i) y[i] = mesh.Node(el.m_node[i]).m_st();
 
 	// calculate normal projection of x onto element
@@ -785,7 +788,7 @@ double FESurface::FaceArea(FESurfaceElement& el)
 
 	// get the initial nodes
 	vec3d r0[FEElement::MAX_NODES];
-	if (!m_bshellb) for (int i=0; i<neln; ++i) r0[i] = mesh.Node(el.m_node[i]).m_r0;
+	if (!m_bshellb) for (int i=0; i<neln; ++i) r0[i] = mesh.Node(el.m_node[i]).m_r0();
     else for (int i=0; i<neln; ++i) r0[i] = mesh.Node(el.m_node[i]).m_s0();
 
 	// get the integration weights
@@ -840,8 +843,8 @@ double FESurface::MaxElementSize()
 		for (int i=0; i<n; ++i)
 			for (int j=i+1; j<n; ++j)
 			{
-                vec3d& a = mesh.Node(e.m_node[i]).m_rt;
-                vec3d& b = mesh.Node(e.m_node[j]).m_rt;
+                vec3d& a = mesh.Node(e.m_node[i]).m_rt();
+                vec3d& b = mesh.Node(e.m_node[j]).m_rt();
 				double L2 = (b - a)*(b - a);
 				if (L2 > h2) h2 = L2;
 			}
@@ -860,7 +863,7 @@ mat2d FESurface::Metric0(FESurfaceElement& el, double r, double s)
 	
 	// element nodes
 	vec3d r0[FEElement::MAX_NODES];
-	if (!m_bshellb) for (int i=0; i<neln; ++i) r0[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+	if (!m_bshellb) for (int i=0; i<neln; ++i) r0[i] = m_pMesh->Node(el.m_node[i]).m_r0();
     else for (int i=0; i<neln; ++i) r0[i] = m_pMesh->Node(el.m_node[i]).m_s0();
 	
 	// shape function derivatives
@@ -893,7 +896,7 @@ mat2d FESurface::Metric(FESurfaceElement& el, double r, double s)
 	
 	// element nodes
 	vec3d rt[FEElement::MAX_NODES];
-    if (!m_bshellb) for (int i=0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+    if (!m_bshellb) for (int i=0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_rt();
     else for (int i=0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_st();
 	
 	// shape function derivatives
@@ -926,7 +929,7 @@ mat2d FESurface::Metric(const FESurfaceElement& el, int n) const
     
     // element nodes
     vec3d rt[FEElement::MAX_NODES];
-    if (!m_bshellb) for (int i=0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_rt;
+    if (!m_bshellb) for (int i=0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_rt();
     else for (int i=0; i<neln; ++i) rt[i] = m_pMesh->Node(el.m_node[i]).m_st();
     
     // get the shape function derivatives at this integration point
@@ -957,7 +960,7 @@ mat2d FESurface::MetricP(FESurfaceElement& el, int n)
     
     // element nodes
     vec3d rp[FEElement::MAX_NODES];
-    for (int i=0; i<neln; ++i) rp[i] = m_pMesh->Node(el.m_node[i]).m_rp;
+    for (int i=0; i<neln; ++i) rp[i] = m_pMesh->Node(el.m_node[i]).m_rp();
     
     // get the shape function derivatives at this integration point
     double* Hr = el.Gr(n);
@@ -987,7 +990,7 @@ vec3d FESurface::Local2Global(FESurfaceElement &el, double r, double s)
 	// get the coordinates of the element nodes
 	int ne = el.Nodes();
 	vec3d y[FEElement::MAX_NODES];
-    if (!m_bshellb) for (int l=0; l<ne; ++l) y[l] = mesh.Node(el.m_node[l]).m_rt;
+    if (!m_bshellb) for (int l=0; l<ne; ++l) y[l] = mesh.Node(el.m_node[l]).m_rt();
     else for (int l=0; l<ne; ++l) y[l] = mesh.Node(el.m_node[l]).m_st();
 
 	// calculate the element position
@@ -1008,7 +1011,7 @@ vec3d FESurface::Local2Global(FESurfaceElement &el, int n)
 	// calculate the location
 	vec3d r(0);
 	int ne = el.Nodes();
-    if (!m_bshellb) for (int i=0; i<ne; ++i) r += m.Node(el.m_node[i]).m_rt*H[i];
+    if (!m_bshellb) for (int i=0; i<ne; ++i) r += m.Node(el.m_node[i]).m_rt()*H[i];
     else for (int i=0; i<ne; ++i) r += m.Node(el.m_node[i]).m_st()*H[i];
 
 	return r;
@@ -1025,7 +1028,7 @@ vec3d FESurface::Local2GlobalP(FESurfaceElement &el, double r, double s)
     // get the coordinates of the element nodes
     int ne = el.Nodes();
     vec3d y[FEElement::MAX_NODES];
-    for (int l=0; l<ne; ++l) y[l] = mesh.Node(el.m_node[l]).m_rp;
+    for (int l=0; l<ne; ++l) y[l] = mesh.Node(el.m_node[l]).m_rp();
     
     // calculate the element position
     return el.eval(y, r, s);
@@ -1045,7 +1048,7 @@ vec3d FESurface::Local2GlobalP(FESurfaceElement &el, int n)
     // calculate the location
     vec3d r;
     int ne = el.Nodes();
-    for (int i=0; i<ne; ++i) r += m.Node(el.m_node[i]).m_rp*H[i];
+    for (int i=0; i<ne; ++i) r += m.Node(el.m_node[i]).m_rp()*H[i];
     
     return r;
 }
@@ -1065,7 +1068,7 @@ vec3d FESurface::SurfaceNormal(const FESurfaceElement &el, int n) const
 	// get the coordinates of the element nodes
 	int ne = el.Nodes();
 	vec3d y[FEElement::MAX_NODES];
-    if (!m_bshellb) for (int i=0; i<ne; ++i) y[i] = m.Node(el.m_node[i]).m_rt;
+    if (!m_bshellb) for (int i=0; i<ne; ++i) y[i] = m.Node(el.m_node[i]).m_rt();
     else for (int i=0; i<ne; ++i) y[i] = m.Node(el.m_node[i]).m_st();
 
 	// calculate the tangents
@@ -1096,7 +1099,7 @@ vec3d FESurface::SurfaceNormal(FESurfaceElement &el, double r, double s) const
 	// get the coordinates of the element nodes
 	int ne = el.Nodes();
 	vec3d y[FEElement::MAX_NODES];
-    if (!m_bshellb) for (l=0; l<ne; ++l) y[l] = mesh.Node(el.m_node[l]).m_rt;
+    if (!m_bshellb) for (l=0; l<ne; ++l) y[l] = mesh.Node(el.m_node[l]).m_rt();
     else for (l=0; l<ne; ++l) y[l] = mesh.Node(el.m_node[l]).m_st();
 	
 	// set up shape functions and derivatives
@@ -1171,8 +1174,8 @@ void FESurface::CoBaseVectors(FESurfaceElement& el, double r, double s, vec3d t[
     if (!m_bshellb) {
         for (int i=0; i<n; ++i)
         {
-            t[0] += m.Node(el.m_node[i]).m_rt*Hr[i];
-            t[1] += m.Node(el.m_node[i]).m_rt*Hs[i];
+            t[0] += m.Node(el.m_node[i]).m_rt()*Hr[i];
+            t[1] += m.Node(el.m_node[i]).m_rt()*Hs[i];
         }
     }
     else {
@@ -1204,8 +1207,8 @@ void FESurface::CoBaseVectors(const FESurfaceElement& el, int j, vec3d t[2]) con
     if (!m_bshellb) {
         for (int i=0; i<n; ++i)
         {
-            t[0] += m.Node(el.m_node[i]).m_rt*Hr[i];
-            t[1] += m.Node(el.m_node[i]).m_rt*Hs[i];
+            t[0] += m.Node(el.m_node[i]).m_rt()*Hr[i];
+            t[1] += m.Node(el.m_node[i]).m_rt()*Hs[i];
         }
     }
     else {
@@ -1235,8 +1238,8 @@ void FESurface::CoBaseVectorsP(FESurfaceElement& el, int j, vec3d t[2])
     t[0] = t[1] = vec3d(0,0,0);
     for (int i=0; i<n; ++i)
     {
-        t[0] += m.Node(el.m_node[i]).m_rp*Hr[i];
-        t[1] += m.Node(el.m_node[i]).m_rp*Hs[i];
+        t[0] += m.Node(el.m_node[i]).m_rp()*Hr[i];
+        t[1] += m.Node(el.m_node[i]).m_rp()*Hs[i];
     }
 }
 
@@ -1251,7 +1254,7 @@ void FESurface::CoBaseVectors0(FESurfaceElement &el, double r, double s, vec3d t
 	vec3d y[MN];
 	double H0[MN], H1[MN];
 	int n = el.Nodes();
-	if (!m_bshellb) for (i=0; i<n; ++i) y[i] = m_pMesh->Node(el.m_node[i]).m_r0;
+	if (!m_bshellb) for (i=0; i<n; ++i) y[i] = m_pMesh->Node(el.m_node[i]).m_r0();
     else for (i=0; i<n; ++i) y[i] = m_pMesh->Node(el.m_node[i]).m_s0();
 	el.shape_deriv(H0, H1, r, s);
 	t[0] = t[1] = vec3d(0,0,0);
@@ -1316,7 +1319,7 @@ double FESurface::jac0(FESurfaceElement &el, int n)
 {
 	const int nseln = el.Nodes();
 	vec3d r0[FEElement::MAX_NODES];
-	if (!m_bshellb) for (int i=0; i<nseln; ++i) r0[i] = GetMesh()->Node(el.m_node[i]).m_r0;
+	if (!m_bshellb) for (int i=0; i<nseln; ++i) r0[i] = GetMesh()->Node(el.m_node[i]).m_r0();
     else for (int i=0; i<nseln; ++i) r0[i] = GetMesh()->Node(el.m_node[i]).m_s0();
 
 	double* Gr = el.Gr(n);
@@ -1340,7 +1343,7 @@ double FESurface::jac0(const FESurfaceElement &el, int n, vec3d& nu)
 {
 	const int nseln = el.Nodes();
 	vec3d r0[FEElement::MAX_NODES];
-	if (!m_bshellb) for (int i=0; i<nseln; ++i) r0[i] = GetMesh()->Node(el.m_node[i]).m_r0;
+	if (!m_bshellb) for (int i=0; i<nseln; ++i) r0[i] = GetMesh()->Node(el.m_node[i]).m_r0();
     else for (int i=0; i<nseln; ++i) r0[i] = GetMesh()->Node(el.m_node[i]).m_s0();
 
 	double* Gr = el.Gr(n);
@@ -2026,7 +2029,7 @@ bool FESurface::Intersect(FESurfaceElement& el, vec3d r, vec3d n, double rs[2],
 	// get the element nodes
 	FEMesh& mesh = *m_pMesh;
 	vec3d y[FEElement::MAX_NODES];
-    if (!m_bshellb) for (int i=0; i<N; ++i) y[i] = mesh.Node(el.m_node[i]).m_rt;
+    if (!m_bshellb) for (int i=0; i<N; ++i) y[i] = mesh.Node(el.m_node[i]).m_rt();
     else for (int i=0; i<N; ++i) y[i] = mesh.Node(el.m_node[i]).m_st();
 
 	// call the correct intersection function
@@ -2109,7 +2112,7 @@ void FESurface::GetNodalCoordinates(FESurfaceElement& el, vec3d* rt)
 {
 	FEMesh& mesh = *GetMesh();
 	int neln = el.Nodes();
-    if (!m_bshellb) for (int j = 0; j < neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt;
+    if (!m_bshellb) for (int j = 0; j < neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_rt();
     else for (int j = 0; j < neln; ++j) rt[j] = mesh.Node(el.m_node[j]).m_st();
 }
 
@@ -2118,7 +2121,7 @@ void FESurface::GetReferenceNodalCoordinates(FESurfaceElement& el, vec3d* r0)
 {
 	FEMesh& mesh = *GetMesh();
 	int neln = el.Nodes();
-    if (!m_bshellb) for (int j = 0; j < neln; ++j) r0[j] = mesh.Node(el.m_node[j]).m_r0;
+    if (!m_bshellb) for (int j = 0; j < neln; ++j) r0[j] = mesh.Node(el.m_node[j]).m_r0();
     else for (int j = 0; j < neln; ++j) r0[j] = mesh.Node(el.m_node[j]).m_s0();
 }
 
@@ -2129,8 +2132,8 @@ void FESurface::GetNodalCoordinates(FESurfaceElement& el, double alpha, vec3d* r
 	int neln = el.Nodes();
 	for (int j = 0; j<neln; ++j) {
 		FENode& node = Node(el.m_lnode[j]);
-		rt[j] = node.m_rt*alpha + node.m_rp*(1.0 - alpha);
-        if (m_bshellb) rt[j] -= node.m_dt*alpha + node.m_dp*(1.0 - alpha);
+		rt[j] = node.m_rt()*alpha + node.m_rp()*(1.0 - alpha);
+        if (m_bshellb) rt[j] -= node.m_dt()*alpha + node.m_dp()*(1.0 - alpha);
 	}
 }
 
@@ -2162,174 +2165,210 @@ double FESurface::Evaluate(int nface, int dof)
 }
 
 //-----------------------------------------------------------------------------
+// Integrates a vector-valued surface load. The elements are evaluated in parallel, each
+// thread using its own element buffers. If R requests a colored assembly, the elements
+// are processed color-by-color (see FEMeshPartition::ElementColoring), so that R
+// can be assembled without atomics.
 void FESurface::LoadVector(FEGlobalVector& R, const FEDofList& dofList, bool breference, FESurfaceVectorIntegrand f)
 {
 	int dofPerNode = dofList.Size();
 	int order = (dofPerNode == 1 ? dofList.InterpolationOrder(0) : -1);
-	vector<double> fe;
-	vector<int> lm;
-	vec3d re[FEElement::MAX_NODES];
-	std::vector<double> G(dofPerNode, 0.0);
-	FESurfaceDofShape dof_a;
-	int NE = Elements();
-	for (int i = 0; i < NE; ++i)
-	{
-		// get the next element
-		FESurfaceElement& el = Element(i);
 
-		// init the element vector
-		int neln = el.ShapeFunctions(order);
-		int ndof = dofPerNode * neln;
-		fe.assign(ndof, 0.0);
+	// the coloring must be calculated outside the parallel region
+	const vector< vector<int> >* colors = (R.ColoredAssembly() ? &ElementColoring() : nullptr);
+	if (colors) R.SetExclusiveAccess(true);
 
-		// get the nodal coordinates
-		FEMesh& mesh = *GetMesh();
-		if (breference)
-			GetReferenceNodalCoordinates(el, re);
-		else
-			GetNodalCoordinates(el, re);
+	int NE = Elements();
+	#pragma omp parallel shared(NE, colors)
+	{
+		// per-thread element buffers
+		vector<double> fe;
+		vector<int> lm;
+		vec3d re[FEElement::MAX_NODES];
+		std::vector<double> G(dofPerNode, 0.0);
+		FESurfaceDofShape dof_a;
 
-		// calculate element vector
-		double* w = el.GaussWeights();
-		int nint = el.GaussPoints();
-		for (int n = 0; n < nint; ++n)
-		{
-			FESurfaceMaterialPoint& pt = static_cast<FESurfaceMaterialPoint&>(*el.GetMaterialPoint(n));
+		auto elementVector = [&](int i) {
 
-			// kinematics at integration points
-			pt.dxr = el.eval_deriv1(re, n);
-			pt.dxs = el.eval_deriv2(re, n);
+			// get the next element
+			FESurfaceElement& el = Element(i);
 
-			pt.m_shape = el.H(n);
+			// init the element vector
+			int neln = el.ShapeFunctions(order);
+			int ndof = dofPerNode * neln;
+			fe.assign(ndof, 0.0);
+
+			// get the nodal coordinates
+			if (breference)
+				GetReferenceNodalCoordinates(el, re);
+			else
+				GetNodalCoordinates(el, re);
+
+			// calculate element vector
+			double* w = el.GaussWeights();
+			int nint = el.GaussPoints();
+			for (int n = 0; n < nint; ++n)
+			{
+				FESurfaceMaterialPoint& pt = static_cast<FESurfaceMaterialPoint&>(*el.GetMaterialPoint(n));
 
-			double* H = el.H(order, n);
-			double* Hr = el.Gr(order, n);
-			double* Hs = el.Gr(order, n);
+				// kinematics at integration points
+				pt.dxr = el.eval_deriv1(re, n);
+				pt.dxs = el.eval_deriv2(re, n);
 
-			// put it all together
-			for (int j = 0; j<neln; ++j)
-			{
-				// shape function and derivatives
-				dof_a.index = j;
-				dof_a.shape = H[j];
-				dof_a.shape_deriv_r = Hr[j];
-				dof_a.shape_deriv_s = Hs[j];
+				pt.m_shape = el.H(n);
 
-				// evaluate the integrand
-				f(pt, dof_a, G);
+				double* H = el.H(order, n);
+				double* Hr = el.Gr(order, n);
+				double* Hs = el.Gr(order, n);
 
-				for (int k = 0; k < dofPerNode; ++k)
+				// put it all together
+				for (int j = 0; j<neln; ++j)
 				{
-					fe[dofPerNode * j + k] += G[k] * w[n];
+					// shape function and derivatives
+					dof_a.index = j;
+					dof_a.shape = H[j];
+					dof_a.shape_deriv_r = Hr[j];
+					dof_a.shape_deriv_s = Hs[j];
+
+					// evaluate the integrand
+					f(pt, dof_a, G);
+
+					for (int k = 0; k < dofPerNode; ++k)
+					{
+						fe[dofPerNode * j + k] += G[k] * w[n];
+					}
 				}
 			}
-		}
 
-		// get the corresponding LM vector
-		UnpackLM(el, dofList, lm);
+			// get the corresponding LM vector
+			UnpackLM(el, dofList, lm);
 
-		// Assemble into global vector
-		R.Assemble(el.m_node, lm, fe);
+			// Assemble into global vector
+			R.Assemble(el.m_node, lm, fe);
+		};
+
+		if (colors)
+		{
+			// the implied barrier at the end of each loop separates the colors
+			for (size_t c = 0; c < colors->size(); ++c)
+			{
+				const vector<int>& elemList = (*colors)[c];
+				int nc = (int)elemList.size();
+				#pragma omp for
+				for (int i = 0; i < nc; ++i) elementVector(elemList[i]);
+			}
+		}
+		else
+		{
+			#pragma omp for
+			for (int i = 0; i < NE; ++i) elementVector(i);
+		}
 	}
+
+	if (colors) R.SetExclusiveAccess(false);
 }
 
 //-----------------------------------------------------------------------------
+// Integrates the stiffness of a surface load. The element matrices are evaluated in parallel,
+// each thread using its own element buffers. The linear system's Assemble is thread-safe.
 void FESurface::LoadStiffness(FELinearSystem& LS, const FEDofList& dofList_a, const FEDofList& dofList_b, FESurfaceMatrixIntegrand f)
 {
-	FEElementMatrix ke;
-
 	int dofPerNode_a = dofList_a.Size();
 	int dofPerNode_b = dofList_b.Size();
 
 	int order_a = (dofPerNode_a == 1 ? dofList_a.InterpolationOrder(0) : -1);
 	int order_b = (dofPerNode_b == 1 ? dofList_b.InterpolationOrder(0) : -1);
 
-	FEMesh& mesh = *GetMesh();
-	vec3d rt[FEElement::MAX_NODES];
-
-	matrix kab(dofPerNode_a, dofPerNode_b);
-	FESurfaceDofShape dof_a, dof_b;
-
 	int NE = Elements();
-	for (int m = 0; m<NE; ++m)
+	#pragma omp parallel shared(NE)
 	{
-		// get the surface element
-		FESurfaceElement& el = Element(m);
+		// per-thread element buffers
+		FEElementMatrix ke;
+		vec3d rt[FEElement::MAX_NODES];
+		matrix kab(dofPerNode_a, dofPerNode_b);
+		FESurfaceDofShape dof_a, dof_b;
 
-		ke.SetNodes(el.m_node);
+		#pragma omp for
+		for (int m = 0; m<NE; ++m)
+		{
+			// get the surface element
+			FESurfaceElement& el = Element(m);
 
-		// shape functions
-		int neln = el.Nodes();
-		int nn_a = el.ShapeFunctions(dofPerNode_a);
-		int nn_b = el.ShapeFunctions(dofPerNode_b);
+			ke.SetNodes(el.m_node);
 
-		// get the element stiffness matrix
-		int ndof_a = dofPerNode_a * nn_a;
-		int ndof_b = dofPerNode_b * nn_b;
-		ke.resize(ndof_a, ndof_b);
+			// shape functions
+			int neln = el.Nodes();
+			int nn_a = el.ShapeFunctions(dofPerNode_a);
+			int nn_b = el.ShapeFunctions(dofPerNode_b);
 
-		// calculate element stiffness
-		int nint = el.GaussPoints();
+			// get the element stiffness matrix
+			int ndof_a = dofPerNode_a * nn_a;
+			int ndof_b = dofPerNode_b * nn_b;
+			ke.resize(ndof_a, ndof_b);
 
-		// gauss weights
-		double* w = el.GaussWeights();
+			// calculate element stiffness
+			int nint = el.GaussPoints();
 
-		// nodal coordinates
-		GetNodalCoordinates(el, rt);
+			// gauss weights
+			double* w = el.GaussWeights();
 
-		// repeat over integration points
-		ke.zero();
-		for (int n = 0; n<nint; ++n)
-		{
-			FESurfaceMaterialPoint& pt = static_cast<FESurfaceMaterialPoint&>(*el.GetMaterialPoint(n));
+			// nodal coordinates
+			GetNodalCoordinates(el, rt);
 
-			double* N = el.H(n);
-			double* Gr = el.Gr(n);
-			double* Gs = el.Gs(n);
-
-			// tangents at integration point
-			pt.dxr = vec3d(0, 0, 0);
-			pt.dxs = vec3d(0, 0, 0);
-			for (int i = 0; i<neln; ++i)
+			// repeat over integration points
+			ke.zero();
+			for (int n = 0; n<nint; ++n)
 			{
-				pt.dxr += rt[i] * Gr[i];
-				pt.dxs += rt[i] * Gs[i];
-			}
+				FESurfaceMaterialPoint& pt = static_cast<FESurfaceMaterialPoint&>(*el.GetMaterialPoint(n));
 
-			// calculate stiffness component
-			for (int i = 0; i < nn_a; ++i)
-			{
-				// shape function values
-				dof_a.index = i;
-				dof_a.shape = el.H(order_a, n)[i];
-				dof_a.shape_deriv_r = el.Gr(order_a, n)[i];
-				dof_a.shape_deriv_s = el.Gs(order_a, n)[i];
+				double* N = el.H(n);
+				double* Gr = el.Gr(n);
+				double* Gs = el.Gs(n);
 
-				for (int j = 0; j < nn_b; ++j)
+				// tangents at integration point
+				pt.dxr = vec3d(0, 0, 0);
+				pt.dxs = vec3d(0, 0, 0);
+				for (int i = 0; i<neln; ++i)
 				{
-					// shape function values
-					dof_b.index = j;
-					dof_b.shape = el.H(order_b, n)[j];
-					dof_b.shape_deriv_r = el.Gr(order_b, n)[j];
-					dof_b.shape_deriv_s = el.Gs(order_b, n)[j];
-
-					// evaluate integrand
-					kab.zero();
-					f(pt, dof_a, dof_b, kab);
+					pt.dxr += rt[i] * Gr[i];
+					pt.dxs += rt[i] * Gs[i];
+				}
 
-					// add it to the local element matrix
-					ke.adds(dofPerNode_a * i, dofPerNode_b * j, kab, w[n]);
+				// calculate stiffness component
+				for (int i = 0; i < nn_a; ++i)
+				{
+					// shape function values
+					dof_a.index = i;
+					dof_a.shape = el.H(order_a, n)[i];
+					dof_a.shape_deriv_r = el.Gr(order_a, n)[i];
+					dof_a.shape_deriv_s = el.Gs(order_a, n)[i];
+
+					for (int j = 0; j < nn_b; ++j)
+					{
+						// shape function values
+						dof_b.index = j;
+						dof_b.shape = el.H(order_b, n)[j];
+						dof_b.shape_deriv_r = el.Gr(order_b, n)[j];
+						dof_b.shape_deriv_s = el.Gs(order_b, n)[j];
+
+						// evaluate integrand
+						kab.zero();
+						f(pt, dof_a, dof_b, kab);
+
+						// add it to the local element matrix
+						ke.adds(dofPerNode_a * i, dofPerNode_b * j, kab, w[n]);
+					}
 				}
 			}
-		}
 
-		// get the element's LM vector
-		std::vector<int>& lma = ke.RowIndices();
-		std::vector<int>& lmb = ke.ColumnsIndices();
-		UnpackLM(el, dofList_a, lma);
-		UnpackLM(el, dofList_b, lmb);
+			// get the element's LM vector
+			std::vector<int>& lma = ke.RowIndices();
+			std::vector<int>& lmb = ke.ColumnsIndices();
+			UnpackLM(el, dofList_a, lma);
+			UnpackLM(el, dofList_b, lmb);
 
-		// assemble element matrix in global stiffness matrix
-		LS.Assemble(ke);
+			// assemble element matrix in global stiffness matrix
+			LS.Assemble(ke);
+		}
 	}
 }
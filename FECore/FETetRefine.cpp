@@ -74,13 +74,13 @@ bool FETetRefine::DoTetRefinement(FEModel& fem)
 		const FEEdgeList::EDGE& edge = topo.Edge(i);
 		FENode& node = mesh.Node(n++);
 
-		vec3d r0 = mesh.Node(edge.node[0]).m_r0;
-		vec3d r1 = mesh.Node(edge.node[1]).m_r0;
-		node.m_r0 = (r0 + r1)*0.5;
+		vec3d r0 = mesh.Node(edge.node[0]).m_r0();
+		vec3d r1 = mesh.Node(edge.node[1]).m_r0();
+		node.m_r0() = (r0 + r1)*0.5;
 
-		r0 = mesh.Node(edge.node[0]).m_rt;
-		r1 = mesh.Node(edge.node[1]).m_rt;
-		node.m_rt = (r0 + r1)*0.5;
+		r0 = mesh.Node(edge.node[0]).m_rt();
+		r1 = mesh.Node(edge.node[1]).m_rt();
+		node.m_rt() = (r0 + r1)*0.5;
 	}
 	assert(n == N1);
 
@@ -135,7 +135,7 @@ TetMesh* mesh_to_tetmesh(FEMeshTopo& topo)
 		if (nodetags[i] >= 0)
 		{
 			TetMesh::VERTEX& v = tet->m_Vert[tetnodes++];
-			v.r = mesh.Node(i).m_r0;
+			v.r = mesh.Node(i).m_r0();
 			v.id = i;
 		}
 	}
@@ -493,20 +493,29 @@ bool FETetgenRefine::ReconstructMesh(FEModel& fem)
 	FEOctreeSearch osearch(&mesh);
 	if (osearch.Init() == false) return false;
 
+	// locate all the old points
+	vector<vec3d> x(N0);
+	for (int i = 0; i < N0; ++i)
+	{
+		x[i].x = oldMesh.pointlist[3 * i  ];
+		x[i].y = oldMesh.pointlist[3 * i+1];
+		x[i].z = oldMesh.pointlist[3 * i+2];
+	}
+	vector<FEElement*> elem;
+	vector<vec3d> iso;
+	int nfail = osearch.FindElements(x, elem, iso); assert(nfail == 0);
+	if (nfail > 0) return false;
+
 	double v[FEElement::MAX_NODES] = { 0 };
 	vec3d rt[FEElement::MAX_NODES];
 	double r[3];
 	for (int i = 0; i < N0; ++i)
 	{
-		vec3d xi;
-		xi.x = oldMesh.pointlist[3 * i  ];
-		xi.y = oldMesh.pointlist[3 * i+1];
-		xi.z = oldMesh.pointlist[3 * i+2];
-		FESolidElement* pe = (FESolidElement*)osearch.FindElement(xi, r); assert(pe);
-		if (pe == nullptr) return false;
+		FESolidElement* pe = (FESolidElement*)elem[i];
+		r[0] = iso[i].x; r[1] = iso[i].y; r[2] = iso[i].z;
 
 		// get the nodal coordinates
-		for (int j = 0; j < pe->Nodes(); ++j) rt[j] = mesh.Node(pe->m_node[j]).m_rt;
+		for (int j = 0; j < pe->Nodes(); ++j) rt[j] = mesh.Node(pe->m_node[j]).m_rt();
 		pos[i] = pe->evaluate(rt, r[0], r[1], r[2]);
 
 		// update values
@@ -527,8 +536,8 @@ bool FETetgenRefine::ReconstructMesh(FEModel& fem)
 		xi.y = oldMesh.pointlist[3 * i + 1];
 		xi.z = oldMesh.pointlist[3 * i + 2];
 		FENode& node = mesh.Node(i);
-		node.m_r0 = xi;
-		node.m_rt = pos[i];
+		node.m_r0() = xi;
+		node.m_rt() = pos[i];
 
 		for (int j = 0; j < MAX_DOFS; ++j)
 		{
@@ -564,7 +573,7 @@ bool build_tetgen_remesh(FEMeshTopo& topo, tetgenio& in, vector<pair<int, double
 	in.pointlist = new REAL[3 * nodes];
 	for (int i = 0; i<nodes; ++i)
 	{
-		vec3d& r = mesh.Node(i).m_r0;
+		vec3d& r = mesh.Node(i).m_r0();
 		in.pointlist[3*i    ] = r.x;
 		in.pointlist[3*i + 1] = r.y;
 		in.pointlist[3*i + 2] = r.z;
@@ -847,7 +856,7 @@ bool build_new_mesh(FEModel& fem, tetgenio& out, bool resetMesh)
 		r.z = out.pointlist[3 * i + 2];
 
 		FENode& node = mesh.Node(i);
-		node.m_r0 = r;
+		node.m_r0() = r;
 	}
 
 	// assign dofs to new nodes
@@ -856,7 +865,7 @@ bool build_new_mesh(FEModel& fem, tetgenio& out, bool resetMesh)
 	{
 		FENode& node = mesh.Node(i);
 		node.SetDOFS(MAX_DOFS);
-		node.m_rt = node.m_r0;
+		node.m_rt() = node.m_r0();
 		for (int j = 0; j < node.m_ID.size(); ++j) {
 			node.set(j, 0.0);
 		}
@@ -867,7 +876,7 @@ bool build_new_mesh(FEModel& fem, tetgenio& out, bool resetMesh)
 		for (int i = 0; i < mesh.Nodes(); ++i)
 		{
 			FENode& node = mesh.Node(i);
-			node.m_rt = node.m_r0;
+			node.m_rt() = node.m_r0();
 			for (int j = 0; j < node.m_ID.size(); ++j) {
 				node.set(j, 0.0);
 			}
@@ -885,7 +894,7 @@ bool build_new_mesh(FEModel& fem, tetgenio& out, bool resetMesh)
 
 			// find the element in which this node is
 /*			double r[3] = { 0 };
-			FESolidElement* el = FindElement(mesh, nodei.m_r0, r);
+			FESolidElement* el = FindElement(mesh, nodei.m_r0(), r);
 			if (el == nullptr)
 			{
 				assert(false);
@@ -893,7 +902,7 @@ bool build_new_mesh(FEModel& fem, tetgenio& out, bool resetMesh)
 			}
 */
 			double r[3] = { 0 };
-			FESolidElement* el = (FESolidElement*) octree.FindElement(nodei.m_r0, r);
+			FESolidElement* el = (FESolidElement*) octree.FindElement(nodei.m_r0(), r);
 			if (el == nullptr)
 			{
 				assert(false);
@@ -904,9 +913,9 @@ bool build_new_mesh(FEModel& fem, tetgenio& out, bool resetMesh)
 
 			// get the nodal coordinates
 			vec3d rt[FEElement::MAX_NODES];
-			for (int j = 0; j < el->Nodes(); ++j) rt[j] = mesh.Node(el->m_node[j]).m_rt;
+			for (int j = 0; j < el->Nodes(); ++j) rt[j] = mesh.Node(el->m_node[j]).m_rt();
 
-			nodei.m_rt = el->evaluate(rt, r[0], r[1], r[2]);
+			nodei.m_rt() = el->evaluate(rt, r[0], r[1], r[2]);
 
 			// update values
 			for (int l = 0; l < MAX_DOFS; ++l)
@@ -38,6 +38,9 @@ FETrussDomain::FETrussDomain(FEModel* fem) : FEDomain(FE_DOMAIN_TRUSS, fem)
 //-----------------------------------------------------------------------------
 bool FETrussDomain::Create(int nsize, FE_Element_Spec espec)
 {
+	// the elements change, so any existing coloring is no longer valid
+	ResetElementColoring();
+
 	m_Elem.resize(nsize);
 	for (int i = 0; i < nsize; ++i)
 	{
@@ -56,8 +59,8 @@ bool FETrussDomain::Create(int nsize, FE_Element_Spec espec)
 vec3d FETrussDomain::TrussNormal(FETrussElement& el)
 {
 	vec3d rt[2];
-	rt[0] = m_pMesh->Node(el.m_node[0]).m_rt;
-	rt[1] = m_pMesh->Node(el.m_node[1]).m_rt;
+	rt[0] = m_pMesh->Node(el.m_node[0]).m_rt();
+	rt[1] = m_pMesh->Node(el.m_node[1]).m_rt();
 
 	vec3d a = rt[0];
 	vec3d b = rt[1];
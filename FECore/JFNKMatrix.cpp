@@ -161,6 +161,7 @@ bool JFNKMatrix::mult_vector(double* x, double* r)
 
 	m_pns->Update2(m_v);
 	if (m_pns->Residual(m_R) == false) return false;
+	m_pns->GatherResidual(m_R);
 
 	for (int i = 0; i < m_freeDofs.size(); ++i)
 	{
@@ -128,6 +128,7 @@ bool JFNKStrategy::Residual(std::vector<double>& R, bool binit)
 	// first calculate the residual
 	bool b = m_pns->Residual(R);
 	if (b == false) return false;
+	m_pns->GatherResidual(R);
 
 	// store a copy
 	m_A->SetReferenceResidual(R);
@@ -50,6 +50,12 @@ bool LinearSolver::IsIterative() const
 	return false;
 }
 
+//-----------------------------------------------------------------------------
+const FEMPIPartition* LinearSolver::GetMPIPartition() const
+{
+	return nullptr;
+}
+
 //-----------------------------------------------------------------------------
 bool LinearSolver::PreProcess()
 { 
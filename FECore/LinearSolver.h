@@ -34,6 +34,7 @@ SOFTWARE.*/
 #include <vector>
 
 class FEModel;
+class FEMPIPartition;
 
 //-----------------------------------------------------------------------------
 struct FECORE_API LinearSolverStats
@@ -112,6 +113,10 @@ public:
 	// returns whether this is an iterative solver or not
 	virtual bool IsIterative() const;
 
+	//! Solvers that support MPI runs return the partition of the model over the ranks.
+	//! This returns null for solvers that only run on a single rank.
+	virtual const FEMPIPartition* GetMPIPartition() const;
+
 public:
 	const LinearSolverStats& GetStats() const;
 
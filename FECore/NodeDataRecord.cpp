@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FEAnalysis.h"
 #include "FECoreKernel.h"
 #include "FEModel.h"
+#include <algorithm>
 
 REGISTER_SUPER_CLASS(FENodeLogData, FENODELOGDATA_ID);
 
@@ -41,7 +42,7 @@ FENodeLogData::FENodeLogData(FEModel* fem) : FECoreBase(fem) {}
 FENodeLogData::~FENodeLogData() {}
 
 //-----------------------------------------------------------------------------
-NodeDataRecord::NodeDataRecord(FEModel* pfem, const char* szfile) : DataRecord(pfem, szfile, FE_DATA_NODE) {}
+NodeDataRecord::NodeDataRecord(FEModel* pfem, const char* szfile) : DataRecord(pfem, szfile, FE_DATA_NODE) { m_offset = 0; }
 
 //-----------------------------------------------------------------------------
 int NodeDataRecord::Size() const { return (int)m_Data.size(); }
@@ -78,33 +79,92 @@ void NodeDataRecord::Parse(const char* szexpr)
 }
 
 //-----------------------------------------------------------------------------
+// Note that when the mesh was reordered, the item is the node ID, which 
+// differs from the node's index in the mesh. Otherwise, it is the one-based index.
 double NodeDataRecord::Evaluate(int item, int ndata)
 {
 	FEMesh& mesh = m_pfem->GetMesh();
 	int nnode = item - 1;
+	if (mesh.IsReordered())
+	{
+		// make sure we have an NLT
+		if (m_NLT.empty()) BuildNLT();
+
+		int index = item - m_offset;
+		nnode = ((index >= 0) && (index < (int)m_NLT.size()) ? m_NLT[index] : -1);
+	}
 	assert((nnode>=0)&&(nnode<mesh.Nodes()));
 	if ((nnode < 0) || (nnode >= mesh.Nodes())) return 0;
 	return m_Data[ndata]->value(nnode);
 }
 
+//-----------------------------------------------------------------------------
+// The mesh can change between evaluations (e.g. after a remesh), so the lookup
+// table is rebuilt for every evaluation.
+void NodeDataRecord::PrepareEvaluation()
+{
+	if (m_pfem->GetMesh().IsReordered()) BuildNLT();
+}
+
+//-----------------------------------------------------------------------------
+void NodeDataRecord::BuildNLT()
+{
+	m_NLT.clear();
+	FEMesh& mesh = m_pfem->GetMesh();
+	int N = mesh.Nodes();
+	if (N == 0) return;
+
+	// find the min, max ID
+	int minID = mesh.Node(0).GetID(), maxID = minID;
+	for (int i=1; i<N; ++i)
+	{
+		int id = mesh.Node(i).GetID();
+		if (id < minID) minID = id;
+		if (id > maxID) maxID = id;
+	}
+
+	// build the lookup table
+	m_offset = minID;
+	m_NLT.assign(maxID - minID + 1, -1);
+	for (int i=0; i<N; ++i) m_NLT[mesh.Node(i).GetID() - minID] = i;
+}
+
 //-----------------------------------------------------------------------------
 void NodeDataRecord::SelectAllItems()
 {
-	int n = m_pfem->GetMesh().Nodes();
+	FEMesh& mesh = m_pfem->GetMesh();
+	int n = mesh.Nodes();
 	m_item.resize(n);
-	for (int i=0; i<n; ++i) m_item[i] = i+1;
+	if (mesh.IsReordered())
+	{
+		// output the nodes in user order
+		for (int i=0; i<n; ++i) m_item[i] = mesh.Node(i).GetID();
+		std::sort(m_item.begin(), m_item.end());
+	}
+	else
+	{
+		for (int i=0; i<n; ++i) m_item[i] = i+1;
+	}
 }
 
 //-----------------------------------------------------------------------------
 // This sets the item list based on a node set.
 // Note that node sets store the nodes in a zero-based list. However, we need
-// a one-base list here.
+// a one-base list here, or the node IDs when the mesh was reordered.
 void NodeDataRecord::SetItemList(FENodeSet* pns)
 {
+	FEMesh& mesh = m_pfem->GetMesh();
 	int n = pns->Size();
 	assert(n);
 	m_item.resize(n);
-	for (int i=0; i<n; ++i) m_item[i] = (*pns)[i] + 1;
+	if (mesh.IsReordered())
+	{
+		for (int i=0; i<n; ++i) m_item[i] = mesh.Node((*pns)[i]).GetID();
+	}
+	else
+	{
+		for (int i=0; i<n; ++i) m_item[i] = (*pns)[i] + 1;
+	}
 }
 
 //-----------------------------------------------------------------------------
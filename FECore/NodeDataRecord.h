@@ -58,8 +58,17 @@ public:
 	void SetItemList(FENodeSet* pns);
 	int Size() const;
 
+protected:
+	void PrepareEvaluation() override;
+	bool ParallelEvaluation() const override { return true; }
+
+private:
+	void BuildNLT();
+
 private:
 	vector<FENodeLogData*>	m_Data;
+	vector<int>		m_NLT;		//!< node ID to node index lookup table
+	int				m_offset;	//!< offset into the lookup table
 };
 
 //-----------------------------------------------------------------------------
@@ -195,6 +195,8 @@ struct FE_Element_Spec
 	double		m_ut4_alpha;
 	bool		m_ut4_bdev;
 
+	bool		m_bcache_grad0;		// cache reference shape gradients (solid domains only)
+
 	FE_Element_Spec()
 	{
 		eclass = FE_ELEM_INVALID_CLASS;
@@ -206,6 +208,7 @@ struct FE_Element_Spec
 		m_but4 = false;
 		m_ut4_alpha = 0.05;
 		m_ut4_bdev = false;
+		m_bcache_grad0 = false;
 	}
 
 	bool operator == (const FE_Element_Spec& s)
@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "mortar.h"
 #include <math.h>
 #include "FEMesh.h"
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 // subtract operator for POINT2D
@@ -451,8 +452,8 @@ bool CalculateMortarIntersection(FESurface& ss, FESurface& ms, int k, int l, Pat
 	const int M = FEElement::MAX_NODES;
 	vec3d rs[M], rm[M];
 	int ns = es.Nodes(), nm = em.Nodes();
-	for (int i=0; i<ns; ++i) rs[i] = ss.Node(es.m_lnode[i]).m_rt;
-	for (int i=0; i<nm; ++i) rm[i] = ms.Node(em.m_lnode[i]).m_rt;
+	for (int i=0; i<ns; ++i) rs[i] = ss.Node(es.m_lnode[i]).m_rt();
+	for (int i=0; i<nm; ++i) rm[i] = ms.Node(em.m_lnode[i]).m_rt();
 
 	// setup an orthonormal coordinate system
 	vec3d c = rs[0];
@@ -541,29 +542,180 @@ bool CalculateMortarIntersection(FESurface& ss, FESurface& ms, int k, int l, Pat
 	return (patch.Empty() == false);
 }
 
-void CalculateMortarSurface(FESurface& ss, FESurface& ms, MortarSurface& mortar)
+//-----------------------------------------------------------------------------
+// axis-aligned bounding box of a surface facet (in the current configuration)
+struct FACET_BOX
+{
+	vec3d	r0, r1;
+
+	bool Overlaps(const FACET_BOX& b) const
+	{
+		return ((r0.x <= b.r1.x) && (r1.x >= b.r0.x) &&
+				(r0.y <= b.r1.y) && (r1.y >= b.r0.y) &&
+				(r0.z <= b.r1.z) && (r1.z >= b.r0.z));
+	}
+};
+
+//-----------------------------------------------------------------------------
+// Calculates the bounding box of a surface facet. The box is inflated by the 
+// search radius, so that facets that are separated by a gap can still be found.
+static FACET_BOX FacetBox(FESurface& s, FESurfaceElement& el, double srad)
+{
+	FACET_BOX b;
+	b.r0 = b.r1 = s.Node(el.m_lnode[0]).m_rt();
+	for (int i = 1; i < el.Nodes(); ++i)
+	{
+		vec3d& r = s.Node(el.m_lnode[i]).m_rt();
+		if (r.x < b.r0.x) b.r0.x = r.x;
+		if (r.x > b.r1.x) b.r1.x = r.x;
+		if (r.y < b.r0.y) b.r0.y = r.y;
+		if (r.y > b.r1.y) b.r1.y = r.y;
+		if (r.z < b.r0.z) b.r0.z = r.z;
+		if (r.z > b.r1.z) b.r1.z = r.z;
+	}
+
+	b.r0 -= vec3d(srad, srad, srad);
+	b.r1 += vec3d(srad, srad, srad);
+
+	return b;
+}
+
+//-----------------------------------------------------------------------------
+// Calculates the mortar intersection between two surfaces.
+// A uniform bucket grid of the secondary facets' bounding boxes is used as a broad 
+// phase so that only facet pairs that are near each other are clipped. Facets that 
+// are separated by more than the search radius srad are not intersected.
+void CalculateMortarSurface(FESurface& ss, FESurface& ms, MortarSurface& mortar, double srad)
 {
-	// loop over all non-mortar facets
 	int NSF = ss.Elements();
 	int NMF = ms.Elements();
-	for (int i=0; i<NSF; ++i)
+	mortar.Clear();
+	if ((NSF == 0) || (NMF == 0)) return;
+
+	// calculate the bounding boxes of the secondary facets
+	vector<FACET_BOX> box(NMF);
+	FACET_BOX bb = box[0] = FacetBox(ms, ms.Element(0), srad);
+	double hmax = 0.0;
+	for (int j = 0; j < NMF; ++j)
+	{
+		FACET_BOX& b = box[j];
+		if (j > 0) b = FacetBox(ms, ms.Element(j), srad);
+		if (b.r0.x < bb.r0.x) bb.r0.x = b.r0.x;
+		if (b.r1.x > bb.r1.x) bb.r1.x = b.r1.x;
+		if (b.r0.y < bb.r0.y) bb.r0.y = b.r0.y;
+		if (b.r1.y > bb.r1.y) bb.r1.y = b.r1.y;
+		if (b.r0.z < bb.r0.z) bb.r0.z = b.r0.z;
+		if (b.r1.z > bb.r1.z) bb.r1.z = b.r1.z;
+
+		vec3d d = b.r1 - b.r0;
+		if (d.x > hmax) hmax = d.x;
+		if (d.y > hmax) hmax = d.y;
+		if (d.z > hmax) hmax = d.z;
+	}
+
+	// setup the bucket grid. The cell size is based on the largest facet box,
+	// but we limit the number of cells to a small multiple of the facet count.
+	vec3d D = bb.r1 - bb.r0;
+	double h = (hmax > 0.0 ? hmax : 1.0);
+	int nx, ny, nz;
+	do
+	{
+		nx = (int)(D.x / h) + 1;
+		ny = (int)(D.y / h) + 1;
+		nz = (int)(D.z / h) + 1;
+		h *= 2.0;
+	}
+	while ((double)nx*ny*nz > 8.0*NMF + 8.0);
+
+	// cell index range of a box
+	auto cellIndex = [](double x, double L, int n) {
+		double t = (L > 0.0 ? x*n / L : 0.0);
+		if (t < 0.0) return 0;
+		if (t > n - 1) return n - 1;
+		return (int)t;
+	};
+	auto cellRange = [&](const FACET_BOX& b, int i0[3], int i1[3]) {
+		vec3d a = b.r0 - bb.r0, c = b.r1 - bb.r0;
+		i0[0] = cellIndex(a.x, D.x, nx); i1[0] = cellIndex(c.x, D.x, nx);
+		i0[1] = cellIndex(a.y, D.y, ny); i1[1] = cellIndex(c.y, D.y, ny);
+		i0[2] = cellIndex(a.z, D.z, nz); i1[2] = cellIndex(c.z, D.z, nz);
+	};
+
+	// fill the buckets (in compressed row format)
+	int NC = nx*ny*nz;
+	vector<int> cellStart(NC + 1, 0), cellItem;
+	for (int pass = 0; pass < 2; ++pass)
 	{
-		// get the non-mortar surface element
-		FESurfaceElement& se = ss.Element(i);
+		vector<int> tag(cellStart.begin(), cellStart.end() - 1);
+		for (int j = 0; j < NMF; ++j)
+		{
+			int i0[3], i1[3];
+			cellRange(box[j], i0, i1);
+			for (int k = i0[2]; k <= i1[2]; ++k)
+				for (int l = i0[1]; l <= i1[1]; ++l)
+					for (int m = i0[0]; m <= i1[0]; ++m)
+					{
+						int c = (k*ny + l)*nx + m;
+						if (pass == 0) cellStart[c + 1]++;
+						else cellItem[tag[c]++] = j;
+					}
+		}
+
+		if (pass == 0)
+		{
+			for (int c = 0; c < NC; ++c) cellStart[c + 1] += cellStart[c];
+			cellItem.resize(cellStart[NC]);
+		}
+	}
 
-		// loop over all the mortar surface elements
-		for (int j=0; j<NMF; ++j)
+	// loop over all non-mortar facets and intersect them with the nearby mortar facets
+	vector< vector<Patch> > patches(NSF);
+#pragma omp parallel
+	{
+		vector<int> tag(NMF, -1);
+#pragma omp for schedule(dynamic, 64)
+		for (int i = 0; i < NSF; ++i)
 		{
-			// get the next surface element
-			FESurfaceElement& me = ms.Element(j);
-
-			// calculate the patch of triangles, representing the intersection
-			// of the non-mortar facet with the mortar facet
-			Patch patch(i,j);
-			CalculateMortarIntersection(ss, ms, i, j, patch);
-			mortar.AddPatch(patch);
+			FACET_BOX bi = FacetBox(ss, ss.Element(i), 0.0);
+
+			// collect the candidate facets
+			vector<int> cand;
+			int i0[3], i1[3];
+			cellRange(bi, i0, i1);
+			for (int k = i0[2]; k <= i1[2]; ++k)
+				for (int l = i0[1]; l <= i1[1]; ++l)
+					for (int m = i0[0]; m <= i1[0]; ++m)
+					{
+						int c = (k*ny + l)*nx + m;
+						for (int n = cellStart[c]; n < cellStart[c + 1]; ++n)
+						{
+							int j = cellItem[n];
+							if ((tag[j] != i) && bi.Overlaps(box[j]))
+							{
+								tag[j] = i;
+								cand.push_back(j);
+							}
+						}
+					}
+
+			// process the candidates in the original order
+			std::sort(cand.begin(), cand.end());
+			for (int n = 0; n < (int)cand.size(); ++n)
+			{
+				// calculate the patch of triangles, representing the intersection
+				// of the non-mortar facet with the mortar facet
+				Patch patch(i, cand[n]);
+				if (CalculateMortarIntersection(ss, ms, i, cand[n], patch))
+					patches[i].push_back(patch);
+			}
 		}
 	}
+
+	// collect all patches
+	for (int i = 0; i < NSF; ++i)
+	{
+		for (int n = 0; n < (int)patches[i].size(); ++n) mortar.AddPatch(patches[i][n]);
+	}
 }
 
 bool ExportMortar(MortarSurface& mortar, const char* szfile)
@@ -132,8 +132,9 @@ private:
 FECORE_API bool CalculateMortarIntersection(FESurface& ss, FESurface& ms, int k, int l, Patch& patch);
 
 //-----------------------------------------------------------------------------
-// Calculates the mortar intersection between two surfaces
-FECORE_API void CalculateMortarSurface(FESurface& ss, FESurface& ms, MortarSurface& s);
+// Calculates the mortar intersection between two surfaces. Only facets that are
+// within the search radius srad of each other are intersected.
+FECORE_API void CalculateMortarSurface(FESurface& ss, FESurface& ms, MortarSurface& s, double srad);
 
 //-----------------------------------------------------------------------------
 // Stores the mortar surface in STL format
@@ -49,7 +49,9 @@ SOFTWARE.*/
 #ifdef WIN32
 extern "C" int __cdecl omp_get_num_threads(void);
 extern "C" int __cdecl omp_get_thread_num(void);
+extern "C" int __cdecl omp_get_max_threads(void);
 #else
 extern "C" int omp_get_num_threads(void);
 extern "C" int omp_get_thread_num(void);
+extern "C" int omp_get_max_threads(void);
 #endif
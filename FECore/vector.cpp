@@ -33,6 +33,13 @@ SOFTWARE.*/
 #include "FEDofList.h"
 #include <algorithm>
 
+//-----------------------------------------------------------------------------
+// block size for the parallel reductions
+#define VBLOCK	4096
+
+// min nr of nodes for running the nodal gather/scatter loops in parallel
+#define NBLOCK	1024
+
 double operator*(const vector<double>& a, const vector<double>& b)
 {
 	double sum_p = 0, sum_n = 0;
@@ -124,6 +131,7 @@ vector<double> FECORE_API operator - (const vector<double>& a)
 void gather(vector<double>& v, FEMesh& mesh, int ndof)
 {
 	const int NN = mesh.Nodes();
+#pragma omp parallel for if (NN > NBLOCK)
 	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
@@ -135,6 +143,7 @@ void gather(vector<double>& v, FEMesh& mesh, const vector<int>& dof)
 {
 	const int NN = mesh.Nodes();
 	const int NDOF = (const int) dof.size();
+#pragma omp parallel for if (NN > NBLOCK)
 	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
@@ -149,6 +158,7 @@ void gather(vector<double>& v, FEMesh& mesh, const vector<int>& dof)
 void scatter(vector<double>& v, FEMesh& mesh, int ndof)
 {
 	const int NN = mesh.Nodes();
+#pragma omp parallel for if (NN > NBLOCK)
 	for (int i=0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
@@ -160,9 +170,11 @@ void scatter(vector<double>& v, FEMesh& mesh, int ndof)
 void scatter3(vector<double>& v, FEMesh& mesh, int ndof1, int ndof2, int ndof3)
 {
 	const int NN = mesh.Nodes();
-	for (int i = 0, n; i<NN; ++i)
+#pragma omp parallel for if (NN > NBLOCK)
+	for (int i = 0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
+		int n;
 		n = node.m_ID[ndof1]; if (n >= 0) node.set(ndof1, v[n]);
 		n = node.m_ID[ndof2]; if (n >= 0) node.set(ndof2, v[n]);
 		n = node.m_ID[ndof3]; if (n >= 0) node.set(ndof3, v[n]);
@@ -172,6 +184,7 @@ void scatter3(vector<double>& v, FEMesh& mesh, int ndof1, int ndof2, int ndof3)
 void scatter(vector<double>& v, FEMesh& mesh, const FEDofList& dofs)
 {
 	const int NN = mesh.Nodes();
+#pragma omp parallel for if (NN > NBLOCK)
 	for (int i = 0; i<NN; ++i)
 	{
 		FENode& node = mesh.Node(i);
@@ -202,3 +215,69 @@ double l2_norm(double* x, int n)
 	for (int i = 0; i < n; ++i) s += x[i]*x[i];
 	return sqrt(s);
 }
+
+double vdot(int n, const double* a, const double* b)
+{
+	int nb = (n + VBLOCK - 1) / VBLOCK;
+	if (nb <= 1)
+	{
+		double s = 0.0;
+		for (int i = 0; i < n; ++i) s += a[i] * b[i];
+		return s;
+	}
+
+	vector<double> partial(nb);
+#pragma omp parallel for
+	for (int k = 0; k < nb; ++k)
+	{
+		int i0 = k*VBLOCK;
+		int i1 = (i0 + VBLOCK < n ? i0 + VBLOCK : n);
+		double s = 0.0;
+		for (int i = i0; i < i1; ++i) s += a[i] * b[i];
+		partial[k] = s;
+	}
+
+	double s = 0.0;
+	for (int k = 0; k < nb; ++k) s += partial[k];
+	return s;
+}
+
+void vaxpy(int n, double s, const double* x, double* y)
+{
+#pragma omp parallel for if (n > VBLOCK)
+	for (int i = 0; i < n; ++i) y[i] += s*x[i];
+}
+
+double vaxpy_dot(int n, double s, const double* x, double* y, const double* z)
+{
+	int nb = (n + VBLOCK - 1) / VBLOCK;
+	if (nb <= 1)
+	{
+		double d = 0.0;
+		for (int i = 0; i < n; ++i)
+		{
+			y[i] += s*x[i];
+			d += z[i] * y[i];
+		}
+		return d;
+	}
+
+	vector<double> partial(nb);
+#pragma omp parallel for
+	for (int k = 0; k < nb; ++k)
+	{
+		int i0 = k*VBLOCK;
+		int i1 = (i0 + VBLOCK < n ? i0 + VBLOCK : n);
+		double d = 0.0;
+		for (int i = i0; i < i1; ++i)
+		{
+			y[i] += s*x[i];
+			d += z[i] * y[i];
+		}
+		partial[k] = d;
+	}
+
+	double d = 0.0;
+	for (int k = 0; k < nb; ++k) d += partial[k];
+	return d;
+}
@@ -72,6 +72,16 @@ void FECORE_API scatter(vector<double>& v, FEMesh& mesh, int ndof);
 void FECORE_API scatter3(vector<double>& v, FEMesh& mesh, int ndof1, int ndof2, int ndof3);
 void FECORE_API scatter(vector<double>& v, FEMesh& mesh, const FEDofList& dofs);
 
+// Parallel dot product of two arrays. The partial sums are evaluated over fixed
+// blocks, so the result does not depend on the number of threads.
+double FECORE_API vdot(int n, const double* a, const double* b);
+
+// Parallel update y += s*x
+void FECORE_API vaxpy(int n, double s, const double* x, double* y);
+
+// Fused update and dot product: y += s*x, and returns z.y (with the updated y).
+double FECORE_API vaxpy_dot(int n, double s, const double* x, double* y, const double* z);
+
 // calculate l2 norm of vector
 double FECORE_API l2_norm(const vector<double>& v);
 double FECORE_API l2_sqrnorm(const vector<double>& v);
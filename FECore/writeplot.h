@@ -35,22 +35,52 @@ SOFTWARE.*/
 #include "fecore_api.h"
 #include <functional>
 
+//=================================================================================================
+// NOTE: The helper functions below evaluate the items in parallel into an array that is indexed 
+// by item, so that the order in which the values are written to the stream does not depend on 
+// the number of threads. Each thread evaluates its own copy of the function object, so function 
+// objects that cache data between calls can still be used.
+
 //=================================================================================================
 template <class T> void writeNodalValues(FEMesh& mesh, FEDataStream& ar, std::function<T(const FENode& node)> f)
 {
-	for (int i = 0; i<mesh.Nodes(); ++i) ar << f(mesh.Node(i));
+	int NN = mesh.Nodes();
+	vector<T> data(NN);
+#pragma omp parallel
+	{
+		std::function<T(const FENode& node)> fi(f);
+#pragma omp for
+		for (int i = 0; i<NN; ++i) data[i] = fi(mesh.Node(i));
+	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class T> void writeNodalValues(FEMeshPartition& dom, FEDataStream& ar, std::function<T(int)> f)
 {
-	for (int i = 0; i<dom.Nodes(); ++i) ar << f(i);
+	int NN = dom.Nodes();
+	vector<T> data(NN);
+#pragma omp parallel
+	{
+		std::function<T(int)> fi(f);
+#pragma omp for
+		for (int i = 0; i<NN; ++i) data[i] = fi(i);
+	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class T> void writeElementValue(FEMeshPartition& dom, FEDataStream& ar, std::function<T(int nface)> f)
 {
-	for (int i = 0; i<dom.Elements(); ++i) ar << f(i);
+	int NE = dom.Elements();
+	vector<T> data(NE);
+#pragma omp parallel
+	{
+		std::function<T(int nface)> fi(f);
+#pragma omp for
+		for (int i = 0; i<NE; ++i) data[i] = fi(i);
+	}
+	ar << data;
 }
 
 //=================================================================================================
@@ -62,7 +92,7 @@ template <class T> void writeNodalValues(FENodeSet& nset, FEDataStream& ar, std:
 	FEMaterialPoint mp;
 	for (int i = 0; i < nset.Size(); ++i) {
 		FENode& node = mesh.Node(nset[i]);
-		mp.m_r0 = node.m_r0;
+		mp.m_r0 = node.m_r0();
 		mp.m_index = i;
 		data[nset[i]] = var(mp);
 	}
@@ -84,60 +114,103 @@ template <class T> void writeIntegratedElementValue(FESurface& surf, FEDataStrea
 //=================================================================================================
 template <class T> void writeElementValue(FEMeshPartition& dom, FEDataStream& ar, std::function<T(const FEMaterialPoint& mp)> fnc)
 {
-	for (int i = 0; i<dom.Elements(); ++i) {
-		FEElement& el = dom.ElementRef(i);
-		ar << fnc(*el.GetMaterialPoint(0));
+	int NE = dom.Elements();
+	vector<T> data(NE);
+#pragma omp parallel
+	{
+		std::function<T(const FEMaterialPoint& mp)> f(fnc);
+#pragma omp for
+		for (int i = 0; i<NE; ++i) {
+			FEElement& el = dom.ElementRef(i);
+			data[i] = f(*el.GetMaterialPoint(0));
+		}
 	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class T> void writeAverageElementValue(FEMeshPartition& dom, FEDataStream& ar, std::function<T(const FEMaterialPoint& mp)> fnc)
 {
-	for (int i = 0; i<dom.Elements(); ++i) {
-		FEElement& el = dom.ElementRef(i);
-		T s(0.0);
-		for (int j = 0; j<el.GaussPoints(); ++j) s += fnc(*el.GetMaterialPoint(j));
-		ar << s / (double)el.GaussPoints();
+	int NE = dom.Elements();
+	vector<T> data(NE);
+#pragma omp parallel
+	{
+		std::function<T(const FEMaterialPoint& mp)> f(fnc);
+#pragma omp for
+		for (int i = 0; i<NE; ++i) {
+			FEElement& el = dom.ElementRef(i);
+			T s(0.0);
+			for (int j = 0; j<el.GaussPoints(); ++j) s += f(*el.GetMaterialPoint(j));
+			data[i] = s / (double)el.GaussPoints();
+		}
 	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class T> void writeAverageElementValue(FEMeshPartition& dom, FEDataStream& ar, std::function<T(FEElement& el, int ip)> fnc)
 {
-	for (int i = 0; i<dom.Elements(); ++i) {
-		FEElement& el = dom.ElementRef(i);
-		T s(0.0);
-		for (int j = 0; j<el.GaussPoints(); ++j) s += fnc(el, j);
-		ar << s / (double) el.GaussPoints();
+	int NE = dom.Elements();
+	vector<T> data(NE);
+#pragma omp parallel
+	{
+		std::function<T(FEElement& el, int ip)> f(fnc);
+#pragma omp for
+		for (int i = 0; i<NE; ++i) {
+			FEElement& el = dom.ElementRef(i);
+			T s(0.0);
+			for (int j = 0; j<el.GaussPoints(); ++j) s += f(el, j);
+			data[i] = s / (double) el.GaussPoints();
+		}
 	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class Tin, class Tout> void writeAverageElementValue(FEMeshPartition& dom, FEDataStream& ar, std::function<Tin(const FEMaterialPoint&)> fnc, std::function<Tout(const Tin& m)> flt)
 {
-	for (int i = 0; i<dom.Elements(); ++i) {
-		FEElement& el = dom.ElementRef(i);
-		Tin s(0.0);
-		for (int j = 0; j<el.GaussPoints(); ++j) s += fnc(*el.GetMaterialPoint(j));
-		ar << flt(s / (double) el.GaussPoints());
+	int NE = dom.Elements();
+	vector<Tout> data(NE);
+#pragma omp parallel
+	{
+		std::function<Tin(const FEMaterialPoint&)> f(fnc);
+#pragma omp for
+		for (int i = 0; i<NE; ++i) {
+			FEElement& el = dom.ElementRef(i);
+			Tin s(0.0);
+			for (int j = 0; j<el.GaussPoints(); ++j) s += f(*el.GetMaterialPoint(j));
+			data[i] = flt(s / (double) el.GaussPoints());
+		}
 	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class Tin, class Tout> void writeAverageElementValue(FEMeshPartition& dom, FEDataStream& ar, std::function<Tin(FEElement& el, int ip)> fnc, std::function<Tout(const Tin& m)> flt)
 {
-	for (int i = 0; i<dom.Elements(); ++i) {
-		FEElement& el = dom.ElementRef(i);
-		Tin s(0.0);
-		for (int j = 0; j<el.GaussPoints(); ++j) s += fnc(el, j);
-		ar << flt(s / (double)el.GaussPoints());
+	int NE = dom.Elements();
+	vector<Tout> data(NE);
+#pragma omp parallel
+	{
+		std::function<Tin(FEElement& el, int ip)> f(fnc);
+#pragma omp for
+		for (int i = 0; i<NE; ++i) {
+			FEElement& el = dom.ElementRef(i);
+			Tin s(0.0);
+			for (int j = 0; j<el.GaussPoints(); ++j) s += f(el, j);
+			data[i] = flt(s / (double)el.GaussPoints());
+		}
 	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class T> void writeAverageElementValue(FEMeshPartition& dom, FEDataStream& ar, FEDomainParameter* var)
 {
-	for (int i = 0; i<dom.Elements(); ++i) {
+	int NE = dom.Elements();
+	vector<T> data(NE);
+#pragma omp parallel for
+	for (int i = 0; i<NE; ++i) {
 		FEElement& el = dom.ElementRef(i);
 		T s(0.0);
 		for (int j = 0; j < el.GaussPoints(); ++j)
@@ -145,88 +218,126 @@ template <class T> void writeAverageElementValue(FEMeshPartition& dom, FEDataStr
 			FEParamValue v = var->value(*el.GetMaterialPoint(j));
 			s += v.value<T>();
 		}
-		ar << s / (double)el.GaussPoints();
+		data[i] = s / (double)el.GaussPoints();
 	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class T> void writeIntegratedElementValue(FESolidDomain& dom, FEDataStream& ar, std::function<T(const FEMaterialPoint& mp)> fnc)
 {
-	for (int i = 0; i<dom.Elements(); ++i) {
-		FESolidElement& el = dom.Element(i);
-		double* gw = el.GaussWeights();
-
-		T ew(0.0);
-		for (int j = 0; j<el.GaussPoints(); ++j)
-		{
-			FEMaterialPoint& mp = *el.GetMaterialPoint(j);
-			ew += fnc(mp)*dom.detJ0(el, j)*gw[j];
+	int NE = dom.Elements();
+	vector<T> data(NE);
+#pragma omp parallel
+	{
+		std::function<T(const FEMaterialPoint& mp)> f(fnc);
+#pragma omp for
+		for (int i = 0; i<NE; ++i) {
+			FESolidElement& el = dom.Element(i);
+			double* gw = el.GaussWeights();
+
+			T ew(0.0);
+			for (int j = 0; j<el.GaussPoints(); ++j)
+			{
+				FEMaterialPoint& mp = *el.GetMaterialPoint(j);
+				ew += f(mp)*dom.detJ0(el, j)*gw[j];
+			}
+			data[i] = ew;
 		}
-		ar << ew;
 	}
+	ar << data;
 }
 
 //=================================================================================================
 template <class T> void writeNodalProjectedElementValues(FEMeshPartition& dom, FEDataStream& ar, std::function<T(const FEMaterialPoint&)> var)
 {
-	// temp storage 
-	T si[FEElement::MAX_INTPOINTS];
-	T sn[FEElement::MAX_NODES];
-
-	// loop over all elements
+	// each element writes its nodal values at this offset
 	int NE = dom.Elements();
-	for (int i = 0; i<NE; ++i)
+	vector<int> offset(NE + 1);
+	offset[0] = 0;
+	for (int i = 0; i<NE; ++i) offset[i + 1] = offset[i] + dom.ElementRef(i).Nodes();
+	vector<T> data(offset[NE]);
+
+#pragma omp parallel
 	{
-		FEElement& e = dom.ElementRef(i);
-		int ne = e.Nodes();
-		int ni = e.GaussPoints();
+		std::function<T(const FEMaterialPoint&)> f(var);
 
-		// get the integration point values
-		for (int k = 0; k<ni; ++k)
+		// temp storage 
+		T si[FEElement::MAX_INTPOINTS];
+		T sn[FEElement::MAX_NODES];
+
+		// loop over all elements
+#pragma omp for
+		for (int i = 0; i<NE; ++i)
 		{
-			FEMaterialPoint& mp = *e.GetMaterialPoint(k);
-			T s = var(mp);
-			si[k] = s;
+			FEElement& e = dom.ElementRef(i);
+			int ne = e.Nodes();
+			int ni = e.GaussPoints();
+
+			// get the integration point values
+			for (int k = 0; k<ni; ++k)
+			{
+				FEMaterialPoint& mp = *e.GetMaterialPoint(k);
+				T s = f(mp);
+				si[k] = s;
+			}
+
+			// project to nodes
+			e.project_to_nodes(si, sn);
+
+			// store the nodal values
+			for (int j = 0; j<ne; ++j) data[offset[i] + j] = sn[j];
 		}
-
-		// project to nodes
-		e.project_to_nodes(si, sn);
-
-		// push data to archive
-		for (int j = 0; j<ne; ++j) ar << sn[j];
 	}
+
+	// push data to archive
+	ar << data;
 }
 
 //=================================================================================================
 template <class T> void writeNodalProjectedElementValues(FESurface& dom, FEDataStream& ar, std::function<T(const FEMaterialPoint&)> var)
 {
-	T gi[FEElement::MAX_INTPOINTS];
-	T gn[FEElement::MAX_NODES];
-
-	// loop over all the elements in the domain
+	// each element writes its nodal values at this offset
 	int NE = dom.Elements();
-	for (int i = 0; i < NE; ++i)
+	vector<int> offset(NE + 1);
+	offset[0] = 0;
+	for (int i = 0; i<NE; ++i) offset[i + 1] = offset[i] + dom.Element(i).Nodes();
+	vector<T> data(offset[NE]);
+
+#pragma omp parallel
 	{
-		// get the element and loop over its integration points
-		// we only calculate the element's average
-		// but since most material parameters can only defined 
-		// at the element level, this should get the same answer
-		FESurfaceElement& e = dom.Element(i);
-		int nint = e.GaussPoints();
-		int neln = e.Nodes();
-
-		for (int j = 0; j < nint; ++j)
-		{
-			// get the material point data for this integration point
-			FEMaterialPoint& mp = *e.GetMaterialPoint(j);
-			gi[j] = var(mp);
-		}
+		std::function<T(const FEMaterialPoint&)> f(var);
 
-		e.FEElement::project_to_nodes(gi, gn);
+		T gi[FEElement::MAX_INTPOINTS];
+		T gn[FEElement::MAX_NODES];
 
-		// store the result
-		for (int j = 0; j < neln; ++j) ar << gn[j];
+		// loop over all the elements in the domain
+#pragma omp for
+		for (int i = 0; i < NE; ++i)
+		{
+			// get the element and loop over its integration points
+			// we only calculate the element's average
+			// but since most material parameters can only defined 
+			// at the element level, this should get the same answer
+			FESurfaceElement& e = dom.Element(i);
+			int nint = e.GaussPoints();
+			int neln = e.Nodes();
+
+			for (int j = 0; j < nint; ++j)
+			{
+				// get the material point data for this integration point
+				FEMaterialPoint& mp = *e.GetMaterialPoint(j);
+				gi[j] = f(mp);
+			}
+
+			e.FEElement::project_to_nodes(gi, gn);
+
+			// store the result
+			for (int j = 0; j < neln; ++j) data[offset[i] + j] = gn[j];
+		}
 	}
+
+	ar << data;
 }
 
 //-----------------------------------------------------------------------------
@@ -37,6 +37,8 @@ SOFTWARE.*/
 #include "Hypre_PCG_AMG.h"
 #include "SchurSolver.h"
 #include "IncompleteCholesky.h"
+#include "SchwarzPreconditioner.h"
+#include "SchwarzCGSolver.h"
 #include "BoomerAMGSolver.h"
 #include "BlockSolver.h"
 #include "BiCGStabSolver.h"
@@ -64,11 +66,13 @@ void NumCore::InitModule()
 	REGISTER_FECORE_CLASS(BIPNSolver          , "bipn");
 	REGISTER_FECORE_CLASS(BiCGStabSolver      , "bicgstab");
 	REGISTER_FECORE_CLASS(StrategySolver      , "strategy");
+	REGISTER_FECORE_CLASS(SchwarzCGSolver     , "schwarz_cg");
 
 	// register preconditioners
 	REGISTER_FECORE_CLASS(ILU0_Preconditioner, "ilu0");
 	REGISTER_FECORE_CLASS(ILUT_Preconditioner, "ilut");
 	REGISTER_FECORE_CLASS(IncompleteCholesky , "ichol");
+	REGISTER_FECORE_CLASS(SchwarzPreconditioner, "schwarz");
 
 	// register eigen solvers
 	REGISTER_FECORE_CLASS(FEASTEigenSolver, "feast");
@@ -0,0 +1,251 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+#include "stdafx.h"
+#include "SchwarzCGSolver.h"
+#include "SchwarzPreconditioner.h"
+#include "CompactSymmMatrix.h"
+#include <FECore/FEMPIPartition.h>
+#include <FECore/log.h>
+#include <math.h>
+
+//-----------------------------------------------------------------------------
+BEGIN_FECORE_CLASS(SchwarzCGSolver, IterativeLinearSolver)
+	ADD_PARAMETER(m_print_level   , "print_level");
+	ADD_PARAMETER(m_tol           , "tol");
+	ADD_PARAMETER(m_maxiter       , "max_iter");
+	ADD_PARAMETER(m_fail_max_iters, "fail_max_iters");
+	ADD_PARAMETER(m_nsub          , "subdomains");
+	ADD_PARAMETER(m_overlap       , "overlap");
+END_FECORE_CLASS();
+
+//-----------------------------------------------------------------------------
+// dot product of two vectors
+// (This is deliberately not done in parallel, so that the result does not
+// depend on the number of threads and is identical on all ranks.)
+static double dot(const std::vector<double>& a, const std::vector<double>& b)
+{
+	double s = 0.0;
+	const int N = (int)a.size();
+	for (int i = 0; i < N; ++i) s += a[i] * b[i];
+	return s;
+}
+
+//-----------------------------------------------------------------------------
+SchwarzCGSolver::SchwarzCGSolver(FEModel* fem) : IterativeLinearSolver(fem), m_pA(nullptr), m_mpi(nullptr)
+{
+	m_maxiter = 1000;
+	m_tol = 1e-8;
+	m_print_level = 0;
+	m_fail_max_iters = true;
+	m_nsub = 4;
+	m_overlap = 1;
+
+	m_pc = new SchwarzPreconditioner(fem);
+}
+
+//-----------------------------------------------------------------------------
+SchwarzCGSolver::~SchwarzCGSolver()
+{
+	delete m_pc;
+	delete m_mpi;
+}
+
+//-----------------------------------------------------------------------------
+SparseMatrix* SchwarzCGSolver::CreateSparseMatrix(Matrix_Type ntype)
+{
+	if (ntype != REAL_SYMMETRIC)
+	{
+		feLogError("The schwarz_cg solver requires a symmetric matrix.");
+		return nullptr;
+	}
+
+	// In MPI runs, we partition the model over the ranks. This must be done before
+	// the matrix profile is built, since it restricts the element assembly.
+	delete m_mpi; m_mpi = nullptr;
+	if (FEMPIPartition::Ranks() > 1)
+	{
+		m_mpi = new FEMPIPartition;
+		if (m_mpi->Create(GetFEModel(), m_overlap) == false)
+		{
+			feLogError("Failed to partition the model over the MPI ranks.");
+			delete m_mpi; m_mpi = nullptr;
+			return nullptr;
+		}
+	}
+
+	m_pA = new CompactSymmMatrix(1);
+	return m_pA;
+}
+
+//-----------------------------------------------------------------------------
+bool SchwarzCGSolver::SetSparseMatrix(SparseMatrix* A)
+{
+	m_pA = dynamic_cast<CompactSymmMatrix*>(A);
+	return (m_pA != nullptr);
+}
+
+//-----------------------------------------------------------------------------
+bool SchwarzCGSolver::HasPreconditioner() const
+{
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+const FEMPIPartition* SchwarzCGSolver::GetMPIPartition() const
+{
+	return m_mpi;
+}
+
+//-----------------------------------------------------------------------------
+bool SchwarzCGSolver::PreProcess()
+{
+	if (m_pA == nullptr) return false;
+
+	m_pc->SetSparseMatrix(m_pA);
+	m_pc->m_print_level = m_print_level;
+	if (m_mpi == nullptr)
+	{
+		// serial run: the preconditioner partitions the mesh itself
+		m_pc->m_nsub = m_nsub;
+		m_pc->m_overlap = m_overlap;
+	}
+	else
+	{
+		// MPI run: the subdomain of this rank is one block of the preconditioner. The
+		// equations that do not belong to a node are scaled by their diagonal on rank 0.
+		int neq = m_pA->Rows();
+		vector< vector<int> > eqs(1, m_mpi->SubdomainEquations());
+		vector<int> diagEq;
+		if (FEMPIPartition::Rank() == 0)
+		{
+			for (int i = 0; i < neq; ++i) if (m_mpi->IsNodalEquation(i) == false) diagEq.push_back(i);
+		}
+		m_pc->SetSubdomains(neq, eqs, diagEq);
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SchwarzCGSolver::Factor()
+{
+	if (m_pA == nullptr) return false;
+
+	// all ranks must agree on the result
+	double nfail = (m_pc->Factor() ? 0.0 : 1.0);
+	if (m_mpi) FEMPIPartition::SumAll(&nfail, 1);
+
+	return (nfail == 0.0);
+}
+
+//-----------------------------------------------------------------------------
+void SchwarzCGSolver::mult_vector(std::vector<double>& x, std::vector<double>& y)
+{
+	m_pA->mult_vector(&x[0], &y[0]);
+
+	// each rank only has the rows of the equations it owns
+	if (m_mpi) m_mpi->GatherOwnedRows(y);
+}
+
+//-----------------------------------------------------------------------------
+void SchwarzCGSolver::precondition(std::vector<double>& r, std::vector<double>& z)
+{
+	m_pc->BackSolve(&z[0], &r[0]);
+
+	// add the subdomain solves of all ranks
+	if (m_mpi) FEMPIPartition::SumAll(&z[0], (int)z.size());
+}
+
+//-----------------------------------------------------------------------------
+bool SchwarzCGSolver::BackSolve(double* x, double* b)
+{
+	if (m_pA == nullptr) return false;
+
+	int neq = m_pA->Rows();
+	for (int i = 0; i < neq; ++i) x[i] = 0.0;
+	if (neq == 0) return true;
+
+	// initial residual
+	vector<double> r(b, b + neq);
+	double norm0 = sqrt(dot(r, r));
+
+	// if the norm is zero, there is nothing to do
+	if (norm0 == 0.0) return true;
+
+	vector<double> z(neq), p(neq), q(neq);
+	precondition(r, z);
+	p = z;
+	double rz = dot(r, z);
+
+	int niter = 0;
+	double normr = norm0;
+	bool bconv = false;
+	while ((bconv == false) && (niter < m_maxiter))
+	{
+		mult_vector(p, q);
+
+		double pq = dot(p, q);
+		if (pq == 0.0) break;
+		double alpha = rz / pq;
+
+		for (int i = 0; i < neq; ++i)
+		{
+			x[i] += alpha*p[i];
+			r[i] -= alpha*q[i];
+		}
+		niter++;
+
+		normr = sqrt(dot(r, r));
+		if (m_print_level > 1) feLog("%d: %lg (%lg)\n", niter, normr, m_tol*norm0);
+		if (normr <= m_tol*norm0) { bconv = true; break; }
+
+		precondition(r, z);
+		double rz_new = dot(r, z);
+		double beta = rz_new / rz;
+		rz = rz_new;
+
+		for (int i = 0; i < neq; ++i) p[i] = z[i] + beta*p[i];
+	}
+
+	if (m_print_level > 0)
+	{
+		feLog("schwarz_cg: %d iterations, residual norm = %lg (initial = %lg)\n", niter, normr, norm0);
+	}
+
+	UpdateStats(niter);
+
+	return (m_fail_max_iters ? bconv : true);
+}
+
+//-----------------------------------------------------------------------------
+void SchwarzCGSolver::Destroy()
+{
+	m_pc->Destroy();
+}
@@ -0,0 +1,89 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+
+
+#pragma once
+#include <FECore/LinearSolver.h>
+
+class CompactSymmMatrix;
+class SchwarzPreconditioner;
+
+//-----------------------------------------------------------------------------
+//! Conjugate gradient solver with an additive Schwarz preconditioner, which
+//! can solve the linear system of an MPI run.
+
+//! In MPI runs, every rank holds the matrix rows of its own subdomain (see 
+//! FEMPIPartition) and all vectors are replicated. After each matrix-vector
+//! product the ranks exchange the rows they own, and the preconditioner is the 
+//! sum of the subdomain solves of all ranks. Equations that do not belong to a 
+//! node are scaled by their diagonal on rank 0. In serial runs, the mesh is split
+//! into a number of subdomains instead. This solver requires a symmetric matrix.
+class SchwarzCGSolver : public IterativeLinearSolver
+{
+public:
+	SchwarzCGSolver(FEModel* fem);
+	~SchwarzCGSolver();
+
+	bool PreProcess() override;
+	bool Factor() override;
+	bool BackSolve(double* x, double* b) override;
+	void Destroy() override;
+
+public:
+	bool HasPreconditioner() const override;
+
+	SparseMatrix* CreateSparseMatrix(Matrix_Type ntype) override;
+
+	bool SetSparseMatrix(SparseMatrix* A) override;
+
+	const FEMPIPartition* GetMPIPartition() const override;
+
+	void SetPrintLevel(int n) override { m_print_level = n; }
+
+private:
+	// calculate y = A*x for the global matrix
+	void mult_vector(std::vector<double>& x, std::vector<double>& y);
+
+	// apply the preconditioner z = P*r
+	void precondition(std::vector<double>& r, std::vector<double>& z);
+
+private:
+	int		m_maxiter;		//!< max nr of iterations
+	double	m_tol;			//!< residual relative tolerance
+	int		m_print_level;	//!< output level
+	bool	m_fail_max_iters;	//!< fail when max iterations are reached
+	int		m_nsub;			//!< number of subdomains (serial runs only)
+	int		m_overlap;		//!< number of overlap layers (in nodes)
+
+private:
+	CompactSymmMatrix*		m_pA;
+	SchwarzPreconditioner*	m_pc;
+	FEMPIPartition*			m_mpi;	//!< partition over the ranks (MPI runs only)
+
+	DECLARE_FECORE_CLASS();
+};
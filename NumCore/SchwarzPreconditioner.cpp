@@ -0,0 +1,267 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "SchwarzPreconditioner.h"
+#include "CompactSymmMatrix.h"
+#include <FECore/FEDomainDecomposition.h>
+#include <FECore/FEModel.h>
+#include <FECore/FEMesh.h>
+#include <FECore/log.h>
+
+// in colsol.cpp
+void colsol_factor(int N, double* values, int* pointers);
+void colsol_solve(int N, double* values, int* pointers, double* R);
+
+//-----------------------------------------------------------------------------
+BEGIN_FECORE_CLASS(SchwarzPreconditioner, Preconditioner)
+	ADD_PARAMETER(m_nsub       , "subdomains");
+	ADD_PARAMETER(m_overlap    , "overlap");
+	ADD_PARAMETER(m_print_level, "print_level");
+END_FECORE_CLASS();
+
+//-----------------------------------------------------------------------------
+SchwarzPreconditioner::SchwarzPreconditioner(FEModel* fem) : Preconditioner(fem)
+{
+	m_nsub = 4;
+	m_overlap = 1;
+	m_print_level = 0;
+	m_neq = 0;
+	m_K = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+SparseMatrix* SchwarzPreconditioner::CreateSparseMatrix(Matrix_Type ntype)
+{
+	if (ntype != REAL_SYMMETRIC)
+	{
+		feLogError("The Schwarz preconditioner requires a symmetric matrix.");
+		return nullptr;
+	}
+	m_K = new CompactSymmMatrix(1);
+	return m_K;
+}
+
+//-----------------------------------------------------------------------------
+// Partition the mesh and collect the equations of each subdomain. Equations 
+// that are not associated with a mesh node (e.g. rigid body dofs) are not part
+// of any subdomain and will be scaled by their diagonal.
+bool SchwarzPreconditioner::BuildSubdomains(int neq)
+{
+	FEMesh& mesh = GetFEModel()->GetMesh();
+
+	FEDomainDecomposition dd;
+	if (dd.Create(mesh, m_nsub, m_overlap) == false) return false;
+
+	int nsub = dd.Subdomains();
+	m_sub.assign(nsub, Subdomain());
+	vector<bool> covered(neq, false);
+	for (int i = 0; i < nsub; ++i)
+	{
+		vector<int>& eq = m_sub[i].eq;
+		dd.Equations(mesh, i, eq);
+		for (size_t j = 0; j < eq.size(); ++j) covered[eq[j]] = true;
+	}
+
+	m_diagEq.clear();
+	for (int i = 0; i < neq; ++i) if (covered[i] == false) m_diagEq.push_back(i);
+
+	m_neq = neq;
+
+	if (m_print_level > 0)
+	{
+		feLog("Schwarz preconditioner: %d subdomains (overlap = %d)\n", (int)m_sub.size(), m_overlap);
+		for (size_t i = 0; i < m_sub.size(); ++i) feLog("\tsubdomain %d: %d equations\n", (int)i + 1, (int)m_sub[i].eq.size());
+		feLog("\tdiagonal scaling: %d equations\n", (int)m_diagEq.size());
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void SchwarzPreconditioner::SetSubdomains(int neq, const vector< vector<int> >& eqs, const vector<int>& diagEq)
+{
+	int nsub = (int)eqs.size();
+	m_sub.assign(nsub, Subdomain());
+	for (int i = 0; i < nsub; ++i) m_sub[i].eq = eqs[i];
+	m_diagEq = diagEq;
+	m_neq = neq;
+}
+
+//-----------------------------------------------------------------------------
+bool SchwarzPreconditioner::Factor()
+{
+	CompactSymmMatrix* K = dynamic_cast<CompactSymmMatrix*>(GetSparseMatrix());
+	if (K == nullptr) K = m_K;
+	if (K == nullptr) return false;
+
+	int neq = K->Rows();
+	if (m_neq != neq)
+	{
+		if (BuildSubdomains(neq) == false) return false;
+	}
+
+	const int offset = K->Offset();
+	double* pv = K->Values();
+	int* pi = K->Indices();
+	int* pp = K->Pointers();
+
+	int nsub = (int)m_sub.size();
+	int nzero = 0;
+#pragma omp parallel shared(nsub) reduction(+:nzero)
+	{
+		// Map of global to local equation numbers. Each thread allocates this only once,
+		// and only the entries of the subdomain's own equations are set and reset.
+		vector<int> loc(neq, -1);
+
+#pragma omp for
+		for (int n = 0; n < nsub; ++n)
+		{
+			Subdomain& sub = m_sub[n];
+			const vector<int>& eq = sub.eq;
+			int neqs = (int)eq.size();
+
+			// map global to local equation numbers
+			for (int i = 0; i < neqs; ++i) loc[eq[i]] = i;
+
+			// determine the skyline profile of the subdomain block
+			// (the global matrix stores the lower triangular part by columns)
+			vector<int> firstRow(neqs);
+			for (int i = 0; i < neqs; ++i) firstRow[i] = i;
+			for (int jl = 0; jl < neqs; ++jl)
+			{
+				int J = eq[jl];
+				for (int k = pp[J] - offset; k < pp[J + 1] - offset; ++k)
+				{
+					int il = loc[pi[k] - offset];
+					if (il >= 0)
+					{
+						int c = (il > jl ? il : jl);
+						int r = (il > jl ? jl : il);
+						if (r < firstRow[c]) firstRow[c] = r;
+					}
+				}
+			}
+
+			sub.pointers.resize(neqs + 1);
+			sub.pointers[0] = 0;
+			for (int i = 0; i < neqs; ++i) sub.pointers[i + 1] = sub.pointers[i] + (i - firstRow[i] + 1);
+
+			// copy the values
+			sub.values.assign(sub.pointers[neqs], 0.0);
+			for (int jl = 0; jl < neqs; ++jl)
+			{
+				int J = eq[jl];
+				for (int k = pp[J] - offset; k < pp[J + 1] - offset; ++k)
+				{
+					int il = loc[pi[k] - offset];
+					if (il >= 0)
+					{
+						int c = (il > jl ? il : jl);
+						int r = (il > jl ? jl : il);
+						sub.values[sub.pointers[c] + c - r] = pv[k];
+					}
+				}
+			}
+
+			// check for zero diagonals, which would make the block singular
+			bool bzero = false;
+			for (int i = 0; i < neqs; ++i)
+			{
+				if (sub.values[sub.pointers[i]] == 0.0) { bzero = true; break; }
+			}
+
+			// factor the block (but don't try to factor a singular block)
+			if (bzero) nzero++;
+			else if (neqs > 0) colsol_factor(neqs, &sub.values[0], &sub.pointers[0]);
+
+			// reset the map
+			for (int i = 0; i < neqs; ++i) loc[eq[i]] = -1;
+		}
+	}
+
+	// The remaining equations are scaled by their diagonal. Since these can be zero
+	// (e.g. for Lagrange multipliers), we leave those equations unscaled.
+	int ndiag = (int)m_diagEq.size();
+	m_diag.resize(ndiag);
+	for (int i = 0; i < ndiag; ++i)
+	{
+		double dii = K->diag(m_diagEq[i]);
+		m_diag[i] = (dii != 0.0 ? 1.0 / dii : 1.0);
+	}
+
+	if (nzero > 0)
+	{
+		feLogError("Zero diagonal encountered in Schwarz preconditioner.");
+		return false;
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SchwarzPreconditioner::BackSolve(double* x, double* y)
+{
+	for (int i = 0; i < m_neq; ++i) x[i] = 0.0;
+
+	int nsub = (int)m_sub.size();
+#pragma omp parallel for
+	for (int n = 0; n < nsub; ++n)
+	{
+		Subdomain& sub = m_sub[n];
+		const vector<int>& eq = sub.eq;
+		int neqs = (int)eq.size();
+		if (neqs == 0) continue;
+
+		// restrict to subdomain, solve and add back
+		vector<double> r(neqs);
+		for (int i = 0; i < neqs; ++i) r[i] = y[eq[i]];
+
+		colsol_solve(neqs, &sub.values[0], &sub.pointers[0], &r[0]);
+
+		for (int i = 0; i < neqs; ++i)
+		{
+#pragma omp atomic
+			x[eq[i]] += r[i];
+		}
+	}
+
+	// diagonal scaling of the remaining equations
+	int ndiag = (int)m_diagEq.size();
+	for (int i = 0; i < ndiag; ++i) x[m_diagEq[i]] = m_diag[i] * y[m_diagEq[i]];
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void SchwarzPreconditioner::Destroy()
+{
+	m_sub.clear();
+	m_diagEq.clear();
+	m_diag.clear();
+	m_neq = 0;
+}
@@ -0,0 +1,89 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2020 University of Utah, The Trustees of Columbia University in 
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include <FECore/Preconditioner.h>
+
+class CompactSymmMatrix;
+
+//-----------------------------------------------------------------------------
+//! Additive Schwarz preconditioner.
+
+//! The mesh is split into a number of overlapping subdomains (see FEDomainDecomposition)
+//! and the preconditioner is the sum of the inverses of the subdomain blocks of
+//! the global matrix. The subdomain blocks are factored (skyline LDLt) and solved 
+//! independently, so that both Factor() and BackSolve() run in parallel over the 
+//! subdomains. Equations that are not part of any subdomain (e.g. rigid body dofs
+//! and Lagrange multipliers) are scaled by the inverse of their diagonal. 
+//! This preconditioner requires a symmetric matrix.
+class SchwarzPreconditioner : public Preconditioner
+{
+	struct Subdomain
+	{
+		vector<int>		eq;			// global equation numbers (zero-based)
+		vector<int>		pointers;	// skyline pointers of subdomain block
+		vector<double>	values;		// skyline values of subdomain block (factored)
+	};
+
+public:
+	SchwarzPreconditioner(FEModel* fem);
+
+	// create a sparse matrix
+	SparseMatrix* CreateSparseMatrix(Matrix_Type ntype) override;
+
+	// create a preconditioner for a sparse matrix
+	bool Factor() override;
+
+	// apply to vector P x = y
+	bool BackSolve(double* x, double* y) override;
+
+	// clean up
+	void Destroy() override;
+
+	// Set the subdomains explicitly, instead of partitioning the mesh. The equations
+	// in diagEq are scaled by their diagonal. All other equations are ignored, i.e.
+	// the corresponding components of x are set to zero. 
+	void SetSubdomains(int neq, const vector< vector<int> >& eqs, const vector<int>& diagEq);
+
+private:
+	// setup the subdomains
+	bool BuildSubdomains(int neq);
+
+public:
+	int		m_nsub;			//!< number of subdomains
+	int		m_overlap;		//!< number of overlap layers (in nodes)
+	int		m_print_level;	//!< output level
+
+private:
+	CompactSymmMatrix*	m_K;
+	vector<Subdomain>	m_sub;
+	vector<int>			m_diagEq;	// equations that are scaled by their diagonal
+	vector<double>		m_diag;		// inverse diagonals of these equations
+	int					m_neq;
+
+	DECLARE_FECORE_CLASS();
+};